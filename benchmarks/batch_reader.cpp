@@ -0,0 +1,96 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "libdicompp/dicomdata.hpp"
+
+using namespace dicom::data::dataset;
+using namespace dicom::data::attribute;
+using namespace dicom::data::dictionary;
+using namespace dicom::filesystem;
+
+/**
+ * Measures the throughput of the batch reader for a set of CT-like files with
+ * a few hundred header attributes and 512 KiB of pixel data each, for an
+ * increasing number of worker threads. The metadata row only parses the
+ * attributes in front of the pixel data.
+ * Configure with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+ */
+
+static const std::size_t num_files = 200;
+static const std::size_t num_elements = 300;
+static const std::size_t pixel_count = 256*1024;
+
+static std::vector<std::string> write_files(dictionaries& dict)
+{
+   iod set;
+   set[{0x0008, 0x0016}] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.2");
+   for (std::size_t i=0; i<num_elements; ++i) {
+      tag_type tag {0x0009, static_cast<unsigned short>(0x1000 + i)};
+      if (i%2 == 0) {
+         set[tag] = make_elementfield<VR::LO>("value " + std::to_string(i));
+      } else {
+         set[tag] = make_elementfield<VR::DS>(std::to_string(i * 0.25));
+      }
+   }
+   set[{0x7fe0, 0x0010}] = make_elementfield<VR::OW>(pixel_count*2, std::vector<unsigned short>(pixel_count, 0x0fff));
+
+   std::vector<std::string> paths;
+   for (std::size_t i=0; i<num_files; ++i) {
+      paths.push_back("bench_batch_reader" + std::to_string(i) + ".dcm");
+      dicomfile file {set, dict};
+      std::ofstream os {paths.back(), std::ios::binary};
+      file.write_dataset(os);
+   }
+   return paths;
+}
+
+static double measure(const batch_reader& reader, const std::vector<std::string>& paths)
+{
+   std::size_t failed = 0;
+   auto start = std::chrono::steady_clock::now();
+   reader.read(paths, [&failed](batch_result& result) {
+      if (result.error) ++failed;
+   });
+   auto end = std::chrono::steady_clock::now();
+   if (failed > 0) std::cerr << failed << " files could not be read\n";
+   return std::chrono::duration<double>(end - start).count();
+}
+
+int main()
+{
+   auto& dict = get_default_dictionaries();
+   auto paths = write_files(dict);
+
+   std::cout << std::left << std::setw(16) << "threads"
+             << std::right << std::setw(14) << "files/s"
+             << std::setw(14) << "speedup" << "\n";
+
+   std::size_t max_threads = std::max(1u, std::thread::hardware_concurrency());
+   double single = 0;
+   for (std::size_t threads=1; threads<=max_threads; threads*=2) {
+      batch_options options;
+      options.threads = threads;
+      double seconds = measure(batch_reader {dict, options}, paths);
+      if (threads == 1) single = seconds;
+      std::cout << std::left << std::setw(16) << threads
+                << std::right << std::setw(14) << num_files / seconds
+                << std::setw(14) << single / seconds << "\n";
+   }
+
+   batch_options options;
+   options.filter.stop_after = tag_type {0x0028, 0xffff};
+   double metadata = measure(batch_reader {dict, options}, paths);
+   std::cout << std::left << std::setw(16) << "metadata only"
+             << std::right << std::setw(14) << num_files / metadata << "\n";
+
+   for (const auto& path : paths) {
+      std::remove(path.c_str());
+   }
+   return 0;
+}
@@ -0,0 +1,128 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <string>
+#include <vector>
+
+#include "libdicompp/dicomdata.hpp"
+
+using namespace dicom::data::dataset;
+using namespace dicom::data::attribute;
+
+/**
+ * Compares the map-based dataset_type with the flat_dataset for a header-sized
+ * set of attributes: building the set from elementfields or serialized values, looking up every tag and iterating over
+ * all attributes. Configure with -DCMAKE_BUILD_TYPE=Release for meaningful
+ * numbers.
+ */
+
+static const std::size_t num_elements = 2000;
+static const int repetitions = 200;
+
+template <typename Fn>
+static double measure(Fn&& fn)
+{
+   auto start = std::chrono::steady_clock::now();
+   for (int i=0; i<repetitions; ++i) {
+      fn();
+   }
+   auto end = std::chrono::steady_clock::now();
+   return std::chrono::duration<double, std::micro>(end - start).count() / repetitions;
+}
+
+static std::vector<std::pair<tag_type, elementfield>> make_attributes()
+{
+   std::vector<std::pair<tag_type, elementfield>> attributes;
+   for (std::size_t i=0; i<num_elements; ++i) {
+      tag_type tag {static_cast<unsigned short>(0x0009 + 2*(i/500)), static_cast<unsigned short>(0x1000 + i%500)};
+      if (i%2 == 0) {
+         attributes.emplace_back(tag, make_elementfield<VR::LO>("value " + std::to_string(i)));
+      } else {
+         attributes.emplace_back(tag, make_elementfield<VR::US>(static_cast<unsigned short>(i)));
+      }
+   }
+   return attributes;
+}
+
+static void report(const std::string& name, double map_us, double flat_us)
+{
+   std::cout << std::left << std::setw(12) << name
+             << std::right << std::setw(14) << map_us
+             << std::setw(14) << flat_us
+             << std::setw(10) << map_us / flat_us << "\n";
+}
+
+int main()
+{
+   auto attributes = make_attributes();
+
+   dataset_type map_set;
+   flat_dataset flat_set;
+   double map_build = measure([&]() {
+      map_set = dataset_type {};
+      for (const auto& attr : attributes) {
+         map_set[attr.first] = attr.second;
+      }
+   });
+   double flat_build = measure([&]() {
+      flat_set = flat_dataset {};
+      for (const auto& attr : attributes) {
+         flat_set[attr.first] = attr.second;
+      }
+   });
+
+   // building from serialized values, as a parser does
+   std::vector<std::vector<unsigned char>> payloads;
+   for (const auto& attr : attributes) {
+      payloads.push_back(encode_value_field(attr.second, ENDIANNESS::LITTLE, *attr.second.value_rep));
+   }
+   double map_parse = measure([&]() {
+      map_set = dataset_type {};
+      for (std::size_t i=0; i<attributes.size(); ++i) {
+         map_set[attributes[i].first] = decode_value_field(payloads[i], ENDIANNESS::LITTLE, payloads[i].size(),
+                                                           *attributes[i].second.value_rep, "*", 0);
+      }
+   });
+   double flat_parse = measure([&]() {
+      flat_set = flat_dataset {};
+      for (std::size_t i=0; i<attributes.size(); ++i) {
+         flat_set.insert_raw(attributes[i].first, *attributes[i].second.value_rep, payloads[i]);
+      }
+   });
+
+   std::size_t found = 0;
+   double map_find = measure([&]() {
+      for (const auto& attr : attributes) {
+         found += map_set.find(attr.first) != map_set.end();
+      }
+   });
+   double flat_find = measure([&]() {
+      for (const auto& attr : attributes) {
+         found += flat_set.find(attr.first) != flat_set.end();
+      }
+   });
+
+   std::size_t length = 0;
+   double map_iterate = measure([&]() {
+      for (const auto& attr : map_set) {
+         length += attr.second.value_len;
+      }
+   });
+   double flat_iterate = measure([&]() {
+      for (const auto& attr : flat_set) {
+         length += attr.second.value_len;
+      }
+   });
+
+   std::cout << num_elements << " attributes, mean of " << repetitions << " runs in us\n";
+   std::cout << std::left << std::setw(12) << "operation"
+             << std::right << std::setw(14) << "std::map"
+             << std::setw(14) << "flat_dataset"
+             << std::setw(10) << "speedup" << "\n";
+   report("build", map_build, flat_build);
+   report("parse", map_parse, flat_parse);
+   report("find", map_find, flat_find);
+   report("iterate", map_iterate, flat_iterate);
+   std::cout << "(checksum " << found + length << ")\n";
+   return 0;
+}
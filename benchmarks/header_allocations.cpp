@@ -0,0 +1,141 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <new>
+#include <string>
+#include <vector>
+
+#include "libdicompp/dicomdata.hpp"
+
+using namespace dicom::data::dataset;
+using namespace dicom::data::attribute;
+using namespace dicom::data::dictionary;
+
+/**
+ * Counts the heap allocations made for decoding, encoding and reading the
+ * values of a typical image header with the little endian explicit transfer
+ * processor. The global operator new of this program counts the
+ * allocations.
+ * Configure with -DCMAKE_BUILD_TYPE=Release for meaningful timings.
+ */
+
+static std::size_t allocations = 0;
+
+void* operator new(std::size_t size)
+{
+   ++allocations;
+   if (void* p = std::malloc(size ? size : 1)) {
+      return p;
+   }
+   throw std::bad_alloc {};
+}
+
+void operator delete(void* p) noexcept
+{
+   std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+   std::free(p);
+}
+
+static const int repetitions = 1000;
+
+static iod make_header()
+{
+   iod set;
+   set[{0x0008, 0x0008}] = make_elementfield<VR::CS>("ORIGINAL\\PRIMARY\\AXIAL");
+   set[{0x0008, 0x0016}] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.2");
+   set[{0x0008, 0x0018}] = make_elementfield<VR::UI>("1.2.826.0.1.3680043.2.1125.1.1");
+   set[{0x0008, 0x0020}] = make_elementfield<VR::DA>("20240101");
+   set[{0x0008, 0x0030}] = make_elementfield<VR::TM>("120000");
+   set[{0x0008, 0x0060}] = make_elementfield<VR::CS>("CT");
+   set[{0x0008, 0x0070}] = make_elementfield<VR::LO>("MANUFACTURER");
+   set[{0x0010, 0x0010}] = make_elementfield<VR::PN>("DOE^JOHN");
+   set[{0x0010, 0x0020}] = make_elementfield<VR::LO>("123456");
+   set[{0x0010, 0x0030}] = make_elementfield<VR::DA>("19700101");
+   set[{0x0010, 0x0040}] = make_elementfield<VR::CS>("M");
+   set[{0x0018, 0x0050}] = make_elementfield<VR::DS>("1.25");
+   set[{0x0018, 0x0060}] = make_elementfield<VR::DS>("120");
+   set[{0x0018, 0x1151}] = make_elementfield<VR::IS>("250");
+   set[{0x0020, 0x000d}] = make_elementfield<VR::UI>("1.2.826.0.1.3680043.2.1125.1.2");
+   set[{0x0020, 0x000e}] = make_elementfield<VR::UI>("1.2.826.0.1.3680043.2.1125.1.3");
+   set[{0x0020, 0x0013}] = make_elementfield<VR::IS>("1");
+   set[{0x0020, 0x0032}] = make_elementfield<VR::DS>("-250\\-250\\100");
+   set[{0x0020, 0x0037}] = make_elementfield<VR::DS>("1\\0\\0\\0\\1\\0");
+   set[{0x0028, 0x0002}] = make_elementfield<VR::US>(1);
+   set[{0x0028, 0x0004}] = make_elementfield<VR::CS>("MONOCHROME2");
+   set[{0x0028, 0x0010}] = make_elementfield<VR::US>(512);
+   set[{0x0028, 0x0011}] = make_elementfield<VR::US>(512);
+   set[{0x0028, 0x0030}] = make_elementfield<VR::DS>("0.5\\0.5");
+   set[{0x0028, 0x0100}] = make_elementfield<VR::US>(16);
+   set[{0x0028, 0x0101}] = make_elementfield<VR::US>(12);
+   set[{0x0028, 0x0102}] = make_elementfield<VR::US>(11);
+   set[{0x0028, 0x0103}] = make_elementfield<VR::US>(0);
+   set[{0x0028, 0x1050}] = make_elementfield<VR::DS>("40");
+   set[{0x0028, 0x1051}] = make_elementfield<VR::DS>("400");
+   set[{0x0028, 0x1052}] = make_elementfield<VR::DS>("-1024");
+   set[{0x0028, 0x1053}] = make_elementfield<VR::DS>("1");
+   set[{0x0018, 0x9306}] = make_elementfield<VR::FD>(0.625);
+   set[{0x0018, 0x9307}] = make_elementfield<VR::FD>(40.0);
+   set[{0x0020, 0x9057}] = make_elementfield<VR::UL>(12);
+   set[{0x0020, 0x9165}] = make_elementfield<VR::AT>(tag_type {0x0020, 0x9057});
+   return set;
+}
+
+template <typename Fn>
+static void report(const std::string& name, Fn&& fn)
+{
+   allocations = 0;
+   auto start = std::chrono::steady_clock::now();
+   for (int i=0; i<repetitions; ++i) {
+      fn();
+   }
+   auto end = std::chrono::steady_clock::now();
+   const std::size_t counted = allocations;
+   std::cout << std::left << std::setw(16) << name
+             << std::right << std::setw(14) << counted / repetitions
+             << std::setw(14) << std::chrono::duration<double, std::micro>(end - start).count() / repetitions
+             << "\n";
+}
+
+int main()
+{
+   auto& dict = get_default_dictionaries();
+   little_endian_explicit lee {dict};
+   const auto header = make_header();
+   const auto serialized = lee.serialize(header);
+
+   std::cout << header.size() << " attributes, " << serialized.size() << " bytes\n";
+   std::cout << std::left << std::setw(16) << "operation"
+             << std::right << std::setw(14) << "allocations"
+             << std::setw(14) << "us" << "\n";
+
+   report("decode", [&]() {
+      auto set = lee.deserialize(serialized);
+      if (set.size() != header.size()) std::cerr << "unexpected size\n";
+   });
+
+   std::vector<unsigned char> buffer;
+   buffer.reserve(serialized.size());
+   report("encode", [&]() {
+      buffer.clear();
+      lee.serialize(header, buffer);
+   });
+
+   std::size_t sum = 0;
+   report("read values", [&]() {
+      unsigned short rows, columns, bits;
+      get_value_field<VR::US>(header.at({0x0028, 0x0010}), rows);
+      get_value_field<VR::US>(header.at({0x0028, 0x0011}), columns);
+      get_value_field<VR::US>(header.at({0x0028, 0x0100}), bits);
+      std::string spacing, position;
+      get_value_field<VR::DS>(header.at({0x0028, 0x0030}), spacing);
+      get_value_field<VR::DS>(header.at({0x0020, 0x0032}), position);
+      sum += rows + columns + bits + spacing.size() + position.size();
+   });
+
+   return sum > 0 ? 0 : 1;
+}
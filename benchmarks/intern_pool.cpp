@@ -0,0 +1,121 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <string>
+#include <vector>
+
+#include <malloc.h>
+
+#include "libdicompp/dicomdata.hpp"
+
+using namespace dicom::data::dataset;
+using namespace dicom::data::attribute;
+using namespace dicom::data::dictionary;
+
+/**
+ * Measures the heap memory held by many deserialized image headers of the
+ * same series, with and without an intern pool. The global operator new of
+ * this program tracks the live bytes using malloc_usable_size().
+ * Configure with -DCMAKE_BUILD_TYPE=Release for meaningful timings.
+ */
+
+static std::size_t live_bytes = 0;
+
+void* operator new(std::size_t size)
+{
+   if (void* p = std::malloc(size ? size : 1)) {
+      live_bytes += malloc_usable_size(p);
+      return p;
+   }
+   throw std::bad_alloc {};
+}
+
+void operator delete(void* p) noexcept
+{
+   if (p) {
+      live_bytes -= malloc_usable_size(p);
+   }
+   std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+   ::operator delete(p);
+}
+
+static const int headers = 10000;
+
+static iod make_header(int instance)
+{
+   iod set;
+   set[{0x0008, 0x0005}] = make_elementfield<VR::CS>("ISO_IR 100");
+   set[{0x0008, 0x0008}] = make_elementfield<VR::CS>("ORIGINAL\\PRIMARY\\AXIAL");
+   set[{0x0008, 0x0016}] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.2");
+   set[{0x0008, 0x0018}] = make_elementfield<VR::UI>("1.2.826.0.1.3680043.2.1125.1.4." + std::to_string(instance));
+   set[{0x0008, 0x0020}] = make_elementfield<VR::DA>("20240101");
+   set[{0x0008, 0x0030}] = make_elementfield<VR::TM>("120000");
+   set[{0x0008, 0x0050}] = make_elementfield<VR::SH>("ACC00001");
+   set[{0x0008, 0x0060}] = make_elementfield<VR::CS>("CT");
+   set[{0x0008, 0x0070}] = make_elementfield<VR::LO>("MANUFACTURER");
+   set[{0x0008, 0x1010}] = make_elementfield<VR::SH>("STATION1");
+   set[{0x0008, 0x1030}] = make_elementfield<VR::LO>("CT THORAX");
+   set[{0x0010, 0x0010}] = make_elementfield<VR::PN>("DOE^JOHN");
+   set[{0x0010, 0x0020}] = make_elementfield<VR::LO>("123456");
+   set[{0x0010, 0x0030}] = make_elementfield<VR::DA>("19700101");
+   set[{0x0010, 0x0040}] = make_elementfield<VR::CS>("M");
+   set[{0x0018, 0x0050}] = make_elementfield<VR::DS>("1.25");
+   set[{0x0018, 0x0060}] = make_elementfield<VR::DS>("120");
+   set[{0x0020, 0x000d}] = make_elementfield<VR::UI>("1.2.826.0.1.3680043.2.1125.1.2");
+   set[{0x0020, 0x000e}] = make_elementfield<VR::UI>("1.2.826.0.1.3680043.2.1125.1.3");
+   set[{0x0020, 0x0013}] = make_elementfield<VR::IS>(std::to_string(instance));
+   set[{0x0020, 0x0052}] = make_elementfield<VR::UI>("1.2.826.0.1.3680043.2.1125.1.5");
+   set[{0x0028, 0x0004}] = make_elementfield<VR::CS>("MONOCHROME2");
+   set[{0x0028, 0x0010}] = make_elementfield<VR::US>(512);
+   set[{0x0028, 0x0011}] = make_elementfield<VR::US>(512);
+   set[{0x0028, 0x0030}] = make_elementfield<VR::DS>("0.5\\0.5");
+   return set;
+}
+
+static void report(const std::string& name, const little_endian_explicit& lee,
+                   const std::vector<std::vector<unsigned char>>& serialized)
+{
+   const std::size_t before = live_bytes;
+   auto start = std::chrono::steady_clock::now();
+   std::vector<dataset_type> kept;
+   kept.reserve(serialized.size());
+   for (const auto& data : serialized) {
+      kept.push_back(lee.deserialize(data));
+   }
+   auto end = std::chrono::steady_clock::now();
+   std::cout << std::left << std::setw(16) << name
+             << std::right << std::setw(14) << (live_bytes - before) / serialized.size()
+             << std::setw(14) << std::chrono::duration<double, std::micro>(end - start).count() / serialized.size()
+             << "\n";
+}
+
+int main()
+{
+   auto& dict = get_default_dictionaries();
+   little_endian_explicit lee {dict};
+
+   std::vector<std::vector<unsigned char>> serialized;
+   serialized.reserve(headers);
+   for (int i=0; i<headers; ++i) {
+      serialized.push_back(lee.serialize(make_header(i + 1)));
+   }
+
+   std::cout << headers << " headers of " << make_header(1).size() << " attributes\n";
+   std::cout << std::left << std::setw(16) << "storage"
+             << std::right << std::setw(14) << "bytes/header"
+             << std::setw(14) << "us" << "\n";
+
+   report("separate", lee, serialized);
+
+   lee.set_intern_pool(std::make_shared<intern_pool>());
+   report("interned", lee, serialized);
+
+   return 0;
+}
@@ -0,0 +1,211 @@
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "libdicompp/network.hpp"
+
+using namespace dicom::data::dataset;
+using namespace dicom::data::attribute;
+using namespace dicom::data::dictionary;
+using namespace dicom::network::upperlayer;
+
+/**
+ * Measures the receive path of the upperlayer for messages with a 1 MiB data
+ * set, which are split into P-DATA-TF PDUs of different maximum lengths. The
+ * PDUs are served from memory by a connection which queues the completion
+ * handlers, so the numbers reflect the parsing and buffer handling of scx
+ * without any socket overhead.
+ * Configure with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+ */
+
+static const std::size_t dataset_size = 1024*1024;
+static const std::size_t num_messages = 100;
+
+class null_timer: public Iinfrastructure_timeout_connection
+{
+   public:
+      void cancel() override {}
+      void wait_async() override {}
+};
+
+/**
+ * @brief The memory_connection class serves reads from a buffer and discards
+ *        writes. Completion handlers are run from run() instead of being
+ *        invoked recursively.
+ */
+class memory_connection: public Iinfrastructure_upperlayer_connection
+{
+   public:
+      explicit memory_connection(std::vector<unsigned char> input):
+         input {std::move(input)},
+         pos {0}
+      {
+      }
+
+      void write_data(std::shared_ptr<std::vector<unsigned char>> buffer,
+                      std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override
+      {
+         complete(on_complete, buffer->size());
+      }
+
+      void write_data(void*, std::size_t len,
+                      std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override
+      {
+         complete(on_complete, len);
+      }
+
+      void write_data(std::vector<boost::asio::const_buffer> buffers,
+                      std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override
+      {
+         complete(on_complete, boost::asio::buffer_size(buffers));
+      }
+
+      void read_data(std::shared_ptr<std::vector<unsigned char>> buffer, std::size_t len,
+                     std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override
+      {
+         read_data(buffer->data(), len, on_complete);
+      }
+
+      void read_data(void* data_offset, std::size_t len,
+                     std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override
+      {
+         if (input.size()-pos < len) {
+            // end of input, stop reading
+            return;
+         }
+         std::memcpy(data_offset, input.data()+pos, len);
+         pos += len;
+         complete(on_complete, len);
+      }
+
+      void read_data(std::shared_ptr<std::vector<unsigned char>> buffer,
+                     std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override
+      {
+         read_data(buffer->data(), buffer->size(), on_complete);
+      }
+
+      std::unique_ptr<Iinfrastructure_timeout_connection> timeout_timer(
+              std::chrono::duration<int>, std::function<void()>) override
+      {
+         return std::unique_ptr<Iinfrastructure_timeout_connection> {new null_timer {}};
+      }
+
+      void post(std::function<void()> f) override
+      {
+         pending.push_back(f);
+      }
+
+      bool is_stopped() const override
+      {
+         return false;
+      }
+
+      void close() override
+      {
+      }
+
+      void run()
+      {
+         while (!pending.empty()) {
+            auto f = std::move(pending.front());
+            pending.pop_front();
+            f();
+         }
+      }
+
+   private:
+      std::vector<unsigned char> input;
+      std::size_t pos;
+      std::deque<std::function<void()>> pending;
+
+      void complete(std::function<void(const boost::system::error_code&, std::size_t)> on_complete,
+                    std::size_t bytes)
+      {
+         pending.push_back([on_complete, bytes]() {
+            on_complete(boost::system::error_code {}, bytes);
+         });
+      }
+};
+
+static std::vector<unsigned char> make_input(dictionaries& dict, std::size_t max_pdu_length,
+                                             std::size_t& num_pdus)
+{
+   a_associate_rq rq;
+   rq.called_ae = rq.calling_ae = "BENCH           ";
+   rq.application_context = "1.2.840.10008.3.1.1.1";
+   rq.pres_contexts.push_back({1, "1.2.840.10008.5.1.4.1.1.7", {"1.2.840.10008.1.2.1"}});
+   rq.max_message_length = max_pdu_length;
+   auto input = rq.make_pdu();
+
+   iod command;
+   command[{0x0000, 0x0800}] = make_elementfield<VR::US>(0x0000);
+
+   p_data_tf pdata;
+   pdata.msg_length = max_pdu_length;
+   pdata.pres_context_id = 1;
+   pdata.command_set = commandset_processor {dict}.serialize(command);
+   pdata.data_set = std::vector<unsigned char>(dataset_size, 0x5a);
+   auto message = pdata.make_pdu();
+
+   for (std::size_t i=0; i<num_messages; ++i) {
+      input.insert(input.end(), message.begin(), message.end());
+   }
+   const std::size_t fragment = max_pdu_length - 12;
+   num_pdus = num_messages * (1 + (dataset_size + fragment - 1) / fragment);
+   return input;
+}
+
+int main()
+{
+   auto& dict = get_default_dictionaries();
+   boost::log::core::get()->set_logging_enabled(false);
+
+   std::cout << std::left << std::setw(16) << "max pdu length"
+             << std::right << std::setw(14) << "PDUs/s"
+             << std::setw(14) << "MiB/s" << "\n";
+
+   for (std::size_t max_pdu_length : {4096, 16384, 65536, 262144, 1048576}) {
+      std::size_t num_pdus = 0;
+      memory_connection conn {make_input(dict, max_pdu_length, num_pdus)};
+
+      std::size_t received = 0;
+      auto on_associate = [](Iupperlayer_comm_ops* ul, std::unique_ptr<property> p) {
+         auto rq = dynamic_cast<a_associate_rq*>(p.get());
+         auto ac = new a_associate_ac;
+         ac->called_ae = rq->called_ae;
+         ac->calling_ae = rq->calling_ae;
+         ac->application_context = rq->application_context;
+         ac->pres_contexts.push_back({1, a_associate_ac::presentation_context::RESULT::ACCEPTANCE,
+                                      "1.2.840.10008.1.2.1"});
+         ac->max_message_length = rq->max_message_length;
+         ul->queue_for_write(std::unique_ptr<property> {ac});
+      };
+      auto on_data = [&received](Iupperlayer_comm_ops*, std::unique_ptr<property>) {
+         ++received;
+      };
+
+      auto start = std::chrono::steady_clock::now();
+      scp_connection scp {&conn, dict,
+                          [](Iupperlayer_comm_ops*) {}, [](Iupperlayer_comm_ops*) {},
+                          [](Iupperlayer_comm_ops*, std::exception_ptr) {},
+                          {{TYPE::A_ASSOCIATE_RQ, on_associate},
+                           {TYPE::P_DATA_TF, on_data}}};
+      conn.run();
+      auto end = std::chrono::steady_clock::now();
+      double seconds = std::chrono::duration<double>(end - start).count();
+
+      if (received != num_messages) {
+         std::cerr << "Received " << received << " of " << num_messages << " messages\n";
+      }
+      std::cout << std::left << std::setw(16) << max_pdu_length
+                << std::right << std::setw(14) << static_cast<std::size_t>(num_pdus / seconds)
+                << std::setw(14) << num_messages * dataset_size / seconds / (1024*1024) << "\n";
+   }
+   return 0;
+}
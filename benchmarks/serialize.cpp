@@ -0,0 +1,135 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "libdicompp/dicomdata.hpp"
+
+using namespace dicom::data::dataset;
+using namespace dicom::data::attribute;
+using namespace dicom::data::dictionary;
+
+/**
+ * Measures the serialization throughput of the little endian explicit
+ * transfer processor for a large image-like set: a few thousand header
+ * attributes, a sequence with nested items and a 4 MiB pixel data value. The
+ * set is serialized into a new vector, into a reused buffer, into a sink and,
+ * after a lazy deserialization, by copying the original value bytes. The
+ * big endian rows measure the byte swapping of the value fields in both
+ * directions.
+ * Configure with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+ */
+
+static const std::size_t num_elements = 4000;
+static const std::size_t num_items = 50;
+static const std::size_t pixel_count = 2048*1024;
+static const int repetitions = 50;
+
+template <typename Fn>
+static double measure(Fn&& fn)
+{
+   auto start = std::chrono::steady_clock::now();
+   for (int i=0; i<repetitions; ++i) {
+      fn();
+   }
+   auto end = std::chrono::steady_clock::now();
+   return std::chrono::duration<double, std::micro>(end - start).count() / repetitions;
+}
+
+static iod make_dataset()
+{
+   iod set;
+   for (std::size_t i=0; i<num_elements; ++i) {
+      tag_type tag {static_cast<unsigned short>(0x0009 + 2*(i/1000)), static_cast<unsigned short>(0x1000 + i%1000)};
+      switch (i%4) {
+         case 0: set[tag] = make_elementfield<VR::LO>("value " + std::to_string(i)); break;
+         case 1: set[tag] = make_elementfield<VR::US>(static_cast<unsigned short>(i)); break;
+         case 2: set[tag] = make_elementfield<VR::FD>(i * 0.5); break;
+         default: set[tag] = make_elementfield<VR::UI>("1.2.840.10008." + std::to_string(i)); break;
+      }
+   }
+
+   std::vector<iod> items;
+   for (std::size_t i=0; i<num_items; ++i) {
+      iod item;
+      item[{0xfffe, 0xe000}] = make_elementfield<VR::NI>(0xffffffff, VR::NI);
+      item[{0x0008, 0x1150}] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.4");
+      item[{0x0008, 0x1155}] = make_elementfield<VR::UI>("1.2.3.4." + std::to_string(i));
+      item[{0xfffe, 0xe00d}] = make_elementfield<VR::NI>();
+      items.push_back(item);
+   }
+   iod seqdel;
+   seqdel[{0xfffe, 0xe0dd}] = make_elementfield<VR::NI>();
+   items.push_back(seqdel);
+   set[{0x0008, 0x1140}] = make_elementfield<VR::SQ>(0xffffffff, items);
+
+   std::vector<unsigned short> pixels(pixel_count);
+   for (std::size_t i=0; i<pixels.size(); ++i) {
+      pixels[i] = static_cast<unsigned short>(i);
+   }
+   set[{0x7fe0, 0x0010}] = make_elementfield<VR::OW>(pixels.size()*2, pixels);
+   return set;
+}
+
+static void report(const std::string& name, double us, std::size_t bytes)
+{
+   std::cout << std::left << std::setw(16) << name
+             << std::right << std::setw(14) << us
+             << std::setw(14) << bytes / us << "\n";
+}
+
+int main()
+{
+   auto& dict = get_default_dictionaries();
+   little_endian_explicit lee {dict};
+   auto set = make_dataset();
+   auto size = lee.serialized_size(set);
+
+   double vector_us = measure([&]() {
+      auto data = lee.serialize(set);
+      if (data.size() != size) std::cerr << "unexpected size\n";
+   });
+
+   std::vector<unsigned char> buffer;
+   double buffer_us = measure([&]() {
+      buffer.clear();
+      lee.serialize(set, buffer);
+   });
+
+   std::size_t sunk = 0;
+   double sink_us = measure([&]() {
+      lee.serialize(set, [&sunk](byte_view chunk) { sunk += chunk.size(); });
+   });
+
+   auto serialized = std::make_shared<std::vector<unsigned char>>(lee.serialize(set));
+   auto lazy_set = lee.deserialize_lazy(serialized);
+   double lazy_us = measure([&]() {
+      buffer.clear();
+      lee.serialize(lazy_set, buffer);
+   });
+
+   big_endian_explicit bee {dict};
+   double big_endian_us = measure([&]() {
+      buffer.clear();
+      bee.serialize(set, buffer);
+   });
+   double big_endian_parse_us = measure([&]() {
+      auto parsed = bee.deserialize(buffer);
+      if (parsed.size() != set.size()) std::cerr << "unexpected size\n";
+   });
+
+   std::cout << "serialized size: " << size << " bytes, "
+             << num_elements << " attributes, " << num_items << " items\n";
+   std::cout << std::left << std::setw(16) << "output"
+             << std::right << std::setw(14) << "us"
+             << std::setw(14) << "MB/s" << "\n";
+   report("new vector", vector_us, size);
+   report("reused buffer", buffer_us, size);
+   report("sink", sink_us, size);
+   report("lazy set", lazy_us, size);
+   report("big endian", big_endian_us, size);
+   report("big endian in", big_endian_parse_us, size);
+   return sunk == size * repetitions ? 0 : 1;
+}
@@ -0,0 +1,106 @@
+#include <iostream>
+#include <iomanip>
+#include <chrono>
+#include <functional>
+#include <map>
+#include <memory>
+#include <utility>
+
+#include "libdicompp/network.hpp"
+
+using namespace dicom::network::upperlayer;
+
+/**
+ * Measures the cost of the upperlayer statemachine transition which is made
+ * for every PDU sent or received. The dispatch of the former transition
+ * table, a std::map of std::function keyed by event and state, is compared
+ * to the array of member function pointers indexed by event and state on a
+ * trivial action; the last row is the complete transition of a received
+ * P-DATA-TF PDU (DT-2) with logging disabled.
+ * Configure with -DCMAKE_BUILD_TYPE=Release for meaningful numbers.
+ */
+
+static const std::size_t num_transitions = 10000000;
+
+class null_ops: public Istate_trans_ops
+{
+   public:
+      void reset_artim() override {}
+      void stop_artim() override {}
+      void start_artim() override {}
+      void ignore_next() override {}
+      void queue_for_write_w_prio(std::unique_ptr<property>) override {}
+      void close_connection() override {}
+};
+
+/**
+ * @brief The counter struct is the target of the trivial action, which
+ *        keeps the compiler from eliding the dispatch
+ */
+struct counter
+{
+      volatile std::size_t count = 0;
+      void action() { count = count + 1; }
+};
+
+using event = statemachine::EVENT;
+using conn_state = statemachine::CONN_STATE;
+
+template <typename F>
+static double ns_per_transition(F transition)
+{
+   auto start = std::chrono::steady_clock::now();
+   for (std::size_t i=0; i<num_transitions; ++i) {
+      transition();
+   }
+   auto end = std::chrono::steady_clock::now();
+   return std::chrono::duration<double, std::nano>(end - start).count() / num_transitions;
+}
+
+static void print(const char* name, double ns)
+{
+   std::cout << std::left << std::setw(36) << name
+             << std::right << std::setw(14) << std::fixed << std::setprecision(2) << ns << "\n";
+}
+
+int main()
+{
+   boost::log::core::get()->set_logging_enabled(false);
+
+   std::cout << std::left << std::setw(36) << "dispatch"
+             << std::right << std::setw(14) << "ns/transition" << "\n";
+
+   counter c;
+   std::map<std::pair<event, conn_state>, std::function<void(counter*)>> map_table;
+   for (std::size_t e = 0; e < statemachine::num_events; ++e) {
+      for (std::size_t s = 0; s < statemachine::num_states; ++s) {
+         map_table[{static_cast<event>(e), static_cast<conn_state>(s)}] = std::mem_fn(&counter::action);
+      }
+   }
+   print("std::map + std::function", ns_per_transition([&]() {
+      auto key = std::make_pair(event::RECV_P_DATA_TF_PDU, conn_state::STA6);
+      if (map_table.find(key) != map_table.end()) {
+         map_table[key](&c);
+      }
+   }));
+
+   using action = void (counter::*)();
+   action array_table[statemachine::num_events][statemachine::num_states] {};
+   array_table[static_cast<std::size_t>(event::RECV_P_DATA_TF_PDU)][static_cast<std::size_t>(conn_state::STA6)] = &counter::action;
+   // read through a volatile pointer so the lookup is not folded
+   action (* volatile table)[statemachine::num_states] = array_table;
+   print("array of member pointers", ns_per_transition([&]() {
+      auto a = table[static_cast<std::size_t>(event::RECV_P_DATA_TF_PDU)][static_cast<std::size_t>(conn_state::STA6)];
+      if (a != nullptr) {
+         (c.*a)();
+      }
+   }));
+
+   null_ops ops;
+   statemachine sm {&ops, conn_state::STA6};
+   print("statemachine::transition (DT-2)", ns_per_transition([&]() {
+      sm.transition(event::RECV_P_DATA_TF_PDU);
+   }));
+
+   return 0;
+}
@@ -6,6 +6,7 @@
 #include "network.hpp"
 
 #include "../../source/serviceclass/storage_scu.hpp"
+#include "../../source/serviceclass/storage_fanout.hpp"
 #include "../../source/serviceclass/storage_scp.hpp"
 #include "../../source/serviceclass/queryretrieve_scp.hpp"
 #include "../../source/serviceclass/worklist_scp.hpp"
@@ -4,18 +4,28 @@
 #include "../../source/data/attribute/encapsulated.hpp"
 #include "../../source/data/attribute/vmtype.hpp"
 #include "../../source/data/attribute/tag.hpp"
+#include "../../source/data/attribute/byte_view.hpp"
 #include "../../source/data/attribute/attribute.hpp"
+#include "../../source/data/attribute/byte_order.hpp"
+#include "../../source/data/attribute/lazy_element_field.hpp"
+#include "../../source/data/attribute/intern_pool.hpp"
 #include "../../source/data/attribute/constants.hpp"
 
 #include "../../source/data/dataset/datasets.hpp"
 #include "../../source/data/dataset/dataset_iterator.hpp"
+#include "../../source/data/dataset/arena.hpp"
+#include "../../source/data/dataset/flat_dataset.hpp"
 #include "../../source/data/attribute/attribute_field_coder.hpp"
 #include "../../source/data/dataset/transfer_processor.hpp"
+#include "../../source/data/dataset/stream_parser.hpp"
 
 #include "../../source/data/dictionary/dictionary.hpp"
+#include "../../source/data/dictionary/dictionary_static.hpp"
 #include "../../source/data/dictionary/commanddictionary.hpp"
 #include "../../source/data/dictionary/datadictionary.hpp"
 
 #include "../../source/filesystem/dicomfile.hpp"
+#include "../../source/filesystem/batch_reader.hpp"
+#include "../../source/filesystem/spool_file.hpp"
 
 #endif // LIBDICOMPP_DICOMDATA_HPP
@@ -9,5 +9,6 @@
 //#include "../../source/network/dimse/sop_class.hpp"
 //#include "../../source/network/dimse/response.hpp"
 #include "../../source/network/dimse/dimse_pm.hpp"
+#include "../../source/network/dimse/association_pool.hpp"
 
 #endif // LIBDICOMPP_NETWORK_HPP
@@ -44,12 +44,12 @@ int main()
    dat[{0x0010, 0x0010}] = value<VR::FD> {1.0, 0.0, -1.0};
    dat[{0x007f, 0x0010}] = value<VR::ST> {a};
 
-//   value_ref<VR::FD> val = dat[{0x0010, 0x0010}];
-//   *(val.value().begin()) = 2.3;
+   value_ref<VR::FD> val = dat[{0x0010, 0x0010}];
 
    value<VR::FD> val2 = dat[{0x0010, 0x0010}];
    value<VR::ST> val3 = dat[{0x007f, 0x0010}];
    auto v = *(val2.get().begin());
+   v = *(val.get().cbegin());
    dat[{0x0010, 0x0010}] = coord;
    val2 = dat[{0x0010, 0x0010}];
    v = *(val2.get().begin());
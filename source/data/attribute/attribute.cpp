@@ -27,17 +27,25 @@ elementfield::elementfield(const elementfield& other):
 {
 }
 
-elementfield::elementfield(elementfield&& other):
+elementfield::elementfield(elementfield&& other) noexcept:
    value_rep {std::move(other.value_rep)},
    value_len {std::move(other.value_len)},
    value_field {std::move(other.value_field)}
 {
-   other.value_field = nullptr;
 }
 
-elementfield& elementfield::operator=(elementfield other)
+elementfield& elementfield::operator=(const elementfield& other)
 {
-   swap(*this, other);
+   elementfield copy {other};
+   swap(*this, copy);
+   return *this;
+}
+
+elementfield& elementfield::operator=(elementfield&& other) noexcept
+{
+   value_rep = std::move(other.value_rep);
+   value_len = other.value_len;
+   value_field = std::move(other.value_field);
    return *this;
 }
 
@@ -5,6 +5,8 @@
 #include <vector>
 #include <chrono>
 #include <memory>
+#include <atomic>
+#include <stdexcept>
 #include <type_traits>
 #include <ostream>
 
@@ -15,6 +17,7 @@
 #include "vmtype.hpp"
 #include "encapsulated.hpp"
 #include "tag.hpp"
+#include "byte_view.hpp"
 
 namespace dicom
 {
@@ -108,7 +111,9 @@ class attribute_visitor
  *        with their different types.
  * This struct may not be dependent on any template parameters, as it is used
  * by the elementfield struct which holds a "type-dependency-free" pointer to
- * it.
+ * it. The element fields form a tagged union: each one records the VR of the
+ * value it holds, so the typed field is obtained with a comparison and a
+ * static_cast instead of a dynamic_cast.
  */
 struct elementfield_base
 {
@@ -118,12 +123,89 @@ struct elementfield_base
        */
       template <VR vr>
       void accept(attribute_visitor<vr>& op)  {
-         element_field<vr>* ef = dynamic_cast<element_field<vr>*>(this);
-         assert(ef); // this class is abstract; the dynamic type of this must be
-                     // a pointer to a subclass, therefore ef cannot be nullptr.
-         op.accept(ef);
+         op.accept(typed<vr>());
       }
 
+      /**
+       * @brief typed returns the element_field holding the value for
+       *        modification, which is decoded first if it was deferred
+       * @return pointer to the element_field of the VR
+       * @throws std::runtime_error if the value is not of the given VR
+       */
+      template <VR vr>
+      element_field<vr>* typed()
+      {
+         elementfield_base* field = resolved.load(std::memory_order_acquire);
+         if (field == nullptr) {
+            field = resolve();
+         }
+         check_vr<vr>(field);
+         return static_cast<element_field<vr>*>(field);
+      }
+
+      /**
+       * @brief typed_detached returns the element_field holding the value
+       *        for modification through a pointer which the caller may keep.
+       *        Unlike typed(), a shared value is not shared with later copies
+       *        of the attribute either.
+       * @return pointer to the element_field of the VR
+       * @throws std::runtime_error if the value is not of the given VR
+       */
+      template <VR vr>
+      element_field<vr>* typed_detached()
+      {
+         elementfield_base* field = detach();
+         check_vr<vr>(field);
+         return static_cast<element_field<vr>*>(field);
+      }
+
+      /**
+       * @brief typed_view returns the element_field holding the value for
+       *        read access. Unlike typed(), a value shared with copies of the
+       *        attribute is not copied.
+       * @return pointer to the element_field of the VR
+       * @throws std::runtime_error if the value is not of the given VR
+       */
+      template <VR vr>
+      const element_field<vr>* typed_view()
+      {
+         const elementfield_base* field = resolved.load(std::memory_order_acquire);
+         if (field == nullptr) {
+            field = view();
+         }
+         check_vr<vr>(field);
+         return static_cast<const element_field<vr>*>(field);
+      }
+
+      /**
+       * @brief resolve returns the typed value field, which is the instance
+       *        itself unless it defers the decoding of the value or shares it.
+       * @return pointer to the element_field holding the value
+       */
+      virtual elementfield_base* resolve() { return this; }
+
+      /**
+       * @brief detach returns the typed value field like resolve(), and stops
+       *        sharing it with copies made afterwards
+       * @return pointer to the element_field holding the value
+       */
+      virtual elementfield_base* detach() { return resolve(); }
+
+      /**
+       * @brief view returns the typed value field for read access
+       * @return pointer to the element_field holding the value
+       */
+      virtual const elementfield_base* view() { return resolve(); }
+
+      /**
+       * @brief raw returns the serialized value if it is still available
+       *        unmodified in the given byte order.
+       * @param endianness byte order the value is requested in
+       * @return view on the serialized value, boost::none if it has to be
+       *         encoded
+       */
+      virtual boost::optional<byte_view> raw(ENDIANNESS) const { return boost::none; }
+
       virtual std::unique_ptr<elementfield_base> deep_copy() = 0;
 
       virtual std::size_t byte_size() = 0;
@@ -131,6 +213,33 @@ struct elementfield_base
       virtual std::ostream& print(std::ostream& os) = 0;
 
       virtual ~elementfield_base() = 0;
+
+   protected:
+      /**
+       * @brief elementfield_base constructor
+       * @param held VR of the value
+       * @param deferred true if the value is held elsewhere and looked up
+       *        by resolve() and view(), eg. decoded on first access
+       */
+      elementfield_base(VR held, bool deferred = false):
+         held_vr {held},
+         resolved {deferred ? nullptr : this}
+      {
+      }
+
+      const VR held_vr;
+
+      // field holding the value, null while it is deferred or shared
+      std::atomic<elementfield_base*> resolved;
+
+   private:
+      template <VR vr>
+      static void check_vr(const elementfield_base* field)
+      {
+         if (field->held_vr != vr) {
+            throw std::runtime_error {"value field is not of the requested VR"};
+         }
+      }
 };
 
 
@@ -397,11 +506,41 @@ struct value
 
 
 
+/**
+ * @brief The value_ref struct refers to the value field of an attribute
+ *        without copying it. It stays valid as long as the attribute is
+ *        neither assigned a new value nor destroyed.
+ */
+template <VR vr>
+struct value_ref
+{
+   private:
+      const typename type_of<vr>::type* value_;
+
+   public:
+      explicit value_ref(const typename type_of<vr>::type& val): value_ {&val} {}
+
+      operator const typename type_of<vr>::type&() const
+      {
+         return *value_;
+      }
+
+      const typename type_of<vr>::type& get() const
+      {
+         return *value_;
+      }
+};
+
+
+
 struct elementfield;
 
 template <VR vr>
 static elementfield make_elementfield(value<vr> val);
 
+template <VR vr>
+const typename type_of<vr>::type& get_value_field_ref(const elementfield& e);
+
 template <VR vr>
 void get_value_field(const elementfield& e, typename type_of<vr>::type& data);
 
@@ -421,8 +560,9 @@ struct elementfield
 
       elementfield() = default;
       elementfield(const elementfield& other);
-      elementfield(elementfield&& other);
-      elementfield& operator=(const elementfield other);
+      elementfield(elementfield&& other) noexcept;
+      elementfield& operator=(const elementfield& other);
+      elementfield& operator=(elementfield&& other) noexcept;
 
       template <VR vr>
       elementfield& operator=(value<vr> val)
@@ -434,17 +574,22 @@ struct elementfield
       template <VR vr>
       operator value<vr>() const
       {
-         typename type_of<vr>::type data;
-         get_value_field<vr>(*this, data);
-         return data;
+         return get_value_field_ref<vr>(*this);
+      }
+
+      /**
+       * @brief operator value_ref accesses the value without copying it
+       */
+      template <VR vr>
+      operator value_ref<vr>() const
+      {
+         return value_ref<vr> {get_value_field_ref<vr>(*this)};
       }
 
       template <VR vr>
       typename type_of<vr>::type value() const
       {
-         typename type_of<vr>::type data;
-         get_value_field<vr>(*this, data);
-         return data;
+         return get_value_field_ref<vr>(*this);
       }
 
 
@@ -463,6 +608,11 @@ struct element_field: elementfield_base
       using vrtype = typename type_of<vr>::type;
       vrtype value_field;
 
+      element_field():
+         elementfield_base {vr}
+      {
+      }
+
       std::unique_ptr<elementfield_base> deep_copy() override
       {
          element_field<vr>* ef = new element_field<vr> {};
@@ -483,6 +633,124 @@ struct element_field: elementfield_base
       virtual ~element_field() {}
 };
 
+/**
+ * @brief shares_value returns true if copies of an attribute of the VR share
+ *        large values until one of them is modified
+ */
+constexpr bool shares_value(VR vr)
+{
+   return vr == VR::OB || vr == VR::OW || vr == VR::UN;
+}
+
+/**
+ * value length from which the values of the VRs selected by shares_value()
+ * are shared
+ */
+constexpr std::size_t shared_value_threshold = 64*1024;
+
+/**
+ * @brief The shared_element_field struct holds a value shared by several
+ *        attributes, like large binary values or values of an intern_pool.
+ * Copying the attribute only copies the reference. The value is copied when
+ * it is accessed for modification while it is still shared or pooled (copy
+ * on write), read access through get_value_field_ref() never copies it.
+ * Once a pointer to the value was handed out by get_value_field_pointer(),
+ * it may still be written through, so copies of the attribute take their own
+ * value from then on.
+ */
+template <VR vr>
+struct shared_element_field: elementfield_base
+{
+      /**
+       * @brief shared_element_field constructor
+       * @param shared field holding the value
+       * @param pooled true if the value is also referenced by an intern
+       *        pool, so it is never modified in place
+       */
+      explicit shared_element_field(std::shared_ptr<element_field<vr>> shared, bool pooled = false):
+         elementfield_base {vr, true},
+         shared {std::move(shared)},
+         pooled {pooled},
+         exposed {false}
+      {
+      }
+
+      elementfield_base* resolve() override
+      {
+         if (pooled || shared.use_count() > 1) {
+            std::shared_ptr<element_field<vr>> own {new element_field<vr> {}};
+            own->value_field = shared->value_field;
+            shared = std::move(own);
+            pooled = false;
+         }
+         return shared.get();
+      }
+
+      elementfield_base* detach() override
+      {
+         exposed = true;
+         return resolve();
+      }
+
+      const elementfield_base* view() override
+      {
+         return shared.get();
+      }
+
+      std::unique_ptr<elementfield_base> deep_copy() override
+      {
+         if (exposed) {
+            return shared->deep_copy();
+         }
+         return std::unique_ptr<elementfield_base> {new shared_element_field<vr> {shared, pooled}};
+      }
+
+      std::size_t byte_size() override
+      {
+         return shared->byte_size();
+      }
+
+      std::ostream& print(std::ostream& os) override
+      {
+         return shared->print(os);
+      }
+
+   private:
+      std::shared_ptr<element_field<vr>> shared;
+      bool pooled;
+
+      // set when detach() handed out the value
+      bool exposed;
+};
+
+template <VR vr>
+std::unique_ptr<elementfield_base> make_value_field(std::size_t, std::false_type)
+{
+   return std::unique_ptr<elementfield_base> {new element_field<vr>};
+}
+
+template <VR vr>
+std::unique_ptr<elementfield_base> make_value_field(std::size_t data_len, std::true_type)
+{
+   if (data_len < shared_value_threshold) {
+      return make_value_field<vr>(data_len, std::false_type {});
+   }
+   return std::unique_ptr<elementfield_base> {
+      new shared_element_field<vr> {std::make_shared<element_field<vr>>()}};
+}
+
+/**
+ * @brief make_value_field creates the node holding a value field of the given
+ *        length, which is shared by copies if it is a large binary value
+ * @param data_len length of the value field
+ * @return empty value field
+ */
+template <VR vr>
+std::unique_ptr<elementfield_base> make_value_field(std::size_t data_len)
+{
+   return make_value_field<vr>(data_len, std::integral_constant<bool, shares_value(vr)> {});
+}
+
 
 /**
  * @brief The get_visitor class is used to retrieve the value of the value field
@@ -507,7 +775,20 @@ class get_visitor : public attribute_visitor<vr>
 
 
 /**
- * @brief >_field is used to retrieve the value of the value field
+ * @brief get_value_field_ref returns a reference to the value field of an
+ *        attribute, without copying it
+ * @param e element field / attribute operated upon
+ * @return value of the attribute
+ * @throws std::runtime_error if the attribute is not of the given VR
+ */
+template <VR vr>
+const typename type_of<vr>::type& get_value_field_ref(const elementfield& e)
+{
+   return e.value_field->typed_view<vr>()->value_field;
+}
+
+/**
+ * @brief get_value_field is used to retrieve the value of the value field
  *        of an attribute.
  * @param e element field / attribute operated upon
  * @param out_data reference where the value will be stored
@@ -515,59 +796,35 @@ class get_visitor : public attribute_visitor<vr>
 template <VR vr>
 void get_value_field(const elementfield& e, typename type_of<vr>::type& out_data)
 {
-   get_visitor<vr> getter(out_data);
-   e.value_field->accept<vr>(getter);
+   out_data = get_value_field_ref<vr>(e);
 }
 
 // for VR OB
 template <VR vr>
 void get_value_field(const elementfield& e, typename type_of<vr>::base_type& out_data)
 {
-   typename type_of<VR::OB>::type wrapped_data;
-
-   get_visitor<vr> getter(wrapped_data);
-   e.value_field->accept<vr>(getter);
-
-   out_data = boost::get<std::vector<unsigned char>>(wrapped_data);
+   out_data = boost::get<std::vector<unsigned char>>(get_value_field_ref<vr>(e));
 }
 
 template <VR vr>
 void get_value_field(const elementfield& e, typename type_of<vr>::type::base_type& out_data)
 {
-   typename type_of<vr>::type wrapper;
-
-   get_visitor<vr> getter(wrapper);
-   e.value_field->accept<vr>(getter);
-   out_data = *wrapper.begin();
+   out_data = *get_value_field_ref<vr>(e).cbegin();
 }
 
-template <VR vr>
-class get_ptr_visitor : public attribute_visitor<vr>
-{
-   private:
-      typename type_of<vr>::type* dataptr;
-
-   public:
-      get_ptr_visitor() = default;
-
-      virtual void apply(element_field<vr>* ef) override
-      {
-         dataptr = &ef->value_field;
-      }
-
-      decltype(dataptr) pointer() const
-      {
-         return dataptr;
-      }
-};
-
-
+/**
+ * @brief get_value_field_pointer returns a pointer to the value field of an
+ *        attribute for modification. A value shared with copies of the
+ *        attribute is copied first and is not shared with later copies, use
+ *        get_value_field_ref() for reading.
+ * @param e element field / attribute operated upon
+ * @return pointer to the value of the attribute
+ * @throws std::runtime_error if the attribute is not of the given VR
+ */
 template <VR vr>
 static typename type_of<vr>::type* get_value_field_pointer(const elementfield& e)
 {
-   get_ptr_visitor<vr> getpointer;
-   e.value_field->accept<vr>(getpointer);
-   return getpointer.pointer();
+   return &e.value_field->typed_detached<vr>()->value_field;
 }
 
 
@@ -622,7 +879,7 @@ elementfield make_elementfield(std::size_t data_len, const typename type_of<vr>:
    elementfield el;
    el.value_rep = vr;
    el.value_len = data_len;
-   el.value_field = std::unique_ptr<elementfield_base> {new element_field<vr>};
+   el.value_field = make_value_field<vr>(data_len);
 
    set_visitor<vr> setter(data);
    el.value_field->accept<vr>(setter);
@@ -636,7 +893,7 @@ elementfield make_elementfield(std::size_t data_len, typename type_of<vr>::type&
    elementfield el;
    el.value_rep = vr;
    el.value_len = data_len;
-   el.value_field = std::unique_ptr<elementfield_base> {new element_field<vr>};
+   el.value_field = make_value_field<vr>(data_len);
 
    set_visitor<vr> setter(std::move(data));
    el.value_field->accept<vr>(setter);
@@ -670,7 +927,7 @@ elementfield make_elementfield(std::size_t data_len, const typename type_of<vr>:
    elementfield el;
    el.value_rep = vr;
    el.value_len = data_len;
-   el.value_field = std::unique_ptr<elementfield_base> {new element_field<vr>};
+   el.value_field = make_value_field<vr>(data_len);
 
    typename type_of<vr>::type wrapper(data);
    set_visitor<vr> setter(wrapper);
@@ -684,16 +941,15 @@ elementfield make_elementfield(std::size_t data_len, const typename type_of<vr>:
 template <VR vr>
 elementfield make_elementfield(std::size_t data_len, const typename type_of<vr>::base_type& data)
 {
-   static_assert(!std::is_same<typename type_of<vr>::type, empty_t>::value, "Cannot construct value field with data for VR of NN");
-   elementfield el;
-   el.value_rep = vr;
-   el.value_len = data_len;
-   el.value_field = std::unique_ptr<elementfield_base> {new element_field<vr>};
-
    typename type_of<vr>::type wrapper(data);
-   set_visitor<vr> setter(wrapper);
-   el.value_field->accept<vr>(setter);
-   return el;
+   return make_elementfield<vr>(data_len, std::move(wrapper));
+}
+
+template <VR vr>
+elementfield make_elementfield(std::size_t data_len, typename type_of<vr>::base_type&& data)
+{
+   typename type_of<vr>::type wrapper(std::move(data));
+   return make_elementfield<vr>(data_len, std::move(wrapper));
 }
 
 
@@ -711,7 +967,7 @@ elementfield make_elementfield(const typename type_of<vr>::base_type data)
    elementfield el;
    el.value_rep = VR::OB;
    el.value_len = byte_length(data);
-   el.value_field = std::unique_ptr<elementfield_base> {new element_field<VR::OB>};
+   el.value_field = make_value_field<VR::OB>(el.value_len);
 
    typename type_of<VR::OB>::type wrapper(data);
    set_visitor<VR::OB> setter(wrapper);
@@ -719,6 +975,19 @@ elementfield make_elementfield(const typename type_of<vr>::base_type data)
    return el;
 }
 
+/**
+ * @brief make_elementfield overload for braced byte lists, ie.
+ *        make_elementfield<VR::OB>({0x00, 0x01}), which would otherwise be
+ *        ambiguous between the variant and the byte vector overloads.
+ * @param data bytes of the value field
+ * @return prepared instance of elementfield
+ */
+template <VR vr, typename = typename type_of<vr>::base_type>
+elementfield make_elementfield(std::initializer_list<unsigned char> data)
+{
+   return make_elementfield<vr>(typename type_of<vr>::base_type(data));
+}
+
 /**
  * @brief make_elementfield overload for attributes that do not have a value
  *        field (like the sequence delimitation item)
@@ -1,6 +1,12 @@
 #include "attribute_field_coder.hpp"
+#include "byte_order.hpp"
 
 #include <type_traits>
+#include <cstdint>
+#include <iterator>
+#include <utility>
+#include <cstring>
+#include <stdexcept>
 
 #include <cstdio>
 
@@ -17,31 +23,23 @@ namespace convhelper
 {
 
 template <typename T>
-static std::vector<unsigned char> integral_to_little_endian(T data, std::size_t size)
+static void append_integral(T data, std::size_t size, ENDIANNESS endianness,
+                            std::vector<unsigned char>& out)
 {
    static_assert(std::is_integral<T>::value, "Integral type expected");
-   std::vector<unsigned char> buf(size);
-
-   for (std::size_t i=0; i<size; ++i) {
-      buf[i] = ((data >> 8*i) & 0xff);
-   }
-
-   return buf;
-}
-
-template <typename T>
-static std::vector<unsigned char> integral_to_big_endian(T data, std::size_t size)
-{
-   static_assert(std::is_integral<T>::value, "Integral type expected");
-   std::vector<unsigned char> buf(size);
-   for (std::size_t i=0; i<size; ++i) {
-      buf[i] = (data >> (8*(size-1-i)) & 0xff);
+   if (endianness == ENDIANNESS::LITTLE) {
+      for (std::size_t i=0; i<size; ++i) {
+         out.push_back((data >> 8*i) & 0xff);
+      }
+   } else {
+      for (std::size_t i=0; i<size; ++i) {
+         out.push_back((data >> (8*(size-1-i))) & 0xff);
+      }
    }
-   return buf;
 }
 
 template <typename T>
-static void little_endian_to_integral(const std::vector<unsigned char>& data
+static void little_endian_to_integral(byte_view data
                                       , std::size_t begin, std::size_t size, T& out)
 {
    static_assert(std::is_integral<T>::value, "Integral type expected");
@@ -52,7 +50,7 @@ static void little_endian_to_integral(const std::vector<unsigned char>& data
 }
 
 template <typename T>
-static void big_endian_to_integral(const std::vector<unsigned char>& data
+static void big_endian_to_integral(byte_view data
                                       , std::size_t begin, std::size_t size, T& out)
 {
    static_assert(std::is_integral<T>::value, "Integral type expected");
@@ -63,185 +61,155 @@ static void big_endian_to_integral(const std::vector<unsigned char>& data
 }
 
 template <typename T>
-static std::vector<unsigned char> float_to_little_endian(T data, std::size_t size)
+static void append_float(T data, ENDIANNESS endianness, std::vector<unsigned char>& out)
 {
    static_assert(std::is_floating_point<T>::value, "Floating type expected");
    static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unexpected floating point size");
-   std::vector<unsigned char> buf(size);
-   unsigned char floatbuf[sizeof(T)];
-   unsigned char* floatbufin = floatbuf;
-   floatbufin = reinterpret_cast<unsigned char*>(&data);
-   for (std::size_t i=0; i<size; ++i) {
-      buf[i] = floatbufin[i];
-   }
-   return buf;
-}
-
-template <typename T>
-static std::vector<unsigned char> float_to_big_endian(T data, std::size_t size)
-{
-   static_assert(std::is_floating_point<T>::value, "Floating type expected");
-   static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unexpected floating point size");
-   std::vector<unsigned char> buf(size);
-   unsigned char floatbuf[sizeof(T)];
-   unsigned char* floatbufin = floatbuf;
-   floatbufin = reinterpret_cast<unsigned char*>(&data);
-   for (std::size_t i=0; i<size; ++i) {
-      buf[size-i-1] = floatbufin[i];
+   // TODO: endianness of current machine
+   auto floatdata = reinterpret_cast<const unsigned char*>(&data);
+   if (endianness == ENDIANNESS::LITTLE) {
+      out.insert(out.end(), floatdata, floatdata + sizeof(T));
+   } else {
+      for (std::size_t i=0; i<sizeof(T); ++i) {
+         out.push_back(floatdata[sizeof(T)-1-i]);
+      }
    }
-   return buf;
 }
 
-template <typename T>
-static void little_endian_to_float(const std::vector<unsigned char>& data
-                                      , std::size_t begin, std::size_t size, T& out)
+/**
+ * @brief byte_string_size returns the size of the encoded multi-valued string,
+ *        including the separators and the padding
+ */
+static std::size_t byte_string_size(const attribute::vmtype<std::string>& str)
 {
-   static_assert(std::is_floating_point<T>::value, "Floating type expected");
-   static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unexpected floating point size");
-   out = 0;
-   unsigned char floatbufout[sizeof(T)] = {0};
-   for (std::size_t i=0; i<size; ++i) {
-      floatbufout[i] |= ((data[begin+i] & 0xff));
+   std::size_t size = str.size() > 0 ? str.size() - 1 : 0;
+   for (auto it = str.cbegin(); it != str.cend(); ++it) {
+      size += (*it).size();
    }
-   out = *reinterpret_cast<T*>(floatbufout);
+   return size + size % 2;
 }
 
-template <typename T>
-static void big_endian_to_float(const std::vector<unsigned char>& data
-                                      , std::size_t begin, std::size_t size, T& out)
+/**
+ * @brief padding_byte returns the byte which pads a string value of the
+ *        given VR to an even length; only UI is padded with a null byte,
+ *        all other string VRs with a space (PS3.5 6.2)
+ */
+static unsigned char padding_byte(VR vr)
 {
-   static_assert(std::is_floating_point<T>::value, "Floating type expected");
-   static_assert(sizeof(T) == 4 || sizeof(T) == 8, "Unexpected floating point size");
-   out = 0;
-   unsigned char floatbufout[sizeof(T)] = {0};
-   for (std::size_t i=0; i<size; ++i) {
-      floatbufout[i] |= ((data[begin+size-1-i] & 0xff));
-   }
-   out = *reinterpret_cast<T*>(floatbufout);
+   return vr == VR::UI ? '\0' : ' ';
 }
 
-static std::vector<unsigned char> encode_byte_string(attribute::vmtype<std::string> str)
+static void append_byte_string(const attribute::vmtype<std::string>& str, VR vr,
+                               std::vector<unsigned char>& out)
 {
-   std::vector<unsigned char> buf;
-   std::size_t offset = 0;
-   for (auto it = str.begin(); it != str.end(); ++it) {
-      std::string value = *it;
-      if (it != str.begin()) { //beginning from the 2nd element, start preceding
-                               //with the separator backslash
-         buf.push_back(0x5c);
-         offset = buf.size();
-      }
-
-      buf.resize(buf.size() + value.size());
-      for (std::size_t i=0; i<value.size(); ++i) {
-         buf[offset + i] = static_cast<unsigned char>(value[i]);
+   // the output is grown once and the values are copied behind each other,
+   // separated by a backslash
+   const std::size_t begin = out.size();
+   out.resize(begin + byte_string_size(str));
+   unsigned char* pos = out.data() + begin;
+   for (auto it = str.cbegin(); it != str.cend(); ++it) {
+      if (it != str.cbegin()) {
+         *pos++ = 0x5c;
       }
+      std::memcpy(pos, it->data(), it->size());
+      pos += it->size();
    }
-   if (buf.size() % 2 != 0) {
-      buf.push_back('\0');
+   if (pos != out.data() + out.size()) {
+      *pos = padding_byte(vr);
    }
-   return buf;
 }
 
-static std::vector<unsigned char> encode_byte_array(const std::vector<unsigned char>& strdata)
+static void append_byte_string(const std::string& str, VR vr, std::vector<unsigned char>& out)
 {
-   return std::vector<unsigned char> {strdata};
+   out.insert(out.end(), str.begin(), str.end());
+   if (str.size() % 2 != 0) {
+      out.push_back(padding_byte(vr));
+   }
 }
 
-
-static std::vector<unsigned char> encode_word_array_le(const std::vector<unsigned short>& strdata)
+static void append_byte_array(const std::vector<unsigned char>& data, std::vector<unsigned char>& out)
 {
-   std::vector<unsigned char> buf;
-   buf.reserve(strdata.size() * 2);
-   for (const auto v : strdata) {
-      buf.push_back((v & 0xff));
-      buf.push_back((v & 0xff00) >> 8);
-   }
-   return buf;
+   out.insert(out.end(), data.begin(), data.end());
 }
 
-static std::vector<unsigned char> encode_word_array_be(const std::vector<unsigned short>& strdata)
+static void append_word_array(const std::vector<unsigned short>& data, ENDIANNESS endianness,
+                              std::vector<unsigned char>& out)
 {
-   std::vector<unsigned char> buf;
-   buf.reserve(strdata.size() * 2);
-   for (const auto v : strdata) {
-      buf.push_back((v & static_cast<unsigned short>(0xff00)) >> 8);
-      buf.push_back(v & static_cast<unsigned short>(0xff));
-   }
-   return buf;
+   const auto offset = out.size();
+   out.resize(offset + data.size() * 2);
+   store_values(data.data(), data.size(), endianness, out.data() + offset);
 }
 
 template <typename FT>
-static std::vector<unsigned char> encode_float_array_le(const std::vector<FT>& strdata)
+static void append_float_array(const std::vector<FT>& data, ENDIANNESS endianness,
+                               std::vector<unsigned char>& out)
 {
    static_assert(std::is_floating_point<FT>::value, "no floating point type");
-   static_assert(sizeof(FT) == 4 || sizeof(FT) == 8, "unexpected size of type");
+   const auto offset = out.size();
+   out.resize(offset + data.size() * sizeof(FT));
+   store_values(data.data(), data.size(), endianness, out.data() + offset);
+}
 
-   // TODO: endianness of current machine
-   auto size = sizeof(FT);
-   std::vector<unsigned char> buf;
-   buf.reserve(strdata.size() * size);
-   for (const auto v : strdata) {
-      auto floatdata = reinterpret_cast<const unsigned char*>(&v);
-      for  (std::size_t i=0; i<size; ++i) {
-         buf.emplace_back(floatdata[i] & static_cast<unsigned char>(0xff));
+template <typename T>
+static void append_integral_values(const vmtype<T>& values, std::size_t size, ENDIANNESS endianness,
+                                   std::vector<unsigned char>& out)
+{
+   if (size == sizeof(T)) {
+      const auto offset = out.size();
+      out.resize(offset + values.size() * size);
+      store_values(values.data(), values.size(), endianness, out.data() + offset);
+   } else {
+      // the in-memory type is wider than the serialized one (SL)
+      for (auto it = values.cbegin(); it != values.cend(); ++it) {
+         append_integral(*it, size, endianness, out);
       }
    }
-   return buf;
 }
 
-template <typename FT>
-static std::vector<unsigned char> encode_float_array_be(const std::vector<FT>& strdata)
+template <typename T>
+static void append_float_values(const vmtype<T>& values, ENDIANNESS endianness,
+                                std::vector<unsigned char>& out)
 {
-   static_assert(std::is_floating_point<FT>::value, "no floating point type");
-   static_assert(sizeof(FT) == 4 || sizeof(FT) == 8, "unexpected size of type");
-
-   // TODO: endianness of current machine
-   auto size = sizeof(FT);
-   std::vector<unsigned char> buf;
-   buf.reserve(strdata.size() * size);
-   for (const auto v : strdata) {
-      auto floatdata = reinterpret_cast<const unsigned char*>(&v);
-      for  (std::size_t i=0; i<size; ++i) {
-         buf.emplace_back(floatdata[size-1-i] & 0xff);
-      }
-   }
-   return buf;
+   const auto offset = out.size();
+   out.resize(offset + values.size() * sizeof(T));
+   store_values(values.data(), values.size(), endianness, out.data() + offset);
 }
 
-static std::vector<unsigned char> encode_tags(const vmtype<tag_type>& tags, ENDIANNESS endianness)
+static void append_tags(const vmtype<tag_type>& tags, ENDIANNESS endianness, std::vector<unsigned char>& out)
 {
-   std::vector<unsigned char> buf;
-   buf.reserve(tags.size() * 4);
    for (auto it = tags.cbegin(); it != tags.cend(); ++it) {
-      auto tag_bytes = encode_tag(*it, endianness);
-      buf.insert(buf.end(), tag_bytes.begin(), tag_bytes.end());
+      encode_tag(*it, endianness, out);
    }
-   assert(buf.size() % 4 == 0);
-   return buf;
 }
 
 
-static attribute::vmtype<std::string> decode_byte_string(const std::vector<unsigned char>& strdata, std::string vm, std::size_t begin, std::size_t len)
+/**
+ * @brief decode_byte_string splits the string at the backslashes and
+ *        removes the insignificant padding of each value.
+ * Each value is constructed directly from the source buffer.
+ * @param strdata buffer holding the value field
+ * @param vr VR of the value field
+ * @param vm value multiplicity of the attribute
+ * @param begin offset of the value field
+ * @param len length of the value field
+ * @return decoded values
+ * @see for_each_string_value()
+ */
+static attribute::vmtype<std::string> decode_byte_string(byte_view strdata, VR vr, std::string vm,
+                                                         std::size_t begin, std::size_t len)
 {
-   std::vector<std::string> strings;
-
-   //std::vector<unsigned char> buf(len);
-   std::vector<unsigned char> buf;
-   for (std::size_t i=begin; i<begin+len; ++i) {
-      if (strdata[i] == 0x5c) {
-         strings.emplace_back(buf.begin(), buf.end());
-         buf.clear();
-         ++i; //skip delimiter
-      }
-
-      buf.push_back(static_cast<unsigned char>(strdata[i]));
-   }
-   strings.emplace_back(buf.begin(), buf.end());
-   return attribute::vmtype<std::string>(vm, strings.begin(), strings.end()); ///todo: change to correct VM
+   // the values are built in place and moved into the field, most strings
+   // have up to four values
+   util::small_vector<std::string, 4> strings;
+   const char* value = reinterpret_cast<const char*>(strdata.data() + begin);
+   for_each_string_value(value, value + len, vr, [&strings](const char* first, const char* last) {
+      strings.emplace_back(first, last);
+   });
+   return attribute::vmtype<std::string>(vm, std::make_move_iterator(strings.begin()),
+                                         std::make_move_iterator(strings.end())); ///todo: change to correct VM
 }
 
-static std::vector<unsigned char> decode_byte_array(const std::vector<unsigned char>& strdata, std::size_t begin, std::size_t len)
+static std::vector<unsigned char> decode_byte_array(byte_view strdata, std::size_t begin, std::size_t len)
 {
    std::vector<unsigned char> str {strdata.begin()+begin, strdata.begin()+begin+len};
    if (len % 2 != 0) {
@@ -251,36 +219,11 @@ static std::vector<unsigned char> decode_byte_array(const std::vector<unsigned c
    return str;
 }
 
-static std::vector<unsigned short> decode_word_array_le(const std::vector<unsigned char>& strdata, std::size_t begin, std::size_t len)
+static std::vector<unsigned short> decode_word_array(byte_view strdata, std::size_t begin, std::size_t len,
+                                                     ENDIANNESS endianness)
 {
-   std::vector<unsigned short> str;
-   str.reserve(len/2);
-
-   for (std::size_t i=begin; i<begin+len; i+=2) {
-      unsigned short value = 0;
-      value |= (strdata[i]);
-      value |= (strdata[i + 1] << 8);
-      str.push_back(value);
-   }
-
-   if (len % 2 != 0) {
-      str.push_back(0x00);
-   }
-   assert(len % 2 == 0);
-   return str;
-}
-
-static std::vector<unsigned short> decode_word_array_be(const std::vector<unsigned char>& strdata, std::size_t begin, std::size_t len)
-{
-   std::vector<unsigned short> str;
-   str.reserve(len/2);
-
-   for (std::size_t i=begin; i<begin+len; i+=2) {
-      unsigned short value = 0;
-      value |= (strdata[i] << 8);
-      value |= (strdata[i + 1]);
-      str.push_back(value);
-   }
+   std::vector<unsigned short> str(len/2);
+   load_values(strdata.data() + begin, str.size(), endianness, str.data());
 
    if (len % 2 != 0) {
       str.push_back(0x00);
@@ -290,46 +233,18 @@ static std::vector<unsigned short> decode_word_array_be(const std::vector<unsign
 }
 
 template <typename FT>
-static std::vector<FT> decode_float_array_le(const std::vector<unsigned char>& strdata, std::size_t begin, std::size_t len)
-{
-   static_assert(std::is_floating_point<FT>::value, "no floating point type");
-   static_assert(sizeof(FT) == 4 || sizeof(FT) == 8, "unexpected size of type");
-
-   auto size = sizeof(FT);
-   std::vector<FT> values;
-   for (std::size_t i=begin; i<begin+len; i += size) {
-      FT value = 0.0;
-      std::array<unsigned char, sizeof(FT)> float_repr;
-      for (std::size_t b=0; b<size; ++b) {
-         float_repr[b] = (strdata[i+b]);
-      }
-      value = *reinterpret_cast<FT*>(&float_repr[0]);
-      values.push_back(value);
-   }
-   return values;
-}
-
-template <typename FT>
-static std::vector<FT> decode_float_array_be(const std::vector<unsigned char>& strdata, std::size_t begin, std::size_t len)
+static std::vector<FT> decode_float_array(byte_view strdata, std::size_t begin, std::size_t len,
+                                          ENDIANNESS endianness)
 {
    static_assert(std::is_floating_point<FT>::value, "no floating point type");
    static_assert(sizeof(FT) == 4 || sizeof(FT) == 8, "unexpected size of type");
 
-   auto size = sizeof(FT);
-   std::vector<FT> values;
-   for (std::size_t i=begin; i<begin+len; i += size) {
-      FT value = 0.0;
-      std::array<unsigned char, sizeof(FT)> float_repr;
-      for (std::size_t b=0; b<size; ++b) {
-         float_repr[b] = (strdata[i+(size-1-b)]);
-      }
-      value = *reinterpret_cast<FT*>(&float_repr[0]);
-      values.push_back(value);
-   }
+   std::vector<FT> values(len / sizeof(FT));
+   load_values(strdata.data() + begin, values.size(), endianness, values.data());
    return values;
 }
 
-static attribute::vmtype<tag_type> decode_tags(const std::vector<unsigned char>& strdata, std::string vm, ENDIANNESS endianness, std::size_t begin, std::size_t len)
+static attribute::vmtype<tag_type> decode_tags(byte_view strdata, std::string vm, ENDIANNESS endianness, std::size_t begin, std::size_t len)
 {
    const std::size_t tag_length = 4;
    std::vector<tag_type> tags;
@@ -345,60 +260,6 @@ static attribute::vmtype<tag_type> decode_tags(const std::vector<unsigned char>&
 
 
 
-/**
- * @brief encode_tag_little_endian converts the element tag into a little endian
- *        representation of 8 bytes
- * @param tag tag to be encoded
- * @return vector of bytes representing the tag in little endian
- */
-std::vector<unsigned char> encode_tag_little_endian(tag_type tag)
-{
-   std::vector<unsigned char> data;
-   auto group_le = convhelper::integral_to_little_endian(tag.group_id, 2);
-   auto elem_le = convhelper::integral_to_little_endian(tag.element_id, 2);
-   data.insert(data.begin(), elem_le.begin(), elem_le.end());
-   data.insert(data.begin(), group_le.begin(), group_le.end());
-   return data;
-}
-
-/**
- * @brief encode_tag_big_endian converts the element tag into a big endian
- *        representation of 8 bytes
- * @param tag tag to be encoded
- * @return vector of bytes representing the tag in big endian
- */
-std::vector<unsigned char> encode_tag_big_endian(tag_type tag)
-{
-   std::vector<unsigned char> data;
-   auto group_le = convhelper::integral_to_big_endian(tag.group_id, 2);
-   auto elem_le = convhelper::integral_to_big_endian(tag.element_id, 2);
-   data.insert(data.begin(), elem_le.begin(), elem_le.end());
-   data.insert(data.begin(), group_le.begin(), group_le.end());
-   return data;
-}
-
-/**
- * @brief encode_len_little_endian converts a length of a value field into
- *        a 4-byte little endian representation.
- * @param len length
- * @return 4 bytes of the parameter length in little endian
- */
-std::vector<unsigned char> encode_len_little_endian(std::size_t lenbytes, std::size_t len)
-{
-   return convhelper::integral_to_little_endian(len, lenbytes);
-}
-
-/**
- * @brief encode_len_big_endian converts a length of a value field into
- *        a 4-byte big endian representation.
- * @param len length
- * @return 4 bytes of the parameter length in big endian
- */
-std::vector<unsigned char> encode_len_big_endian(std::size_t lenbytes, std::size_t len)
-{
-   return convhelper::integral_to_big_endian(len, lenbytes);
-}
-
 /**
  * @brief decode_tag_little_endian transforms the serialized tag data into a
  *        structured form.
@@ -407,7 +268,7 @@ std::vector<unsigned char> encode_len_big_endian(std::size_t lenbytes, std::size
  *        of the value field
  * @return instance of tag_type with the tag elements
  */
-tag_type decode_tag_little_endian(const std::vector<unsigned char>& data, std::size_t begin)
+tag_type decode_tag_little_endian(byte_view data, std::size_t begin)
 {
    unsigned short gid, eid;
    convhelper::little_endian_to_integral(data, begin, 2, gid);
@@ -425,7 +286,7 @@ tag_type decode_tag_little_endian(const std::vector<unsigned char>& data, std::s
  *        of the value field
  * @return instance of tag_type with the tag elements
  */
-tag_type decode_tag_big_endian(const std::vector<unsigned char>& data, std::size_t begin)
+tag_type decode_tag_big_endian(byte_view data, std::size_t begin)
 {
    unsigned short gid, eid;
    convhelper::big_endian_to_integral(data, begin, 2, gid);
@@ -444,7 +305,7 @@ tag_type decode_tag_big_endian(const std::vector<unsigned char>& data, std::size
  *        of the value field
  * @return length specified in the serialized stream data
  */
-std::size_t decode_len_little_endian(const std::vector<unsigned char>& data, std::size_t lenbytes, std::size_t begin)
+std::size_t decode_len_little_endian(byte_view data, std::size_t lenbytes, std::size_t begin)
 {
    std::size_t len;
    convhelper::little_endian_to_integral(data, begin, lenbytes, len);
@@ -459,7 +320,7 @@ std::size_t decode_len_little_endian(const std::vector<unsigned char>& data, std
  *        of the value field
  * @return length specified in the serialized stream data
  */
-std::size_t decode_len_big_endian(const std::vector<unsigned char>& data, std::size_t lenbytes, std::size_t begin)
+std::size_t decode_len_big_endian(byte_view data, std::size_t lenbytes, std::size_t begin)
 {
    std::size_t len;
       convhelper::big_endian_to_integral(data, begin, lenbytes, len);
@@ -467,427 +328,343 @@ std::size_t decode_len_big_endian(const std::vector<unsigned char>& data, std::s
 }
 
 
-template <typename T, typename Fn>
-std::vector<unsigned char> serialize_vmtype(const vmtype<T>& vmdata, Fn&& function, const std::size_t size)
-{
-   auto fn = std::move(function);
-   std::vector<unsigned char> data;
-   data.reserve(size*data.size());
-   for (auto it = vmdata.cbegin(); it != vmdata.cend(); ++it) {
-      const auto& value = *it;
-      auto serdata = fn(value, size);
-      data.insert(data.end(), serdata.begin(), serdata.end());
-   }
-   return data;
-}
-
-template <typename T, typename Fn>
-void deserialize_vmtype(const std::vector<unsigned char>& data, Fn&& function,
+/**
+ * @brief deserialize_vmtype decodes the values of the serialized type W and
+ *        adds them to a multi-valued field
+ * @tparam W serialized type, if it differs from the in-memory type T
+ */
+template <typename T, typename W = T>
+void deserialize_vmtype(byte_view data, ENDIANNESS endianness,
                         const std::size_t begin, const std::size_t len,
-                        const std::size_t size,
                         vmtype<T>& values)
 {
-   auto fn = std::move(function);
-   std::vector<T> vals;
-   vals.reserve(len/sizeof(T));
-   for (std::size_t i=0; i<len; i+=size)
-   {
-      T out;
-      fn(data, begin + i, size, out);
-      vals.emplace_back(std::move(out));
-   }
+   util::small_vector<W, 4> vals;
+   vals.resize(len / sizeof(W));
+   load_values(data.data() + begin, vals.size(), endianness, vals.data());
    values.insert(vals.begin(), vals.end());
 }
 
 
-std::vector<unsigned char> encode_value_field(elementfield attr, ENDIANNESS endianness, const VR vr)
+std::size_t encoded_value_size(const elementfield& attr, const VR vr)
 {
-   std::vector<unsigned char> data;
    switch (vr) {
-      case VR::AE: {
-         attribute::vmtype<std::string> ae;
-         get_value_field<VR::AE>(attr, ae);
-         data = convhelper::encode_byte_string(ae);
-         break;
+      case VR::AE:
+         return convhelper::byte_string_size(get_value_field_ref<VR::AE>(attr));
+      case VR::AS:
+         return convhelper::byte_string_size(get_value_field_ref<VR::AS>(attr));
+      case VR::AT:
+         return get_value_field_ref<VR::AT>(attr).size() * 4;
+      case VR::CS:
+         return convhelper::byte_string_size(get_value_field_ref<VR::CS>(attr));
+      case VR::DA:
+         return convhelper::byte_string_size(get_value_field_ref<VR::DA>(attr));
+      case VR::DS:
+         return convhelper::byte_string_size(get_value_field_ref<VR::DS>(attr));
+      case VR::DT:
+         return convhelper::byte_string_size(get_value_field_ref<VR::DT>(attr));
+      case VR::FL:
+         return get_value_field_ref<VR::FL>(attr).size() * 4;
+      case VR::FD:
+         return get_value_field_ref<VR::FD>(attr).size() * 8;
+      case VR::IS:
+         return convhelper::byte_string_size(get_value_field_ref<VR::IS>(attr));
+      case VR::LO:
+         return convhelper::byte_string_size(get_value_field_ref<VR::LO>(attr));
+      case VR::LT: {
+         auto size = get_value_field_ref<VR::LT>(attr).size();
+         return size + size % 2;
+      }
+      case VR::OB:
+         return boost::get<std::vector<unsigned char>>(get_value_field_ref<VR::OB>(attr)).size();
+      case VR::OD:
+         return get_value_field_ref<VR::OD>(attr).size() * 8;
+      case VR::OF:
+         return get_value_field_ref<VR::OF>(attr).size() * 4;
+      case VR::OW:
+         return get_value_field_ref<VR::OW>(attr).size() * 2;
+      case VR::PN:
+         return convhelper::byte_string_size(get_value_field_ref<VR::PN>(attr));
+      case VR::SH:
+         return convhelper::byte_string_size(get_value_field_ref<VR::SH>(attr));
+      case VR::SL:
+         return get_value_field_ref<VR::SL>(attr).size() * 4;
+      case VR::SS:
+         return get_value_field_ref<VR::SS>(attr).size() * 2;
+      case VR::ST: {
+         auto size = get_value_field_ref<VR::ST>(attr).size();
+         return size + size % 2;
+      }
+      case VR::TM:
+         return convhelper::byte_string_size(get_value_field_ref<VR::TM>(attr));
+      case VR::UI:
+         return convhelper::byte_string_size(get_value_field_ref<VR::UI>(attr));
+      case VR::UL:
+         return get_value_field_ref<VR::UL>(attr).size() * 4;
+      case VR::UN:
+         return get_value_field_ref<VR::UN>(attr).size();
+      case VR::UR:
+         return convhelper::byte_string_size(get_value_field_ref<VR::UR>(attr));
+      case VR::US:
+         return get_value_field_ref<VR::US>(attr).size() * 2;
+      case VR::UT: {
+         auto size = get_value_field_ref<VR::UT>(attr).size();
+         return size + size % 2;
       }
-      case VR::AS: {
-         attribute::vmtype<std::string> as;
-         get_value_field<VR::AS>(attr, as);
-         data = convhelper::encode_byte_string(as);
+      default:
+         // sequences and the item attributes have no value field of their own
+         return 0;
+   }
+}
+
+void encode_value_field(const elementfield& attr, ENDIANNESS endianness, const VR vr,
+                        std::vector<unsigned char>& out)
+{
+   switch (vr) {
+      case VR::AE:
+         convhelper::append_byte_string(get_value_field_ref<VR::AE>(attr), VR::AE, out);
          break;
-      }
-      case VR::AT: {
-         vmtype<tag_type> tags;
-         get_value_field<VR::AT>(attr, tags);
-         data = convhelper::encode_tags(tags, endianness);
+      case VR::AS:
+         convhelper::append_byte_string(get_value_field_ref<VR::AS>(attr), VR::AS, out);
          break;
-      }
-      case VR::CS: {
-         attribute::vmtype<std::string> cs;
-         get_value_field<VR::CS>(attr, cs);
-         data = convhelper::encode_byte_string(cs);
+      case VR::AT:
+         convhelper::append_tags(get_value_field_ref<VR::AT>(attr), endianness, out);
          break;
-      }
-      case VR::DA: {
-         attribute::vmtype<std::string> da;
-         get_value_field<VR::DA>(attr, da);
-         data = convhelper::encode_byte_string(da);
+      case VR::CS:
+         convhelper::append_byte_string(get_value_field_ref<VR::CS>(attr), VR::CS, out);
          break;
-      }
-      case VR::DS: {
-         attribute::vmtype<std::string> ds;
-         get_value_field<VR::DS>(attr, ds);
-         data = convhelper::encode_byte_string(ds);
+      case VR::DA:
+         convhelper::append_byte_string(get_value_field_ref<VR::DA>(attr), VR::DA, out);
          break;
-      }
-      case VR::DT: {
-         attribute::vmtype<std::string> dt;
-         get_value_field<VR::DT>(attr, dt);
-         data = convhelper::encode_byte_string(dt);
+      case VR::DS:
+         convhelper::append_byte_string(get_value_field_ref<VR::DS>(attr), VR::DS, out);
          break;
-      }
-      case VR::FL: {
-         attribute::vmtype<float> fl;
-         get_value_field<VR::FL>(attr, fl);
-         if (endianness == ENDIANNESS::LITTLE) {
-            data = serialize_vmtype(fl, convhelper::float_to_little_endian<float>, 4);
-         } else {
-            data = serialize_vmtype(fl, convhelper::float_to_big_endian<float>, 4);
-         }
+      case VR::DT:
+         convhelper::append_byte_string(get_value_field_ref<VR::DT>(attr), VR::DT, out);
          break;
-      }
-      case VR::FD: {
-         attribute::vmtype<double> fd;
-         get_value_field<VR::FD>(attr, fd);
-         if (endianness == ENDIANNESS::LITTLE) {
-            data = serialize_vmtype(fd, convhelper::float_to_little_endian<double>, 8);
-         } else {
-            data = serialize_vmtype(fd, convhelper::float_to_big_endian<double>, 8);
-         }
+      case VR::FL:
+         convhelper::append_float_values(get_value_field_ref<VR::FL>(attr), endianness, out);
          break;
-      }
-      case VR::IS: {
-         attribute::vmtype<std::string> is;
-         get_value_field<VR::IS>(attr, is);
-         data = convhelper::encode_byte_string(is);
+      case VR::FD:
+         convhelper::append_float_values(get_value_field_ref<VR::FD>(attr), endianness, out);
          break;
-      }
-      case VR::LO: {
-         attribute::vmtype<std::string> lo;
-         get_value_field<VR::LO>(attr, lo);
-         data = convhelper::encode_byte_string(lo);
+      case VR::IS:
+         convhelper::append_byte_string(get_value_field_ref<VR::IS>(attr), VR::IS, out);
          break;
-      }
-      case VR::LT: {
-         std::string lt;
-         get_value_field<VR::LT>(attr, lt);
-         data = convhelper::encode_byte_string(lt);
+      case VR::LO:
+         convhelper::append_byte_string(get_value_field_ref<VR::LO>(attr), VR::LO, out);
+         break;
+      case VR::LT:
+         convhelper::append_byte_string(get_value_field_ref<VR::LT>(attr), VR::LT, out);
          break;
-      }
       case VR::OB: {
-         typename type_of<VR::OB>::type ob;
-         get_value_field<VR::OB>(attr, ob);
-         std::vector<unsigned char> ob_data = boost::get<std::vector<unsigned char>>(ob);
-         data = convhelper::encode_byte_array(ob_data);
+         const auto& ob = get_value_field_ref<VR::OB>(attr);
+         convhelper::append_byte_array(boost::get<std::vector<unsigned char>>(ob), out);
          break;
       }
-      case VR::OD: {
-         std::vector<double> od;
-         get_value_field<VR::OD>(attr, od);
-         if (endianness == ENDIANNESS::LITTLE) {
-             data = convhelper::encode_float_array_le<double>(od);
-         } else {
-             data = convhelper::encode_float_array_be<double>(od);
-         }
+      case VR::OD:
+         convhelper::append_float_array(get_value_field_ref<VR::OD>(attr), endianness, out);
          break;
-      }
-      case VR::OF: {
-         std::vector<float> of;
-         get_value_field<VR::OF>(attr, of);
-         if (endianness == ENDIANNESS::LITTLE) {
-             data = convhelper::encode_float_array_le<float>(of);
-         } else {
-             data = convhelper::encode_float_array_be<float>(of);
-         }
+      case VR::OF:
+         convhelper::append_float_array(get_value_field_ref<VR::OF>(attr), endianness, out);
          break;
-      }
-      case VR::OW: {
-         std::vector<unsigned short> ow;
-         get_value_field<VR::OW>(attr, ow);
-         if (endianness == ENDIANNESS::LITTLE) {
-             data = convhelper::encode_word_array_le(ow);
-         } else {
-             data = convhelper::encode_word_array_be(ow);
-         }
+      case VR::OW:
+         convhelper::append_word_array(get_value_field_ref<VR::OW>(attr), endianness, out);
          break;
-      }
-      case VR::PN: {
-         attribute::vmtype<std::string> pn;
-         get_value_field<VR::PN>(attr, pn);
-         data = convhelper::encode_byte_string(pn);
+      case VR::PN:
+         convhelper::append_byte_string(get_value_field_ref<VR::PN>(attr), VR::PN, out);
          break;
-      }
-      case VR::SH: {
-         attribute::vmtype<std::string> sh;
-         get_value_field<VR::SH>(attr, sh);
-         data = convhelper::encode_byte_string(sh);
+      case VR::SH:
+         convhelper::append_byte_string(get_value_field_ref<VR::SH>(attr), VR::SH, out);
          break;
-      }
-      case VR::SL: {
-         attribute::vmtype<long> sl;
-         get_value_field<VR::SL>(attr, sl);
-         if (endianness == ENDIANNESS::LITTLE) {
-            data = serialize_vmtype(sl, convhelper::integral_to_little_endian<long>, 4);
-         } else {
-            data = serialize_vmtype(sl, convhelper::integral_to_big_endian<long>, 4);
-         }
+      case VR::SL:
+         convhelper::append_integral_values(get_value_field_ref<VR::SL>(attr), 4, endianness, out);
          break;
-      }
-      case VR::SQ: {
-         // do nothing, value field consists of nested attributes which will be
-         // encoded in the next iteration
+      case VR::SQ:
+         // do nothing, value field consists of nested attributes which are
+         // encoded separately
          break;
-      }
-      case VR::SS: {
-         attribute::vmtype<short> ss;
-         get_value_field<VR::SS>(attr, ss);
-         if (endianness == ENDIANNESS::LITTLE) {
-            data = serialize_vmtype(ss, convhelper::integral_to_little_endian<short>, 2);
-         } else {
-            data = serialize_vmtype(ss, convhelper::integral_to_big_endian<short>, 2);
-         }
+      case VR::SS:
+         convhelper::append_integral_values(get_value_field_ref<VR::SS>(attr), 2, endianness, out);
          break;
-      }
-      case VR::ST: {
-         std::string st;
-         get_value_field<VR::ST>(attr, st);
-         data = convhelper::encode_byte_string(st);
+      case VR::ST:
+         convhelper::append_byte_string(get_value_field_ref<VR::ST>(attr), VR::ST, out);
          break;
-      }
-      case VR::TM: {
-         attribute::vmtype<std::string> tm;
-         get_value_field<VR::TM>(attr, tm);
-         data = convhelper::encode_byte_string(tm);
+      case VR::TM:
+         convhelper::append_byte_string(get_value_field_ref<VR::TM>(attr), VR::TM, out);
          break;
-      }
-      case VR::UI: {
-         attribute::vmtype<std::string> ui;
-         get_value_field<VR::UI>(attr, ui);
-         data = convhelper::encode_byte_string(ui);
+      case VR::UI:
+         convhelper::append_byte_string(get_value_field_ref<VR::UI>(attr), VR::UI, out);
          break;
-      }
-      case VR::UL: {
-         attribute::vmtype<unsigned int> ul;
-         get_value_field<VR::UL>(attr, ul);
-         if (endianness == ENDIANNESS::LITTLE) {
-            data = serialize_vmtype(ul, convhelper::integral_to_little_endian<unsigned int>, 4);
-         } else {
-            data = serialize_vmtype(ul, convhelper::integral_to_big_endian<unsigned int>, 4);
-         }
+      case VR::UL:
+         convhelper::append_integral_values(get_value_field_ref<VR::UL>(attr), 4, endianness, out);
          break;
-      }
-      case VR::UN: {
-         std::vector<unsigned char> un;
-         get_value_field<VR::UN>(attr, un);
-         data = convhelper::encode_byte_array(un);
+      case VR::UN:
+         convhelper::append_byte_array(get_value_field_ref<VR::UN>(attr), out);
          break;
-      }
-      case VR::UR: {
-         attribute::vmtype<std::string> ur;
-         get_value_field<VR::UR>(attr, ur);
-         data = convhelper::encode_byte_string(ur);
+      case VR::UR:
+         convhelper::append_byte_string(get_value_field_ref<VR::UR>(attr), VR::UR, out);
          break;
-      }
-      case VR::US: {
-         attribute::vmtype<unsigned short> us;
-         get_value_field<VR::US>(attr, us);
-         if (endianness == ENDIANNESS::LITTLE) {
-            data = serialize_vmtype(us, convhelper::integral_to_little_endian<unsigned short>, 2);
-         } else {
-            data = serialize_vmtype(us, convhelper::integral_to_big_endian<unsigned short>, 2);
-         }
+      case VR::US:
+         convhelper::append_integral_values(get_value_field_ref<VR::US>(attr), 2, endianness, out);
          break;
-      }
-      case VR::UT: {
-         std::string ut;
-         get_value_field<VR::UT>(attr, ut);
-         data = convhelper::encode_byte_string(ut);
+      case VR::UT:
+         convhelper::append_byte_string(get_value_field_ref<VR::UT>(attr), VR::UT, out);
          break;
-      }
       default:
          break;
    }
+}
 
+std::vector<unsigned char> encode_value_field(const elementfield& attr, ENDIANNESS endianness, const VR vr)
+{
+   std::vector<unsigned char> data;
+   data.reserve(encoded_value_size(attr, vr));
+   encode_value_field(attr, endianness, vr, data);
    return data;
 }
 
 
+/**
+ * @brief check_bounds throws if the range of len bytes at begin exceeds the
+ *        serialized data, which happens for truncated or malformed streams
+ */
+static void check_bounds(byte_view data, std::size_t begin, std::size_t len)
+{
+   if (begin > data.size() || len > data.size() - begin) {
+      throw std::runtime_error {"Serialized data ends within a data element"};
+   }
+}
 
-elementfield decode_value_field(const std::vector<unsigned char>& data, ENDIANNESS endianness,
+elementfield decode_value_field(byte_view data, ENDIANNESS endianness,
                                   std::size_t len, VR vr, std::string vm, std::size_t begin)
 {
+   check_bounds(data, begin, len);
    switch (vr) {
       case VR::AE: {
-         auto ae = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::AE>(len, ae);
+         auto ae = convhelper::decode_byte_string(data, VR::AE, vm, begin, len);
+         return make_elementfield<VR::AE>(len, std::move(ae));
       }
       case VR::AS: {
-         auto as = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::AS>(len, as);
+         auto as = convhelper::decode_byte_string(data, VR::AS, vm, begin, len);
+         return make_elementfield<VR::AS>(len, std::move(as));
       }
       case VR::AT: {
          auto at = convhelper::decode_tags(data, vm, endianness, begin, len);
-         return make_elementfield<VR::AT>(len, at);
+         return make_elementfield<VR::AT>(len, std::move(at));
       }
       case VR::CS: {
-         auto cs = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::CS>(len, cs);
+         auto cs = convhelper::decode_byte_string(data, VR::CS, vm, begin, len);
+         return make_elementfield<VR::CS>(len, std::move(cs));
       }
       case VR::DA: {
-         auto da = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::DA>(len, da);
+         auto da = convhelper::decode_byte_string(data, VR::DA, vm, begin, len);
+         return make_elementfield<VR::DA>(len, std::move(da));
       }
       case VR::DS: {
-         auto ds = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::DS>(len, ds);
+         auto ds = convhelper::decode_byte_string(data, VR::DS, vm, begin, len);
+         return make_elementfield<VR::DS>(len, std::move(ds));
       }
       case VR::DT: {
-         auto dt = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::DT>(len, dt);
+         auto dt = convhelper::decode_byte_string(data, VR::DT, vm, begin, len);
+         return make_elementfield<VR::DT>(len, std::move(dt));
       }
       case VR::FL: {
          vmtype<float> fl;
-         if (endianness == ENDIANNESS::LITTLE) {
-            deserialize_vmtype(data, convhelper::little_endian_to_float<float>, begin, len, 4, fl);
-         } else {
-            deserialize_vmtype(data, convhelper::big_endian_to_float<float>, begin, len, 4, fl);
-         }
-         return make_elementfield<VR::FL>(len, fl);
+         deserialize_vmtype(data, endianness, begin, len, fl);
+         return make_elementfield<VR::FL>(len, std::move(fl));
       }
       case VR::FD: {
          vmtype<double> fd;
-         if (endianness == ENDIANNESS::LITTLE) {
-            deserialize_vmtype(data, convhelper::little_endian_to_float<double>, begin, len, 8, fd);
-         } else {
-            deserialize_vmtype(data, convhelper::big_endian_to_float<double>, begin, len, 8, fd);
-         }
-         return make_elementfield<VR::FD>(len, fd);
+         deserialize_vmtype(data, endianness, begin, len, fd);
+         return make_elementfield<VR::FD>(len, std::move(fd));
       }
       case VR::IS: {
-         auto is = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::IS>(len, is);
+         auto is = convhelper::decode_byte_string(data, VR::IS, vm, begin, len);
+         return make_elementfield<VR::IS>(len, std::move(is));
       }
       case VR::LO: {
-         auto lo = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::LO>(len, lo);
+         auto lo = convhelper::decode_byte_string(data, VR::LO, vm, begin, len);
+         return make_elementfield<VR::LO>(len, std::move(lo));
       }
       case VR::LT: {
-         auto lt = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::LT>(len, lt);
+         auto lt = convhelper::decode_byte_string(data, VR::LT, vm, begin, len);
+         return make_elementfield<VR::LT>(len, std::move(lt));
       }
       case VR::OB: {
          std::vector<unsigned char> ob;
          ob = convhelper::decode_byte_array(data, begin, len);
-         return make_elementfield<VR::OB>(len, ob);
+         return make_elementfield<VR::OB>(len, std::move(ob));
       }
       case VR::OD: {
          std::vector<double> od;
-         if (endianness == ENDIANNESS::LITTLE) {
-             od = convhelper::decode_float_array_le<double>(data, begin, len);
-         } else {
-             od = convhelper::decode_float_array_be<double>(data, begin, len);
-         }
-         return make_elementfield<VR::OD>(len, od);
+         od = convhelper::decode_float_array<double>(data, begin, len, endianness);
+         return make_elementfield<VR::OD>(len, std::move(od));
       }
       case VR::OF: {
          std::vector<float> of;
-         if (endianness == ENDIANNESS::LITTLE) {
-             of = convhelper::decode_float_array_le<float>(data, begin, len);
-         } else {
-             of = convhelper::decode_float_array_be<float>(data, begin, len);
-         }
-         return make_elementfield<VR::OF>(len, of);
+         of = convhelper::decode_float_array<float>(data, begin, len, endianness);
+         return make_elementfield<VR::OF>(len, std::move(of));
       }
       case VR::OW: {
          std::vector<unsigned short> ow;
-         if (endianness == ENDIANNESS::LITTLE) {
-             ow = convhelper::decode_word_array_le(data, begin, len);
-         } else {
-             ow = convhelper::decode_word_array_be(data, begin, len);
-         }
-         return make_elementfield<VR::OW>(len, ow);
+         ow = convhelper::decode_word_array(data, begin, len, endianness);
+         return make_elementfield<VR::OW>(len, std::move(ow));
       }
       case VR::PN: {
-         auto pn = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::PN>(len, pn);
+         auto pn = convhelper::decode_byte_string(data, VR::PN, vm, begin, len);
+         return make_elementfield<VR::PN>(len, std::move(pn));
       }
       case VR::SH: {
-         auto sh = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::SH>(len, sh);
+         auto sh = convhelper::decode_byte_string(data, VR::SH, vm, begin, len);
+         return make_elementfield<VR::SH>(len, std::move(sh));
       }
       case VR::SL: {
          vmtype<long> sl;
-         if (endianness == ENDIANNESS::LITTLE) {
-            deserialize_vmtype(data, convhelper::little_endian_to_integral<long>, begin, len, 4, sl);
-         } else {
-            deserialize_vmtype(data, convhelper::big_endian_to_integral<long>, begin, len, 4, sl);
-         }
-         return make_elementfield<VR::SL>(len, sl);
+         deserialize_vmtype<long, std::int32_t>(data, endianness, begin, len, sl);
+         return make_elementfield<VR::SL>(len, std::move(sl));
       }
       case VR::SQ: {
          break;
       }
       case VR::SS: {
          vmtype<short> ss;
-         if (endianness == ENDIANNESS::LITTLE) {
-            deserialize_vmtype(data, convhelper::little_endian_to_integral<short>, begin, len, 2, ss);
-         } else {
-            deserialize_vmtype(data, convhelper::big_endian_to_integral<short>, begin, len, 2, ss);
-         }
-         return make_elementfield<VR::SS>(len, ss);
+         deserialize_vmtype(data, endianness, begin, len, ss);
+         return make_elementfield<VR::SS>(len, std::move(ss));
       }
       case VR::ST: {
-         auto st = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::ST>(len, st);
+         auto st = convhelper::decode_byte_string(data, VR::ST, vm, begin, len);
+         return make_elementfield<VR::ST>(len, std::move(st));
       }
       case VR::TM: {
-         auto tm = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::TM>(len, tm);
+         auto tm = convhelper::decode_byte_string(data, VR::TM, vm, begin, len);
+         return make_elementfield<VR::TM>(len, std::move(tm));
       }
       case VR::UL: {
          vmtype<unsigned int> ul;
-         if (endianness == ENDIANNESS::LITTLE) {
-            deserialize_vmtype(data, convhelper::little_endian_to_integral<unsigned int>, begin, len, 4, ul);
-         } else {
-            deserialize_vmtype(data, convhelper::big_endian_to_integral<unsigned int>, begin, len, 4, ul);
-         }
-         return make_elementfield<VR::UL>(len, ul);
+         deserialize_vmtype(data, endianness, begin, len, ul);
+         return make_elementfield<VR::UL>(len, std::move(ul));
       }
       case VR::UI: {
-         auto ui = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::UI>(len, ui);
+         auto ui = convhelper::decode_byte_string(data, VR::UI, vm, begin, len);
+         return make_elementfield<VR::UI>(len, std::move(ui));
       }
       case VR::UR: {
-         auto ur = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::UR>(len, ur);
+         auto ur = convhelper::decode_byte_string(data, VR::UR, vm, begin, len);
+         return make_elementfield<VR::UR>(len, std::move(ur));
       }
       case VR::US: {
          vmtype<unsigned short> us;
-         if (endianness == ENDIANNESS::LITTLE) {
-            deserialize_vmtype(data, convhelper::little_endian_to_integral<unsigned short>, begin, len, 2, us);
-         } else {
-            deserialize_vmtype(data, convhelper::big_endian_to_integral<unsigned short>, begin, len, 2, us);
-         }
-         return make_elementfield<VR::US>(len, us);
+         deserialize_vmtype(data, endianness, begin, len, us);
+         return make_elementfield<VR::US>(len, std::move(us));
       }
       case VR::UT: {
-         auto ut = convhelper::decode_byte_string(data, vm, begin, len);
-         return make_elementfield<VR::UT>(len, ut);
+         auto ut = convhelper::decode_byte_string(data, VR::UT, vm, begin, len);
+         return make_elementfield<VR::UT>(len, std::move(ut));
       }
       case VR::UN: {
          std::vector<unsigned char> un;
          un = convhelper::decode_byte_array(data, begin, len);
-         return make_elementfield<VR::UN>(len, un);
+         return make_elementfield<VR::UN>(len, std::move(un));
       }
       default:
          assert(false);
@@ -896,26 +673,36 @@ elementfield decode_value_field(const std::vector<unsigned char>& data, ENDIANNE
    assert(false);
 }
 
+void encode_tag(tag_type tag, ENDIANNESS endianness, std::vector<unsigned char>& out)
+{
+   convhelper::append_integral(tag.group_id, 2, endianness, out);
+   convhelper::append_integral(tag.element_id, 2, endianness, out);
+}
+
 std::vector<unsigned char> encode_tag(tag_type tag, ENDIANNESS endianness)
 {
-   if (endianness == ENDIANNESS::LITTLE) {
-      return encode_tag_little_endian(tag);
-   } else {
-      return encode_tag_big_endian(tag);
-   }
+   std::vector<unsigned char> data;
+   data.reserve(4);
+   encode_tag(tag, endianness, data);
+   return data;
+}
+
+void encode_len(std::size_t lenbytes, std::size_t len, ENDIANNESS endianness, std::vector<unsigned char>& out)
+{
+   convhelper::append_integral(len, lenbytes, endianness, out);
 }
 
 std::vector<unsigned char> encode_len(std::size_t lenbytes, std::size_t len, ENDIANNESS endianness)
 {
-   if (endianness == ENDIANNESS::LITTLE) {
-      return encode_len_little_endian(lenbytes, len);
-   } else {
-      return encode_len_big_endian(lenbytes, len);
-   }
+   std::vector<unsigned char> data;
+   data.reserve(lenbytes);
+   encode_len(lenbytes, len, endianness, data);
+   return data;
 }
 
-tag_type decode_tag(const std::vector<unsigned char>& data, std::size_t begin, ENDIANNESS endianness)
+tag_type decode_tag(byte_view data, std::size_t begin, ENDIANNESS endianness)
 {
+   check_bounds(data, begin, 4);
    if (endianness == ENDIANNESS::LITTLE) {
       return decode_tag_little_endian(data, begin);
    } else {
@@ -923,8 +710,9 @@ tag_type decode_tag(const std::vector<unsigned char>& data, std::size_t begin, E
    }
 }
 
-std::size_t decode_len(const std::vector<unsigned char>& data, ENDIANNESS endianness, std::size_t lenbytes, std::size_t begin)
+std::size_t decode_len(byte_view data, ENDIANNESS endianness, std::size_t lenbytes, std::size_t begin)
 {
+   check_bounds(data, begin, lenbytes);
    if (endianness == ENDIANNESS::LITTLE) {
       return decode_len_little_endian(data, lenbytes, begin);
    } else {
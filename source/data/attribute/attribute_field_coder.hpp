@@ -2,9 +2,11 @@
 #define ATTRIBUTE_FIELD_CODER_HPP
 
 #include <vector>
+#include <cstring>
 
 #include "data/dataset/datasets.hpp"
 #include "data/attribute/attribute.hpp"
+#include "data/attribute/byte_view.hpp"
 
 namespace dicom
 {
@@ -22,7 +24,27 @@ namespace attribute
  * @param vr VR of given attribute
  * @return vector of bytes representing the attribute
  */
-std::vector<unsigned char> encode_value_field(elementfield attr, ENDIANNESS endianness, const VR vr);
+std::vector<unsigned char> encode_value_field(const elementfield& attr, ENDIANNESS endianness, const VR vr);
+
+/**
+ * @brief encode_value_field overload which appends the serialized
+ *        representation to an existing buffer instead of returning a new one.
+ * @param attr attribute to be encoded
+ * @param endianness endiannes of the to-be-encoded data
+ * @param vr VR of given attribute
+ * @param[out] out buffer the encoded bytes are appended to
+ */
+void encode_value_field(const elementfield& attr, ENDIANNESS endianness, const VR vr,
+                        std::vector<unsigned char>& out);
+
+/**
+ * @brief encoded_value_size returns the number of bytes encode_value_field()
+ *        produces for the attribute, without encoding it.
+ * @param attr attribute to be measured
+ * @param vr VR of given attribute
+ * @return size of the encoded value field, including padding
+ */
+std::size_t encoded_value_size(const elementfield& attr, const VR vr);
 
 /**
  * @brief decode_value_field converts a serialized attribute into a structured
@@ -39,7 +61,63 @@ std::vector<unsigned char> encode_value_field(elementfield attr, ENDIANNESS endi
  * as a parameter, parses the respective value field, and returns an instance of
  * elementfield which contains all the data.
  */
-elementfield decode_value_field(const std::vector<unsigned char>& data, ENDIANNESS endianness, std::size_t len, VR vr, std::string vm, std::size_t begin);
+elementfield decode_value_field(byte_view data, ENDIANNESS endianness, std::size_t len, VR vr, std::string vm, std::size_t begin);
+
+/**
+ * @brief is_multi_valued returns false for the string VRs whose value may
+ *        contain backslashes, because it is never split into several values
+ */
+inline bool is_multi_valued(VR vr)
+{
+   return vr != VR::LT && vr != VR::ST && vr != VR::UT && vr != VR::UR;
+}
+
+/**
+ * @brief trims_leading_spaces returns true for the string VRs whose leading
+ *        spaces are insignificant
+ */
+inline bool trims_leading_spaces(VR vr)
+{
+   return vr == VR::AE || vr == VR::CS || vr == VR::DS || vr == VR::IS
+         || vr == VR::LO || vr == VR::SH;
+}
+
+/**
+ * @brief for_each_string_value splits a serialized string value field at the
+ *        backslashes and removes the insignificant padding of each value,
+ *        like decode_value_field() does.
+ * The delimiters are located with memchr(), which scans several bytes at once.
+ * Trailing spaces and null bytes are removed from the values of all string
+ * VRs, leading spaces from those selected by trims_leading_spaces().
+ * @param value first byte of the value field
+ * @param end end of the value field
+ * @param vr VR of the value field
+ * @param f callable invoked with the bounds (first, last) of each value
+ */
+template <typename F>
+void for_each_string_value(const char* value, const char* end, VR vr, F&& f)
+{
+   const bool split = is_multi_valued(vr);
+   const bool trim_leading = trims_leading_spaces(vr);
+   while (true) {
+      const char* delimiter = split
+            ? static_cast<const char*>(std::memchr(value, 0x5c, end - value))
+            : nullptr;
+      const char* first = value;
+      const char* last = delimiter != nullptr ? delimiter : end;
+      while (last != first && (last[-1] == ' ' || last[-1] == '\0')) {
+         --last;
+      }
+      while (trim_leading && first != last && *first == ' ') {
+         ++first;
+      }
+      f(first, last);
+      if (delimiter == nullptr) {
+         break;
+      }
+      value = delimiter + 1;
+   }
+}
 
 
 /**
@@ -51,6 +129,11 @@ elementfield decode_value_field(const std::vector<unsigned char>& data, ENDIANNE
  */
 std::vector<unsigned char> encode_tag(tag_type tag, ENDIANNESS endianness);
 
+/**
+ * @brief encode_tag overload which appends the serialized tag to out
+ */
+void encode_tag(tag_type tag, ENDIANNESS endianness, std::vector<unsigned char>& out);
+
 /**
  * @brief encode_len converts a length of a value field into a 4-byte serialized
  *        representation.
@@ -61,6 +144,11 @@ std::vector<unsigned char> encode_tag(tag_type tag, ENDIANNESS endianness);
  */
 std::vector<unsigned char> encode_len(std::size_t lenbytes, std::size_t len, ENDIANNESS endianness);
 
+/**
+ * @brief encode_len overload which appends the serialized length to out
+ */
+void encode_len(std::size_t lenbytes, std::size_t len, ENDIANNESS endianness, std::vector<unsigned char>& out);
+
 /**
  * @brief decode_tag transforms the serialized tag data into a structured form.
  * @param data serialized stream data
@@ -69,7 +157,7 @@ std::vector<unsigned char> encode_len(std::size_t lenbytes, std::size_t len, END
  * @param endianness of the encoded data
  * @return instance of tag_type with the tag elements
  */
-tag_type decode_tag(const std::vector<unsigned char>& data, std::size_t begin, ENDIANNESS endianness);
+tag_type decode_tag(byte_view data, std::size_t begin, ENDIANNESS endianness);
 
 /**
  * @brief decode_len transforms the serialized length data into a structured
@@ -81,7 +169,7 @@ tag_type decode_tag(const std::vector<unsigned char>& data, std::size_t begin, E
  *        of the value field
  * @return length specified in the serialized stream data
  */
-std::size_t decode_len(const std::vector<unsigned char>& data, ENDIANNESS endianness, std::size_t lenbytes, std::size_t begin);
+std::size_t decode_len(byte_view data, ENDIANNESS endianness, std::size_t lenbytes, std::size_t begin);
 
 
 
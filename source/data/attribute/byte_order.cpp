@@ -0,0 +1,131 @@
+#include "byte_order.hpp"
+
+#include <cassert>
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__SSSE3__)
+#include <tmmintrin.h>
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace attribute
+{
+
+template <std::size_t width>
+static void swap_scalar(const unsigned char* in, unsigned char* out, std::size_t count)
+{
+   for (std::size_t i=0; i<count; ++i) {
+      unsigned char value[width];
+      for (std::size_t b=0; b<width; ++b) {
+         value[b] = in[width-1-b];
+      }
+      std::memcpy(out, value, width);
+      in += width;
+      out += width;
+   }
+}
+
+#if defined(__SSSE3__) || defined(__AVX2__)
+
+/**
+ * @brief shuffle_mask returns the byte permutation reversing each value of
+ *        the given width in a 16 byte lane
+ */
+static __m128i shuffle_mask(std::size_t width)
+{
+   switch (width) {
+      case 2:
+         return _mm_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+      case 4:
+         return _mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+      default:
+         return _mm_setr_epi8(7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8);
+   }
+}
+
+/**
+ * @brief swap_vectorized swaps as many whole 16 (or 32) byte blocks as
+ *        possible and returns the number of processed bytes.
+ */
+static std::size_t swap_vectorized(const unsigned char* in, unsigned char* out,
+                                   std::size_t size, std::size_t width)
+{
+   std::size_t pos = 0;
+   const __m128i mask = shuffle_mask(width);
+#if defined(__AVX2__)
+   const __m256i mask256 = _mm256_broadcastsi128_si256(mask);
+   for (; pos + 32 <= size; pos += 32) {
+      __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + pos));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + pos), _mm256_shuffle_epi8(v, mask256));
+   }
+#endif
+   for (; pos + 16 <= size; pos += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos), _mm_shuffle_epi8(v, mask));
+   }
+   return pos;
+}
+
+#elif defined(__SSE2__)
+
+static std::size_t swap_vectorized(const unsigned char* in, unsigned char* out,
+                                   std::size_t size, std::size_t width)
+{
+   std::size_t pos = 0;
+   for (; pos + 16 <= size; pos += 16) {
+      __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos));
+      // reverse the order of the 16 bit words within each value, then swap
+      // the bytes of each word
+      if (width == 4) {
+         v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xb1), 0xb1);
+      } else if (width == 8) {
+         v = _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0x1b), 0x1b);
+      }
+      v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+      _mm_storeu_si128(reinterpret_cast<__m128i*>(out + pos), v);
+   }
+   return pos;
+}
+
+#else
+
+static std::size_t swap_vectorized(const unsigned char*, unsigned char*, std::size_t, std::size_t)
+{
+   return 0;
+}
+
+#endif
+
+void swap_bytes(const unsigned char* in, unsigned char* out, std::size_t count, std::size_t width)
+{
+   assert(width == 2 || width == 4 || width == 8);
+   const std::size_t size = count * width;
+   // blocks are multiples of the width, so the remainder consists of whole values
+   const std::size_t done = swap_vectorized(in, out, size, width);
+   const std::size_t remaining = (size - done) / width;
+   switch (width) {
+      case 2:
+         swap_scalar<2>(in + done, out + done, remaining);
+         break;
+      case 4:
+         swap_scalar<4>(in + done, out + done, remaining);
+         break;
+      default:
+         swap_scalar<8>(in + done, out + done, remaining);
+         break;
+   }
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,93 @@
+#ifndef BYTE_ORDER_HPP
+#define BYTE_ORDER_HPP
+
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#include "attribute.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace attribute
+{
+
+/**
+ * @brief host_endianness returns the byte order of the machine the library
+ *        was compiled for.
+ * @return endianness of the host
+ */
+constexpr ENDIANNESS host_endianness()
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+   return ENDIANNESS::BIG;
+#else
+   return ENDIANNESS::LITTLE;
+#endif
+}
+
+/**
+ * @brief swap_bytes copies count values of width bytes each from in to out
+ *        and reverses the byte order of every value.
+ * Depending on the instruction sets enabled at compile time, AVX2, SSSE3 or
+ * SSE2 shuffles are used for the bulk of the data, with a scalar loop for the
+ * remainder. in and out may point to the same memory, but must not overlap
+ * otherwise.
+ * @param in values to be swapped
+ * @param out destination of the swapped values
+ * @param count number of values
+ * @param width size of a value in bytes, either 2, 4 or 8
+ */
+void swap_bytes(const unsigned char* in, unsigned char* out, std::size_t count, std::size_t width);
+
+/**
+ * @brief store_values writes the values with the given byte order into out.
+ *        For a matching byte order this amounts to a memcpy().
+ * @param values values to be written
+ * @param count number of values
+ * @param endianness byte order of the output
+ * @param out destination of at least count * sizeof(T) bytes
+ */
+template <typename T>
+void store_values(const T* values, std::size_t count, ENDIANNESS endianness, unsigned char* out)
+{
+   static_assert(std::is_arithmetic<T>::value, "Arithmetic type expected");
+   const auto bytes = reinterpret_cast<const unsigned char*>(values);
+   if (sizeof(T) == 1 || endianness == host_endianness()) {
+      std::memcpy(out, bytes, count * sizeof(T));
+   } else {
+      swap_bytes(bytes, out, count, sizeof(T));
+   }
+}
+
+/**
+ * @brief load_values reads count values with the given byte order from in.
+ *        For a matching byte order this amounts to a memcpy().
+ * @param in serialized values of at least count * sizeof(T) bytes
+ * @param count number of values
+ * @param endianness byte order of the input
+ * @param values destination of the values
+ */
+template <typename T>
+void load_values(const unsigned char* in, std::size_t count, ENDIANNESS endianness, T* values)
+{
+   static_assert(std::is_arithmetic<T>::value, "Arithmetic type expected");
+   const auto bytes = reinterpret_cast<unsigned char*>(values);
+   if (sizeof(T) == 1 || endianness == host_endianness()) {
+      std::memcpy(bytes, in, count * sizeof(T));
+   } else {
+      swap_bytes(in, bytes, count, sizeof(T));
+   }
+}
+
+}
+
+}
+
+}
+
+#endif // BYTE_ORDER_HPP
@@ -0,0 +1,89 @@
+#ifndef BYTE_VIEW_HPP
+#define BYTE_VIEW_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cassert>
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace attribute
+{
+
+/**
+ * @brief The byte_view class is a non-owning, read-only view on a contiguous
+ *        range of serialized bytes.
+ * It is used by the decoding functions and the transfer processors to parse
+ * serialized data in place, without copying it into an intermediate buffer
+ * first. The viewed memory must outlive the view.
+ */
+class byte_view
+{
+   public:
+      using value_type = unsigned char;
+      using const_iterator = const unsigned char*;
+
+      byte_view():
+         data_ {nullptr},
+         size_ {0}
+      {
+      }
+
+      byte_view(const unsigned char* data, std::size_t size):
+         data_ {data},
+         size_ {size}
+      {
+      }
+
+      /**
+       * @brief byte_view implicitly views the content of a vector, so
+       *        existing callers passing vectors continue to work.
+       * @param data vector to be viewed
+       */
+      byte_view(const std::vector<unsigned char>& data):
+         data_ {data.data()},
+         size_ {data.size()}
+      {
+      }
+
+      const unsigned char* data() const { return data_; }
+      std::size_t size() const { return size_; }
+      bool empty() const { return size_ == 0; }
+
+      const_iterator begin() const { return data_; }
+      const_iterator end() const { return data_ + size_; }
+
+      const unsigned char& operator[](std::size_t pos) const
+      {
+         return data_[pos];
+      }
+
+      /**
+       * @brief subview returns a view on the half-open range
+       *        [pos, pos+len) of this view.
+       * @param pos offset of the first byte
+       * @param len number of bytes
+       * @return view on the subrange
+       */
+      byte_view subview(std::size_t pos, std::size_t len) const
+      {
+         assert(pos + len <= size_);
+         return byte_view {data_ + pos, len};
+      }
+
+   private:
+      const unsigned char* data_;
+      std::size_t size_;
+};
+
+}
+
+}
+
+}
+
+#endif // BYTE_VIEW_HPP
@@ -0,0 +1,203 @@
+#include "intern_pool.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <stdexcept>
+
+#include "attribute_field_coder.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace attribute
+{
+
+namespace
+{
+
+// per shard
+const std::size_t min_purge = 64;
+
+template <VR vr>
+elementfield share(std::shared_ptr<elementfield_base> value, std::size_t len)
+{
+   elementfield el;
+   el.value_rep = vr;
+   el.value_len = len;
+   el.value_field = std::unique_ptr<elementfield_base> {
+         new shared_element_field<vr> {std::static_pointer_cast<element_field<vr>>(value), true}};
+   return el;
+}
+
+elementfield share(VR vr, std::shared_ptr<elementfield_base> value, std::size_t len)
+{
+   switch (vr) {
+      case VR::AE: return share<VR::AE>(value, len);
+      case VR::AS: return share<VR::AS>(value, len);
+      case VR::CS: return share<VR::CS>(value, len);
+      case VR::DA: return share<VR::DA>(value, len);
+      case VR::DS: return share<VR::DS>(value, len);
+      case VR::DT: return share<VR::DT>(value, len);
+      case VR::IS: return share<VR::IS>(value, len);
+      case VR::LO: return share<VR::LO>(value, len);
+      case VR::PN: return share<VR::PN>(value, len);
+      case VR::SH: return share<VR::SH>(value, len);
+      case VR::TM: return share<VR::TM>(value, len);
+      case VR::UI: return share<VR::UI>(value, len);
+      default:
+         throw std::runtime_error {"values of this VR are not interned"};
+   }
+}
+
+template <VR vr>
+const vmtype<std::string>* strings_of(const elementfield_base& value)
+{
+   return &static_cast<const element_field<vr>&>(value).value_field;
+}
+
+const vmtype<std::string>* strings_of(VR vr, const elementfield_base& value)
+{
+   switch (vr) {
+      case VR::AE: return strings_of<VR::AE>(value);
+      case VR::AS: return strings_of<VR::AS>(value);
+      case VR::CS: return strings_of<VR::CS>(value);
+      case VR::DA: return strings_of<VR::DA>(value);
+      case VR::DS: return strings_of<VR::DS>(value);
+      case VR::DT: return strings_of<VR::DT>(value);
+      case VR::IS: return strings_of<VR::IS>(value);
+      case VR::LO: return strings_of<VR::LO>(value);
+      case VR::PN: return strings_of<VR::PN>(value);
+      case VR::SH: return strings_of<VR::SH>(value);
+      case VR::TM: return strings_of<VR::TM>(value);
+      case VR::UI: return strings_of<VR::UI>(value);
+      default:
+         throw std::runtime_error {"values of this VR are not interned"};
+   }
+}
+
+/**
+ * @brief hash_values computes the FNV-1a hash of the VR and the values of
+ *        the value field, without their padding
+ */
+std::size_t hash_values(VR vr, const char* first, const char* last)
+{
+   std::uint64_t hash = 14695981039346656037ull;
+   auto add = [&hash](unsigned char byte) {
+      hash = (hash ^ byte) * 1099511628211ull;
+   };
+   add(static_cast<unsigned char>(vr));
+   for_each_string_value(first, last, vr, [&add](const char* value, const char* end) {
+      for (; value != end; ++value) {
+         add(static_cast<unsigned char>(*value));
+      }
+      // the delimiter separates the values, so "A\\B" and "AB" differ
+      add('\\');
+   });
+   return static_cast<std::size_t>(hash ^ (hash >> 32));
+}
+
+/**
+ * @brief equals compares the pooled strings with the values of the value
+ *        field, without their padding
+ */
+bool equals(const vmtype<std::string>& strings, VR vr, const char* first, const char* last)
+{
+   auto it = strings.cbegin();
+   bool equal = true;
+   std::size_t count = 0;
+   for_each_string_value(first, last, vr, [&](const char* value, const char* end) {
+      ++count;
+      if (!equal || count > strings.size()) {
+         equal = false;
+         return;
+      }
+      const std::size_t len = static_cast<std::size_t>(end - value);
+      equal = it->size() == len && std::equal(value, end, it->begin());
+      ++it;
+   });
+   return equal && count == strings.size();
+}
+
+}
+
+intern_pool::intern_pool()
+{
+   for (auto& s : shards) {
+      s.purge_at = min_purge;
+   }
+}
+
+bool intern_pool::interns(VR vr)
+{
+   switch (vr) {
+      case VR::AE: case VR::AS: case VR::CS: case VR::DA:
+      case VR::DS: case VR::DT: case VR::IS: case VR::LO:
+      case VR::PN: case VR::SH: case VR::TM: case VR::UI:
+         return true;
+      default:
+         return false;
+   }
+}
+
+elementfield intern_pool::intern(VR vr, byte_view data)
+{
+   const char* first = reinterpret_cast<const char*>(data.data());
+   const char* last = first + data.size();
+   const std::size_t hash = hash_values(vr, first, last);
+   shard& s = shards[(hash >> 8) % shard_count];
+
+   std::shared_ptr<elementfield_base> value;
+   {
+      std::lock_guard<std::mutex> guard {s.lock};
+      auto candidates = s.values.equal_range(hash);
+      for (auto it = candidates.first; it != candidates.second && !value; ++it) {
+         if (it->second.vr != vr) {
+            continue;
+         }
+         auto pooled = it->second.value.lock();
+         if (pooled && equals(*it->second.strings, vr, first, last)) {
+            value = std::move(pooled);
+         }
+      }
+      if (!value) {
+         value = std::move(decode_value_field(data, ENDIANNESS::LITTLE, data.size(), vr, "*", 0).value_field);
+         s.values.emplace(hash, entry {vr, value, strings_of(vr, *value)});
+         if (s.values.size() >= s.purge_at) {
+            s.purge();
+         }
+      }
+   }
+   return share(vr, std::move(value), data.size());
+}
+
+std::size_t intern_pool::size()
+{
+   std::size_t size = 0;
+   for (auto& s : shards) {
+      std::lock_guard<std::mutex> guard {s.lock};
+      s.purge();
+      size += s.values.size();
+   }
+   return size;
+}
+
+void intern_pool::shard::purge()
+{
+   for (auto it = values.begin(); it != values.end(); ) {
+      if (it->second.value.expired()) {
+         it = values.erase(it);
+      } else {
+         ++it;
+      }
+   }
+   purge_at = std::max(2*values.size(), min_purge);
+}
+
+}
+
+}
+
+}
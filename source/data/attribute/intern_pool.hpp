@@ -0,0 +1,99 @@
+#ifndef INTERN_POOL_HPP
+#define INTERN_POOL_HPP
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "attribute.hpp"
+#include "byte_view.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace attribute
+{
+
+/**
+ * @brief The intern_pool class stores each distinct value of the short string
+ *        VRs once, shared by all attributes having that value.
+ * Within a study most of these values repeat, like the study and series
+ * instance UIDs, SOP class UIDs, modalities or AE titles. An attribute taken
+ * from the pool only holds a reference to the pooled value. The value is
+ * released when the last attribute referencing it is destroyed, and copied
+ * when an attribute is modified, so the pooled value never changes.
+ * The pool may be shared by several transfer processors and is thread-safe.
+ * The values are spread over shards by the hash of their contents, each
+ * guarded by its own lock, so concurrent readers seldom wait for each other.
+ * A shard indexes the values by that hash and compares the candidates with
+ * the pooled value itself, so the value is not stored a second time as key.
+ */
+class intern_pool
+{
+   public:
+      intern_pool();
+
+      intern_pool(const intern_pool&) = delete;
+      intern_pool& operator=(const intern_pool&) = delete;
+
+      /**
+       * @brief interns returns true for the VRs whose values are pooled:
+       *        AE, AS, CS, DA, DS, DT, IS, LO, PN, SH, TM and UI
+       */
+      static bool interns(VR vr);
+
+      /**
+       * @brief intern returns an attribute with the value of the serialized
+       *        value field, which is decoded only if the pool does not hold
+       *        it yet. Value fields which only differ in their padding share
+       *        the pooled value.
+       * @param vr VR of the value field, one selected by interns()
+       * @param data serialized value field
+       * @return attribute referencing the pooled value
+       */
+      elementfield intern(VR vr, byte_view data);
+
+      /**
+       * @brief size returns the number of distinct values held by the pool
+       */
+      std::size_t size();
+
+   private:
+      struct entry
+      {
+            VR vr;
+            std::weak_ptr<elementfield_base> value;
+
+            // strings of the value, only accessed while value is locked
+            const vmtype<std::string>* strings;
+      };
+
+      struct shard
+      {
+            std::mutex lock;
+
+            // keyed by the hash of the VR and the values
+            std::unordered_multimap<std::size_t, entry> values;
+
+            // number of entries at which the released values are removed next
+            std::size_t purge_at;
+
+            void purge();
+      };
+
+      static const std::size_t shard_count = 16;
+      shard shards[shard_count];
+};
+
+}
+
+}
+
+}
+
+#endif // INTERN_POOL_HPP
@@ -0,0 +1,105 @@
+#include "lazy_element_field.hpp"
+
+#include "attribute_field_coder.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace attribute
+{
+
+lazy_element_field::lazy_element_field(byte_view data, std::shared_ptr<const void> owner,
+                                       VR vr, ENDIANNESS endianness):
+   elementfield_base {vr, true},
+   data {data},
+   owner {std::move(owner)},
+   vr {vr},
+   endianness {endianness},
+   decoded_flag {false}
+{
+}
+
+elementfield_base* lazy_element_field::resolve()
+{
+   return decode()->resolve();
+}
+
+elementfield_base* lazy_element_field::detach()
+{
+   return decode()->detach();
+}
+
+const elementfield_base* lazy_element_field::view()
+{
+   return decode()->view();
+}
+
+elementfield_base* lazy_element_field::decode()
+{
+   std::call_once(decode_once, [this]() {
+      decoded = std::move(decode_value_field(data, endianness, data.size(), vr, "*", 0).value_field);
+      decoded_flag.store(true, std::memory_order_release);
+      // later accesses use the decoded field directly, unless it is shared
+      if (decoded->resolve() == decoded.get()) {
+         resolved.store(decoded.get(), std::memory_order_release);
+      }
+   });
+   return decoded.get();
+}
+
+boost::optional<byte_view> lazy_element_field::raw(ENDIANNESS endianness) const
+{
+   // once decoded, the value may have been modified through the cached field
+   if (is_decoded() || endianness != this->endianness) {
+      return boost::none;
+   }
+   return data;
+}
+
+std::unique_ptr<elementfield_base> lazy_element_field::deep_copy()
+{
+   if (is_decoded()) {
+      return decoded->deep_copy();
+   }
+   return std::unique_ptr<elementfield_base> {new lazy_element_field {data, owner, vr, endianness}};
+}
+
+std::size_t lazy_element_field::byte_size()
+{
+   if (is_decoded()) {
+      return decoded->byte_size();
+   }
+   return data.size();
+}
+
+std::ostream& lazy_element_field::print(std::ostream& os)
+{
+   return decode()->print(os);
+}
+
+bool lazy_element_field::is_decoded() const
+{
+   return decoded_flag.load(std::memory_order_acquire);
+}
+
+
+elementfield make_lazy_elementfield(VR vr, byte_view data,
+                                    std::shared_ptr<const void> owner,
+                                    ENDIANNESS endianness)
+{
+   elementfield el;
+   el.value_rep = vr;
+   el.value_len = data.size();
+   el.value_field = std::unique_ptr<elementfield_base> {
+         new lazy_element_field {data, std::move(owner), vr, endianness}};
+   return el;
+}
+
+}
+
+}
+
+}
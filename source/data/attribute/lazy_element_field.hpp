@@ -0,0 +1,98 @@
+#ifndef LAZY_ELEMENT_FIELD_HPP
+#define LAZY_ELEMENT_FIELD_HPP
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "attribute.hpp"
+#include "byte_view.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace attribute
+{
+
+/**
+ * @brief The lazy_element_field struct defers the decoding of a serialized
+ *        value field until its value is accessed for the first time.
+ * It records the position of the value in the source buffer, its VR and its
+ * byte order, and shares ownership of the buffer. The first visit decodes the
+ * value into a regular element_field, which is cached and accessed directly
+ * afterwards, or into a shared_element_field for large binary values. As
+ * long as the value was not accessed, serializing it in the original byte
+ * order copies the recorded bytes verbatim.
+ */
+struct lazy_element_field: elementfield_base
+{
+      /**
+       * @brief lazy_element_field constructor
+       * @param data view on the serialized value field
+       * @param owner owner of the memory viewed by data
+       * @param vr VR of the value
+       * @param endianness byte order of the serialized value
+       */
+      lazy_element_field(byte_view data, std::shared_ptr<const void> owner,
+                         VR vr, ENDIANNESS endianness);
+
+      elementfield_base* resolve() override;
+
+      elementfield_base* detach() override;
+
+      const elementfield_base* view() override;
+
+      boost::optional<byte_view> raw(ENDIANNESS endianness) const override;
+
+      std::unique_ptr<elementfield_base> deep_copy() override;
+
+      std::size_t byte_size() override;
+
+      std::ostream& print(std::ostream& os) override;
+
+      /**
+       * @brief is_decoded returns whether the value has been decoded
+       */
+      bool is_decoded() const;
+
+   private:
+      byte_view data;
+      std::shared_ptr<const void> owner;
+      VR vr;
+      ENDIANNESS endianness;
+
+      std::once_flag decode_once;
+      std::unique_ptr<elementfield_base> decoded;
+      std::atomic<bool> decoded_flag;
+
+      /**
+       * @brief decode decodes the value on first access
+       * @return field holding the decoded value
+       */
+      elementfield_base* decode();
+};
+
+/**
+ * @brief make_lazy_elementfield is a factory function for an attribute whose
+ *        value is decoded on first access.
+ * @param vr VR of the attribute
+ * @param data view on the serialized value field
+ * @param owner owner of the memory viewed by data
+ * @param endianness byte order of the serialized value
+ * @return prepared instance of elementfield
+ */
+elementfield make_lazy_elementfield(VR vr, byte_view data,
+                                    std::shared_ptr<const void> owner,
+                                    ENDIANNESS endianness);
+
+}
+
+}
+
+}
+
+#endif // LAZY_ELEMENT_FIELD_HPP
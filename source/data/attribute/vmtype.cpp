@@ -1,5 +1,7 @@
 #include "vmtype.hpp"
 
+#include <cctype>
+
 namespace dicom
 {
 
@@ -9,6 +11,103 @@ namespace data
 namespace attribute
 {
 
+namespace
+{
+
+/**
+ * @brief parse_count parses the decimal number in [begin, end)
+ * @return false if the range is empty or contains other characters
+ */
+bool parse_count(const char* begin, const char* end, std::size_t& count)
+{
+   if (begin == end) {
+      return false;
+   }
+   count = 0;
+   for (; begin != end; ++begin) {
+      if (!std::isdigit(static_cast<unsigned char>(*begin))) {
+         return false;
+      }
+      count = count*10 + static_cast<std::size_t>(*begin - '0');
+   }
+   return true;
+}
+
+/**
+ * @brief parse_multiplier parses a component of the form "kn", where an
+ *        omitted k means 1
+ * @return false if the component does not contain an n
+ */
+bool parse_multiplier(const char* begin, const char* end, std::size_t& multiplier)
+{
+   const char* n = std::find(begin, end, 'n');
+   if (n == end) {
+      return false;
+   }
+   if (!parse_count(begin, n, multiplier)) {
+      multiplier = 1;
+   }
+   return multiplier > 0;
+}
+
+}
+
+constexpr std::size_t multiplicity_data::unbounded;
+
+multiplicity_data::multiplicity_data(const std::string& mult):
+   min {0},
+   max {unbounded},
+   step {1}
+{
+   // the notation without whitespace, multiplicities are only a few
+   // characters long
+   char compact[16];
+   std::size_t len = 0;
+   for (char c : mult) {
+      if (!std::isspace(static_cast<unsigned char>(c)) && len < sizeof(compact)) {
+         compact[len++] = c;
+      }
+   }
+   const char* begin = compact;
+   const char* end = compact + len;
+   const char* dash = std::find(begin, end, '-');
+
+   std::size_t lower, upper, multiplier;
+   if (dash != end && dash+1 != end) {
+      // a range "a-b" or "a-kn"
+      if (!parse_count(begin, dash, lower)) {
+         return;
+      }
+      if (parse_count(dash+1, end, upper)) {
+         min = lower;
+         max = upper;
+      } else if (parse_multiplier(dash+1, end, multiplier)) {
+         min = lower;
+         step = multiplier;
+      }
+   } else if (parse_count(begin, dash, lower)) {
+      min = max = lower;
+   } else if (parse_multiplier(begin, dash, multiplier)) {
+      min = 1;
+      step = multiplier;
+   }
+   // any other notation, like "*", does not restrict the number of values
+}
+
+std::string multiplicity_data::to_string() const
+{
+   if (min == max) {
+      return std::to_string(min);
+   }
+   if (max != unbounded) {
+      return std::to_string(min) + "-" + std::to_string(max);
+   }
+   if (min == 0 && step == 1) {
+      return "*";
+   }
+   return std::to_string(min) + "-" + (step > 1 ? std::to_string(step) : "") + "n";
+}
+
 
 std::ostream& operator<<(std::ostream& os, vmtype<std::string> data)
 {
@@ -13,6 +13,7 @@
 
 #include "base_types.hpp"
 #include "tag.hpp"
+#include "util/small_vector.hpp"
 
 namespace dicom
 {
@@ -23,44 +24,46 @@ namespace data
 namespace attribute
 {
 
-inline bool rule_n(std::size_t multiplier, std::size_t current, std::size_t new_elements)
-{
-   return (current + new_elements) % multiplier == 0;
-}
-
-inline bool rule_less(std::size_t size, std::size_t current, std::size_t new_elements)
-{
-   return current + new_elements <= size;
-}
-
-inline bool rule_more(std::size_t size, std::size_t current, std::size_t new_elements)
-{
-   return current + new_elements >= size;
-}
-
-inline bool rule_equals(std::size_t size, std::size_t current, std::size_t new_elements)
-{
-   return current + new_elements == size;
-}
-
 /**
- * @brief The multiplicity_data struct contains structured data about the
- *        multiplicity of the value field
+ * @brief The multiplicity_data struct contains the value multiplicity of a
+ *        value field as the range and step of the allowed value counts,
+ *        parsed once from its dictionary notation.
  */
 struct multiplicity_data
 {
-      std::string multiplicity = "1";
+      static constexpr std::size_t unbounded = static_cast<std::size_t>(-1);
 
-   public:
-      multiplicity_data(std::string mult):
-         multiplicity(mult)
-      {
+      std::size_t min;
+      std::size_t max;
+      std::size_t step;
 
-      }
-};
+      /**
+       * @brief multiplicity_data parses the multiplicity in the notation of
+       *        the data dictionary, eg. "1", "1-3", "2-2n" or "*"
+       * @param mult multiplicity
+       */
+      multiplicity_data(const std::string& mult);
 
+      constexpr multiplicity_data(std::size_t min, std::size_t max, std::size_t step):
+         min {min},
+         max {max},
+         step {step}
+      {
+      }
 
+      /**
+       * @brief allows returns true if a field may hold count values
+       */
+      bool allows(std::size_t count) const
+      {
+         return count >= min && count <= max && count % step == 0;
+      }
 
+      /**
+       * @brief to_string returns the multiplicity in the dictionary notation
+       */
+      std::string to_string() const;
+};
 
 template <typename T>
 class vmtype;
@@ -91,15 +94,19 @@ class vmtype
    private:
       enum OVERLOAD {DUMMY};
       /**
-       * @brief the private vmtype constructor initializes the rules as specified
-       *        by the parameter
+       * @brief the private vmtype constructor initializes the multiplicity as
+       *        specified by the parameter
        * @param mult multiplicity
        * @param int dummy parameter to prevent ambiguous overloads for T = string
        */
-      vmtype(std::string mult, OVERLOAD):
+      vmtype(multiplicity_data mult, OVERLOAD):
          multiplicity {mult}
       {
-         populate_mult_rules();
+      }
+
+      static constexpr multiplicity_data any_multiplicity()
+      {
+         return multiplicity_data {0, multiplicity_data::unbounded, 1};
       }
 
    public:
@@ -111,9 +118,8 @@ class vmtype
        * @param mult multiplicity
        */
       vmtype(multiplicity_data mult):
-         multiplicity {mult.multiplicity, 0}
+         multiplicity {mult}
       {
-         populate_mult_rules();
          insert({});
       }
 
@@ -122,14 +128,14 @@ class vmtype
        * @param value value to be added
        */
       vmtype(T value):
-         vmtype {"*", OVERLOAD::DUMMY}
+         vmtype {any_multiplicity(), OVERLOAD::DUMMY}
       {
          const T* value_addr = &value;
          insert(value_addr, value_addr+1);
       }
 
       vmtype():
-         vmtype {"*", OVERLOAD::DUMMY}
+         vmtype {any_multiplicity(), OVERLOAD::DUMMY}
       {
          insert({});
       }
@@ -151,7 +157,7 @@ class vmtype
        * @param values values to be stored
        */
       vmtype(std::initializer_list<T> values, multiplicity_data multiplicity):
-         vmtype {multiplicity.multiplicity, OVERLOAD::DUMMY}
+         vmtype {multiplicity, OVERLOAD::DUMMY}
       {
          insert(values);
       }
@@ -164,7 +170,7 @@ class vmtype
        * @param end end pointer of the values
        */
       template <typename Iter>
-      vmtype(std::string multiplicity, Iter begin, Iter end):
+      vmtype(multiplicity_data multiplicity, Iter begin, Iter end):
          vmtype {multiplicity, OVERLOAD::DUMMY}
       {
          insert(begin, end);
@@ -342,6 +348,14 @@ class vmtype
       }
 
 
+      /**
+       * @brief data returns a pointer to the contiguously stored values
+       */
+      const T* data() const
+      {
+         return value_sequence.data();
+      }
+
       std::size_t byte_size() const
       {
          std::size_t bytesize = 0;
@@ -355,86 +369,16 @@ class vmtype
       }
 
    private:
-      std::vector<T> value_sequence;
-      std::string multiplicity;
-
-      std::vector<std::function<bool(std::size_t, std::size_t)>> multiplicity_rules;
-
-      /**
-         * @brief validate_multiplicity verifies that the respective attribute's
-         *        multiplicity definitions are satisfied.
-         * @param num_new_elements number of new elements to be added
-         * @pre multiplicity rule must be satisfied for the current number of
-         *      elements.
-         * @return
-         */
-      bool validate_multiplicity(std::size_t num_new_elements) const
-      {
-         return std::all_of(multiplicity_rules.begin()
-                            , multiplicity_rules.end()
-                            , [=](std::function<bool(std::size_t, std::size_t)> rule)
-         { return rule(value_sequence.size(), num_new_elements); } );
-      }
-
-      /**
-         * @brief populate_mult_rules parses the multiplicity definiton and adds
-         *        all necessary rules.
-         */
-      void populate_mult_rules()
-      {
-         auto it = std::remove_if(multiplicity.begin(), multiplicity.end(), ::isspace);
-         multiplicity.erase(it, multiplicity.end());
-
-         std::vector<std::string> components;
-	 components = split_multiplicity_by_dash(multiplicity);
-
-         using namespace std::placeholders;
-         if (components.size() > 1) {
-            if (components[1] == "") components[1] = "n";
-            if (std::all_of(components[0].begin(), components[0].end(), ::isdigit)) {
-               std::size_t lower = std::stoull(components[0]);
-               if (std::all_of(components[1].begin(), components[1].end(), ::isdigit)) {
-                  std::size_t upper = std::stoull(components[1]);
-                  multiplicity_rules.push_back(std::bind(rule_more, lower, _1, _2));
-                  multiplicity_rules.push_back(std::bind(rule_less, upper, _1, _2));
-               } else if (components[1].find('n') != std::string::npos) {
-                  std::string multiplier {components[1].begin(), components[1].begin() + components[1].find_last_of('n')};
-                  if (multiplier == "") multiplier = "1";
-                  multiplicity_rules.push_back(std::bind(rule_n, std::stoul(multiplier), _1, _2));
-                  multiplicity_rules.push_back(std::bind(rule_more, lower, _1, _2));
-               }
-            }
-         } else {
-            if (std::all_of(components[0].begin(), components[0].end(), ::isdigit)) {
-               std::size_t value = std::stoull(components[0]);
-               multiplicity_rules.push_back(std::bind(rule_equals, value, _1, _2));
-            } else if (components[0].find('n') != std::string::npos) {
-               std::string multiplier {components[0].begin(), components[0].begin() + components[0].find_last_of('n')};
-               if (multiplier == "") multiplier = "1";
-               multiplicity_rules.push_back(std::bind(rule_n, std::stoul(multiplier), _1, _2));
-               multiplicity_rules.push_back(std::bind(rule_more, 1, _1, _2));
-            }
-         }
-      }
-
-      /**
-         * @brief split_multiplicity_by_dash tokenizes the multiplicity rule represented 
-	 *        as a string for further processing. Components are separed by a dash -
-	 */
-      std::vector<std::string> split_multiplicity_by_dash(const std::string& multiplicity)
-      {
-         std::vector<std::string> components;
-	 auto dash_pos = multiplicity.find("-");
-	 auto end = multiplicity.size();
-	 if (dash_pos == std::string::npos) dash_pos = end;
-	 components.push_back(multiplicity.substr(0, dash_pos));
-	 if (dash_pos < end-1) {
-	    components.push_back(multiplicity.substr(dash_pos+1, end-1-dash_pos)); 
-	 }
-	 return components;
-      }
+      // values of the common multiplicities up to 4 are stored inline
+      util::small_vector<T, 4> value_sequence;
+      multiplicity_data multiplicity;
 
    public:
+      vmtype(const vmtype&) = default;
+      vmtype(vmtype&&) = default;
+      vmtype& operator=(const vmtype&) = default;
+      vmtype& operator=(vmtype&&) = default;
+
       virtual ~vmtype();
 
       operator T()
@@ -457,6 +401,11 @@ class vmtype
          return value_sequence.back();
       }
 
+      const T& back() const
+      {
+         return value_sequence.back();
+      }
+
 
       /**
        * @brief insert inserts all values in the range specified by the
@@ -468,10 +417,10 @@ class vmtype
       void insert(Iter begin, Iter end)
       {
          auto size = end-begin;
-         if (!validate_multiplicity(size)) {
-            throw new std::runtime_error("addition of " + std::to_string(size) +  " elements would violate the multiplicity rule: " + multiplicity);
+         if (!multiplicity.allows(value_sequence.size() + size)) {
+            throw new std::runtime_error("addition of " + std::to_string(size) +  " elements would violate the multiplicity rule: " + multiplicity.to_string());
          }
-         std::copy(begin, end, std::back_inserter(value_sequence));
+         value_sequence.append(begin, end);
       }
 };
 
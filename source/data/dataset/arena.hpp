@@ -0,0 +1,127 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <vector>
+#include <cstddef>
+#include <cassert>
+
+#include "data/attribute/byte_view.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dataset
+{
+
+/**
+ * @brief The arena class is a bump allocator for the value payloads of a
+ *        dataset.
+ * All payloads are appended to one contiguous buffer and addressed by their
+ * offset, so allocations are amortized constant time and the offsets remain
+ * valid when the buffer grows or the arena is copied. Single payloads are never
+ * freed; the memory is released at once by clear() or the destruction of the
+ * arena.
+ */
+class arena
+{
+   public:
+      arena() = default;
+
+      /**
+       * @brief arena constructs an arena with preallocated memory
+       * @param capacity number of bytes to reserve
+       */
+      explicit arena(std::size_t capacity)
+      {
+         storage.reserve(capacity);
+      }
+
+      /**
+       * @brief allocate reserves size bytes at the end of the arena
+       * @param size number of bytes to be allocated
+       * @return offset of the allocated memory
+       */
+      std::size_t allocate(std::size_t size)
+      {
+         auto offset = storage.size();
+         storage.resize(offset + size);
+         return offset;
+      }
+
+      /**
+       * @brief store copies the given bytes into the arena
+       * @param data bytes to be copied
+       * @return offset of the copy
+       */
+      std::size_t store(attribute::byte_view data)
+      {
+         auto offset = storage.size();
+         storage.insert(storage.end(), data.begin(), data.end());
+         return offset;
+      }
+
+      /**
+       * @brief append lets a writer append a payload to the end of the arena
+       *        in place, without staging it in a separate buffer
+       * @param write callable receiving the underlying buffer, which it may
+       *        only append to
+       * @return offset of the appended payload
+       */
+      template <typename Writer>
+      std::size_t append(Writer&& write)
+      {
+         auto offset = storage.size();
+         write(storage);
+         return offset;
+      }
+
+      /**
+       * @brief shrink releases the payloads from offset to the end of the
+       *        arena, which must not be referenced anymore
+       * @param offset new size of the arena
+       */
+      void shrink(std::size_t offset)
+      {
+         assert(offset <= storage.size());
+         storage.resize(offset);
+      }
+
+      unsigned char* data(std::size_t offset)
+      {
+         assert(offset <= storage.size());
+         return storage.data() + offset;
+      }
+
+      /**
+       * @brief view returns a view on an allocated range. The view is
+       *        invalidated by the next allocation.
+       * @param offset offset of the range
+       * @param size size of the range
+       * @return view on the range
+       */
+      attribute::byte_view view(std::size_t offset, std::size_t size) const
+      {
+         assert(offset + size <= storage.size());
+         return attribute::byte_view {storage.data() + offset, size};
+      }
+
+      std::size_t size() const { return storage.size(); }
+
+      void reserve(std::size_t capacity) { storage.reserve(capacity); }
+
+      void clear() { storage.clear(); }
+
+   private:
+      std::vector<unsigned char> storage;
+};
+
+}
+
+}
+
+}
+
+#endif // ARENA_HPP
@@ -216,7 +216,7 @@ bool dataset_iterator::is_in_nested() const
 }
 
 dataset_iterator_adaptor::dataset_iterator_adaptor(std::map<tag_type, elementfield> ds):
-   dataset {ds}
+   dataset {std::move(ds)}
 {
 }
 
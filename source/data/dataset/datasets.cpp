@@ -46,10 +46,10 @@ void traverse(const dataset_type& data, std::function<void(attribute::tag_type,
       if (it != sets.top()->end()) {
          handler(it->first, it->second);
 
-	 auto data = get_value_field_pointer<VR::SQ>(it->second);
+	 const auto& data = get_value_field_ref<VR::SQ>(it->second);
 
-         for (int i=data->size()-1; i >= 0; --i) {
-            sets.push(&((*data)[i]));
+         for (int i=data.size()-1; i >= 0; --i) {
+            sets.push(&data[i]);
             positions.push(sets.top()->begin());
          }
          ++it;
@@ -0,0 +1,230 @@
+#include "flat_dataset.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <typeinfo>
+
+#include "data/attribute/attribute_field_coder.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dataset
+{
+
+using namespace attribute;
+
+static bool tag_less(const flat_dataset::value_type& element, tag_type tag)
+{
+   return element.first < tag;
+}
+
+
+flat_dataset::element_proxy::element_proxy(flat_dataset& set, tag_type tag):
+   set {set},
+   tag {tag}
+{
+}
+
+flat_dataset::element_proxy& flat_dataset::element_proxy::operator=(const elementfield& value)
+{
+   set.insert_or_assign(tag, value);
+   return *this;
+}
+
+flat_dataset::element_proxy::operator elementfield() const
+{
+   return set.at(tag);
+}
+
+
+flat_dataset::flat_dataset(const dataset_type& set)
+{
+   elements.reserve(set.size());
+   for (const auto& attr : set) {
+      insert_or_assign(attr.first, attr.second);
+   }
+}
+
+void flat_dataset::reserve(std::size_t elements, std::size_t bytes)
+{
+   this->elements.reserve(elements);
+   payloads.reserve(bytes);
+}
+
+flat_dataset::element_proxy flat_dataset::operator[](tag_type tag)
+{
+   return element_proxy {*this, tag};
+}
+
+elementfield flat_dataset::at(tag_type tag) const
+{
+   auto it = find(tag);
+   if (it == end()) {
+      throw std::out_of_range {"flat_dataset does not contain the tag"};
+   }
+   return value(it);
+}
+
+elementfield flat_dataset::value(const_iterator it) const
+{
+   const flat_element& header = it->second;
+   if (!header.in_arena) {
+      return nested[header.offset];
+   }
+   auto ef = decode_value_field(payloads.view(header.offset, header.size),
+                                ENDIANNESS::LITTLE, header.size,
+                                *header.value_rep, "*", 0);
+   ef.value_len = header.value_len;
+   return ef;
+}
+
+byte_view flat_dataset::payload(const_iterator it) const
+{
+   const flat_element& header = it->second;
+   if (!header.in_arena) {
+      return byte_view {};
+   }
+   return payloads.view(header.offset, header.size);
+}
+
+flat_dataset::const_iterator flat_dataset::insert_or_assign(tag_type tag, const elementfield& value)
+{
+   if (!store_in_arena(value)) {
+      auto it = position(tag);
+      if (it != elements.end() && it->first == tag && !it->second.in_arena) {
+         nested[it->second.offset] = value;
+         it->second.value_rep = value.value_rep;
+         it->second.value_len = value.value_len;
+         return it;
+      }
+      nested.push_back(value);
+      return store(tag, flat_element {value.value_rep, value.value_len,
+                                      nested.size()-1, 0, false});
+   }
+
+   VR vr = *value.value_rep;
+   auto offset = payloads.append([&value, vr](std::vector<unsigned char>& out) {
+      encode_value_field(value, ENDIANNESS::LITTLE, vr, out);
+   });
+   return store_payload(tag, vr, value.value_len, offset, payloads.size() - offset);
+}
+
+flat_dataset::const_iterator flat_dataset::insert_raw(tag_type tag, VR vr, byte_view data)
+{
+   auto offset = payloads.store(data);
+   return store_payload(tag, vr, data.size(), offset, data.size());
+}
+
+flat_dataset::const_iterator flat_dataset::store_payload(tag_type tag, VR vr,
+                                                         std::size_t value_len,
+                                                         std::size_t offset,
+                                                         std::size_t size)
+{
+   auto it = position(tag);
+   if (it != elements.end() && it->first == tag
+       && it->second.in_arena && it->second.size >= size) {
+      // move the new value into the slot of the replaced one if it fits, and
+      // release its space at the end of the arena again
+      const unsigned char* appended = payloads.data(offset);
+      std::copy(appended, appended + size, payloads.data(it->second.offset));
+      payloads.shrink(offset);
+      it->second.value_rep = vr;
+      it->second.value_len = value_len;
+      it->second.size = size;
+      return it;
+   }
+   return store(tag, flat_element {vr, value_len, offset, size, true});
+}
+
+flat_dataset::const_iterator flat_dataset::find(tag_type tag) const
+{
+   auto it = std::lower_bound(elements.begin(), elements.end(), tag, tag_less);
+   if (it != elements.end() && it->first == tag) {
+      return it;
+   }
+   return elements.end();
+}
+
+flat_dataset::size_type flat_dataset::count(tag_type tag) const
+{
+   return find(tag) != end() ? 1 : 0;
+}
+
+flat_dataset::size_type flat_dataset::erase(tag_type tag)
+{
+   auto it = position(tag);
+   if (it == elements.end() || it->first != tag) {
+      return 0;
+   }
+   elements.erase(it);
+   return 1;
+}
+
+void flat_dataset::clear()
+{
+   elements.clear();
+   payloads.clear();
+   nested.clear();
+}
+
+dataset_type flat_dataset::to_dataset() const
+{
+   dataset_type set;
+   for (auto it = begin(); it != end(); ++it) {
+      set.emplace_hint(set.end(), it->first, value(it));
+   }
+   return set;
+}
+
+std::vector<flat_dataset::value_type>::iterator flat_dataset::position(tag_type tag)
+{
+   // attributes are usually added in ascending order while parsing or
+   // converting, so check the back before searching
+   if (elements.empty() || elements.back().first < tag) {
+      return elements.end();
+   }
+   return std::lower_bound(elements.begin(), elements.end(), tag, tag_less);
+}
+
+flat_dataset::const_iterator flat_dataset::store(tag_type tag, flat_element header)
+{
+   auto it = position(tag);
+   if (it != elements.end() && it->first == tag) {
+      it->second = header;
+      return it;
+   }
+   return elements.insert(it, value_type {tag, header});
+}
+
+bool flat_dataset::store_in_arena(const elementfield& value) const
+{
+   if (!value.value_rep.is_initialized() || !value.value_field) {
+      return false;
+   }
+   switch (*value.value_rep) {
+      case VR::SQ:
+      case VR::NN:
+      case VR::NI:
+         return false;
+      case VR::OB:
+         return get_value_field_ref<VR::OB>(value).type() != typeid(attribute::encapsulated);
+      default:
+         return true;
+   }
+}
+
+
+bool contains_tag(const flat_dataset& set, tag_type tag)
+{
+   return set.find(tag) != std::end(set);
+}
+
+}
+
+}
+
+}
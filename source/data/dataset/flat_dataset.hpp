@@ -0,0 +1,200 @@
+#ifndef FLAT_DATASET_HPP
+#define FLAT_DATASET_HPP
+
+#include <vector>
+#include <utility>
+#include <cstddef>
+
+#include <boost/optional.hpp>
+
+#include "arena.hpp"
+#include "datasets.hpp"
+#include "data/attribute/attribute.hpp"
+#include "data/attribute/byte_view.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dataset
+{
+
+/**
+ * @brief The flat_element struct is the small, fixed-size header of an
+ *        attribute stored in a flat_dataset.
+ * The payload of the attribute is kept in the arena of the owning set in its
+ * little endian serialized form. Attributes whose values are not a plain byte
+ * string (sequences, encapsulated pixel data and the delimitation items) are
+ * kept as elementfields in a side table instead, indexed by offset.
+ */
+struct flat_element
+{
+      boost::optional<attribute::VR> value_rep;
+      std::size_t value_len;
+      std::size_t offset;
+      std::size_t size;
+      bool in_arena;
+};
+
+/**
+ * @brief The flat_dataset class is a contiguous alternative to the node-based
+ *        dataset_type.
+ * The attribute headers are kept in a vector sorted by tag and the value
+ * payloads are appended to a per-set arena, so building a set of n attributes
+ * costs O(log n) allocations instead of two per attribute, and iteration walks
+ * linear memory. Values are encoded directly into the arena.
+ * Lookups and iteration yield (tag, header) pairs rather than elementfields;
+ * a value is decoded by at() or value() on every access, and operator[]
+ * returns a proxy which can be assigned an elementfield or converted to one.
+ * The set is therefore a storage format for building and scanning sets, not
+ * a replacement for dataset_type, which the rest of the library uses; sets
+ * are exchanged with it through the conversions. Overwritten and erased
+ * payloads remain in the arena until the set is cleared.
+ */
+class flat_dataset
+{
+   public:
+      using key_type = attribute::tag_type;
+      using mapped_type = flat_element;
+      using value_type = std::pair<attribute::tag_type, flat_element>;
+      using size_type = std::size_t;
+      using const_iterator = std::vector<value_type>::const_iterator;
+      using iterator = const_iterator;
+
+      /**
+       * @brief The element_proxy class is returned by operator[] to assign
+       *        or retrieve the attribute with the given tag.
+       */
+      class element_proxy
+      {
+         public:
+            element_proxy(flat_dataset& set, attribute::tag_type tag);
+
+            element_proxy& operator=(const attribute::elementfield& value);
+
+            operator attribute::elementfield() const;
+
+         private:
+            flat_dataset& set;
+            attribute::tag_type tag;
+      };
+
+      flat_dataset() = default;
+
+      /**
+       * @brief flat_dataset converts a map-based dataset
+       * @param set dataset to be converted
+       */
+      explicit flat_dataset(const dataset_type& set);
+
+      /**
+       * @brief reserve preallocates memory for the headers and the payloads
+       * @param elements expected number of attributes
+       * @param bytes expected accumulated size of the payloads
+       */
+      void reserve(std::size_t elements, std::size_t bytes);
+
+      element_proxy operator[](attribute::tag_type tag);
+
+      /**
+       * @brief at returns the decoded attribute with the given tag
+       * @param tag tag of the attribute
+       * @return decoded attribute
+       * @throws std::out_of_range if the set does not contain the tag
+       */
+      attribute::elementfield at(attribute::tag_type tag) const;
+
+      /**
+       * @brief value returns the decoded attribute the iterator points to
+       * @param it valid, dereferencable iterator of this set
+       * @return decoded attribute
+       */
+      attribute::elementfield value(const_iterator it) const;
+
+      /**
+       * @brief payload returns the serialized little endian value of the
+       *        attribute without decoding it.
+       * The view is invalidated by any modification of the set.
+       * @param it valid, dereferencable iterator of this set
+       * @return view on the payload, empty if the value is not kept in the
+       *         arena
+       */
+      attribute::byte_view payload(const_iterator it) const;
+
+      /**
+       * @brief insert_or_assign encodes the attribute into the set, replacing
+       *        an attribute with the same tag.
+       * @param tag tag of the attribute
+       * @param value attribute to be stored
+       * @return iterator to the stored attribute
+       */
+      const_iterator insert_or_assign(attribute::tag_type tag, const attribute::elementfield& value);
+
+      /**
+       * @brief insert_raw stores an already serialized little endian value
+       *        without an intermediate decode.
+       * @param tag tag of the attribute
+       * @param vr value representation of the attribute
+       * @param data serialized value field
+       * @return iterator to the stored attribute
+       */
+      const_iterator insert_raw(attribute::tag_type tag, attribute::VR vr, attribute::byte_view data);
+
+      const_iterator find(attribute::tag_type tag) const;
+      size_type count(attribute::tag_type tag) const;
+      size_type erase(attribute::tag_type tag);
+
+      const_iterator begin() const { return elements.begin(); }
+      const_iterator end() const { return elements.end(); }
+
+      size_type size() const { return elements.size(); }
+      bool empty() const { return elements.empty(); }
+
+      /**
+       * @brief arena_size returns the number of payload bytes allocated so
+       *        far, including overwritten and erased ones.
+       */
+      std::size_t arena_size() const { return payloads.size(); }
+
+      void clear();
+
+      /**
+       * @brief to_dataset converts the set back into a map-based dataset
+       * @return converted dataset
+       */
+      dataset_type to_dataset() const;
+
+   private:
+      std::vector<value_type> elements;
+      arena payloads;
+      std::vector<attribute::elementfield> nested;
+
+      std::vector<value_type>::iterator position(attribute::tag_type tag);
+      const_iterator store(attribute::tag_type tag, flat_element header);
+      /**
+       * @brief store_payload records the payload which was just appended to
+       *        the arena at offset as the value of the tag
+       */
+      const_iterator store_payload(attribute::tag_type tag, attribute::VR vr,
+                                   std::size_t value_len, std::size_t offset,
+                                   std::size_t size);
+      bool store_in_arena(const attribute::elementfield& value) const;
+};
+
+/**
+ * @brief contains_tag checks whether a flat set contains a certain tag
+ * @param set set to check
+ * @param tag tag to look for
+ * @return true if found, false otherwise
+ */
+bool contains_tag(const flat_dataset& set, attribute::tag_type tag);
+
+}
+
+}
+
+}
+
+#endif // FLAT_DATASET_HPP
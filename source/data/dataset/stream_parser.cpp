@@ -0,0 +1,221 @@
+#include "stream_parser.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <stdexcept>
+
+#include "data/attribute/attribute_field_coder.hpp"
+#include "data/attribute/constants.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dataset
+{
+
+using namespace attribute;
+
+static const std::size_t undefined_end = std::numeric_limits<std::size_t>::max();
+
+static bool is_item_attribute(tag_type tag)
+{
+   return tag == Item || tag == ItemDelimitationItem || tag == SequenceDelimitationItem;
+}
+
+
+stream_parser::stream_parser(const transfer_processor& processor,
+                             stream_handler handler,
+                             std::size_t value_buffer_size):
+   processor (processor),
+   handler {std::move(handler)},
+   value_buffer_size {value_buffer_size},
+   pos {0},
+   header_fill {0},
+   in_value {false},
+   value_remaining {0},
+   value_offset {0}
+{
+   value_buffer.reserve(value_buffer_size);
+}
+
+void stream_parser::feed(byte_view chunk)
+{
+   std::size_t i = 0;
+   while (i < chunk.size()) {
+      if (in_value) {
+         i += consume_value(chunk.subview(i, chunk.size()-i));
+         continue;
+      }
+
+      // the header size is only known after its first bytes are read, so
+      // it is re-evaluated after each partial read
+      std::size_t n = std::min(header_size() - header_fill, chunk.size() - i);
+      std::copy(chunk.begin()+i, chunk.begin()+i+n, header.begin()+header_fill);
+      header_fill += n;
+      pos += n;
+      i += n;
+      if (header_fill == header_size()) {
+         dispatch_header();
+      }
+   }
+}
+
+void stream_parser::finish() const
+{
+   if (in_value || header_fill > 0 || !frames.empty()) {
+      throw std::runtime_error {"Incomplete serialized dataset at byte " + std::to_string(pos)};
+   }
+}
+
+std::size_t stream_parser::position() const
+{
+   return pos;
+}
+
+std::size_t stream_parser::header_size() const
+{
+   if (header_fill < 4) {
+      return 4;
+   }
+   byte_view data {header.data(), header_fill};
+   tag_type tag = decode_tag(data, 0, processor.endianness);
+   if (processor.vrtype == transfer_processor::VR_TYPE::IMPLICIT || is_item_attribute(tag)) {
+      return 8;
+   }
+   if (header_fill < 6) {
+      return 6;
+   }
+   // special VRs are followed by two reserved bytes and a 4 byte length
+   std::size_t vrpos = 4;
+   processor.deserialize_VR(data, tag, vrpos);
+   return vrpos == 8 ? 12 : 8;
+}
+
+void stream_parser::dispatch_header()
+{
+   byte_view data {header.data(), header_fill};
+   std::size_t hpos = 0;
+   tag_type tag = decode_tag(data, hpos, processor.endianness);
+   hpos += 4;
+   VR repr = processor.deserialize_VR(data, tag, hpos);
+   std::size_t len = processor.deserialize_length(data, tag, repr, hpos);
+   header_fill = 0;
+
+   bool undefined_length = ((len & 0xffffffff) == 0xffffffff);
+   std::size_t end = undefined_length ? undefined_end : pos + len;
+
+   if (tag == Item) {
+      bool fragment = !frames.empty() && frames.top().type == FRAME::FRAGMENTS;
+      if (handler.item_begin) {
+         handler.item_begin(len);
+      }
+      frames.push({FRAME::ITEM, tag, end});
+      if (fragment) {
+         begin_value(tag, len);
+         return;
+      }
+   } else if (tag == ItemDelimitationItem) {
+      end_frame(FRAME::ITEM);
+   } else if (tag == SequenceDelimitationItem) {
+      // tolerate a missing delimitation of the last undefined length item
+      if (!frames.empty() && frames.top().type == FRAME::ITEM) {
+         end_frame(FRAME::ITEM);
+      }
+      end_frame(FRAME::SEQUENCE);
+   } else if (repr == VR::SQ || undefined_length) {
+      // undefined length values other than sequences or UN are encapsulated
+      // pixel data, consisting of fragment items
+      if (handler.sequence_begin) {
+         handler.sequence_begin(tag, len);
+      }
+      bool sequence = repr == VR::SQ || repr == VR::UN;
+      frames.push({sequence ? FRAME::SEQUENCE : FRAME::FRAGMENTS, tag, end});
+   } else {
+      if (handler.element) {
+         handler.element(tag, repr, len);
+      }
+      begin_value(tag, len);
+      return;
+   }
+   close_frames();
+}
+
+void stream_parser::begin_value(tag_type tag, std::size_t len)
+{
+   value_tag = tag;
+   value_remaining = len;
+   value_offset = 0;
+   if (len == 0) {
+      if (handler.value) {
+         handler.value(tag, byte_view {}, 0);
+      }
+      close_frames();
+   } else {
+      in_value = true;
+   }
+}
+
+std::size_t stream_parser::consume_value(byte_view chunk)
+{
+   std::size_t n = std::min(value_remaining, chunk.size());
+   byte_view part = chunk.subview(0, n);
+   bool whole = (value_offset == 0 && n == value_remaining);
+   bool buffered = (value_offset + value_remaining <= value_buffer_size);
+
+   if (whole || !buffered) {
+      if (handler.value) {
+         handler.value(value_tag, part, value_offset);
+      }
+   } else {
+      value_buffer.insert(value_buffer.end(), part.begin(), part.end());
+      if (n == value_remaining) {
+         if (handler.value) {
+            handler.value(value_tag, byte_view {value_buffer}, 0);
+         }
+         value_buffer.clear();
+      }
+   }
+
+   value_offset += n;
+   value_remaining -= n;
+   pos += n;
+   if (value_remaining == 0) {
+      in_value = false;
+      close_frames();
+   }
+   return n;
+}
+
+void stream_parser::close_frames()
+{
+   while (!frames.empty() && frames.top().end == pos) {
+      end_frame(frames.top().type);
+   }
+}
+
+void stream_parser::end_frame(FRAME type)
+{
+   if (frames.empty() || (frames.top().type == FRAME::ITEM) != (type == FRAME::ITEM)) {
+      throw std::runtime_error {"Unexpected delimitation item at byte " + std::to_string(pos)};
+   }
+   frame f = frames.top();
+   frames.pop();
+   if (f.type == FRAME::ITEM) {
+      if (handler.item_end) {
+         handler.item_end();
+      }
+   } else {
+      if (handler.sequence_end) {
+         handler.sequence_end(f.tag);
+      }
+   }
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,143 @@
+#ifndef STREAM_PARSER_HPP
+#define STREAM_PARSER_HPP
+
+#include <array>
+#include <functional>
+#include <stack>
+#include <vector>
+#include <cstddef>
+
+#include "transfer_processor.hpp"
+#include "data/attribute/attribute.hpp"
+#include "data/attribute/byte_view.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dataset
+{
+
+/**
+ * @brief The stream_handler struct bundles the callbacks invoked by the
+ *        stream_parser. Unset callbacks are skipped.
+ */
+struct stream_handler
+{
+      /**
+       * element is called for each attribute header, except for sequences,
+       * items and delimitation items.
+       */
+      std::function<void(attribute::tag_type tag, attribute::VR vr, std::size_t len)> element;
+
+      /**
+       * value is called with (a part of) the value field of the last element
+       * or encapsulated fragment. offset is the position of the chunk within
+       * the value field.
+       */
+      std::function<void(attribute::tag_type tag, attribute::byte_view chunk, std::size_t offset)> value;
+
+      /**
+       * sequence_begin is called for sequences and for encapsulated pixel
+       * data, whose fragments are reported as items.
+       */
+      std::function<void(attribute::tag_type tag, std::size_t len)> sequence_begin;
+      std::function<void(attribute::tag_type tag)> sequence_end;
+
+      std::function<void(std::size_t len)> item_begin;
+      std::function<void()> item_end;
+};
+
+/**
+ * @brief The stream_parser class is a resumable, push-based parser for
+ *        serialized datasets.
+ * The serialized set may be fed in chunks of arbitrary size, and the parser
+ * reports its structure as events while the data arrives, using the VR and
+ * length decoding of the given transfer processor. It never holds more than
+ * one attribute header and at most value_buffer_size bytes of a value, so
+ * objects of any size are processed with constant memory: values up to
+ * value_buffer_size bytes are delivered in one piece, larger ones in the
+ * chunks they were fed in.
+ */
+class stream_parser
+{
+   public:
+      /**
+       * @brief stream_parser constructor
+       * @param processor transfer processor of the serialized data, must
+       *        outlive the parser
+       * @param handler callbacks for the parse events
+       * @param value_buffer_size maximum size of values delivered in one piece
+       */
+      stream_parser(const transfer_processor& processor,
+                    stream_handler handler,
+                    std::size_t value_buffer_size = 4096);
+
+      /**
+       * @brief feed parses the next chunk of the serialized data, invoking the
+       *        handlers for all completed parts. The chunk is not referenced
+       *        after the call returns.
+       * @param chunk next part of the serialized data
+       */
+      void feed(attribute::byte_view chunk);
+
+      /**
+       * @brief finish asserts that the fed data ended with a complete set
+       * @throws std::runtime_error if an attribute, item or sequence is
+       *         incomplete
+       */
+      void finish() const;
+
+      /**
+       * @brief position returns the number of bytes consumed
+       */
+      std::size_t position() const;
+
+   private:
+      enum class FRAME
+      {
+         SEQUENCE, FRAGMENTS, ITEM
+      };
+
+      struct frame
+      {
+            FRAME type;
+            attribute::tag_type tag;
+            std::size_t end;
+      };
+
+      static constexpr std::size_t max_header_size = 12;
+
+      const transfer_processor& processor;
+      stream_handler handler;
+      const std::size_t value_buffer_size;
+
+      std::size_t pos;
+      std::stack<frame> frames;
+
+      std::array<unsigned char, max_header_size> header;
+      std::size_t header_fill;
+
+      bool in_value;
+      attribute::tag_type value_tag;
+      std::size_t value_remaining;
+      std::size_t value_offset;
+      std::vector<unsigned char> value_buffer;
+
+      std::size_t header_size() const;
+      void dispatch_header();
+      void begin_value(attribute::tag_type tag, std::size_t len);
+      std::size_t consume_value(attribute::byte_view chunk);
+      void close_frames();
+      void end_frame(FRAME type);
+};
+
+}
+
+}
+
+}
+
+#endif // STREAM_PARSER_HPP
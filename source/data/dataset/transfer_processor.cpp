@@ -5,13 +5,17 @@
 #include <vector>
 #include <string>
 #include <algorithm>
+#include <functional>
+#include <typeinfo>
+#include <cassert>
+#include <stdexcept>
 
 #include <boost/log/trivial.hpp>
 
 #include "data/attribute/attribute_field_coder.hpp"
+#include "data/attribute/lazy_element_field.hpp"
 #include "data/attribute/constants.hpp"
 #include "data/dictionary/dictionary_entry.hpp" // vr of string
-#include "dataset_iterator.hpp"
 
 namespace dicom
 {
@@ -30,8 +34,20 @@ static const std::vector<VR> specialVRs {VR::OB, VR::OW, VR::OF, VR::SQ, VR::UR,
 
 static const std::vector<tag_type> item_attributes {Item, ItemDelimitationItem, SequenceDelimitationItem};
 
+/**
+ * @brief check_length throws if a value field or a nested set of len bytes
+ *        starting at pos exceeds the enclosing set ending at end, so that a
+ *        truncated or malformed stream is not read beyond its end.
+ */
+static void check_length(std::size_t pos, std::size_t len, std::size_t end)
+{
+   if (pos > end || len > end - pos) {
+      throw std::runtime_error {"Length of a data element exceeds the enclosing data"};
+   }
+}
+
 
-std::size_t dataset_bytesize(dicom::data::dataset::dataset_type data, const transfer_processor& transfer_proc)
+std::size_t dataset_bytesize(const dicom::data::dataset::dataset_type& data, const transfer_processor& transfer_proc)
 {
    return std::accumulate(data.begin(), data.end(), 0,
       [&transfer_proc](int acc, const std::pair<const tag_type, elementfield>& attr)
@@ -100,80 +116,12 @@ std::size_t transfer_processor::dataelement_length(const std::pair<tag_type, con
    }
 }
 
-std::size_t transfer_processor::calculate_item_lengths(dataset::dataset_type& dataset) const
-{
-   std::size_t accu = 0;
-
-   // skip undefined length items. The accumulator for this sequence will stay at 0.
-   // This is ok since it is not used for the sequence length, since when one item
-   // length is undefined, the sequence length is necessarily undefined as well.
-   if (dataset.count(Item) > 0 && dataset[Item].value_len == 0xffffffff) {
-      return accu;
-   }
-
-   // item only contains "item type" tags, so the length is essentially zero.
-   if (dataset.size() == 3 &&
-       std::all_of(dataset.begin(), dataset.end(),
-                   [](std::pair<const tag_type, elementfield> attr)
-                     { return is_item_attribute(attr.first); })) {
-      return 0;
-   }
-
-
-   for (auto& attr : dataset) {
-      VR repr;
-      if (vrtype == VR_TYPE::EXPLICIT) {
-         repr = attr.second.value_rep.get();
-      } else {
-         repr = get_vr(attr.first);
-      }
-
-      if (repr != VR::SQ && !is_item_attribute(attr.first)) {
-         accu += dataelement_length(attr);
-      } else if (repr == VR::SQ) {
-         // now handle all sequence items
-         // sequences with undefined length need to be checked as well
-         // because they may contain items with defined length
-         typename type_of<VR::SQ>::type data;
-         get_value_field<VR::SQ>(attr.second, data);
-         std::size_t sequencesize = 0;
-         for (dataset_type& itemset : data) {            
-            auto itemsize = calculate_item_lengths(itemset);
-            if (itemsize > 0) {
-               itemset[Item].value_len = itemsize;
-               sequencesize += itemsize + 8;
-            } else {
-               // subset only contains delimitation items. When we write with
-               // explicit lengths, this amounts to a sequence of size zero.
-               if (std::all_of(itemset.begin(), itemset.end(),
-                               [](std::pair<const tag_type, elementfield> attr) {
-                                 return attr.first == ItemDelimitationItem
-                                    || attr.first == SequenceDelimitationItem; }))
-               {
-                  sequencesize += 0;
-               } else {
-                  sequencesize += 8;
-               }
-            }
-         }
-
-         if (attr.second.value_len != 0xffffffff) {
-            attr.second.value_len = sequencesize;
-            set_value_field<VR::SQ>(attr.second, data);
-            accu += dataelement_length(attr); // update the sequence length
-         }
-      }
-   }
-   return accu;
-}
-
-
 transfer_processor::~transfer_processor()
 {
 }
 
 
-std::size_t transfer_processor::find_enclosing(const std::vector<unsigned char>& data, std::size_t beg) const
+std::size_t transfer_processor::find_enclosing(attribute::byte_view data, std::size_t beg) const
 {
    std::size_t pos = beg;
    int nested_sets = 0;
@@ -203,6 +151,7 @@ std::size_t transfer_processor::find_enclosing(const std::vector<unsigned char>&
       if ((value_len & 0xffffffff) == 0xffffffff) {
          beginnings.push(pos);
       } else {
+         check_length(pos, value_len, data.size());
          pos += value_len;
       }
 
@@ -218,7 +167,41 @@ commandset_processor::commandset_processor(dictionary::dictionaries& dict):
 }
 
 
-dataset_type transfer_processor::deserialize(std::vector<unsigned char> data) const
+dataset_type transfer_processor::deserialize(const std::vector<unsigned char>& data) const
+{
+   return deserialize(byte_view {data});
+}
+
+dataset_type transfer_processor::deserialize(const unsigned char* data, std::size_t size) const
+{
+   return deserialize(byte_view {data, size});
+}
+
+dataset_type transfer_processor::deserialize(byte_view data) const
+{
+   return deserialize_set(data, nullptr, parse_filter {});
+}
+
+dataset_type transfer_processor::deserialize(byte_view data, const parse_filter& filter) const
+{
+   return deserialize_set(data, nullptr, filter);
+}
+
+dataset_type transfer_processor::deserialize_lazy(std::shared_ptr<const std::vector<unsigned char>> data) const
+{
+   byte_view view {*data};
+   return deserialize_set(view, std::move(data), parse_filter {});
+}
+
+dataset_type transfer_processor::deserialize_lazy(byte_view data, std::shared_ptr<const void> owner,
+                                                  const parse_filter& filter) const
+{
+   assert(owner);
+   return deserialize_set(data, std::move(owner), filter);
+}
+
+dataset_type transfer_processor::deserialize_set(byte_view data, std::shared_ptr<const void> owner,
+                                                 const parse_filter& filter) const
 {
    dataset_type dataset;
    std::vector<dataset_type> outerset {dataset};
@@ -257,10 +240,26 @@ dataset_type transfer_processor::deserialize(std::vector<unsigned char> data) co
          assert(!current_sequence.top().empty());
 
          tag_type tag = decode_tag(data, pos, endianness);
+         bool top_level = (current_sequence.size() == 1);
+         if (top_level && filter.stop_after.is_initialized() && *filter.stop_after < tag) {
+            pos = current_data.top().second;
+            break;
+         }
          pos += 4;
 
          VR repr = deserialize_VR(data, tag, pos);
          std::size_t value_len = deserialize_length(data, tag, repr, pos);
+         if ((value_len & 0xffffffff) != 0xffffffff) {
+            check_length(pos, value_len, current_data.top().second);
+         }
+
+         // skip filtered attributes without decoding their values
+         if (top_level && !filter.includes(tag)) {
+            pos += ((value_len & 0xffffffff) == 0xffffffff)
+                  ? find_enclosing(data, pos)
+                  : value_len;
+            continue;
+         }
 
 
          // Items and DelimitationItems do not have a VR or length field and are
@@ -272,13 +271,20 @@ dataset_type transfer_processor::deserialize(std::vector<unsigned char> data) co
             // state of the deserialization on appropriate stacks.
             if (repr == VR::SQ) {
                undefined_length_sequence = ((value_len & 0xffffffff) == 0xffffffff);
-               value_len = ((value_len & 0xffffffff) == 0xffffffff)
-                     ? find_enclosing(data, pos)
-                     : value_len;
+               if (undefined_length_sequence) {
+                  value_len = find_enclosing(data, pos);
+                  check_length(pos, value_len, current_data.top().second);
+               }
                current_data.push({pos, pos+value_len});
                current_sequence.push({dataset_type {}});
                positions.push(current_data.top().first);
                lasttag.push({tag, undefined_length_sequence ? 0xffffffff : value_len});
+            } else if (pool && intern_pool::interns(repr) && value_len != 0xffffffff) {
+               current_sequence.top().back().emplace(tag, pool->intern(repr, data.subview(pos, value_len)));
+            } else if (owner && value_len != 0xffffffff) {
+               // undefined length (encapsulated) values are always decoded
+               // by the transfer syntax immediately
+               current_sequence.top().back().emplace(tag, make_lazy_elementfield(repr, data.subview(pos, value_len), owner, endianness));
             } else {
                //auto multiplicity = get_dictionary().lookup(tag).vm;
                current_sequence.top().back().emplace(tag, std::move(deserialize_attribute(data, endianness, value_len, repr, "*", pos)));
@@ -353,10 +359,11 @@ dataset_type transfer_processor::deserialize(std::vector<unsigned char> data) co
 }
 
 
-VR transfer_processor::deserialize_VR(const std::vector<unsigned char>& dataset, tag_type tag, std::size_t& pos) const
+VR transfer_processor::deserialize_VR(attribute::byte_view dataset, tag_type tag, std::size_t& pos) const
 {
    if (!is_item_attribute(tag)) {
       if (vrtype != VR_TYPE::IMPLICIT) {
+         check_length(pos, 2, dataset.size());
          VR repr = dictionary::dictionary_entry::vr_of_string
                .left.at(std::string {dataset.begin()+pos, dataset.begin()+pos+2});
          if (is_special_VR(repr)) {
@@ -372,7 +379,7 @@ VR transfer_processor::deserialize_VR(const std::vector<unsigned char>& dataset,
    return VR::NN;
 }
 
-std::size_t transfer_processor::deserialize_length(const std::vector<unsigned char>& dataset,
+std::size_t transfer_processor::deserialize_length(attribute::byte_view dataset,
                                                    attribute::tag_type tag,
                                                    VR repr, std::size_t& pos) const
 {
@@ -394,94 +401,291 @@ std::size_t transfer_processor::deserialize_length(const std::vector<unsigned ch
 }
 
 
-std::vector<unsigned char> commandset_processor::serialize_attribute(elementfield& e, ENDIANNESS end, VR vr) const
+/**
+ * @brief The serialization_output class collects the output of the
+ *        serializer. If a sink is set, the collected data is passed on to it
+ *        whenever the buffer exceeds the chunk size.
+ */
+class serialization_output
 {
-   return encode_value_field(e, end, vr);
+   public:
+      explicit serialization_output(std::vector<unsigned char>& buffer):
+         buffer {buffer},
+         sink {nullptr},
+         chunk_size {0}
+      {
+      }
+
+      serialization_output(std::vector<unsigned char>& buffer,
+                           const std::function<void(byte_view)>& sink,
+                           std::size_t chunk_size):
+         buffer {buffer},
+         sink {&sink},
+         chunk_size {chunk_size}
+      {
+      }
+
+      /**
+       * @brief data returns the buffer for the encoders to append to
+       */
+      std::vector<unsigned char>& data() { return buffer; }
+
+      /**
+       * @brief write appends already serialized data. Data exceeding the
+       *        chunk size is passed to the sink directly.
+       */
+      void write(byte_view data)
+      {
+         if (sink != nullptr && data.size() >= chunk_size) {
+            flush();
+            (*sink)(data);
+         } else {
+            buffer.insert(buffer.end(), data.begin(), data.end());
+         }
+      }
+
+      /**
+       * @brief commit is called after each attribute and passes the buffer
+       *        to the sink if it is full.
+       */
+      void commit()
+      {
+         if (sink != nullptr && buffer.size() >= chunk_size) {
+            flush();
+         }
+      }
+
+      void flush()
+      {
+         if (sink != nullptr && !buffer.empty()) {
+            (*sink)(byte_view {buffer});
+            buffer.clear();
+         }
+      }
+
+   private:
+      std::vector<unsigned char>& buffer;
+      const std::function<void(byte_view)>* sink;
+      std::size_t chunk_size;
+};
+
+
+void commandset_processor::serialize_attribute(const elementfield& e, ENDIANNESS end, VR vr,
+                                               std::vector<unsigned char>& out) const
+{
+   encode_value_field(e, end, vr, out);
 }
 
-std::vector<unsigned char> transfer_processor::serialize(iod dataset) const
+std::size_t transfer_processor::serialized_attribute_size(const elementfield& e, VR vr) const
 {
-   calculate_item_lengths(dataset);
+   return encoded_value_size(e, vr);
+}
 
+std::vector<unsigned char> transfer_processor::serialize(const iod& dataset) const
+{
    std::vector<unsigned char> stream;
-   bool explicit_length_item = true;
-   bool explicit_length_sequence = true;
-   for (auto attr : dataset_iterator_adaptor(dataset)) {
-      if (attr.first == SequenceDelimitationItem) {
-         if (!explicit_length_sequence) {
-            auto tag = encode_tag(attr.first, endianness);
-            auto len = encode_len(4, attr.second.value_len, endianness);
-            stream.insert(stream.end(), tag.begin(), tag.end());
-            stream.insert(stream.end(), len.begin(), len.end());
-         }
-         continue;
+   serialize(dataset, stream);
+   return stream;
+}
+
+void transfer_processor::serialize(const iod& dataset, std::vector<unsigned char>& out) const
+{
+   std::vector<std::size_t> lengths;
+   const auto size = measure_set(dataset, false, false, lengths);
+   const auto begin = out.size();
+   out.reserve(begin + size);
+
+   serialization_output output {out};
+   std::size_t next = 0;
+   write_set(dataset, false, false, lengths, next, output);
+   assert(next == lengths.size());
+   assert(out.size() - begin == size);
+}
+
+void transfer_processor::serialize(const iod& dataset, const std::function<void(byte_view)>& sink,
+                                   std::size_t chunk_size) const
+{
+   std::vector<std::size_t> lengths;
+   measure_set(dataset, false, false, lengths);
+
+   std::vector<unsigned char> buffer;
+   buffer.reserve(chunk_size);
+   serialization_output output {buffer, sink, chunk_size};
+   std::size_t next = 0;
+   write_set(dataset, false, false, lengths, next, output);
+   output.flush();
+}
+
+std::size_t transfer_processor::serialized_size(const iod& dataset) const
+{
+   std::vector<std::size_t> lengths;
+   return measure_set(dataset, false, false, lengths);
+}
+
+VR transfer_processor::attribute_vr(const std::pair<const tag_type, elementfield>& attr) const
+{
+   if (vrtype == VR_TYPE::EXPLICIT || attr.second.value_rep.is_initialized()) {
+      return attr.second.value_rep.get();
+   }
+   return get_vr(attr.first);
+}
+
+std::size_t transfer_processor::measure_set(const dataset_type& set, bool item, bool undefined_sequence,
+                                            std::vector<std::size_t>& lengths) const
+{
+   std::size_t slot = lengths.size();
+   bool header = false;
+   bool undefined_item = false;
+   if (item) {
+      lengths.push_back(0);
+      auto it = set.find(Item);
+      header = it != set.end();
+      undefined_item = header && it->second.value_len == 0xffffffff;
+   }
+
+   std::size_t content = 0;
+   std::size_t delimiters = 0;
+   for (const auto& attr : set) {
+      if (attr.first == Item) {
+         delimiters += item ? 0 : 8;
       } else if (attr.first == ItemDelimitationItem) {
-         if (!explicit_length_item)  {
-            auto tag = encode_tag(attr.first, endianness);
-            auto len = encode_len(4, attr.second.value_len, endianness);
-            stream.insert(stream.end(), tag.begin(), tag.end());
-            stream.insert(stream.end(), len.begin(), len.end());
-         }
-         continue;
-      } else if (attr.first == Item) {
-         auto tag = encode_tag(attr.first, endianness);
-         auto len = encode_len(4, attr.second.value_len, endianness);
-         stream.insert(stream.end(), tag.begin(), tag.end());
-         stream.insert(stream.end(), len.begin(), len.end());
-         explicit_length_item = (attr.second.value_len != 0xffffffff);
-         continue;
+         delimiters += undefined_item ? 8 : 0;
+      } else if (attr.first == SequenceDelimitationItem) {
+         delimiters += undefined_sequence ? 8 : 0;
+      } else {
+         content += measure_attribute(attr, lengths);
       }
+   }
 
-      VR repr;
-      if (vrtype == VR_TYPE::EXPLICIT || attr.second.value_rep.is_initialized()) {
-         repr = attr.second.value_rep.get();
-      } else {
-         repr = get_vr(attr.first);
-      }
-
-      auto& value_field = attr.second;
-      auto data = serialize_attribute(value_field, endianness, repr);
-      std::size_t value_length = value_field.value_len;
-      if (data.size() != value_field.value_len
-          && value_field.value_len != 0xffffffff) {
-
-         if (value_field.value_rep.is_initialized() &&
-             *value_field.value_rep != VR::SQ &&
-             *value_field.value_rep != VR::NN &&
-             *value_field.value_rep != VR::NI) {
-            BOOST_LOG_SEV(logger, warning) << "Mismatched value lengths for tag "
-                                           << attr.first << ": Expected "
-                                           << value_field.value_len << ", actual "
-                                           << data.size();
-            value_length = data.size();
+   if (item) {
+      lengths[slot] = content;
+      // items without an Item attribute are written with an explicit header
+      header = header || content > 0;
+   }
+   return (header ? 8 : 0) + content + delimiters;
+}
+
+std::size_t transfer_processor::measure_attribute(const std::pair<const tag_type, elementfield>& attr,
+                                                  std::vector<std::size_t>& lengths) const
+{
+   const elementfield& ef = attr.second;
+   VR repr = attribute_vr(attr);
+   std::size_t size = (vrtype == VR_TYPE::EXPLICIT && is_special_VR(repr)) ? 12 : 8;
+
+   if (repr == VR::SQ) {
+      std::size_t slot = lengths.size();
+      lengths.push_back(0);
+      bool undefined = ef.value_len == 0xffffffff;
+      std::size_t items = 0;
+      for (const auto& itemset : get_value_field_ref<VR::SQ>(ef)) {
+         if (!itemset.empty()) {
+            items += measure_set(itemset, true, undefined, lengths);
          }
       }
+      lengths[slot] = items;
+      return size + items;
+   }
 
-      auto tag = encode_tag(attr.first, endianness);
-      std::vector<unsigned char> len;
-      stream.insert(stream.end(), tag.begin(), tag.end());
-      if (vrtype == VR_TYPE::EXPLICIT) {
-         auto vr = dictionary::dictionary_entry::vr_of_string.right.at(repr);
-         stream.insert(stream.end(), vr.begin(), vr.begin()+2);
-         if (is_special_VR(repr)) {
-            stream.push_back(0x00); stream.push_back(0x00);
-            len = encode_len(4, value_length, endianness);
-         } else {
-            len = encode_len(2, value_length, endianness);
+   auto raw = ef.value_field->raw(endianness);
+   return size + (raw.is_initialized() ? raw->size() : serialized_attribute_size(ef, repr));
+}
+
+void transfer_processor::write_set(const dataset_type& set, bool item, bool undefined_sequence,
+                                   const std::vector<std::size_t>& lengths, std::size_t& next,
+                                   serialization_output& out) const
+{
+   bool undefined_item = false;
+   if (item) {
+      auto length = lengths[next++];
+      auto header = set.find(Item);
+      if (header != set.end()) {
+         undefined_item = header->second.value_len == 0xffffffff;
+         length = undefined_item ? 0xffffffff : length;
+      }
+      if (header != set.end() || length > 0) {
+         encode_tag(Item, endianness, out.data());
+         encode_len(4, length, endianness, out.data());
+      }
+   }
+
+   for (const auto& attr : set) {
+      bool delimiter = (attr.first == Item && !item)
+            || (attr.first == ItemDelimitationItem && undefined_item)
+            || (attr.first == SequenceDelimitationItem && undefined_sequence);
+      if (delimiter) {
+         encode_tag(attr.first, endianness, out.data());
+         encode_len(4, attr.second.value_len, endianness, out.data());
+      } else if (!is_item_attribute(attr.first)) {
+         write_attribute(attr, lengths, next, out);
+      }
+      out.commit();
+   }
+}
+
+void transfer_processor::write_attribute(const std::pair<const tag_type, elementfield>& attr,
+                                         const std::vector<std::size_t>& lengths, std::size_t& next,
+                                         serialization_output& out) const
+{
+   const elementfield& ef = attr.second;
+   VR repr = attribute_vr(attr);
+
+   if (repr == VR::SQ) {
+      bool undefined = ef.value_len == 0xffffffff;
+      auto length = lengths[next++];
+      write_header(attr.first, repr, undefined ? 0xffffffff : length, out.data());
+      for (const auto& itemset : get_value_field_ref<VR::SQ>(ef)) {
+         if (!itemset.empty()) {
+            write_set(itemset, true, undefined, lengths, next, out);
          }
-      } else {
-         len = encode_len(4, value_length, endianness);
       }
+      return;
+   }
 
-      if (repr == VR::SQ)
-      {
-         explicit_length_sequence = (attr.second.value_len != 0xffffffff);
+   // untouched lazily decoded values are copied verbatim
+   auto raw = ef.value_field->raw(endianness);
+   std::size_t size = raw.is_initialized() ? raw->size() : serialized_attribute_size(ef, repr);
+   std::size_t value_length = ef.value_len;
+   if (!raw.is_initialized() && repr == VR::OB
+       && get_value_field_ref<VR::OB>(ef).type() == typeid(attribute::encapsulated)) {
+      // encapsulated pixel data is always of undefined length
+      value_length = 0xffffffff;
+   } else if (size != ef.value_len && ef.value_len != 0xffffffff) {
+      if (ef.value_rep.is_initialized() &&
+          *ef.value_rep != VR::SQ &&
+          *ef.value_rep != VR::NN &&
+          *ef.value_rep != VR::NI) {
+         BOOST_LOG_SEV(logger, warning) << "Mismatched value lengths for tag "
+                                        << attr.first << ": Expected "
+                                        << ef.value_len << ", actual "
+                                        << size;
+         value_length = size;
       }
+   }
 
-      stream.insert(stream.end(), len.begin(), len.end());
-      stream.insert(stream.end(), data.begin(), data.end());
+   write_header(attr.first, repr, value_length, out.data());
+   if (raw.is_initialized()) {
+      out.write(*raw);
+   } else {
+      serialize_attribute(ef, endianness, repr, out.data());
+   }
+}
+
+void transfer_processor::write_header(tag_type tag, VR repr, std::size_t length,
+                                      std::vector<unsigned char>& out) const
+{
+   encode_tag(tag, endianness, out);
+   if (vrtype == VR_TYPE::EXPLICIT) {
+      const auto& vr = dictionary::dictionary_entry::vr_of_string.right.at(repr);
+      out.insert(out.end(), vr.begin(), vr.begin()+2);
+      if (is_special_VR(repr)) {
+         out.push_back(0x00); out.push_back(0x00);
+         encode_len(4, length, endianness, out);
+      } else {
+         encode_len(2, length, endianness, out);
+      }
+   } else {
+      encode_len(4, length, endianness, out);
    }
-   return stream;
 }
 
 std::string transfer_processor::get_transfer_syntax() const
@@ -489,7 +693,12 @@ std::string transfer_processor::get_transfer_syntax() const
    return transfer_syntax;
 }
 
-elementfield commandset_processor::deserialize_attribute(std::vector<unsigned char>& data,
+attribute::ENDIANNESS transfer_processor::get_endianness() const
+{
+   return endianness;
+}
+
+elementfield commandset_processor::deserialize_attribute(attribute::byte_view data,
                                                          attribute::ENDIANNESS end,
                                                        std::size_t len,
                                                        VR vr, std::string vm,
@@ -508,6 +717,7 @@ transfer_processor::transfer_processor(boost::optional<dictionary::dictionaries&
    transfer_syntax {tfs},
    vrtype {vrtype},
    endianness {endianness},
+   static_lookup {false},
    logger {"transfer processor"}
 {
    if (vrtype == VR_TYPE::IMPLICIT && !dict.is_initialized()) {
@@ -525,10 +735,22 @@ transfer_processor::transfer_processor(const transfer_processor& other):
    dict {other.dict},
    transfer_syntax {other.transfer_syntax},
    vrtype {other.vrtype},
+   pool {other.pool},
+   static_lookup {other.static_lookup},
    logger {"transfer processor"}
 {
 }
 
+void transfer_processor::set_intern_pool(std::shared_ptr<intern_pool> pool)
+{
+   this->pool = pool;
+}
+
+void transfer_processor::set_static_lookup(bool enabled)
+{
+   static_lookup = enabled;
+}
+
 VR transfer_processor::get_vr(tag_type tag) const
 {
    auto spectag = std::find_if(tstags.begin(), tstags.end(),
@@ -537,7 +759,8 @@ VR transfer_processor::get_vr(tag_type tag) const
              && (tag.element_id & vrt.eid_mask) == vrt.tag.element_id;
    });
    if (spectag == tstags.end()) {
-      return dict.get().lookup(tag).vr[0];
+      return static_lookup ? dict.get().lookup_static_vr(tag)
+                           : dict.get().lookup_vr(tag);
    } else {
       return spectag->vr;
    }
@@ -570,12 +793,13 @@ little_endian_implicit::little_endian_implicit(const little_endian_implicit& oth
 
 }
 
-std::vector<unsigned char> little_endian_implicit::serialize_attribute(elementfield& e, ENDIANNESS end, attribute::VR vr) const
+void little_endian_implicit::serialize_attribute(const elementfield& e, ENDIANNESS end, VR vr,
+                                                 std::vector<unsigned char>& out) const
 {
-   return encode_value_field(e, end, vr);
+   encode_value_field(e, end, vr, out);
 }
 
-elementfield little_endian_implicit::deserialize_attribute(std::vector<unsigned char>& data,
+elementfield little_endian_implicit::deserialize_attribute(attribute::byte_view data,
                                                            attribute::ENDIANNESS end,
                                                            std::size_t len, attribute::VR vr,
                                                            std::string vm,
@@ -616,12 +840,13 @@ little_endian_explicit::little_endian_explicit(dictionary::dictionaries& dict, s
 
 }
 
-std::vector<unsigned char> little_endian_explicit::serialize_attribute(elementfield& e, attribute::ENDIANNESS end, VR vr) const
+void little_endian_explicit::serialize_attribute(const elementfield& e, ENDIANNESS end, VR vr,
+                                                 std::vector<unsigned char>& out) const
 {
-   return encode_value_field(e, end, vr);
+   encode_value_field(e, end, vr, out);
 }
 
-elementfield little_endian_explicit::deserialize_attribute(std::vector<unsigned char>& data, ENDIANNESS end,
+elementfield little_endian_explicit::deserialize_attribute(attribute::byte_view data, ENDIANNESS end,
                                                            std::size_t len, VR vr, std::string vm,
                                                            std::size_t pos) const
 {
@@ -649,12 +874,13 @@ big_endian_explicit::big_endian_explicit(dictionary::dictionaries& dict, std::st
 
 }
 
-std::vector<unsigned char> big_endian_explicit::serialize_attribute(elementfield& e, attribute::ENDIANNESS end, VR vr) const
+void big_endian_explicit::serialize_attribute(const elementfield& e, ENDIANNESS end, VR vr,
+                                              std::vector<unsigned char>& out) const
 {
-   return encode_value_field(e, end, vr);
+   encode_value_field(e, end, vr, out);
 }
 
-elementfield big_endian_explicit::deserialize_attribute(std::vector<unsigned char>& data, ENDIANNESS end,
+elementfield big_endian_explicit::deserialize_attribute(attribute::byte_view data, ENDIANNESS end,
                                                            std::size_t len, VR vr, std::string vm,
                                                            std::size_t pos) const
 {
@@ -668,24 +894,31 @@ encapsulated::encapsulated(dictionary::dictionaries& dict, std::string transfer_
 
 }
 
-std::vector<unsigned char> encapsulated::serialize_attribute(elementfield& e, attribute::ENDIANNESS end, VR vr) const
+void encapsulated::serialize_attribute(const elementfield& e, ENDIANNESS end, VR vr,
+                                       std::vector<unsigned char>& out) const
 {
    if (vr == VR::OB) {
-      boost::variant<std::vector<unsigned char>, attribute::encapsulated> data;
-      get_value_field<VR::OB>(e, data);
+      const auto& data = get_value_field_ref<VR::OB>(e);
       if (data.type() == typeid(attribute::encapsulated)) {
-         e.value_len = 0xffffffff;
-         auto encapsulated = boost::get<attribute::encapsulated>(data);
-         return serialize_fragments(encapsulated);
-      } else {
-         return encode_value_field(e, end, vr);
+         serialize_fragments(boost::get<attribute::encapsulated>(data), out);
+         return;
       }
-   } else {
-      return encode_value_field(e, end, vr);
    }
+   encode_value_field(e, end, vr, out);
 }
 
-elementfield encapsulated::deserialize_attribute(std::vector<unsigned char>& data, ENDIANNESS end,
+std::size_t encapsulated::serialized_attribute_size(const elementfield& e, VR vr) const
+{
+   if (vr == VR::OB) {
+      const auto& data = get_value_field_ref<VR::OB>(e);
+      if (data.type() == typeid(attribute::encapsulated)) {
+         return fragments_size(boost::get<attribute::encapsulated>(data));
+      }
+   }
+   return encoded_value_size(e, vr);
+}
+
+elementfield encapsulated::deserialize_attribute(attribute::byte_view data, ENDIANNESS end,
                                                            std::size_t len, VR vr, std::string vm,
                                                            std::size_t pos) const
 {
@@ -700,7 +933,7 @@ elementfield encapsulated::deserialize_attribute(std::vector<unsigned char>& dat
    }
 }
 
-attribute::encapsulated encapsulated::deserialize_fragments(std::vector<unsigned char>& data, std::size_t pos, std::size_t& outsize) const
+attribute::encapsulated encapsulated::deserialize_fragments(attribute::byte_view data, std::size_t pos, std::size_t& outsize) const
 {
    attribute::encapsulated encapsulated_data;
    tag_type tag = decode_tag(data, pos, ENDIANNESS::LITTLE);
@@ -718,6 +951,7 @@ attribute::encapsulated encapsulated::deserialize_fragments(std::vector<unsigned
             // shall be Item
             auto item_length = deserialize_length(data, tag, VR::NI, pos);
             //pos += 4; // skip length
+            check_length(pos, item_length, data.size());
             encapsulated_data.push_fragment(std::vector<unsigned char>(data.begin()+pos, data.begin()+pos+item_length));
             pos += item_length;
 
@@ -751,6 +985,7 @@ attribute::encapsulated encapsulated::deserialize_fragments(std::vector<unsigned
                }
                itempos += 4;
                auto item_length = deserialize_length(data, tag, VR::NI, itempos);
+               check_length(itempos, item_length, data.size());
 
                encapsulated_data.push_fragment(std::vector<unsigned char>(data.begin()+itempos, data.begin()+itempos+item_length));
                itempos += item_length;
@@ -782,74 +1017,54 @@ attribute::encapsulated encapsulated::deserialize_fragments(std::vector<unsigned
    return encapsulated_data;
 }
 
-std::vector<unsigned char> encapsulated::serialize_fragments(attribute::encapsulated data) const
+void encapsulated::serialize_fragments(const attribute::encapsulated& data, std::vector<unsigned char>& out) const
 {
-   std::vector<unsigned char> encapsulated_data;
+   // write the basic offset table, which stays empty if there is no compressed
+   // frame data
+   std::size_t frames = 0;
+   if (data.have_compressed_frame_info()) {
+      for (std::size_t i=0; i<data.fragment_count(); ++i) {
+         frames += data.marks_frame_start(i) ? 1 : 0;
+      }
+   }
+   encode_tag(Item, endianness, out);
+   encode_len(4, frames * 4, endianness, out);
    if (data.have_compressed_frame_info()) {
-      // write basic offset table
-      std::vector<unsigned char> offset_table;
       std::size_t accu = 0;
       for (std::size_t i=0; i<data.fragment_count(); ++i) {
          if (data.marks_frame_start(i)) {
-            auto frag_len = encode_len(4, accu, endianness);
-            offset_table.insert(offset_table.end(), std::begin(frag_len), std::end(frag_len));
+            encode_len(4, accu, endianness, out);
          }
          accu += 4; // Item tag
          accu += 4; // Length field
-         const auto& fragment = data.get_fragment(i);
-         accu += fragment.size();
-      }
-
-      auto offset_table_entries = encode_len(4, offset_table.size(), endianness);
-      auto item_tag = encode_tag(Item, endianness);
-      encapsulated_data.insert(encapsulated_data.end(), std::begin(item_tag), std::end(item_tag));
-      encapsulated_data.insert(encapsulated_data.end(), std::begin(offset_table_entries), std::end(offset_table_entries));
-
-      std::copy(std::begin(offset_table), std::end(offset_table), std::back_inserter(encapsulated_data));
-
-      // now the actual values
-      for (std::size_t i=0; i<data.fragment_count(); ++i) {
-         const auto& fragment = data.get_fragment(i);
-
-         auto item_tag = encode_tag(Item, endianness);
-         encapsulated_data.insert(encapsulated_data.end(), std::begin(item_tag), std::end(item_tag));
-         auto frag_len = encode_len(4, fragment.size(), endianness);
-         encapsulated_data.insert(encapsulated_data.end(), std::begin(frag_len), std::end(frag_len));
-         std::copy(std::begin(fragment), std::end(fragment), std::back_inserter(encapsulated_data));
+         accu += data.get_fragment(i).size();
       }
+   }
 
-      // sequence delimitation item
-      auto seq_del = encode_tag(SequenceDelimitationItem, endianness);
-      auto zero_len = encode_len(4, 0, endianness);
-      encapsulated_data.insert(encapsulated_data.end(), std::begin(seq_del), std::end(seq_del));
-      encapsulated_data.insert(encapsulated_data.end(), std::begin(zero_len), std::end(zero_len));
-   } else {
-      // no compressed frame data
-
-      // write empty basic offset table
-      auto offset_table_entries = encode_len(4, 0, endianness);
-      auto item_tag = encode_tag(Item, endianness);
-      encapsulated_data.insert(encapsulated_data.end(), std::begin(item_tag), std::end(item_tag));
-      encapsulated_data.insert(encapsulated_data.end(), std::begin(offset_table_entries), std::end(offset_table_entries));
+   // now the actual values
+   for (std::size_t i=0; i<data.fragment_count(); ++i) {
+      const auto& fragment = data.get_fragment(i);
+      encode_tag(Item, endianness, out);
+      encode_len(4, fragment.size(), endianness, out);
+      out.insert(out.end(), fragment.begin(), fragment.end());
+   }
 
-      for (std::size_t i=0; i<data.fragment_count(); ++i) {
-         const auto& fragment = data.get_fragment(i);
+   // sequence delimitation item
+   encode_tag(SequenceDelimitationItem, endianness, out);
+   encode_len(4, 0, endianness, out);
+}
 
-         auto item_tag = encode_tag(Item, endianness);
-         encapsulated_data.insert(encapsulated_data.end(), std::begin(item_tag), std::end(item_tag));
-         auto frag_len = encode_len(4, fragment.size(), endianness);
-         encapsulated_data.insert(encapsulated_data.end(), std::begin(frag_len), std::end(frag_len));
-         std::copy(std::begin(fragment), std::end(fragment), std::back_inserter(encapsulated_data));
+std::size_t encapsulated::fragments_size(const attribute::encapsulated& data) const
+{
+   // basic offset table and sequence delimitation item
+   std::size_t size = 8 + 8;
+   for (std::size_t i=0; i<data.fragment_count(); ++i) {
+      if (data.have_compressed_frame_info() && data.marks_frame_start(i)) {
+         size += 4;
       }
-
-      // sequence delimitation item
-      auto seq_del = encode_tag(SequenceDelimitationItem, endianness);
-      auto zero_len = encode_len(4, 0, endianness);
-      encapsulated_data.insert(encapsulated_data.end(), std::begin(seq_del), std::end(seq_del));
-      encapsulated_data.insert(encapsulated_data.end(), std::begin(zero_len), std::end(zero_len));
+      size += 8 + data.get_fragment(i).size();
    }
-
-   return encapsulated_data;
+   return size;
 }
 
 
@@ -3,12 +3,17 @@
 
 #include <vector>
 #include <string>
+#include <memory>
+#include <set>
+#include <functional>
 
 #include "datasets.hpp"
 #include "data/dictionary/dictionary.hpp"
 #include "data/dictionary/datadictionary.hpp"
 #include "data/dictionary/dictionary_dyn.hpp"
 #include "data/attribute/attribute.hpp"
+#include "data/attribute/byte_view.hpp"
+#include "data/attribute/intern_pool.hpp"
 #include "util/channel_sev_logger.hpp"
 
 namespace dicom
@@ -25,11 +30,59 @@ namespace dataset
 {
 
 class transfer_processor;
+class stream_parser;
+class serialization_output;
 
 std::vector<std::string> supported_transfer_syntaxes();
 
 std::unique_ptr<transfer_processor> make_transfer_processor(std::string transfer_syntax_uid, dictionary::dictionaries& dict);
 
+/**
+ * @brief The parse_filter struct restricts the deserialization to a subset of
+ *        the top-level attributes of a set.
+ * Attributes which are filtered out are skipped by their length field, or by
+ * searching the enclosing delimitation item for undefined lengths, without
+ * decoding or copying their values. Nested sets of included sequences are
+ * deserialized completely.
+ */
+struct parse_filter
+{
+      /**
+       * if set, parsing stops at the first top-level attribute with a tag
+       * greater than this one.
+       */
+      boost::optional<attribute::tag_type> stop_after;
+
+      /**
+       * if not empty, only top-level attributes with these tags are
+       * deserialized.
+       */
+      std::set<attribute::tag_type> tags;
+
+      /**
+       * @brief includes checks if the given top-level tag passes the tag set
+       * @param tag tag to be checked
+       * @return true if the attribute shall be deserialized
+       */
+      bool includes(attribute::tag_type tag) const
+      {
+         return tags.empty() || tags.count(tag) > 0;
+      }
+};
+
+/**
+ * @brief The encoded_dataset struct refers to a serialized dataset owned by an
+ *        arbitrary object, like a mapped file, together with the transfer
+ *        syntax it is encoded in. It allows to pass a dataset on without
+ *        deserializing it.
+ */
+struct encoded_dataset
+{
+      attribute::byte_view data;
+      std::shared_ptr<const void> owner;
+      std::string transfer_syntax;
+};
+
 /**
  * @brief The transfer_processor class defines the interface for serializing
  *        and deserializing attribute sets (IODs), honoring the transfer
@@ -39,6 +92,8 @@ std::unique_ptr<transfer_processor> make_transfer_processor(std::string transfer
  */
 class transfer_processor
 {
+      friend class stream_parser;
+
    protected:
       /**
        * @brief The VR_TYPE enum defines if an explicit VR is used in the
@@ -99,7 +154,55 @@ class transfer_processor
        * @param data structured dataset to be serialized
        * @return bytestream of serialized data
        */
-      std::vector<unsigned char> serialize(iod data) const;
+      std::vector<unsigned char> serialize(const iod& data) const;
+
+      /**
+       * @brief serialize overload which appends the serialized data to out.
+       * The size of the output is computed once beforehand, so out is grown
+       * at most once and no intermediate buffers are allocated per attribute.
+       * @param data structured dataset to be serialized
+       * @param[out] out buffer the serialized data is appended to
+       */
+      void serialize(const iod& data, std::vector<unsigned char>& out) const;
+
+      /**
+       * @brief serialize overload which passes the serialized data to a sink
+       *        in consecutive chunks instead of collecting all of it.
+       * Values larger than the chunk size which are still in their serialized
+       * form are passed to the sink without being copied.
+       * @param data structured dataset to be serialized
+       * @param sink callable receiving the chunks in order. The viewed memory
+       *        is only valid for the duration of the call.
+       * @param chunk_size size of the internal buffer
+       */
+      void serialize(const iod& data, const std::function<void(attribute::byte_view)>& sink,
+                     std::size_t chunk_size = 64*1024) const;
+
+      /**
+       * @brief serialized_size returns the exact number of bytes serialize()
+       *        produces for the given set.
+       * @param data structured dataset
+       * @return size of the serialized set in bytes
+       */
+      std::size_t serialized_size(const iod& data) const;
+
+      /**
+       * @brief set_intern_pool makes subsequent deserializations take the
+       *        values of the short string VRs from the given pool, so that
+       *        values repeated across datasets are stored only once.
+       * @param pool pool to use, which may be shared by several processors,
+       *        or nullptr to decode each value separately
+       */
+      void set_intern_pool(std::shared_ptr<attribute::intern_pool> pool);
+
+      /**
+       * @brief set_static_lookup makes the VR lookups of implicit VR data
+       *        elements use only the compiled-in dictionary table, which does
+       *        not lock. Tags which are not part of it are decoded as UN.
+       * @param enabled true to skip the dictionary files, false to consult
+       *        them for tags missing from the table (default)
+       */
+      void set_static_lookup(bool enabled);
 
       /**
        * @brief deserialize shall be called to deserialize a datastream into
@@ -107,7 +210,55 @@ class transfer_processor
        * @param data datastream
        * @return structured attribute
        */
-      dataset_type deserialize(std::vector<unsigned char> data) const;
+      dataset_type deserialize(const std::vector<unsigned char>& data) const;
+
+      /**
+       * @brief deserialize overload which parses the serialized data in place
+       *        without taking a copy. The viewed memory must stay valid for
+       *        the duration of the call.
+       * @param data view on the datastream
+       * @return structured attribute
+       */
+      dataset_type deserialize(attribute::byte_view data) const;
+
+      /**
+       * @brief deserialize overload for a raw buffer of serialized data.
+       * @param data pointer to the first byte of the datastream
+       * @param size size of the datastream in bytes
+       * @return structured attribute
+       */
+      dataset_type deserialize(const unsigned char* data, std::size_t size) const;
+
+      /**
+       * @brief deserialize overload which only deserializes the attributes
+       *        passing the filter.
+       * @param data view on the datastream
+       * @param filter restriction of the deserialized attributes
+       * @return structured attribute
+       */
+      dataset_type deserialize(attribute::byte_view data, const parse_filter& filter) const;
+
+      /**
+       * @brief deserialize_lazy deserializes the datastream, but defers the
+       *        decoding of each value field until it is accessed.
+       * The returned set shares ownership of the datastream. Values which are
+       * never accessed are serialized by copying their original bytes if the
+       * byte order matches.
+       * @param data datastream
+       * @return structured attribute
+       */
+      dataset_type deserialize_lazy(std::shared_ptr<const std::vector<unsigned char>> data) const;
+
+      /**
+       * @brief deserialize_lazy overload for datastreams owned by an arbitrary
+       *        object, like a mapped file.
+       * @param data view on the datastream
+       * @param owner owner of the viewed memory, kept alive by the set
+       * @param filter restriction of the deserialized attributes
+       * @return structured attribute
+       */
+      dataset_type deserialize_lazy(attribute::byte_view data, std::shared_ptr<const void> owner,
+                                    const parse_filter& filter = parse_filter {}) const;
 
       /**
        * @brief get_transfer_syntax is used to acquire the UID of the classe's
@@ -116,6 +267,13 @@ class transfer_processor
        */
       std::string get_transfer_syntax() const;
 
+      /**
+       * @brief get_endianness returns the byte order of the implemented
+       *        transfer syntax.
+       * @return endianness of the serialized data
+       */
+      attribute::ENDIANNESS get_endianness() const;
+
       std::size_t dataelement_length(const std::pair<attribute::tag_type, const attribute::elementfield&>& attribute) const;
 
       virtual ~transfer_processor();
@@ -126,10 +284,21 @@ class transfer_processor
        *        transfer-syntax specific serialization of data.
        * @param e attribute
        * @param vr VR of the attribute
-       * @return vector of bytes with serialized data
+       * @param[out] out buffer the serialized value field is appended to
+       */
+      virtual void
+      serialize_attribute(const attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr,
+                          std::vector<unsigned char>& out) const = 0;
+
+      /**
+       * @brief serialized_attribute_size returns the number of bytes
+       *        serialize_attribute() appends for the attribute.
+       * @param e attribute
+       * @param vr VR of the attribute
+       * @return size of the serialized value field
        */
-      virtual std::vector<unsigned char>
-      serialize_attribute(attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr) const = 0;
+      virtual std::size_t
+      serialized_attribute_size(const attribute::elementfield& e, attribute::VR vr) const;
 
       /**
        * @brief deserialize_attribute is overriden by a subclass to implement
@@ -141,11 +310,22 @@ class transfer_processor
        * @return elementfield with structured data
        */
       virtual attribute::elementfield
-      deserialize_attribute(std::vector<unsigned char>& data,
+      deserialize_attribute(attribute::byte_view data,
                             attribute::ENDIANNESS end,
                             std::size_t len, attribute::VR vr, std::string vm,
                             std::size_t pos) const = 0;
 
+      /**
+       * @brief deserialize_set implements the deserialization of a set.
+       * @param data view on the datastream
+       * @param owner owner of the viewed memory if value fields shall be
+       *        decoded lazily, nullptr to decode them immediately
+       * @param filter restriction of the deserialized attributes
+       * @return structured attribute
+       */
+      dataset_type deserialize_set(attribute::byte_view data, std::shared_ptr<const void> owner,
+                                   const parse_filter& filter) const;
+
       /**
        * @brief deserialize_VR deserializes and returns the VR, which may be
        *        explicit or implicit.
@@ -154,7 +334,7 @@ class transfer_processor
        * @param[in, out] pos
        * @return deserialized VR
        */
-      attribute::VR deserialize_VR(const std::vector<unsigned char>& dataset,
+      attribute::VR deserialize_VR(attribute::byte_view dataset,
                                    attribute::tag_type tag,
                                    std::size_t& pos)  const;
 
@@ -166,7 +346,7 @@ class transfer_processor
        * @param[in, out] pos
        * @return length of the value field
        */
-      std::size_t deserialize_length(const std::vector<unsigned char>& dataset,
+      std::size_t deserialize_length(attribute::byte_view dataset,
                                      attribute::tag_type tag,
                                      attribute::VR repr,
                                      std::size_t& pos) const;
@@ -182,16 +362,48 @@ class transfer_processor
        * @param dict dictionary for the tag lookup
        * @return size of the nested set
        */
-      std::size_t find_enclosing(const std::vector<unsigned char>& data, std::size_t beg) const;
+      std::size_t find_enclosing(attribute::byte_view data, std::size_t beg) const;
+
+      /**
+       * @brief measure_set calculates the serialized size of a (nested) set.
+       * The lengths of the items and sequences are recorded in lengths in the
+       * order in which write_set() consumes them.
+       * @param set set to be measured
+       * @param item true if the set is an item of a sequence
+       * @param undefined_sequence true if the enclosing sequence is of
+       *        undefined length
+       * @param[out] lengths item and sequence lengths in serialization order
+       * @return size of the serialized set in bytes
+       */
+      std::size_t measure_set(const dataset_type& set, bool item, bool undefined_sequence,
+                              std::vector<std::size_t>& lengths) const;
+
+      std::size_t measure_attribute(const std::pair<const attribute::tag_type, attribute::elementfield>& attr,
+                                    std::vector<std::size_t>& lengths) const;
 
       /**
-       * @brief calculate_item_lengths calculates the correct sequence and item lengths
-       *        given the specified transfer syntax.
-       * @param dataset dataset which will receive updated length values
-       * @return byte length of the set given in the parameter minus any item and / or
-       *         sequence sizes which are undefined length.
+       * @brief write_set serializes a (nested) set into out, using the
+       *        lengths calculated by measure_set().
+       * @param set set to be serialized
+       * @param item true if the set is an item of a sequence
+       * @param undefined_sequence true if the enclosing sequence is of
+       *        undefined length
+       * @param lengths item and sequence lengths in serialization order
+       * @param[in, out] next index of the next length to be consumed
+       * @param out output of the serialized data
        */
-      std::size_t calculate_item_lengths(data::dataset::dataset_type& dataset) const;
+      void write_set(const dataset_type& set, bool item, bool undefined_sequence,
+                     const std::vector<std::size_t>& lengths, std::size_t& next,
+                     serialization_output& out) const;
+
+      void write_attribute(const std::pair<const attribute::tag_type, attribute::elementfield>& attr,
+                           const std::vector<std::size_t>& lengths, std::size_t& next,
+                           serialization_output& out) const;
+
+      void write_header(attribute::tag_type tag, attribute::VR repr, std::size_t length,
+                        std::vector<unsigned char>& out) const;
+
+      attribute::VR attribute_vr(const std::pair<const attribute::tag_type, attribute::elementfield>& attr) const;
 
       std::vector<vr_of_tag> tstags;
 
@@ -199,6 +411,8 @@ class transfer_processor
       const std::string transfer_syntax;
       VR_TYPE vrtype;
       attribute::ENDIANNESS endianness;
+      std::shared_ptr<attribute::intern_pool> pool;
+      bool static_lookup;
 
    protected:
       mutable dicom::util::log::channel_sev_logger logger;
@@ -215,11 +429,12 @@ class commandset_processor: public transfer_processor
       explicit commandset_processor(dictionary::dictionaries& dict);
 
    private:
-      virtual std::vector<unsigned char>
-      serialize_attribute(attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr) const override;
+      virtual void
+      serialize_attribute(const attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr,
+                          std::vector<unsigned char>& out) const override;
 
       virtual attribute::elementfield
-      deserialize_attribute(std::vector<unsigned char>& data,
+      deserialize_attribute(attribute::byte_view data,
                             attribute::ENDIANNESS end,
                             std::size_t len, attribute::VR vr, std::string vm,
                             std::size_t pos) const override;
@@ -238,11 +453,12 @@ class little_endian_implicit: public transfer_processor
       little_endian_implicit(const little_endian_implicit& other);
 
    private:
-      virtual std::vector<unsigned char>
-      serialize_attribute(attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr) const;
+      virtual void
+      serialize_attribute(const attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr,
+                          std::vector<unsigned char>& out) const;
 
       virtual attribute::elementfield
-      deserialize_attribute(std::vector<unsigned char>& data, attribute::ENDIANNESS end,
+      deserialize_attribute(attribute::byte_view data, attribute::ENDIANNESS end,
                             std::size_t len, attribute::VR vr, std::string vm,
                             std::size_t pos) const;
 };
@@ -254,11 +470,12 @@ class little_endian_explicit: public transfer_processor
                                       std::string transfer_syntax = "1.2.840.10008.1.2.1");
 
    private:
-      virtual std::vector<unsigned char>
-      serialize_attribute(attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr) const;
+      virtual void
+      serialize_attribute(const attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr,
+                          std::vector<unsigned char>& out) const;
 
       virtual attribute::elementfield
-      deserialize_attribute(std::vector<unsigned char>& data,
+      deserialize_attribute(attribute::byte_view data,
                             attribute::ENDIANNESS end,
                             std::size_t len, attribute::VR vr, std::string vm,
                             std::size_t pos) const;
@@ -271,11 +488,12 @@ class big_endian_explicit: public transfer_processor
                                    std::string transfer_syntax = "1.2.840.10008.1.2.2");
 
    private:
-      virtual std::vector<unsigned char>
-      serialize_attribute(attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr) const;
+      virtual void
+      serialize_attribute(const attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr,
+                          std::vector<unsigned char>& out) const;
 
       virtual attribute::elementfield
-      deserialize_attribute(std::vector<unsigned char>& data,
+      deserialize_attribute(attribute::byte_view data,
                             attribute::ENDIANNESS end,
                             std::size_t len, attribute::VR vr, std::string vm,
                             std::size_t pos) const;
@@ -288,18 +506,24 @@ class encapsulated: public little_endian_explicit
       explicit encapsulated(dictionary::dictionaries& dict, std::string transfer_syntax);
 
    private:
-      virtual std::vector<unsigned char>
-      serialize_attribute(attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr) const;
+      virtual void
+      serialize_attribute(const attribute::elementfield& e, attribute::ENDIANNESS end, attribute::VR vr,
+                          std::vector<unsigned char>& out) const;
 
       virtual attribute::elementfield
-      deserialize_attribute(std::vector<unsigned char>& data,
+      deserialize_attribute(attribute::byte_view data,
                             attribute::ENDIANNESS end,
                             std::size_t len, attribute::VR vr, std::string vm,
                             std::size_t pos) const;
 
-      attribute::encapsulated deserialize_fragments(std::vector<unsigned char>& data, std::size_t pos, std::size_t& outsize) const;
+      attribute::encapsulated deserialize_fragments(attribute::byte_view data, std::size_t pos, std::size_t& outsize) const;
+
+      virtual std::size_t
+      serialized_attribute_size(const attribute::elementfield& e, attribute::VR vr) const;
+
+      void serialize_fragments(const attribute::encapsulated& data, std::vector<unsigned char>& out) const;
 
-      std::vector<unsigned char> serialize_fragments(attribute::encapsulated data) const;
+      std::size_t fragments_size(const attribute::encapsulated& data) const;
 };
 
 
@@ -311,7 +535,7 @@ class encapsulated: public little_endian_explicit
  *        calculation
  * @return size of the dataset in bytes
  */
-std::size_t dataset_bytesize(dataset_type data, const transfer_processor& transfer_proc);
+std::size_t dataset_bytesize(const dataset_type& data, const transfer_processor& transfer_proc);
 
 
 }
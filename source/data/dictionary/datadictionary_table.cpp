@@ -0,0 +1,3602 @@
+#include "datadictionary_table.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dictionary
+{
+
+// This file is generated by tools/gendatatic.sh -t from the data dictionary.
+
+const datadictionary_table_entry datadictionary_table[] =
+{
+   {0x0008, 0x0001, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Length to End", "LengthToEnd", "1", true},
+   {0x0008, 0x0005, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Specific Character", "SpecificCharacterSet", "1-", false},
+   {0x0008, 0x0006, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Language Code", "LanguageCodeSequence", "1", false},
+   {0x0008, 0x0008, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Type", "ImageType", "2-", false},
+   {0x0008, 0x0010, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Recognition Code", "RecognitionCode", "1", true},
+   {0x0008, 0x0012, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Instance Creation", "InstanceCreationDate", "1", false},
+   {0x0008, 0x0013, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Instance Creation", "InstanceCreationTime", "1", false},
+   {0x0008, 0x0014, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Instance Creator", "InstanceCreatorUID", "1", false},
+   {0x0008, 0x0016, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "SOP Class UID", "SOPClassUID", "1", false},
+   {0x0008, 0x0018, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "SOP Instance UID", "SOPInstanceUID", "1", false},
+   {0x0008, 0x001a, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Related General SOP", "RelatedGeneralSOPClassUID", "1-", false},
+   {0x0008, 0x001b, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Specialized SOP", "OriginalSpecializedSOPClassUID", "1", false},
+   {0x0008, 0x0020, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Study Date", "StudyDate", "1", false},
+   {0x0008, 0x0021, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Series Date", "SeriesDate", "1", false},
+   {0x0008, 0x0022, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Acquisition Date", "AcquisitionDate", "1", false},
+   {0x0008, 0x0023, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Content Date", "ContentDate", "1", false},
+   {0x0008, 0x0024, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Overlay Date", "OverlayDate", "1", true},
+   {0x0008, 0x0025, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Curve Date", "CurveDate", "1", true},
+   {0x0008, 0x002a, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "AcquisitionDateTime", "1", false},
+   {0x0008, 0x0030, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Study Time", "StudyTime", "1", false},
+   {0x0008, 0x0031, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Series Time", "SeriesTime", "1", false},
+   {0x0008, 0x0032, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Acquisition Time", "AcquisitionTime", "1", false},
+   {0x0008, 0x0033, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Content Time", "ContentTime", "1", false},
+   {0x0008, 0x0034, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Overlay Time", "OverlayTime", "1", true},
+   {0x0008, 0x0035, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Curve Time", "CurveTime", "1", true},
+   {0x0008, 0x0040, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Data Set Type", "DataSetType", "1", true},
+   {0x0008, 0x0041, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Data Set Subtype", "DataSetSubtype", "1", true},
+   {0x0008, 0x0042, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Nuclear Medicine", "NuclearMedicineSeriesType", "1", true},
+   {0x0008, 0x0050, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Accession Number", "AccessionNumber", "1", false},
+   {0x0008, 0x0051, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Issuer of Accession", "IssuerOfAccessionNumberSequence", "1", false},
+   {0x0008, 0x0052, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Query/Retrieve", "QueryRetrieveLevel", "1", false},
+   {0x0008, 0x0054, 0xffff, 0xffff, {attribute::VR::AE, attribute::VR::NN, attribute::VR::NN}, "Retrieve AE Title", "RetrieveAETitle", "1-", false},
+   {0x0008, 0x0056, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Instance", "InstanceAvailability", "1", false},
+   {0x0008, 0x0058, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Failed SOP Instance", "FailedSOPInstanceUIDList", "1-", false},
+   {0x0008, 0x0060, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Modality", "Modality", "1", false},
+   {0x0008, 0x0061, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Modalities in Study", "ModalitiesInStudy", "1-", false},
+   {0x0008, 0x0062, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "SOP Classes in", "SOPClassesInStudy", "1-", false},
+   {0x0008, 0x0064, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Conversion Type", "ConversionType", "1", false},
+   {0x0008, 0x0068, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Presentation Intent", "PresentationIntentType", "1", false},
+   {0x0008, 0x0070, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Manufacturer", "Manufacturer", "1", false},
+   {0x0008, 0x0080, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Institution Name", "InstitutionName", "1", false},
+   {0x0008, 0x0081, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Institution Address", "InstitutionAddress", "1", false},
+   {0x0008, 0x0082, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Institution Code", "InstitutionCodeSequence", "1", false},
+   {0x0008, 0x0090, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Referring", "ReferringPhysicianName", "1", false},
+   {0x0008, 0x0092, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Physicians", "ReferringPhysicianAddress", "1", false},
+   {0x0008, 0x0094, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Physicians", "ReferringPhysicianTelephoneNumbers", "n", false},
+   {0x0008, 0x0096, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification", "ReferringPhysicianIdentificationSequence", "1", false},
+   {0x0008, 0x0100, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Code Value", "CodeValue", "1", false},
+   {0x0008, 0x0102, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Coding Scheme", "CodingSchemeDesignator", "1", false},
+   {0x0008, 0x0103, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Coding Scheme", "CodingSchemeVersion", "1", false},
+   {0x0008, 0x0104, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Code Meaning", "CodeMeaning", "1", false},
+   {0x0008, 0x0105, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Mapping Resource", "MappingResource", "1", false},
+   {0x0008, 0x0106, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Context Group", "ContextGroupVersion", "1", false},
+   {0x0008, 0x0107, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Context Group Local", "ContextGroupLocalVersion", "1", false},
+   {0x0008, 0x010b, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Context Group", "ContextGroupExtensionFlag", "1", false},
+   {0x0008, 0x010c, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Coding Scheme UID", "CodingSchemeUID", "1", false},
+   {0x0008, 0x010d, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Extension Creator", "ContextGroupExtensionCreatorUID", "1", false},
+   {0x0008, 0x010f, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Context Identifier", "ContextIdentifier", "1", false},
+   {0x0008, 0x0110, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification", "CodingSchemeIdentificationSequence", "1", false},
+   {0x0008, 0x0112, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Coding Scheme", "CodingSchemeRegistry", "1", false},
+   {0x0008, 0x0114, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Coding Scheme", "CodingSchemeExternalID", "1", false},
+   {0x0008, 0x0115, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Coding Scheme Name", "CodingSchemeName", "1", false},
+   {0x0008, 0x0116, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Responsible", "CodingSchemeResponsibleOrganization", "1", false},
+   {0x0008, 0x0117, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Context UID", "ContextUID", "1", false},
+   {0x0008, 0x0201, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Timezone Offset", "TimezoneOffsetFromUTC", "1", false},
+   {0x0008, 0x1000, 0xffff, 0xffff, {attribute::VR::AE, attribute::VR::NN, attribute::VR::NN}, "Network ID", "NetworkID", "1", true},
+   {0x0008, 0x1010, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Station Name", "StationName", "1", false},
+   {0x0008, 0x1030, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Study Description", "StudyDescription", "1", false},
+   {0x0008, 0x1032, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Procedure Code", "ProcedureCodeSequence", "1", false},
+   {0x0008, 0x103e, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Series Description", "SeriesDescription", "1", false},
+   {0x0008, 0x103f, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Series Description", "SeriesDescriptionCodeSequence", "1", false},
+   {0x0008, 0x1040, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Institutional", "InstitutionalDepartmentName", "1", false},
+   {0x0008, 0x1048, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Physician(s) of", "PhysiciansOfRecord", "1-", false},
+   {0x0008, 0x1049, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Record", "PhysiciansOfRecordIdentificationSequence", "1", false},
+   {0x0008, 0x1050, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Performing", "PerformingPhysicianName", "1-", false},
+   {0x0008, 0x1052, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Physician", "PerformingPhysicianIdentificationSequence", "1", false},
+   {0x0008, 0x1060, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Name of Physician", "NameOfPhysiciansReadingStudy", "1-", false},
+   {0x0008, 0x1062, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Reading Study", "PhysiciansReadingStudyIdentificationSequence", "1", false},
+   {0x0008, 0x1070, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Operators Name", "OperatorsName", "1-", false},
+   {0x0008, 0x1072, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification", "OperatorIdentificationSequence", "1", false},
+   {0x0008, 0x1080, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Admitting Diagnoses", "AdmittingDiagnosesDescription", "1-", false},
+   {0x0008, 0x1084, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Admitting Diagnoses", "AdmittingDiagnosesCodeSequence", "1", false},
+   {0x0008, 0x1090, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Manufacturers", "ManufacturerModelName", "1", false},
+   {0x0008, 0x1100, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Results", "ReferencedResultsSequence", "1", true},
+   {0x0008, 0x1110, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Study", "ReferencedStudySequence", "1", false},
+   {0x0008, 0x1111, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "ReferencedPerformedProcedureStepSequence", "1", false},
+   {0x0008, 0x1115, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Series", "ReferencedSeriesSequence", "1", false},
+   {0x0008, 0x1120, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Patient", "ReferencedPatientSequence", "1", false},
+   {0x0008, 0x1125, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Visit", "ReferencedVisitSequence", "1", false},
+   {0x0008, 0x1130, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Overlay", "ReferencedOverlaySequence", "1", true},
+   {0x0008, 0x1134, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Stereometric", "ReferencedStereometricInstanceSequence", "1", false},
+   {0x0008, 0x113a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Waveform", "ReferencedWaveformSequence", "1", false},
+   {0x0008, 0x1140, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Image", "ReferencedImageSequence", "1", false},
+   {0x0008, 0x1145, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Curve", "ReferencedCurveSequence", "1", true},
+   {0x0008, 0x114a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Instance", "ReferencedInstanceSequence", "1", false},
+   {0x0008, 0x114b, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "World Value Mapping", "ReferencedRealWorldValueMappingInstanceSequence", "1", false},
+   {0x0008, 0x1150, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Referenced SOP", "ReferencedSOPClassUID", "1", false},
+   {0x0008, 0x1155, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Referenced SOP", "ReferencedSOPInstanceUID", "1", false},
+   {0x0008, 0x115a, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "SOP Classes", "SOPClassesSupported", "1-", false},
+   {0x0008, 0x1160, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Frame", "ReferencedFrameNumber", "1-", false},
+   {0x0008, 0x1161, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Simple Frame List", "SimpleFrameList", "1-", false},
+   {0x0008, 0x1162, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Calculated Frame", "CalculatedFrameList", "3-", false},
+   {0x0008, 0x1163, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Time Range", "TimeRange", "2", false},
+   {0x0008, 0x1164, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Extraction", "FrameExtractionSequence", "1", false},
+   {0x0008, 0x1167, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Multi-Frame Source", "MultiFrameSourceSOPInstanceUID", "1", false},
+   {0x0008, 0x1195, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Transaction UID", "TransactionUID", "1", false},
+   {0x0008, 0x1197, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Failure Reason", "FailureReason", "1", false},
+   {0x0008, 0x1198, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Failed SOP Sequence", "FailedSOPSequence", "1", false},
+   {0x0008, 0x1199, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced SOP", "ReferencedSOPSequence", "1", false},
+   {0x0008, 0x1200, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Other Referenced", "StudiesContainingOtherReferencedInstancesSequence", "1", false},
+   {0x0008, 0x1250, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Related Series", "RelatedSeriesSequence", "1", false},
+   {0x0008, 0x2110, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compression", "LossyImageCompressionRetired", "1", true},
+   {0x0008, 0x2111, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Derivation", "DerivationDescription", "1", false},
+   {0x0008, 0x2112, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Source Image", "SourceImageSequence", "1", false},
+   {0x0008, 0x2120, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Stage Name", "StageName", "1", false},
+   {0x0008, 0x2122, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Stage Number", "StageNumber", "1", false},
+   {0x0008, 0x2124, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Stages", "NumberOfStages", "1", false},
+   {0x0008, 0x2127, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "View Name", "ViewName", "1", false},
+   {0x0008, 0x2128, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "View Number", "ViewNumber", "1", false},
+   {0x0008, 0x2129, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Event", "NumberOfEventTimers", "1", false},
+   {0x0008, 0x212a, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Views in", "NumberOfViewsInStage", "1", false},
+   {0x0008, 0x2130, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Event Elapsed Time", "EventElapsedTimes", "1-", false},
+   {0x0008, 0x2132, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Event Timer Name(s)", "EventTimerNames", "1-", false},
+   {0x0008, 0x2133, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Event Timer", "EventTimerSequence", "1", false},
+   {0x0008, 0x2134, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Event Time Offset", "EventTimeOffset", "1", false},
+   {0x0008, 0x2135, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Event Code Sequence", "EventCodeSequence", "1", false},
+   {0x0008, 0x2142, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Start Trim", "StartTrim", "1", false},
+   {0x0008, 0x2143, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Stop Trim", "StopTrim", "1", false},
+   {0x0008, 0x2144, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Recommended Display", "RecommendedDisplayFrameRate", "1", false},
+   {0x0008, 0x2200, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Transducer Position", "TransducerPosition", "1", true},
+   {0x0008, 0x2204, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Transducer", "TransducerOrientation", "1", true},
+   {0x0008, 0x2208, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Anatomic Structure", "AnatomicStructure", "1", true},
+   {0x0008, 0x2218, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Anatomic Region", "AnatomicRegionSequence", "1", false},
+   {0x0008, 0x2220, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Anatomic Region", "AnatomicRegionModifierSequence", "1", false},
+   {0x0008, 0x2228, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Primary Anatomic", "PrimaryAnatomicStructureSequence", "1", false},
+   {0x0008, 0x2229, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Space or Region", "AnatomicStructureSpaceOrRegionSequence", "1", false},
+   {0x0008, 0x2230, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Structure Modifier", "PrimaryAnatomicStructureModifierSequence", "1", false},
+   {0x0008, 0x2240, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Transducer Position", "TransducerPositionSequence", "1", true},
+   {0x0008, 0x2242, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Transducer Position", "TransducerPositionModifierSequence", "1", true},
+   {0x0008, 0x2244, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Orientation", "TransducerOrientationSequence", "1", true},
+   {0x0008, 0x2246, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Orientation", "TransducerOrientationModifierSequence", "1", true},
+   {0x0008, 0x2251, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Space Or Region", "AnatomicStructureSpaceOrRegionCodeSequenceTrial", "1", true},
+   {0x0008, 0x2253, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Entrance Code", "AnatomicPortalOfEntranceCodeSequenceTrial", "1", true},
+   {0x0008, 0x2255, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Direction Code", "AnatomicApproachDirectionCodeSequenceTrial", "1", true},
+   {0x0008, 0x2256, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Perspective", "AnatomicPerspectiveDescriptionTrial", "1", true},
+   {0x0008, 0x2257, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Perspective Code", "AnatomicPerspectiveCodeSequenceTrial", "1", true},
+   {0x0008, 0x2258, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Of Examining", "AnatomicLocationOfExaminingInstrumentDescriptionTrial", "1", true},
+   {0x0008, 0x2259, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Of Examining", "AnatomicLocationOfExaminingInstrumentCodeSequenceTrial", "1", true},
+   {0x0008, 0x225a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Space Or Region", "AnatomicStructureSpaceOrRegionModifierCodeSequenceTrial", "1", true},
+   {0x0008, 0x225c, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Anatomic Structure", "OnAxisBackgroundAnatomicStructureCodeSequenceTrial", "1", true},
+   {0x0008, 0x3001, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Representation", "AlternateRepresentationSequence", "1", false},
+   {0x0008, 0x3010, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Irradiation Event", "IrradiationEventUID", "1", false},
+   {0x0008, 0x4000, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Identifying", "IdentifyingComments", "1", true},
+   {0x0008, 0x9007, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Frame Type", "FrameType", "4", false},
+   {0x0008, 0x9092, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Image", "ReferencedImageEvidenceSequence", "1", false},
+   {0x0008, 0x9121, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Raw Data", "ReferencedRawDataSequence", "1", false},
+   {0x0008, 0x9123, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Creator-Version UID", "CreatorVersionUID", "1", false},
+   {0x0008, 0x9124, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Derivation Image", "DerivationImageSequence", "1", false},
+   {0x0008, 0x9154, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Source Image", "SourceImageEvidenceSequence", "1", false},
+   {0x0008, 0x9205, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Pixel Presentation", "PixelPresentation", "1", false},
+   {0x0008, 0x9206, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Volumetric", "VolumetricProperties", "1", false},
+   {0x0008, 0x9207, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Calculation", "VolumeBasedCalculationTechnique", "1", false},
+   {0x0008, 0x9208, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Complex Image", "ComplexImageComponent", "1", false},
+   {0x0008, 0x9209, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "AcquisitionContrast", "1", false},
+   {0x0008, 0x9215, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Derivation Code", "DerivationCodeSequence", "1", false},
+   {0x0008, 0x9237, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Presentation State", "ReferencedPresentationStateSequence", "1", false},
+   {0x0008, 0x9410, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Other", "ReferencedOtherPlaneSequence", "1", false},
+   {0x0008, 0x9458, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Display", "FrameDisplaySequence", "1", false},
+   {0x0008, 0x9459, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Recommended Display", "RecommendedDisplayFrameRateInFloat", "1", false},
+   {0x0008, 0x9460, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Skip Frame Range", "SkipFrameRangeFlag", "1", false},
+   {0x0010, 0x0010, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Patients Name", "PatientName", "1", false},
+   {0x0010, 0x0020, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patient ID", "PatientID", "1", false},
+   {0x0010, 0x0021, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Issuer of Patient", "IssuerOfPatientID", "1", false},
+   {0x0010, 0x0022, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Type of Patient ID", "TypeOfPatientID", "1", false},
+   {0x0010, 0x0024, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "ID Qualifiers", "IssuerOfPatientIDQualifiersSequence", "1", false},
+   {0x0010, 0x0030, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Patients Birth", "PatientBirthDate", "1", false},
+   {0x0010, 0x0032, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Patients Birth", "PatientBirthTime", "1", false},
+   {0x0010, 0x0040, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patients Sex", "PatientSex", "1", false},
+   {0x0010, 0x0050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Insurance Plan Code", "PatientInsurancePlanCodeSequence", "1", false},
+   {0x0010, 0x0101, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Language Code", "PatientPrimaryLanguageCodeSequence", "1", false},
+   {0x0010, 0x0102, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Language Modifier", "PatientPrimaryLanguageModifierCodeSequence", "1", false},
+   {0x0010, 0x1000, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Other Patient IDs", "OtherPatientIDs", "1-", false},
+   {0x0010, 0x1001, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Other Patient Names", "OtherPatientNames", "1-", false},
+   {0x0010, 0x1002, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Other Patient IDs", "OtherPatientIDsSequence", "1", false},
+   {0x0010, 0x1005, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Patients Birth", "PatientBirthName", "1", false},
+   {0x0010, 0x1010, 0xffff, 0xffff, {attribute::VR::AS, attribute::VR::NN, attribute::VR::NN}, "Patients Age", "PatientAge", "1", false},
+   {0x0010, 0x1020, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Patients Size", "PatientSize", "1", false},
+   {0x0010, 0x1021, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Patients Size", "PatientSizeCodeSequence", "1", false},
+   {0x0010, 0x1030, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Patients Weight", "PatientWeight", "1", false},
+   {0x0010, 0x1040, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patients Address", "PatientAddress", "1", false},
+   {0x0010, 0x1050, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Insurance Plan", "InsurancePlanIdentification", "1-", true},
+   {0x0010, 0x1060, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Mothers Birth", "PatientMotherBirthName", "1", false},
+   {0x0010, 0x1080, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Military Rank", "MilitaryRank", "1", false},
+   {0x0010, 0x1081, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Branch of Service", "BranchOfService", "1", false},
+   {0x0010, 0x1090, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Medical Record", "MedicalRecordLocator", "1", false},
+   {0x0010, 0x2000, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Medical Alerts", "MedicalAlerts", "1-", false},
+   {0x0010, 0x2110, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Allergies", "Allergies", "1-", false},
+   {0x0010, 0x2150, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Country of", "CountryOfResidence", "1", false},
+   {0x0010, 0x2152, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Region of Residence", "RegionOfResidence", "1", false},
+   {0x0010, 0x2154, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Patients", "PatientTelephoneNumbers", "1-", false},
+   {0x0010, 0x2160, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Ethnic Group", "EthnicGroup", "1", false},
+   {0x0010, 0x2180, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Occupation", "Occupation", "1", false},
+   {0x0010, 0x21a0, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Smoking Status", "SmokingStatus", "1", false},
+   {0x0010, 0x21b0, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Additional Patient", "AdditionalPatientHistory", "1", false},
+   {0x0010, 0x21c0, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pregnancy Status", "PregnancyStatus", "1", false},
+   {0x0010, 0x21d0, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Last Menstrual Date", "LastMenstrualDate", "1", false},
+   {0x0010, 0x21f0, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Religious", "PatientReligiousPreference", "1", false},
+   {0x0010, 0x2201, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patient Species", "PatientSpeciesDescription", "1", false},
+   {0x0010, 0x2202, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Patient Species", "PatientSpeciesCodeSequence", "1", false},
+   {0x0010, 0x2203, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patients Sex", "PatientSexNeutered", "1", false},
+   {0x0010, 0x2210, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Anatomical", "AnatomicalOrientationType", "1", false},
+   {0x0010, 0x2292, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patient Breed", "PatientBreedDescription", "1", false},
+   {0x0010, 0x2293, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Patient Breed Code", "PatientBreedCodeSequence", "1", false},
+   {0x0010, 0x2294, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Breed Registration", "BreedRegistrationSequence", "1", false},
+   {0x0010, 0x2295, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Breed Registration", "BreedRegistrationNumber", "1", false},
+   {0x0010, 0x2296, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Breed Registry Code", "BreedRegistryCodeSequence", "1", false},
+   {0x0010, 0x2297, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Responsible Person", "ResponsiblePerson", "1", false},
+   {0x0010, 0x2298, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Responsible Person", "ResponsiblePersonRole", "1", false},
+   {0x0010, 0x2299, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Responsible", "ResponsibleOrganization", "1", false},
+   {0x0010, 0x4000, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Patient Comments", "PatientComments", "1", false},
+   {0x0010, 0x9431, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Examined Body", "ExaminedBodyThickness", "1", false},
+   {0x0012, 0x0010, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial", "ClinicalTrialSponsorName", "1", false},
+   {0x0012, 0x0020, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial", "ClinicalTrialProtocolID", "1", false},
+   {0x0012, 0x0021, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial", "ClinicalTrialProtocolName", "1", false},
+   {0x0012, 0x0030, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial Site", "ClinicalTrialSiteID", "1", false},
+   {0x0012, 0x0031, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial Site", "ClinicalTrialSiteName", "1", false},
+   {0x0012, 0x0040, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial", "ClinicalTrialSubjectID", "1", false},
+   {0x0012, 0x0042, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial", "ClinicalTrialSubjectReadingID", "1", false},
+   {0x0012, 0x0050, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial Time", "ClinicalTrialTimePointID", "1", false},
+   {0x0012, 0x0051, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial Time", "ClinicalTrialTimePointDescription", "1", false},
+   {0x0012, 0x0060, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Coordinating Center", "ClinicalTrialCoordinatingCenterName", "1", false},
+   {0x0012, 0x0062, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patient Identity", "PatientIdentityRemoved", "1", false},
+   {0x0012, 0x0063, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "De-identification", "DeidentificationMethod", "1-", false},
+   {0x0012, 0x0064, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Method Code", "DeidentificationMethodCodeSequence", "1", false},
+   {0x0012, 0x0071, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial", "ClinicalTrialSeriesID", "1", false},
+   {0x0012, 0x0072, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial", "ClinicalTrialSeriesDescription", "1", false},
+   {0x0012, 0x0081, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Protocol Ethics", "ClinicalTrialProtocolEthicsCommitteeName", "1", false},
+   {0x0012, 0x0082, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Protocol Ethics", "ClinicalTrialProtocolEthicsCommitteeApprovalNumber", "1", false},
+   {0x0012, 0x0083, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Clinical Trial Use", "ConsentForClinicalTrialUseSequence", "1", false},
+   {0x0012, 0x0084, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Distribution Type", "DistributionType", "1", false},
+   {0x0012, 0x0085, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Consent for", "ConsentForDistributionFlag", "1", false},
+   {0x0014, 0x0023, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "CAD File Format", "CADFileFormat", "1-", false},
+   {0x0014, 0x0024, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Component Reference", "ComponentReferenceSystem", "1-", false},
+   {0x0014, 0x0025, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Manufacturing", "ComponentManufacturingProcedure", "n", false},
+   {0x0014, 0x0028, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Component", "ComponentManufacturer", "1-", false},
+   {0x0014, 0x0030, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Material Thickness", "MaterialThickness", "1-", false},
+   {0x0014, 0x0032, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Material Pipe", "MaterialPipeDiameter", "1-", false},
+   {0x0014, 0x0034, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Material Isolation", "MaterialIsolationDiameter", "1-", false},
+   {0x0014, 0x0042, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Material Grade", "MaterialGrade", "1-", false},
+   {0x0014, 0x0044, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Material Properties", "MaterialPropertiesFileID", "1-", false},
+   {0x0014, 0x0045, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Material Properties", "MaterialPropertiesFileFormat", "1-", false},
+   {0x0014, 0x0046, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Material Notes", "MaterialNotes", "1", false},
+   {0x0014, 0x0050, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Component Shape", "ComponentShape", "1", false},
+   {0x0014, 0x0052, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Curvature Type", "CurvatureType", "1", false},
+   {0x0014, 0x0054, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Outer Diameter", "OuterDiameter", "1", false},
+   {0x0014, 0x0056, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Inner Diameter", "InnerDiameter", "1", false},
+   {0x0014, 0x1010, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Environmental", "ActualEnvironmentalConditions", "1", false},
+   {0x0014, 0x1020, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Expiry Date", "ExpiryDate", "1", false},
+   {0x0014, 0x1040, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Environmental", "EnvironmentalConditions", "1", false},
+   {0x0014, 0x2002, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Evaluator Sequence", "EvaluatorSequence", "1", false},
+   {0x0014, 0x2004, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Evaluator Number", "EvaluatorNumber", "1", false},
+   {0x0014, 0x2006, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Evaluator Name", "EvaluatorName", "1", false},
+   {0x0014, 0x2008, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Evaluation Attempt", "EvaluationAttempt", "1", false},
+   {0x0014, 0x2012, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Indication Sequence", "IndicationSequence", "1", false},
+   {0x0014, 0x2014, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Indication Number", "IndicationNumber", "1", false},
+   {0x0014, 0x2016, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Indication Label", "IndicationLabel", "1", false},
+   {0x0014, 0x2018, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Indication", "IndicationDescription", "1", false},
+   {0x0014, 0x201a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Indication Type", "IndicationType", "1-", false},
+   {0x0014, 0x201c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Indication", "IndicationDisposition", "1", false},
+   {0x0014, 0x201e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Indication ROI", "IndicationROISequence", "1", false},
+   {0x0014, 0x2030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Indication Physical", "IndicationPhysicalPropertySequence", "1", false},
+   {0x0014, 0x2032, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Property Label", "PropertyLabel", "1", false},
+   {0x0014, 0x2202, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemNumberOfAxes", "1", false},
+   {0x0014, 0x2204, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemAxesSequence", "1", false},
+   {0x0014, 0x2206, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemAxisDescription", "1", false},
+   {0x0014, 0x2208, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemDataSetMapping", "1", false},
+   {0x0014, 0x220a, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemAxisNumber", "1", false},
+   {0x0014, 0x220c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemAxisType", "1", false},
+   {0x0014, 0x220e, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemAxisUnits", "1", false},
+   {0x0014, 0x2210, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemAxisValues", "1", false},
+   {0x0014, 0x2220, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemTransformSequence", "1", false},
+   {0x0014, 0x2222, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Transform", "TransformDescription", "1", false},
+   {0x0014, 0x2224, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Transform Number of", "TransformNumberOfAxes", "1", false},
+   {0x0014, 0x2226, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Transform Order of", "TransformOrderOfAxes", "1-", false},
+   {0x0014, 0x2228, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Transformed Axis", "TransformedAxisUnits", "1", false},
+   {0x0014, 0x222a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Transform Rotation", "CoordinateSystemTransformRotationAndScaleMatrix", "n", false},
+   {0x0014, 0x222c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Transform", "CoordinateSystemTransformTranslationMatrix", "n", false},
+   {0x0014, 0x3011, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Internal Detector", "InternalDetectorFrameTime", "1", false},
+   {0x0014, 0x3012, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Number of Frames", "NumberOfFramesIntegrated", "1", false},
+   {0x0014, 0x3020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Temperature", "DetectorTemperatureSequence", "1", false},
+   {0x0014, 0x3022, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Sensor Name", "SensorName", "1", false},
+   {0x0014, 0x3024, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Horizontal Offset", "HorizontalOffsetOfSensor", "1", false},
+   {0x0014, 0x3026, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Vertical Offset of", "VerticalOffsetOfSensor", "1", false},
+   {0x0014, 0x3028, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Sensor Temperature", "SensorTemperature", "1", false},
+   {0x0014, 0x3040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Dark Current", "DarkCurrentSequence", "1", false},
+   {0x0014, 0x3050, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Dark Current Counts", "DarkCurrentCounts", "1", false},
+   {0x0014, 0x3060, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Gain Correction", "GainCorrectionReferenceSequence", "1", false},
+   {0x0014, 0x3070, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Air Counts", "AirCounts", "1", false},
+   {0x0014, 0x3071, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "KV Used in Gain", "KVUsedInGainCalibration", "1", false},
+   {0x0014, 0x3072, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "MA Used in Gain", "MAUsedInGainCalibration", "1", false},
+   {0x0014, 0x3073, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Used for", "NumberOfFramesUsedForIntegration", "1", false},
+   {0x0014, 0x3074, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Used in Gain", "FilterMaterialUsedInGainCalibration", "1", false},
+   {0x0014, 0x3075, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Used in Gain", "FilterThicknessUsedInGainCalibration", "1", false},
+   {0x0014, 0x3076, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Date of Gain", "DateOfGainCalibration", "1", false},
+   {0x0014, 0x3077, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Time of Gain", "TimeOfGainCalibration", "1", false},
+   {0x0014, 0x3080, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Bad Pixel Image", "BadPixelImage", "1", false},
+   {0x0014, 0x3099, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Calibration Notes", "CalibrationNotes", "1", false},
+   {0x0014, 0x4002, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pulser Equipment", "PulserEquipmentSequence", "1", false},
+   {0x0014, 0x4004, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Pulser Type", "PulserType", "1", false},
+   {0x0014, 0x4006, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Pulser Notes", "PulserNotes", "1", false},
+   {0x0014, 0x4008, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Receiver Equipment", "ReceiverEquipmentSequence", "1", false},
+   {0x0014, 0x400a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Amplifier Type", "AmplifierType", "1", false},
+   {0x0014, 0x400c, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Receiver Notes", "ReceiverNotes", "1", false},
+   {0x0014, 0x400e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pre-Amplifier", "PreAmplifierEquipmentSequence", "1", false},
+   {0x0014, 0x400f, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Pre-Amplifier Notes", "PreAmplifierNotes", "1", false},
+   {0x0014, 0x4010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Transmit Transducer", "TransmitTransducerSequence", "1", false},
+   {0x0014, 0x4011, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Receive Transducer", "ReceiveTransducerSequence", "1", false},
+   {0x0014, 0x4012, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Elements", "NumberOfElements", "1", false},
+   {0x0014, 0x4013, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Element Shape", "ElementShape", "1", false},
+   {0x0014, 0x4014, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Element Dimension A", "ElementDimensionA", "1", false},
+   {0x0014, 0x4015, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Element Dimension B", "ElementDimensionB", "1", false},
+   {0x0014, 0x4016, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Element Pitch", "ElementPitch", "1", false},
+   {0x0014, 0x4017, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Measured Beam", "MeasuredBeamDimensionA", "1", false},
+   {0x0014, 0x4018, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Measured Beam", "MeasuredBeamDimensionB", "1", false},
+   {0x0014, 0x4019, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Measured Beam", "LocationOfMeasuredBeamDiameter", "1", false},
+   {0x0014, 0x401a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Nominal Frequency", "NominalFrequency", "1", false},
+   {0x0014, 0x401b, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Measured Center", "MeasuredCenterFrequency", "1", false},
+   {0x0014, 0x401c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Measured Bandwidth", "MeasuredBandwidth", "1", false},
+   {0x0014, 0x4020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pulser Settings", "PulserSettingsSequence", "1", false},
+   {0x0014, 0x4022, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Pulse Width", "PulseWidth", "1", false},
+   {0x0014, 0x4024, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Excitation", "ExcitationFrequency", "1", false},
+   {0x0014, 0x4026, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Modulation Type", "ModulationType", "1", false},
+   {0x0014, 0x4028, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Damping", "Damping", "1", false},
+   {0x0014, 0x4030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Receiver Settings", "ReceiverSettingsSequence", "1", false},
+   {0x0014, 0x4031, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Acquired Soundpath", "AcquiredSoundpathLength", "1", false},
+   {0x0014, 0x4032, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "AcquisitionCompressionType", "1", false},
+   {0x0014, 0x4033, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Acquisition Sample", "AcquisitionSampleSize", "1", false},
+   {0x0014, 0x4034, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Rectifier Smoothing", "RectifierSmoothing", "1", false},
+   {0x0014, 0x4035, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "DAC Sequence", "DACSequence", "1", false},
+   {0x0014, 0x4036, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "DAC Type", "DACType", "1", false},
+   {0x0014, 0x4038, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DAC Gain Points", "DACGainPoints", "1-", false},
+   {0x0014, 0x403a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DAC Time Points", "DACTimePoints", "1-", false},
+   {0x0014, 0x403c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DAC Amplitude", "DACAmplitude", "1-", false},
+   {0x0014, 0x4040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pre-Amplifier", "PreAmplifierSettingsSequence", "1", false},
+   {0x0014, 0x4050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Transmit Transducer", "TransmitTransducerSettingsSequence", "1", false},
+   {0x0014, 0x4051, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Receive Transducer", "ReceiveTransducerSettingsSequence", "1", false},
+   {0x0014, 0x4052, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Incident Angle", "IncidentAngle", "1", false},
+   {0x0014, 0x4054, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Coupling Technique", "CouplingTechnique", "1", false},
+   {0x0014, 0x4056, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Coupling Medium", "CouplingMedium", "1", false},
+   {0x0014, 0x4057, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Coupling Velocity", "CouplingVelocity", "1", false},
+   {0x0014, 0x4058, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Crystal Center", "CrystalCenterLocationX", "1", false},
+   {0x0014, 0x4059, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Crystal Center", "CrystalCenterLocationZ", "1", false},
+   {0x0014, 0x405a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Sound Path Length", "SoundPathLength", "1", false},
+   {0x0014, 0x405c, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Delay Law", "DelayLawIdentifier", "1", false},
+   {0x0014, 0x4060, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Gate Settings", "GateSettingsSequence", "1", false},
+   {0x0014, 0x4062, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Gate Threshold", "GateThreshold", "1", false},
+   {0x0014, 0x4064, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Velocity of Sound", "VelocityOfSound", "1", false},
+   {0x0014, 0x4070, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Calibration", "CalibrationSettingsSequence", "1", false},
+   {0x0014, 0x4072, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Calibration", "CalibrationProcedure", "1", false},
+   {0x0014, 0x4074, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Procedure Version", "ProcedureVersion", "1", false},
+   {0x0014, 0x4076, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Procedure Creation", "ProcedureCreationDate", "1", false},
+   {0x0014, 0x4078, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Procedure", "ProcedureExpirationDate", "1", false},
+   {0x0014, 0x407a, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Procedure Last", "ProcedureLastModifiedDate", "1", false},
+   {0x0014, 0x407c, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Calibration Time", "CalibrationTime", "1-", false},
+   {0x0014, 0x407e, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Calibration Date", "CalibrationDate", "1-", false},
+   {0x0014, 0x5002, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "LINAC Energy", "LINACEnergy", "1", false},
+   {0x0014, 0x5004, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "LINAC Output", "LINACOutput", "1", false},
+   {0x0018, 0x0010, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusAgent", "1", false},
+   {0x0018, 0x0012, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusAgentSequence", "1", false},
+   {0x0018, 0x0014, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Administration", "ContrastBolusAdministrationRouteSequence", "1", false},
+   {0x0018, 0x0015, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Body Part Examined", "BodyPartExamined", "1", false},
+   {0x0018, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Scanning Sequence", "ScanningSequence", "1-", false},
+   {0x0018, 0x0021, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Sequence Variant", "SequenceVariant", "1-", false},
+   {0x0018, 0x0022, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Scan Options", "ScanOptions", "1-", false},
+   {0x0018, 0x0023, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "MR Acquisition Type", "MRAcquisitionType", "1", false},
+   {0x0018, 0x0024, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Sequence Name", "SequenceName", "1", false},
+   {0x0018, 0x0025, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Angio Flag", "AngioFlag", "1", false},
+   {0x0018, 0x0026, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Information", "InterventionDrugInformationSequence", "1", false},
+   {0x0018, 0x0027, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Intervention Drug", "InterventionDrugStopTime", "1", false},
+   {0x0018, 0x0028, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Intervention Drug", "InterventionDrugDose", "1", false},
+   {0x0018, 0x0029, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Intervention Drug", "InterventionDrugCodeSequence", "1", false},
+   {0x0018, 0x002a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Additional Drug", "AdditionalDrugSequence", "1", false},
+   {0x0018, 0x0030, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Radionuclide", "Radionuclide", "1-", true},
+   {0x0018, 0x0031, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "Radiopharmaceutical", "1", false},
+   {0x0018, 0x0032, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Energy Window", "EnergyWindowCenterline", "1", true},
+   {0x0018, 0x0033, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Energy Window Total", "EnergyWindowTotalWidth", "1-", true},
+   {0x0018, 0x0034, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Intervention Drug", "InterventionDrugName", "1", false},
+   {0x0018, 0x0035, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Intervention Drug", "InterventionDrugStartTime", "1", false},
+   {0x0018, 0x0036, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Intervention", "InterventionSequence", "1", false},
+   {0x0018, 0x0037, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Therapy Type", "TherapyType", "1", true},
+   {0x0018, 0x0038, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Intervention Status", "InterventionStatus", "1", false},
+   {0x0018, 0x0039, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Therapy Description", "TherapyDescription", "1", true},
+   {0x0018, 0x003a, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Intervention", "InterventionDescription", "1", false},
+   {0x0018, 0x0040, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Cine Rate", "CineRate", "1", false},
+   {0x0018, 0x0042, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Initial Cine Run", "InitialCineRunState", "1", false},
+   {0x0018, 0x0050, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Slice Thickness", "SliceThickness", "1", false},
+   {0x0018, 0x0060, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "KVP", "KVP", "1", false},
+   {0x0018, 0x0070, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Counts Accumulated", "CountsAccumulated", "1", false},
+   {0x0018, 0x0071, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Termination", "AcquisitionTerminationCondition", "1", false},
+   {0x0018, 0x0072, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Effective Duration", "EffectiveDuration", "1", false},
+   {0x0018, 0x0073, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Acquisition Start", "AcquisitionStartCondition", "1", false},
+   {0x0018, 0x0074, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Acquisition Start", "AcquisitionStartConditionData", "1", false},
+   {0x0018, 0x0075, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Termination", "AcquisitionTerminationConditionData", "1", false},
+   {0x0018, 0x0080, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Repetition Time", "RepetitionTime", "1", false},
+   {0x0018, 0x0081, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Echo Time", "EchoTime", "1", false},
+   {0x0018, 0x0082, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Inversion Time", "InversionTime", "1", false},
+   {0x0018, 0x0083, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Number of Averages", "NumberOfAverages", "1", false},
+   {0x0018, 0x0084, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Imaging Frequency", "ImagingFrequency", "1", false},
+   {0x0018, 0x0085, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Imaged Nucleus", "ImagedNucleus", "1", false},
+   {0x0018, 0x0086, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Echo Number(s)", "EchoNumbers", "1-", false},
+   {0x0018, 0x0087, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Magnetic Field", "MagneticFieldStrength", "1", false},
+   {0x0018, 0x0088, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Spacing Between", "SpacingBetweenSlices", "1", false},
+   {0x0018, 0x0089, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Phase", "NumberOfPhaseEncodingSteps", "1", false},
+   {0x0018, 0x0090, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Data Collection", "DataCollectionDiameter", "1", false},
+   {0x0018, 0x0091, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Echo Train Length", "EchoTrainLength", "1", false},
+   {0x0018, 0x0093, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Percent Sampling", "PercentSampling", "1", false},
+   {0x0018, 0x0094, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Percent Phase Field", "PercentPhaseFieldOfView", "1", false},
+   {0x0018, 0x0095, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Pixel Bandwidth", "PixelBandwidth", "1", false},
+   {0x0018, 0x1000, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Device Serial", "DeviceSerialNumber", "1", false},
+   {0x0018, 0x1002, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Device UID", "DeviceUID", "1", false},
+   {0x0018, 0x1003, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Device ID", "DeviceID", "1", false},
+   {0x0018, 0x1004, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Plate ID", "PlateID", "1", false},
+   {0x0018, 0x1005, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Generator ID", "GeneratorID", "1", false},
+   {0x0018, 0x1006, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Grid ID", "GridID", "1", false},
+   {0x0018, 0x1007, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Cassette ID", "CassetteID", "1", false},
+   {0x0018, 0x1008, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Gantry ID", "GantryID", "1", false},
+   {0x0018, 0x1010, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Secondary Capture", "SecondaryCaptureDeviceID", "1", false},
+   {0x0018, 0x1011, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Hardcopy Creation", "HardcopyCreationDeviceID", "1", true},
+   {0x0018, 0x1012, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Date of Secondary", "DateOfSecondaryCapture", "1", false},
+   {0x0018, 0x1014, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Time of Secondary", "TimeOfSecondaryCapture", "1", false},
+   {0x0018, 0x1016, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Secondary Capture", "SecondaryCaptureDeviceManufacturer", "1", false},
+   {0x0018, 0x1017, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Hardcopy Device", "HardcopyDeviceManufacturer", "1", true},
+   {0x0018, 0x1018, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Device", "SecondaryCaptureDeviceManufacturerModelName", "1", false},
+   {0x0018, 0x1019, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Device Software", "SecondaryCaptureDeviceSoftwareVersions", "n", false},
+   {0x0018, 0x101a, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Hardcopy Device", "HardcopyDeviceSoftwareVersion", "1-", true},
+   {0x0018, 0x101b, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Manufacturers", "HardcopyDeviceManufacturerModelName", "1", true},
+   {0x0018, 0x1020, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Software Version(s)", "SoftwareVersions", "1-", false},
+   {0x0018, 0x1022, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Video Image Format", "VideoImageFormatAcquired", "1", false},
+   {0x0018, 0x1023, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Digital Image", "DigitalImageFormatAcquired", "1", false},
+   {0x0018, 0x1030, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Protocol Name", "ProtocolName", "1", false},
+   {0x0018, 0x1040, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusRoute", "1", false},
+   {0x0018, 0x1041, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusVolume", "1", false},
+   {0x0018, 0x1042, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusStartTime", "1", false},
+   {0x0018, 0x1043, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus Stop", "ContrastBolusStopTime", "1", false},
+   {0x0018, 0x1044, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusTotalDose", "1", false},
+   {0x0018, 0x1045, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Syringe Counts", "SyringeCounts", "1", false},
+   {0x0018, 0x1046, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Contrast Flow Rate", "ContrastFlowRate", "1-", false},
+   {0x0018, 0x1047, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Contrast Flow", "ContrastFlowDuration", "1-", false},
+   {0x0018, 0x1048, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusIngredient", "1", false},
+   {0x0018, 0x1049, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Ingredient", "ContrastBolusIngredientConcentration", "1", false},
+   {0x0018, 0x1050, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Spatial Resolution", "SpatialResolution", "1", false},
+   {0x0018, 0x1060, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Trigger Time", "TriggerTime", "1", false},
+   {0x0018, 0x1061, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Trigger Source or Type", "TriggerSourceOrType", "1", false},
+   {0x0018, 0x1062, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Nominal Interval", "NominalInterval", "1", false},
+   {0x0018, 0x1063, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Frame Time", "FrameTime", "1", false},
+   {0x0018, 0x1064, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Cardiac Framing", "CardiacFramingType", "1", false},
+   {0x0018, 0x1065, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Frame Time Vector", "FrameTimeVector", "1-", false},
+   {0x0018, 0x1066, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Frame Delay", "FrameDelay", "1", false},
+   {0x0018, 0x1067, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Image Trigger Delay", "ImageTriggerDelay", "1", false},
+   {0x0018, 0x1068, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Multiplex Group", "MultiplexGroupTimeOffset", "1", false},
+   {0x0018, 0x1069, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Trigger Time Offset", "TriggerTimeOffset", "1", false},
+   {0x0018, 0x106a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Synchronization", "SynchronizationTrigger", "1", false},
+   {0x0018, 0x106c, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Synchronization", "SynchronizationChannel", "2", false},
+   {0x0018, 0x106e, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Trigger Sample", "TriggerSamplePosition", "1", false},
+   {0x0018, 0x1070, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalRoute", "1", false},
+   {0x0018, 0x1071, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalVolume", "1", false},
+   {0x0018, 0x1072, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalStartTime", "1", false},
+   {0x0018, 0x1073, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalStopTime", "1", false},
+   {0x0018, 0x1074, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Radionuclide Total", "RadionuclideTotalDose", "1", false},
+   {0x0018, 0x1075, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Radionuclide Half", "RadionuclideHalfLife", "1", false},
+   {0x0018, 0x1076, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Radionuclide", "RadionuclidePositronFraction", "1", false},
+   {0x0018, 0x1077, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalSpecificActivity", "1", false},
+   {0x0018, 0x1078, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalStartDateTime", "1", false},
+   {0x0018, 0x1079, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalStopDateTime", "1", false},
+   {0x0018, 0x1080, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Beat Rejection Flag", "BeatRejectionFlag", "1", false},
+   {0x0018, 0x1081, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Low R-R Value", "LowRRValue", "1", false},
+   {0x0018, 0x1082, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "High R-R Value", "HighRRValue", "1", false},
+   {0x0018, 0x1083, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Intervals Acquired", "IntervalsAcquired", "1", false},
+   {0x0018, 0x1084, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Intervals Rejected", "IntervalsRejected", "1", false},
+   {0x0018, 0x1085, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "PVC Rejection", "PVCRejection", "1", false},
+   {0x0018, 0x1086, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Skip Beats", "SkipBeats", "1", false},
+   {0x0018, 0x1088, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Heart Rate", "HeartRate", "1", false},
+   {0x0018, 0x1090, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Cardiac Number of", "CardiacNumberOfImages", "1", false},
+   {0x0018, 0x1094, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Trigger Window", "TriggerWindow", "1", false},
+   {0x0018, 0x1100, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "ReconstructionDiameter", "1", false},
+   {0x0018, 0x1110, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Distance Source to", "DistanceSourceToDetector", "1", false},
+   {0x0018, 0x1111, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Distance Source to", "DistanceSourceToPatient", "1", false},
+   {0x0018, 0x1114, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Radiographic", "EstimatedRadiographicMagnificationFactor", "1", false},
+   {0x0018, 0x1120, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Gantry/Detector", "GantryDetectorTilt", "1", false},
+   {0x0018, 0x1121, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Gantry/Detector", "GantryDetectorSlew", "1", false},
+   {0x0018, 0x1130, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Height", "TableHeight", "1", false},
+   {0x0018, 0x1131, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Traverse", "TableTraverse", "1", false},
+   {0x0018, 0x1134, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Table Motion", "TableMotion", "1", false},
+   {0x0018, 0x1135, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Vertical", "TableVerticalIncrement", "1-", false},
+   {0x0018, 0x1136, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Lateral", "TableLateralIncrement", "1-", false},
+   {0x0018, 0x1137, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Longitudinal", "TableLongitudinalIncrement", "1-", false},
+   {0x0018, 0x1138, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Angle", "TableAngle", "1", false},
+   {0x0018, 0x113a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Table Type", "TableType", "1", false},
+   {0x0018, 0x1140, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Rotation Direction", "RotationDirection", "1", false},
+   {0x0018, 0x1141, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Angular Position", "AngularPosition", "1", true},
+   {0x0018, 0x1142, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Radial Position", "RadialPosition", "1-", false},
+   {0x0018, 0x1143, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Scan Arc", "ScanArc", "1", false},
+   {0x0018, 0x1144, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Angular Step", "AngularStep", "1", false},
+   {0x0018, 0x1145, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Center of Rotation", "CenterOfRotationOffset", "1", false},
+   {0x0018, 0x1146, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Rotation Offset", "RotationOffset", "1-", true},
+   {0x0018, 0x1147, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Field of View Shape", "FieldOfViewShape", "1", false},
+   {0x0018, 0x1149, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Field of View", "FieldOfViewDimensions", "1-", false},
+   {0x0018, 0x1150, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Exposure Time", "ExposureTime", "1", false},
+   {0x0018, 0x1151, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "X-Ray Tube Current", "XRayTubeCurrent", "1", false},
+   {0x0018, 0x1152, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Exposure", "Exposure", "1", false},
+   {0x0018, 0x1153, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Exposure in As", "ExposureInuAs", "1", false},
+   {0x0018, 0x1154, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Average Pulse Width", "AveragePulseWidth", "1", false},
+   {0x0018, 0x1155, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Radiation Setting", "RadiationSetting", "1", false},
+   {0x0018, 0x1156, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Rectification Type", "RectificationType", "1", false},
+   {0x0018, 0x115a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Radiation Mode", "RadiationMode", "1", false},
+   {0x0018, 0x115e, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Fluoroscopy Area", "ImageAndFluoroscopyAreaDoseProduct", "1", false},
+   {0x0018, 0x1160, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Filter Type", "FilterType", "1", false},
+   {0x0018, 0x1161, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Type of Filters", "TypeOfFilters", "1-", false},
+   {0x0018, 0x1162, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Intensifier Size", "IntensifierSize", "1", false},
+   {0x0018, 0x1164, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Imager Pixel", "ImagerPixelSpacing", "2", false},
+   {0x0018, 0x1166, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Grid", "Grid", "1-", false},
+   {0x0018, 0x1170, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Generator Power", "GeneratorPower", "1", false},
+   {0x0018, 0x1180, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Collimator/grid", "CollimatorGridName", "1", false},
+   {0x0018, 0x1181, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Collimator Type", "CollimatorType", "1", false},
+   {0x0018, 0x1182, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Focal Distance", "FocalDistance", "1-", false},
+   {0x0018, 0x1183, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "X Focus Center", "XFocusCenter", "1-", false},
+   {0x0018, 0x1184, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Y Focus Center", "YFocusCenter", "1-", false},
+   {0x0018, 0x1190, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Focal Spot(s)", "FocalSpots", "1-", false},
+   {0x0018, 0x1191, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Anode Target", "AnodeTargetMaterial", "1", false},
+   {0x0018, 0x11a0, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Body Part Thickness", "BodyPartThickness", "1", false},
+   {0x0018, 0x11a2, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Compression Force", "CompressionForce", "1", false},
+   {0x0018, 0x1200, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Date of Last", "DateOfLastCalibration", "1-", false},
+   {0x0018, 0x1201, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Time of Last", "TimeOfLastCalibration", "1-", false},
+   {0x0018, 0x1210, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Convolution Kernel", "ConvolutionKernel", "1-", false},
+   {0x0018, 0x1240, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Upper/Lower Pixel", "UpperLowerPixelValues", "1-", true},
+   {0x0018, 0x1242, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Actual Frame", "ActualFrameDuration", "1", false},
+   {0x0018, 0x1243, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Count Rate", "CountRate", "1", false},
+   {0x0018, 0x1244, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Preferred Playback", "PreferredPlaybackSequencing", "1", false},
+   {0x0018, 0x1250, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Receive Coil Name", "ReceiveCoilName", "1", false},
+   {0x0018, 0x1251, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Transmit Coil Name", "TransmitCoilName", "1", false},
+   {0x0018, 0x1260, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Plate Type", "PlateType", "1", false},
+   {0x0018, 0x1261, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Phosphor Type", "PhosphorType", "1", false},
+   {0x0018, 0x1300, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Scan Velocity", "ScanVelocity", "1", false},
+   {0x0018, 0x1301, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Whole Body", "WholeBodyTechnique", "1-", false},
+   {0x0018, 0x1302, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Scan Length", "ScanLength", "1", false},
+   {0x0018, 0x1310, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Acquisition Matrix", "AcquisitionMatrix", "4", false},
+   {0x0018, 0x1312, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "In-plane Phase", "InPlanePhaseEncodingDirection", "1", false},
+   {0x0018, 0x1314, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Flip Angle", "FlipAngle", "1", false},
+   {0x0018, 0x1315, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Variable Flip Angle", "VariableFlipAngleFlag", "1", false},
+   {0x0018, 0x1316, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "SAR", "SAR", "1", false},
+   {0x0018, 0x1318, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "dB/dt", "dBdt", "1", false},
+   {0x0018, 0x1400, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Processing", "AcquisitionDeviceProcessingDescription", "1", false},
+   {0x0018, 0x1401, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Acquisition Device", "AcquisitionDeviceProcessingCode", "1", false},
+   {0x0018, 0x1402, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Cassette", "CassetteOrientation", "1", false},
+   {0x0018, 0x1403, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Cassette Size", "CassetteSize", "1", false},
+   {0x0018, 0x1404, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Exposures on Plate", "ExposuresOnPlate", "1", false},
+   {0x0018, 0x1405, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Relative X-Ray", "RelativeXRayExposure", "1", false},
+   {0x0018, 0x1411, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Exposure Index", "ExposureIndex", "1", false},
+   {0x0018, 0x1412, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Target Exposure", "TargetExposureIndex", "1", false},
+   {0x0018, 0x1413, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Deviation Index", "DeviationIndex", "1", false},
+   {0x0018, 0x1450, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Column Angulation", "ColumnAngulation", "1", false},
+   {0x0018, 0x1460, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Tomo Layer Height", "TomoLayerHeight", "1", false},
+   {0x0018, 0x1470, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Tomo Angle", "TomoAngle", "1", false},
+   {0x0018, 0x1480, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Tomo Time", "TomoTime", "1", false},
+   {0x0018, 0x1490, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Tomo Type", "TomoType", "1", false},
+   {0x0018, 0x1491, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Tomo Class", "TomoClass", "1", false},
+   {0x0018, 0x1495, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Tomosynthesis", "NumberOfTomosynthesisSourceImages", "1", false},
+   {0x0018, 0x1500, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Positioner Motion", "PositionerMotion", "1", false},
+   {0x0018, 0x1508, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Positioner Type", "PositionerType", "1", false},
+   {0x0018, 0x1510, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Positioner Primary", "PositionerPrimaryAngle", "1", false},
+   {0x0018, 0x1511, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Positioner", "PositionerSecondaryAngle", "1", false},
+   {0x0018, 0x1520, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Positioner Primary", "PositionerPrimaryAngleIncrement", "1-", false},
+   {0x0018, 0x1521, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Secondary Angle", "PositionerSecondaryAngleIncrement", "n", false},
+   {0x0018, 0x1530, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Primary", "DetectorPrimaryAngle", "1", false},
+   {0x0018, 0x1531, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Secondary", "DetectorSecondaryAngle", "1", false},
+   {0x0018, 0x1600, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Shutter Shape", "ShutterShape", "1-", false},
+   {0x0018, 0x1602, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Shutter Left", "ShutterLeftVerticalEdge", "1", false},
+   {0x0018, 0x1604, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Shutter Right", "ShutterRightVerticalEdge", "1", false},
+   {0x0018, 0x1606, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Shutter Upper", "ShutterUpperHorizontalEdge", "1", false},
+   {0x0018, 0x1608, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Shutter Lower", "ShutterLowerHorizontalEdge", "1", false},
+   {0x0018, 0x1610, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Center of Circular", "CenterOfCircularShutter", "2", false},
+   {0x0018, 0x1612, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Radius of Circular", "RadiusOfCircularShutter", "1", false},
+   {0x0018, 0x1620, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Vertices of the", "VerticesOfThePolygonalShutter", "2-", false},
+   {0x0018, 0x1622, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Shutter", "ShutterPresentationValue", "1", false},
+   {0x0018, 0x1623, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Shutter Overlay", "ShutterOverlayGroup", "1", false},
+   {0x0018, 0x1624, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Presentation Color", "ShutterPresentationColorCIELabValue", "3", false},
+   {0x0018, 0x1700, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Collimator Shape", "CollimatorShape", "1-", false},
+   {0x0018, 0x1702, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Collimator Left", "CollimatorLeftVerticalEdge", "1", false},
+   {0x0018, 0x1704, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Collimator Right", "CollimatorRightVerticalEdge", "1", false},
+   {0x0018, 0x1706, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Collimator Upper", "CollimatorUpperHorizontalEdge", "1", false},
+   {0x0018, 0x1708, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Collimator Lower", "CollimatorLowerHorizontalEdge", "1", false},
+   {0x0018, 0x1710, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Center of Circular", "CenterOfCircularCollimator", "2", false},
+   {0x0018, 0x1712, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Radius of Circular", "RadiusOfCircularCollimator", "1", false},
+   {0x0018, 0x1720, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Polygonal", "VerticesOfThePolygonalCollimator", "2n", false},
+   {0x0018, 0x1800, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Acquisition Time", "AcquisitionTimeSynchronized", "1", false},
+   {0x0018, 0x1801, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Time Source", "TimeSource", "1", false},
+   {0x0018, 0x1802, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Time Distribution", "TimeDistributionProtocol", "1", false},
+   {0x0018, 0x1803, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "NTP Source Address", "NTPSourceAddress", "1", false},
+   {0x0018, 0x2001, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Page Number Vector", "PageNumberVector", "1-", false},
+   {0x0018, 0x2002, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Frame Label Vector", "FrameLabelVector", "1-", false},
+   {0x0018, 0x2003, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Frame Primary Angle", "FramePrimaryAngleVector", "1-", false},
+   {0x0018, 0x2004, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Frame Secondary", "FrameSecondaryAngleVector", "1-", false},
+   {0x0018, 0x2005, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Slice Location", "SliceLocationVector", "1-", false},
+   {0x0018, 0x2006, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Display Window", "DisplayWindowLabelVector", "1-", false},
+   {0x0018, 0x2010, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Nominal Scanned", "NominalScannedPixelSpacing", "2", false},
+   {0x0018, 0x2020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Digitizing Device", "DigitizingDeviceTransportDirection", "1", false},
+   {0x0018, 0x2030, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Rotation of Scanned", "RotationOfScannedFilm", "1", false},
+   {0x0018, 0x3100, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "IVUS Acquisition", "IVUSAcquisition", "1", false},
+   {0x0018, 0x3101, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "IVUS Pullback Rate", "IVUSPullbackRate", "1", false},
+   {0x0018, 0x3102, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "IVUS Gated Rate", "IVUSGatedRate", "1", false},
+   {0x0018, 0x3103, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "IVUS Pullback Start", "IVUSPullbackStartFrameNumber", "1", false},
+   {0x0018, 0x3104, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "IVUS Pullback Stop", "IVUSPullbackStopFrameNumber", "1", false},
+   {0x0018, 0x3105, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Lesion Number", "LesionNumber", "1-", false},
+   {0x0018, 0x4000, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "AcquisitionComments", "1", true},
+   {0x0018, 0x5000, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Output Power", "OutputPower", "1-", false},
+   {0x0018, 0x5010, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Transducer Data", "TransducerData", "1-", false},
+   {0x0018, 0x5012, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Focus Depth", "FocusDepth", "1", false},
+   {0x0018, 0x5020, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Processing Function", "ProcessingFunction", "1", false},
+   {0x0018, 0x5021, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Postprocessing", "PostprocessingFunction", "1", true},
+   {0x0018, 0x5022, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Mechanical Index", "MechanicalIndex", "1", false},
+   {0x0018, 0x5024, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Bone Thermal Index", "BoneThermalIndex", "1", false},
+   {0x0018, 0x5026, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Cranial Thermal", "CranialThermalIndex", "1", false},
+   {0x0018, 0x5027, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Soft Tissue Thermal", "SoftTissueThermalIndex", "1", false},
+   {0x0018, 0x5028, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Soft Tissue-focus", "SoftTissueFocusThermalIndex", "1", false},
+   {0x0018, 0x5029, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Soft Tissue-surface", "SoftTissueSurfaceThermalIndex", "1", false},
+   {0x0018, 0x5030, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Dynamic Range", "DynamicRange", "1", true},
+   {0x0018, 0x5040, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Total Gain", "TotalGain", "1", true},
+   {0x0018, 0x5050, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Depth of Scan Field", "DepthOfScanField", "1", false},
+   {0x0018, 0x5100, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patient Position", "PatientPosition", "1", false},
+   {0x0018, 0x5101, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "View Position", "ViewPosition", "1", false},
+   {0x0018, 0x5104, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Eponymous Name Code", "ProjectionEponymousNameCodeSequence", "1", false},
+   {0x0018, 0x5210, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Transformation", "ImageTransformationMatrix", "6", true},
+   {0x0018, 0x5212, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Image Translation", "ImageTranslationVector", "3", true},
+   {0x0018, 0x6000, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Sensitivity", "Sensitivity", "1", false},
+   {0x0018, 0x6011, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Sequence of", "SequenceOfUltrasoundRegions", "1", false},
+   {0x0018, 0x6012, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Region Spatial", "RegionSpatialFormat", "1", false},
+   {0x0018, 0x6014, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Region Data Type", "RegionDataType", "1", false},
+   {0x0018, 0x6016, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Region Flags", "RegionFlags", "1", false},
+   {0x0018, 0x6018, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Region Location Min", "RegionLocationMinX0", "1", false},
+   {0x0018, 0x601a, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Region Location Min", "RegionLocationMinY0", "1", false},
+   {0x0018, 0x601c, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Region Location Max", "RegionLocationMaxX1", "1", false},
+   {0x0018, 0x601e, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Region Location Max", "RegionLocationMaxY1", "1", false},
+   {0x0018, 0x6020, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Reference Pixel X0", "ReferencePixelX0", "1", false},
+   {0x0018, 0x6022, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Reference Pixel Y0", "ReferencePixelY0", "1", false},
+   {0x0018, 0x6024, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Physical Units X", "PhysicalUnitsXDirection", "1", false},
+   {0x0018, 0x6026, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Physical Units Y", "PhysicalUnitsYDirection", "1", false},
+   {0x0018, 0x6028, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Reference Pixel", "ReferencePixelPhysicalValueX", "1", false},
+   {0x0018, 0x602a, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Reference Pixel", "ReferencePixelPhysicalValueY", "1", false},
+   {0x0018, 0x602c, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Physical Delta X", "PhysicalDeltaX", "1", false},
+   {0x0018, 0x602e, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Physical Delta Y", "PhysicalDeltaY", "1", false},
+   {0x0018, 0x6030, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Transducer", "TransducerFrequency", "1", false},
+   {0x0018, 0x6031, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Transducer Type", "TransducerType", "1", false},
+   {0x0018, 0x6032, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Pulse Repetition", "PulseRepetitionFrequency", "1", false},
+   {0x0018, 0x6034, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Doppler Correction", "DopplerCorrectionAngle", "1", false},
+   {0x0018, 0x6036, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Steering Angle", "SteeringAngle", "1", false},
+   {0x0018, 0x6038, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Volume X Position", "DopplerSampleVolumeXPositionRetired", "1", true},
+   {0x0018, 0x6039, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Doppler Sample", "DopplerSampleVolumeXPosition", "1", false},
+   {0x0018, 0x603a, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Volume Y Position", "DopplerSampleVolumeYPositionRetired", "1", true},
+   {0x0018, 0x603b, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Doppler Sample", "DopplerSampleVolumeYPosition", "1", false},
+   {0x0018, 0x603c, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "TM-Line Position X0", "TMLinePositionX0Retired", "1", true},
+   {0x0018, 0x603d, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "TM-Line Position X0", "TMLinePositionX0", "1", false},
+   {0x0018, 0x603e, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "TM-Line Position Y0", "TMLinePositionY0Retired", "1", true},
+   {0x0018, 0x603f, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "TM-Line Position Y0", "TMLinePositionY0", "1", false},
+   {0x0018, 0x6040, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "TM-Line Position X1", "TMLinePositionX1Retired", "1", true},
+   {0x0018, 0x6041, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "TM-Line Position X1", "TMLinePositionX1", "1", false},
+   {0x0018, 0x6042, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "TM-Line Position Y1", "TMLinePositionY1Retired", "1", true},
+   {0x0018, 0x6043, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "TM-Line Position Y1", "TMLinePositionY1", "1", false},
+   {0x0018, 0x6044, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pixel Component", "PixelComponentOrganization", "1", false},
+   {0x0018, 0x6046, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Pixel Component", "PixelComponentMask", "1", false},
+   {0x0018, 0x6048, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Pixel Component", "PixelComponentRangeStart", "1", false},
+   {0x0018, 0x604a, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Pixel Component", "PixelComponentRangeStop", "1", false},
+   {0x0018, 0x604c, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pixel Component", "PixelComponentPhysicalUnits", "1", false},
+   {0x0018, 0x604e, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pixel Component", "PixelComponentDataType", "1", false},
+   {0x0018, 0x6050, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Number of Table", "NumberOfTableBreakPoints", "1", false},
+   {0x0018, 0x6052, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Table of X Break", "TableOfXBreakPoints", "1-", false},
+   {0x0018, 0x6054, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Table of Y Break", "TableOfYBreakPoints", "1-", false},
+   {0x0018, 0x6056, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Number of Table", "NumberOfTableEntries", "1", false},
+   {0x0018, 0x6058, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Table of Pixel", "TableOfPixelValues", "1-", false},
+   {0x0018, 0x605a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table of Parameter", "TableOfParameterValues", "1-", false},
+   {0x0018, 0x6060, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "R Wave Time Vector", "RWaveTimeVector", "1-", false},
+   {0x0018, 0x7000, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Detector Conditions", "DetectorConditionsNominalFlag", "1", false},
+   {0x0018, 0x7001, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector", "DetectorTemperature", "1", false},
+   {0x0018, 0x7004, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Detector Type", "DetectorType", "1", false},
+   {0x0018, 0x7005, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Detector", "DetectorConfiguration", "1", false},
+   {0x0018, 0x7006, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Detector", "DetectorDescription", "1", false},
+   {0x0018, 0x7008, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Detector Mode", "DetectorMode", "1", false},
+   {0x0018, 0x700a, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Detector ID", "DetectorID", "1", false},
+   {0x0018, 0x700c, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Detector", "DateOfLastDetectorCalibration", "1", false},
+   {0x0018, 0x700e, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Detector", "TimeOfLastDetectorCalibration", "1", false},
+   {0x0018, 0x7010, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Detector Since Last", "ExposuresOnDetectorSinceLastCalibration", "1", false},
+   {0x0018, 0x7011, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Detector Since", "ExposuresOnDetectorSinceManufactured", "1", false},
+   {0x0018, 0x7012, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Time Since", "DetectorTimeSinceLastExposure", "1", false},
+   {0x0018, 0x7014, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Active", "DetectorActiveTime", "1", false},
+   {0x0018, 0x7016, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Offset From", "DetectorActivationOffsetFromExposure", "1", false},
+   {0x0018, 0x701a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Binning", "DetectorBinning", "2", false},
+   {0x0018, 0x7020, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Element", "DetectorElementPhysicalSize", "2", false},
+   {0x0018, 0x7022, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Element", "DetectorElementSpacing", "2", false},
+   {0x0018, 0x7024, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Detector Active", "DetectorActiveShape", "1", false},
+   {0x0018, 0x7026, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Active", "DetectorActiveDimensions", "1-", false},
+   {0x0018, 0x7028, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Active", "DetectorActiveOrigin", "2", false},
+   {0x0018, 0x702a, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Detector", "DetectorManufacturerName", "1", false},
+   {0x0018, 0x702b, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Manufacturers", "DetectorManufacturerModelName", "1", false},
+   {0x0018, 0x7030, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Field of View", "FieldOfViewOrigin", "2", false},
+   {0x0018, 0x7032, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Field of View", "FieldOfViewRotation", "1", false},
+   {0x0018, 0x7034, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Field of View", "FieldOfViewHorizontalFlip", "1", false},
+   {0x0018, 0x7036, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Origin Relative To", "PixelDataAreaOriginRelativeToFOV", "2", false},
+   {0x0018, 0x7038, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Rotation Angle", "PixelDataAreaRotationAngleRelativeToFOV", "1", false},
+   {0x0018, 0x7040, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Grid Absorbing", "GridAbsorbingMaterial", "1", false},
+   {0x0018, 0x7041, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Grid Spacing", "GridSpacingMaterial", "1", false},
+   {0x0018, 0x7042, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Grid Thickness", "GridThickness", "1", false},
+   {0x0018, 0x7044, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Grid Pitch", "GridPitch", "1", false},
+   {0x0018, 0x7046, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Grid Aspect Ratio", "GridAspectRatio", "2", false},
+   {0x0018, 0x7048, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Grid Period", "GridPeriod", "1", false},
+   {0x0018, 0x704c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Grid Focal Distance", "GridFocalDistance", "1", false},
+   {0x0018, 0x7050, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Filter Material", "FilterMaterial", "1-", false},
+   {0x0018, 0x7052, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Filter Thickness", "FilterThicknessMinimum", "1-", false},
+   {0x0018, 0x7054, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Filter Thickness", "FilterThicknessMaximum", "1-", false},
+   {0x0018, 0x7056, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Filter Beam Path", "FilterBeamPathLengthMinimum", "1-", false},
+   {0x0018, 0x7058, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Filter Beam Path", "FilterBeamPathLengthMaximum", "1-", false},
+   {0x0018, 0x7060, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Exposure Control", "ExposureControlMode", "1", false},
+   {0x0018, 0x7062, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Exposure Control", "ExposureControlModeDescription", "1", false},
+   {0x0018, 0x7064, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Exposure Status", "ExposureStatus", "1", false},
+   {0x0018, 0x7065, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Phototimer Setting", "PhototimerSetting", "1", false},
+   {0x0018, 0x8150, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Exposure Time in", "ExposureTimeInuS", "1", false},
+   {0x0018, 0x8151, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "X-Ray Tube Current", "XRayTubeCurrentInuA", "1", false},
+   {0x0018, 0x9004, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Content", "ContentQualification", "1", false},
+   {0x0018, 0x9005, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Pulse Sequence Name", "PulseSequenceName", "1", false},
+   {0x0018, 0x9006, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Imaging Modifier", "MRImagingModifierSequence", "1", false},
+   {0x0018, 0x9008, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Echo Pulse Sequence", "EchoPulseSequence", "1", false},
+   {0x0018, 0x9009, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Inversion Recovery", "InversionRecovery", "1", false},
+   {0x0018, 0x9010, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Flow Compensation", "FlowCompensation", "1", false},
+   {0x0018, 0x9011, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Multiple Spin Echo", "MultipleSpinEcho", "1", false},
+   {0x0018, 0x9012, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Multi-planar", "MultiPlanarExcitation", "1", false},
+   {0x0018, 0x9014, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Phase Contrast", "PhaseContrast", "1", false},
+   {0x0018, 0x9015, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Time of Flight", "TimeOfFlightContrast", "1", false},
+   {0x0018, 0x9016, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Spoiling", "Spoiling", "1", false},
+   {0x0018, 0x9017, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Steady State Pulse", "SteadyStatePulseSequence", "1", false},
+   {0x0018, 0x9018, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Echo Planar Pulse", "EchoPlanarPulseSequence", "1", false},
+   {0x0018, 0x9019, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Tag Angle First", "TagAngleFirstAxis", "1", false},
+   {0x0018, 0x9020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Magnetization", "MagnetizationTransfer", "1", false},
+   {0x0018, 0x9021, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "T2 Preparation", "T2Preparation", "1", false},
+   {0x0018, 0x9022, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Blood Signal", "BloodSignalNulling", "1", false},
+   {0x0018, 0x9024, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Saturation Recovery", "SaturationRecovery", "1", false},
+   {0x0018, 0x9025, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Spectrally Selected", "SpectrallySelectedSuppression", "1", false},
+   {0x0018, 0x9026, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Spectrally Selected", "SpectrallySelectedExcitation", "1", false},
+   {0x0018, 0x9027, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Spatial Pre-", "SpatialPresaturation", "1", false},
+   {0x0018, 0x9028, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Tagging", "Tagging", "1", false},
+   {0x0018, 0x9029, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Oversampling Phase", "OversamplingPhase", "1", false},
+   {0x0018, 0x9030, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Tag Spacing First", "TagSpacingFirstDimension", "1", false},
+   {0x0018, 0x9032, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Geometry of k-Space", "GeometryOfKSpaceTraversal", "1", false},
+   {0x0018, 0x9033, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Segmented k-Space", "SegmentedKSpaceTraversal", "1", false},
+   {0x0018, 0x9034, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Rectilinear Phase", "RectilinearPhaseEncodeReordering", "1", false},
+   {0x0018, 0x9035, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Tag Thickness", "TagThickness", "1", false},
+   {0x0018, 0x9036, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Partial Fourier", "PartialFourierDirection", "1", false},
+   {0x0018, 0x9037, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Synchronization", "CardiacSynchronizationTechnique", "1", false},
+   {0x0018, 0x9041, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Receive Coil", "ReceiveCoilManufacturerName", "1", false},
+   {0x0018, 0x9042, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Receive Coil", "MRReceiveCoilSequence", "1", false},
+   {0x0018, 0x9043, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Receive Coil Type", "ReceiveCoilType", "1", false},
+   {0x0018, 0x9044, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Quadrature Receive", "QuadratureReceiveCoil", "1", false},
+   {0x0018, 0x9045, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Multi-Coil", "MultiCoilDefinitionSequence", "1", false},
+   {0x0018, 0x9046, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Multi-Coil", "MultiCoilConfiguration", "1", false},
+   {0x0018, 0x9047, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Multi-Coil Element", "MultiCoilElementName", "1", false},
+   {0x0018, 0x9048, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Multi-Coil Element", "MultiCoilElementUsed", "1", false},
+   {0x0018, 0x9049, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Transmit Coil", "MRTransmitCoilSequence", "1", false},
+   {0x0018, 0x9050, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Transmit Coil", "TransmitCoilManufacturerName", "1", false},
+   {0x0018, 0x9051, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Transmit Coil Type", "TransmitCoilType", "1", false},
+   {0x0018, 0x9052, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Spectral Width", "SpectralWidth", "1-", false},
+   {0x0018, 0x9053, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Chemical Shift", "ChemicalShiftReference", "1-", false},
+   {0x0018, 0x9054, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Volume Localization", "VolumeLocalizationTechnique", "1", false},
+   {0x0018, 0x9058, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Frequency Encoding", "MRAcquisitionFrequencyEncodingSteps", "1", false},
+   {0x0018, 0x9059, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "De-coupling", "Decoupling", "1", false},
+   {0x0018, 0x9060, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "De-coupled Nucleus", "DecoupledNucleus", "1-", false},
+   {0x0018, 0x9061, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "De-coupling", "DecouplingFrequency", "1-", false},
+   {0x0018, 0x9062, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "De-coupling Method", "DecouplingMethod", "1", false},
+   {0x0018, 0x9063, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Chemical Shift", "DecouplingChemicalShiftReference", "2", false},
+   {0x0018, 0x9064, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "k-space Filtering", "KSpaceFiltering", "1", false},
+   {0x0018, 0x9065, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Time Domain", "TimeDomainFiltering", "1-", false},
+   {0x0018, 0x9066, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Zero", "NumberOfZeroFills", "1-", false},
+   {0x0018, 0x9067, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Baseline Correction", "BaselineCorrection", "1", false},
+   {0x0018, 0x9069, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Parallel Reduction", "ParallelReductionFactorInPlane", "1", false},
+   {0x0018, 0x9070, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "R Interval", "CardiacRRIntervalSpecified", "1", false},
+   {0x0018, 0x9073, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "AcquisitionDuration", "1", false},
+   {0x0018, 0x9074, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Frame Acquisition", "FrameAcquisitionDateTime", "1", false},
+   {0x0018, 0x9075, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Diffusion", "DiffusionDirectionality", "1", false},
+   {0x0018, 0x9076, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Diffusion Gradient", "DiffusionGradientDirectionSequence", "1", false},
+   {0x0018, 0x9077, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Parallel", "ParallelAcquisition", "1", false},
+   {0x0018, 0x9078, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "ParallelAcquisitionTechnique", "1", false},
+   {0x0018, 0x9079, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Inversion Times", "InversionTimes", "1-", false},
+   {0x0018, 0x9080, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Metabolite Map", "MetaboliteMapDescription", "1", false},
+   {0x0018, 0x9081, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Partial Fourier", "PartialFourier", "1", false},
+   {0x0018, 0x9082, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Effective Echo Time", "EffectiveEchoTime", "1", false},
+   {0x0018, 0x9083, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Metabolite Map Code", "MetaboliteMapCodeSequence", "1", false},
+   {0x0018, 0x9084, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Chemical Shift", "ChemicalShiftSequence", "1", false},
+   {0x0018, 0x9085, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Cardiac Signal", "CardiacSignalSource", "1", false},
+   {0x0018, 0x9087, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Diffusion b-value", "DiffusionBValue", "1", false},
+   {0x0018, 0x9089, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Diffusion Gradient", "DiffusionGradientOrientation", "3", false},
+   {0x0018, 0x9090, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Velocity Encoding", "VelocityEncodingDirection", "3", false},
+   {0x0018, 0x9091, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Velocity Encoding", "VelocityEncodingMinimumValue", "1", false},
+   {0x0018, 0x9092, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "VelocityEncodingAcquisitionSequence", "1", false},
+   {0x0018, 0x9093, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of k-Space", "NumberOfKSpaceTrajectories", "1", false},
+   {0x0018, 0x9094, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Coverage of k-Space", "CoverageOfKSpace", "1", false},
+   {0x0018, 0x9095, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Acquisition Phase", "SpectroscopyAcquisitionPhaseRows", "1", false},
+   {0x0018, 0x9096, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Factor In-plane", "ParallelReductionFactorInPlaneRetired", "1", true},
+   {0x0018, 0x9098, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Transmitter", "TransmitterFrequency", "1-", false},
+   {0x0018, 0x9100, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Resonant Nucleus", "ResonantNucleus", "1-", false},
+   {0x0018, 0x9101, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Frequency", "FrequencyCorrection", "1", false},
+   {0x0018, 0x9103, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "FOV/Geometry", "MRSpectroscopyFOVGeometrySequence", "1", false},
+   {0x0018, 0x9104, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Slab Thickness", "SlabThickness", "1", false},
+   {0x0018, 0x9105, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Slab Orientation", "SlabOrientation", "3", false},
+   {0x0018, 0x9106, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Mid Slab Position", "MidSlabPosition", "3", false},
+   {0x0018, 0x9107, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Spatial", "MRSpatialSaturationSequence", "1", false},
+   {0x0018, 0x9112, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Related Parameters", "MRTimingAndRelatedParametersSequence", "1", false},
+   {0x0018, 0x9114, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Echo Sequence", "MREchoSequence", "1", false},
+   {0x0018, 0x9115, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Modifier", "MRModifierSequence", "1", false},
+   {0x0018, 0x9117, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Diffusion", "MRDiffusionSequence", "1", false},
+   {0x0018, 0x9118, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Synchronization", "CardiacSynchronizationSequence", "1", false},
+   {0x0018, 0x9119, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Averages", "MRAveragesSequence", "1", false},
+   {0x0018, 0x9125, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR FOV/Geometry", "MRFOVGeometrySequence", "1", false},
+   {0x0018, 0x9126, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Volume Localization", "VolumeLocalizationSequence", "1", false},
+   {0x0018, 0x9127, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Acquisition Data", "SpectroscopyAcquisitionDataColumns", "1", false},
+   {0x0018, 0x9147, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Diffusion", "DiffusionAnisotropyType", "1", false},
+   {0x0018, 0x9151, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Frame Reference", "FrameReferenceDateTime", "1", false},
+   {0x0018, 0x9152, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Metabolite Map", "MRMetaboliteMapSequence", "1", false},
+   {0x0018, 0x9155, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Parallel Reduction", "ParallelReductionFactorOutOfPlane", "1", false},
+   {0x0018, 0x9159, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Acquisition Out-of-", "SpectroscopyAcquisitionOutOfPlanePhaseSteps", "1", false},
+   {0x0018, 0x9166, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Bulk Motion Status", "BulkMotionStatus", "1", true},
+   {0x0018, 0x9168, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Factor Second In-", "ParallelReductionFactorSecondInPlane", "1", false},
+   {0x0018, 0x9169, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Cardiac Beat", "CardiacBeatRejectionTechnique", "1", false},
+   {0x0018, 0x9170, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compensation", "RespiratoryMotionCompensationTechnique", "1", false},
+   {0x0018, 0x9171, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Respiratory Signal", "RespiratorySignalSource", "1", false},
+   {0x0018, 0x9172, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compensation", "BulkMotionCompensationTechnique", "1", false},
+   {0x0018, 0x9173, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Bulk Motion Signal", "BulkMotionSignalSource", "1", false},
+   {0x0018, 0x9174, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Applicable Safety", "ApplicableSafetyStandardAgency", "1", false},
+   {0x0018, 0x9175, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Standard", "ApplicableSafetyStandardDescription", "1", false},
+   {0x0018, 0x9176, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Operating Mode", "OperatingModeSequence", "1", false},
+   {0x0018, 0x9177, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Operating Mode Type", "OperatingModeType", "1", false},
+   {0x0018, 0x9178, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Operating Mode", "OperatingMode", "1", false},
+   {0x0018, 0x9179, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Specific Absorption", "SpecificAbsorptionRateDefinition", "1", false},
+   {0x0018, 0x9180, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Gradient Output", "GradientOutputType", "1", false},
+   {0x0018, 0x9181, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Specific Absorption", "SpecificAbsorptionRateValue", "1", false},
+   {0x0018, 0x9182, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Gradient Output", "GradientOutput", "1", false},
+   {0x0018, 0x9183, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Flow Compensation", "FlowCompensationDirection", "1", false},
+   {0x0018, 0x9184, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Tagging Delay", "TaggingDelay", "1", false},
+   {0x0018, 0x9185, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Compensation", "RespiratoryMotionCompensationTechniqueDescription", "1", false},
+   {0x0018, 0x9186, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Respiratory Signal", "RespiratorySignalSourceID", "1", false},
+   {0x0018, 0x9195, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Minimum Integration", "ChemicalShiftMinimumIntegrationLimitInHz", "1", true},
+   {0x0018, 0x9196, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Maximum Integration", "ChemicalShiftMaximumIntegrationLimitInHz", "1", true},
+   {0x0018, 0x9197, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Velocity", "MRVelocityEncodingSequence", "1", false},
+   {0x0018, 0x9198, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "First Order Phase", "FirstOrderPhaseCorrection", "1", false},
+   {0x0018, 0x9199, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Water Referenced", "WaterReferencedPhaseCorrection", "1", false},
+   {0x0018, 0x9200, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "MR Spectroscopy", "MRSpectroscopyAcquisitionType", "1", false},
+   {0x0018, 0x9214, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Respiratory Cycle", "RespiratoryCyclePosition", "1", false},
+   {0x0018, 0x9217, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Velocity Encoding", "VelocityEncodingMaximumValue", "1", false},
+   {0x0018, 0x9218, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Tag Spacing Second", "TagSpacingSecondDimension", "1", false},
+   {0x0018, 0x9219, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Tag Angle Second", "TagAngleSecondAxis", "1", false},
+   {0x0018, 0x9220, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Frame Acquisition", "FrameAcquisitionDuration", "1", false},
+   {0x0018, 0x9226, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Image Frame Type", "MRImageFrameTypeSequence", "1", false},
+   {0x0018, 0x9227, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Spectroscopy", "MRSpectroscopyFrameTypeSequence", "1", false},
+   {0x0018, 0x9231, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Phase Encoding", "MRAcquisitionPhaseEncodingStepsInPlane", "1", false},
+   {0x0018, 0x9232, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Phase Encoding", "MRAcquisitionPhaseEncodingStepsOutOfPlane", "1", false},
+   {0x0018, 0x9234, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Acquisition Phase", "SpectroscopyAcquisitionPhaseColumns", "1", false},
+   {0x0018, 0x9236, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Cardiac Cycle", "CardiacCyclePosition", "1", false},
+   {0x0018, 0x9239, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Specific Absorption", "SpecificAbsorptionRateSequence", "1", false},
+   {0x0018, 0x9240, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "RF Echo Train", "RFEchoTrainLength", "1", false},
+   {0x0018, 0x9241, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Gradient Echo Train", "GradientEchoTrainLength", "1", false},
+   {0x0018, 0x9250, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Arterial Spin", "ArterialSpinLabelingContrast", "1", false},
+   {0x0018, 0x9251, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MR Arterial Spin", "MRArterialSpinLabelingSequence", "1", false},
+   {0x0018, 0x9252, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "ASL Technique", "ASLTechniqueDescription", "1", false},
+   {0x0018, 0x9253, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "ASL Slab Number", "ASLSlabNumber", "1", false},
+   {0x0018, 0x9254, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "ASL Slab Thickness", "ASLSlabThickness", "1", false},
+   {0x0018, 0x9255, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "ASL Slab", "ASLSlabOrientation", "3", false},
+   {0x0018, 0x9256, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "ASL Mid Slab", "ASLMidSlabPosition", "3", false},
+   {0x0018, 0x9257, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "ASL Context", "ASLContext", "1", false},
+   {0x0018, 0x9258, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "ASL Pulse Train", "ASLPulseTrainDuration", "1", false},
+   {0x0018, 0x9259, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "ASL Crusher Flag", "ASLCrusherFlag", "1", false},
+   {0x0018, 0x925a, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "ASL Crusher Flow", "ASLCrusherFlow", "1", false},
+   {0x0018, 0x925b, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "ASL Crusher", "ASLCrusherDescription", "1", false},
+   {0x0018, 0x925c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "ASL Bolus Cut-off", "ASLBolusCutoffFlag", "1", false},
+   {0x0018, 0x925d, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "ASL Bolus Cut-off", "ASLBolusCutoffTimingSequence", "1", false},
+   {0x0018, 0x925e, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "ASL Bolus Cut-off", "ASLBolusCutoffTechnique", "1", false},
+   {0x0018, 0x925f, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "ASL Bolus Cut-off", "ASLBolusCutoffDelayTime", "1", false},
+   {0x0018, 0x9260, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "ASL Slab Sequence", "ASLSlabSequence", "1", false},
+   {0x0018, 0x9295, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Minimum Integration", "ChemicalShiftMinimumIntegrationLimitInppm", "1", false},
+   {0x0018, 0x9296, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Maximum Integration", "ChemicalShiftMaximumIntegrationLimitInppm", "1", false},
+   {0x0018, 0x9301, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT Acquisition Type", "CTAcquisitionTypeSequence", "1", false},
+   {0x0018, 0x9302, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Acquisition Type", "AcquisitionType", "1", false},
+   {0x0018, 0x9303, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Tube Angle", "TubeAngle", "1", false},
+   {0x0018, 0x9304, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT Acquisition", "CTAcquisitionDetailsSequence", "1", false},
+   {0x0018, 0x9305, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Revolution Time", "RevolutionTime", "1", false},
+   {0x0018, 0x9306, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Single Collimation", "SingleCollimationWidth", "1", false},
+   {0x0018, 0x9307, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Total Collimation", "TotalCollimationWidth", "1", false},
+   {0x0018, 0x9308, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT Table Dynamics", "CTTableDynamicsSequence", "1", false},
+   {0x0018, 0x9309, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Table Speed", "TableSpeed", "1", false},
+   {0x0018, 0x9310, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Table Feed per", "TableFeedPerRotation", "1", false},
+   {0x0018, 0x9311, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Spiral Pitch Factor", "SpiralPitchFactor", "1", false},
+   {0x0018, 0x9312, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT Geometry", "CTGeometrySequence", "1", false},
+   {0x0018, 0x9313, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Data Collection", "DataCollectionCenterPatient", "3", false},
+   {0x0018, 0x9314, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT Reconstruction", "CTReconstructionSequence", "1", false},
+   {0x0018, 0x9315, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "ReconstructionAlgorithm", "1", false},
+   {0x0018, 0x9316, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Convolution Kernel", "ConvolutionKernelGroup", "1", false},
+   {0x0018, 0x9317, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "ReconstructionFieldOfView", "2", false},
+   {0x0018, 0x9318, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Target Center", "ReconstructionTargetCenterPatient", "3", false},
+   {0x0018, 0x9319, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "ReconstructionAngle", "1", false},
+   {0x0018, 0x9320, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Image Filter", "ImageFilter", "1", false},
+   {0x0018, 0x9321, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT Exposure", "CTExposureSequence", "1", false},
+   {0x0018, 0x9322, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "ReconstructionPixelSpacing", "2", false},
+   {0x0018, 0x9323, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Exposure Modulation", "ExposureModulationType", "1", false},
+   {0x0018, 0x9324, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Estimated Dose", "EstimatedDoseSaving", "1", false},
+   {0x0018, 0x9325, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT X-Ray Details", "CTXRayDetailsSequence", "1", false},
+   {0x0018, 0x9326, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT Position", "CTPositionSequence", "1", false},
+   {0x0018, 0x9327, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Table Position", "TablePosition", "1", false},
+   {0x0018, 0x9328, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Exposure Time in ms", "ExposureTimeInms", "1", false},
+   {0x0018, 0x9329, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT Image Frame Type", "CTImageFrameTypeSequence", "1", false},
+   {0x0018, 0x9330, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "X-Ray Tube Current", "XRayTubeCurrentInmA", "1", false},
+   {0x0018, 0x9332, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Exposure in mAs", "ExposureInmAs", "1", false},
+   {0x0018, 0x9333, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Constant Volume", "ConstantVolumeFlag", "1", false},
+   {0x0018, 0x9334, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Fluoroscopy Flag", "FluoroscopyFlag", "1", false},
+   {0x0018, 0x9335, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Data Collection", "DistanceSourceToDataCollectionCenter", "1", false},
+   {0x0018, 0x9337, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusAgentNumber", "1", false},
+   {0x0018, 0x9338, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ingredient Code", "ContrastBolusIngredientCodeSequence", "1", false},
+   {0x0018, 0x9340, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Administration", "ContrastAdministrationProfileSequence", "1", false},
+   {0x0018, 0x9341, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusUsageSequence", "1", false},
+   {0x0018, 0x9342, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusAgentAdministered", "1", false},
+   {0x0018, 0x9343, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusAgentDetected", "1", false},
+   {0x0018, 0x9344, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusAgentPhase", "1", false},
+   {0x0018, 0x9345, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "CTDIvol", "CTDIvol", "1", false},
+   {0x0018, 0x9346, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CTDI Phantom Type", "CTDIPhantomTypeCodeSequence", "1", false},
+   {0x0018, 0x9351, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Calcium Scoring", "CalciumScoringMassFactorPatient", "1", false},
+   {0x0018, 0x9352, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Calcium Scoring", "CalciumScoringMassFactorDevice", "3", false},
+   {0x0018, 0x9353, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Energy Weighting", "EnergyWeightingFactor", "1", false},
+   {0x0018, 0x9360, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "CT Additional X-Ray", "CTAdditionalXRaySourceSequence", "1", false},
+   {0x0018, 0x9401, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Calibration", "ProjectionPixelCalibrationSequence", "1", false},
+   {0x0018, 0x9402, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Distance Source to", "DistanceSourceToIsocenter", "1", false},
+   {0x0018, 0x9403, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Distance Object to", "DistanceObjectToTableTop", "1", false},
+   {0x0018, 0x9404, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Spacing in Center", "ObjectPixelSpacingInCenterOfBeam", "2", false},
+   {0x0018, 0x9405, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Positioner Position", "PositionerPositionSequence", "1", false},
+   {0x0018, 0x9406, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Table Position", "TablePositionSequence", "1", false},
+   {0x0018, 0x9407, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Collimator Shape", "CollimatorShapeSequence", "1", false},
+   {0x0018, 0x9410, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Planes in", "PlanesInAcquisition", "1", false},
+   {0x0018, 0x9412, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Characteristics", "XAXRFFrameCharacteristicsSequence", "1", false},
+   {0x0018, 0x9417, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Acquisition", "FrameAcquisitionSequence", "1", false},
+   {0x0018, 0x9420, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "X-Ray Receptor Type", "XRayReceptorType", "1", false},
+   {0x0018, 0x9423, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "AcquisitionProtocolName", "1", false},
+   {0x0018, 0x9424, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Protocol", "AcquisitionProtocolDescription", "1", false},
+   {0x0018, 0x9425, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Contrast/Bolus", "ContrastBolusIngredientOpaque", "1", false},
+   {0x0018, 0x9426, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Plane to Detector", "DistanceReceptorPlaneToDetectorHousing", "1", false},
+   {0x0018, 0x9427, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Intensifier Active", "IntensifierActiveShape", "1", false},
+   {0x0018, 0x9428, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Intensifier Active", "IntensifierActiveDimensions", "1-", false},
+   {0x0018, 0x9429, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Physical Detector", "PhysicalDetectorSize", "2", false},
+   {0x0018, 0x9430, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Isocenter", "PositionOfIsocenterProjection", "2", false},
+   {0x0018, 0x9432, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Field of View", "FieldOfViewSequence", "1", false},
+   {0x0018, 0x9433, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Field of View", "FieldOfViewDescription", "1", false},
+   {0x0018, 0x9434, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Sensing Regions", "ExposureControlSensingRegionsSequence", "1", false},
+   {0x0018, 0x9435, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Sensing Region", "ExposureControlSensingRegionShape", "1", false},
+   {0x0018, 0x9436, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Sensing Region Left", "ExposureControlSensingRegionLeftVerticalEdge", "1", false},
+   {0x0018, 0x9437, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Sensing Region", "ExposureControlSensingRegionRightVerticalEdge", "1", false},
+   {0x0018, 0x9438, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Sensing Region", "ExposureControlSensingRegionUpperHorizontalEdge", "1", false},
+   {0x0018, 0x9439, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Sensing Region", "ExposureControlSensingRegionLowerHorizontalEdge", "1", false},
+   {0x0018, 0x9440, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Exposure Control", "CenterOfCircularExposureControlSensingRegion", "2", false},
+   {0x0018, 0x9441, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Exposure Control", "RadiusOfCircularExposureControlSensingRegion", "1", false},
+   {0x0018, 0x9442, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Polygonal Exposure", "VerticesOfThePolygonalExposureControlSensingRegion", "2-", false},
+   {0x0018, 0x9447, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Column Angulation", "ColumnAngulationPatient", "1", false},
+   {0x0018, 0x9449, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Beam Angle", "BeamAngle", "1", false},
+   {0x0018, 0x9451, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Detector", "FrameDetectorParametersSequence", "1", false},
+   {0x0018, 0x9452, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Calculated Anatomy", "CalculatedAnatomyThickness", "1", false},
+   {0x0018, 0x9455, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Calibration", "CalibrationSequence", "1", false},
+   {0x0018, 0x9456, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Object Thickness", "ObjectThicknessSequence", "1", false},
+   {0x0018, 0x9457, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Plane", "PlaneIdentification", "1", false},
+   {0x0018, 0x9461, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Dimension(s) in", "FieldOfViewDimensionsInFloat", "2", false},
+   {0x0018, 0x9462, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Isocenter Reference", "IsocenterReferenceSystemSequence", "1", false},
+   {0x0018, 0x9463, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Isocenter Primary", "PositionerIsocenterPrimaryAngle", "1", false},
+   {0x0018, 0x9464, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Isocenter Secondary", "PositionerIsocenterSecondaryAngle", "1", false},
+   {0x0018, 0x9465, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Isocenter Detector", "PositionerIsocenterDetectorRotationAngle", "1", false},
+   {0x0018, 0x9466, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table X Position to", "TableXPositionToIsocenter", "1", false},
+   {0x0018, 0x9467, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table Y Position to", "TableYPositionToIsocenter", "1", false},
+   {0x0018, 0x9468, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table Z Position to", "TableZPositionToIsocenter", "1", false},
+   {0x0018, 0x9469, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table Horizontal", "TableHorizontalRotationAngle", "1", false},
+   {0x0018, 0x9470, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table Head Tilt", "TableHeadTiltAngle", "1", false},
+   {0x0018, 0x9471, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table Cradle Tilt", "TableCradleTiltAngle", "1", false},
+   {0x0018, 0x9472, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Display", "FrameDisplayShutterSequence", "1", false},
+   {0x0018, 0x9473, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Acquired Image Area", "AcquiredImageAreaDoseProduct", "1", false},
+   {0x0018, 0x9474, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Tabletop", "CArmPositionerTabletopRelationship", "1", false},
+   {0x0018, 0x9476, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "X-Ray Geometry", "XRayGeometrySequence", "1", false},
+   {0x0018, 0x9477, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification", "IrradiationEventIdentificationSequence", "1", false},
+   {0x0018, 0x9504, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "X-Ray 3D Frame Type", "XRay3DFrameTypeSequence", "1", false},
+   {0x0018, 0x9506, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Contributing", "ContributingSourcesSequence", "1", false},
+   {0x0018, 0x9507, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "XRay3DAcquisitionSequence", "1", false},
+   {0x0018, 0x9508, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Primary Positioner", "PrimaryPositionerScanArc", "1", false},
+   {0x0018, 0x9509, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Secondary", "SecondaryPositionerScanArc", "1", false},
+   {0x0018, 0x9510, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Primary Positioner", "PrimaryPositionerScanStartAngle", "1", false},
+   {0x0018, 0x9511, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Positioner Scan", "SecondaryPositionerScanStartAngle", "1", false},
+   {0x0018, 0x9514, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Primary Positioner", "PrimaryPositionerIncrement", "1", false},
+   {0x0018, 0x9515, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Positioner", "SecondaryPositionerIncrement", "1", false},
+   {0x0018, 0x9516, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Start Acquisition", "StartAcquisitionDateTime", "1", false},
+   {0x0018, 0x9517, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "End Acquisition", "EndAcquisitionDateTime", "1", false},
+   {0x0018, 0x9524, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Application Name", "ApplicationName", "1", false},
+   {0x0018, 0x9525, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Application Version", "ApplicationVersion", "1", false},
+   {0x0018, 0x9526, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Application", "ApplicationManufacturer", "1", false},
+   {0x0018, 0x9527, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Algorithm Type", "AlgorithmType", "1", false},
+   {0x0018, 0x9528, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Algorithm", "AlgorithmDescription", "1", false},
+   {0x0018, 0x9530, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "XRay3DReconstructionSequence", "1", false},
+   {0x0018, 0x9531, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "ReconstructionDescription", "1", false},
+   {0x0018, 0x9538, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "PerProjectionAcquisitionSequence", "1", false},
+   {0x0018, 0x9601, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Diffusion b-matrix", "DiffusionBMatrixSequence", "1", false},
+   {0x0018, 0x9602, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Diffusion b-value", "DiffusionBValueXX", "1", false},
+   {0x0018, 0x9603, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Diffusion b-value", "DiffusionBValueXY", "1", false},
+   {0x0018, 0x9604, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Diffusion b-value", "DiffusionBValueXZ", "1", false},
+   {0x0018, 0x9605, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Diffusion b-value", "DiffusionBValueYY", "1", false},
+   {0x0018, 0x9606, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Diffusion b-value", "DiffusionBValueYZ", "1", false},
+   {0x0018, 0x9607, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Diffusion b-value", "DiffusionBValueZZ", "1", false},
+   {0x0018, 0x9701, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Decay Correction", "DecayCorrectionDateTime", "1", false},
+   {0x0018, 0x9715, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Start Density", "StartDensityThreshold", "1", false},
+   {0x0018, 0x9716, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Density Difference", "StartRelativeDensityDifferenceThreshold", "1", false},
+   {0x0018, 0x9717, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Trigger Count", "StartCardiacTriggerCountThreshold", "1", false},
+   {0x0018, 0x9718, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Trigger Count", "StartRespiratoryTriggerCountThreshold", "1", false},
+   {0x0018, 0x9719, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Termination Counts", "TerminationCountsThreshold", "1", false},
+   {0x0018, 0x9720, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Termination Density", "TerminationDensityThreshold", "1", false},
+   {0x0018, 0x9721, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Relative Density", "TerminationRelativeDensityThreshold", "1", false},
+   {0x0018, 0x9722, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Termination Time", "TerminationTimeThreshold", "1", false},
+   {0x0018, 0x9723, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Trigger Count", "TerminationCardiacTriggerCountThreshold", "1", false},
+   {0x0018, 0x9724, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Respiratory Trigger", "TerminationRespiratoryTriggerCountThreshold", "1", false},
+   {0x0018, 0x9725, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Detector Geometry", "DetectorGeometry", "1", false},
+   {0x0018, 0x9726, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Transverse Detector", "TransverseDetectorSeparation", "1", false},
+   {0x0018, 0x9727, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Axial Detector", "AxialDetectorDimension", "1", false},
+   {0x0018, 0x9729, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalAgentNumber", "1", false},
+   {0x0018, 0x9732, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "PETFrameAcquisitionSequence", "1", false},
+   {0x0018, 0x9733, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "PET Detector Motion", "PETDetectorMotionDetailsSequence", "1", false},
+   {0x0018, 0x9734, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "PET Table Dynamics", "PETTableDynamicsSequence", "1", false},
+   {0x0018, 0x9735, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "PET Position", "PETPositionSequence", "1", false},
+   {0x0018, 0x9736, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Correction Factors", "PETFrameCorrectionFactorsSequence", "1", false},
+   {0x0018, 0x9737, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalUsageSequence", "1", false},
+   {0x0018, 0x9738, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Attenuation", "AttenuationCorrectionSource", "1", false},
+   {0x0018, 0x9739, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of", "NumberOfIterations", "1", false},
+   {0x0018, 0x9740, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Subsets", "NumberOfSubsets", "1", false},
+   {0x0018, 0x9749, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "PET Reconstruction", "PETReconstructionSequence", "1", false},
+   {0x0018, 0x9751, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "PET Frame Type", "PETFrameTypeSequence", "1", false},
+   {0x0018, 0x9755, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Time of Flight", "TimeOfFlightInformationUsed", "1", false},
+   {0x0018, 0x9756, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Reconstruction Type", "ReconstructionType", "1", false},
+   {0x0018, 0x9758, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Decay Corrected", "DecayCorrected", "1", false},
+   {0x0018, 0x9759, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Attenuation", "AttenuationCorrected", "1", false},
+   {0x0018, 0x9760, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Scatter Corrected", "ScatterCorrected", "1", false},
+   {0x0018, 0x9761, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Dead Time Corrected", "DeadTimeCorrected", "1", false},
+   {0x0018, 0x9762, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Gantry Motion", "GantryMotionCorrected", "1", false},
+   {0x0018, 0x9763, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patient Motion", "PatientMotionCorrected", "1", false},
+   {0x0018, 0x9764, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Normalization", "CountLossNormalizationCorrected", "1", false},
+   {0x0018, 0x9765, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Randoms Corrected", "RandomsCorrected", "1", false},
+   {0x0018, 0x9766, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Non-uniform Radial", "NonUniformRadialSamplingCorrected", "1", false},
+   {0x0018, 0x9767, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Sensitivity", "SensitivityCalibrated", "1", false},
+   {0x0018, 0x9768, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Normalization", "DetectorNormalizationCorrection", "1", false},
+   {0x0018, 0x9769, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "IterativeReconstructionMethod", "1", false},
+   {0x0018, 0x9770, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Correction Temporal", "AttenuationCorrectionTemporalRelationship", "1", false},
+   {0x0018, 0x9771, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Physiological State", "PatientPhysiologicalStateSequence", "1", false},
+   {0x0018, 0x9772, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Physiological State", "PatientPhysiologicalStateCodeSequence", "1", false},
+   {0x0018, 0x9801, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Depth(s) of Focus", "DepthsOfFocus", "1-", false},
+   {0x0018, 0x9803, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Excluded Intervals", "ExcludedIntervalsSequence", "1", false},
+   {0x0018, 0x9804, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Exclusion Start", "ExclusionStartDatetime", "1", false},
+   {0x0018, 0x9805, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Exclusion Duration", "ExclusionDuration", "1", false},
+   {0x0018, 0x9806, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Description", "USImageDescriptionSequence", "1", false},
+   {0x0018, 0x9807, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Image Data Type", "ImageDataTypeSequence", "1", false},
+   {0x0018, 0x9808, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Data Type", "DataType", "1", false},
+   {0x0018, 0x9809, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pattern Code", "TransducerScanPatternCodeSequence", "1", false},
+   {0x0018, 0x980b, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Aliased Data Type", "AliasedDataType", "1", false},
+   {0x0018, 0x980c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Position Measuring", "PositionMeasuringDeviceUsed", "1", false},
+   {0x0018, 0x980d, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Transducer Geometry", "TransducerGeometryCodeSequence", "1", false},
+   {0x0018, 0x980e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Steering Code", "TransducerBeamSteeringCodeSequence", "1", false},
+   {0x0018, 0x980f, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Application Code", "TransducerApplicationCodeSequence", "1", false},
+   {0x0018, 0xa001, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Contributing", "ContributingEquipmentSequence", "1", false},
+   {0x0018, 0xa002, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Contribution Date", "ContributionDateTime", "1", false},
+   {0x0018, 0xa003, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Contribution", "ContributionDescription", "1", false},
+   {0x0020, 0x000d, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Study Instance UID", "StudyInstanceUID", "1", false},
+   {0x0020, 0x000e, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Series Instance UID", "SeriesInstanceUID", "1", false},
+   {0x0020, 0x0010, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Study ID", "StudyID", "1", false},
+   {0x0020, 0x0011, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Series Number", "SeriesNumber", "1", false},
+   {0x0020, 0x0012, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Acquisition Number", "AcquisitionNumber", "1", false},
+   {0x0020, 0x0013, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Instance Number", "InstanceNumber", "1", false},
+   {0x0020, 0x0014, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Isotope Number", "IsotopeNumber", "1", true},
+   {0x0020, 0x0015, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Phase Number", "PhaseNumber", "1", true},
+   {0x0020, 0x0016, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Interval Number", "IntervalNumber", "1", true},
+   {0x0020, 0x0017, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Time Slot Number", "TimeSlotNumber", "1", true},
+   {0x0020, 0x0018, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Angle Number", "AngleNumber", "1", true},
+   {0x0020, 0x0019, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Item Number", "ItemNumber", "1", false},
+   {0x0020, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patient Orientation", "PatientOrientation", "2", false},
+   {0x0020, 0x0022, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Overlay Number", "OverlayNumber", "1", true},
+   {0x0020, 0x0024, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Curve Number", "CurveNumber", "1", true},
+   {0x0020, 0x0026, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "LUT Number", "LUTNumber", "1", true},
+   {0x0020, 0x0030, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Image Position", "ImagePosition", "3", true},
+   {0x0020, 0x0032, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Image Position", "ImagePositionPatient", "3", false},
+   {0x0020, 0x0035, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Image Orientation", "ImageOrientation", "6", true},
+   {0x0020, 0x0037, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Image Orientation", "ImageOrientationPatient", "6", false},
+   {0x0020, 0x0050, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Location", "Location", "1", true},
+   {0x0020, 0x0052, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Frame of Reference", "FrameOfReferenceUID", "1", false},
+   {0x0020, 0x0060, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Laterality", "Laterality", "1", false},
+   {0x0020, 0x0062, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Laterality", "ImageLaterality", "1", false},
+   {0x0020, 0x0070, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Image Geometry Type", "ImageGeometryType", "1", true},
+   {0x0020, 0x0080, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Masking Image", "MaskingImage", "1-", true},
+   {0x0020, 0x00aa, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Report Number", "ReportNumber", "1", true},
+   {0x0020, 0x0100, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Temporal Position", "TemporalPositionIdentifier", "1", false},
+   {0x0020, 0x0105, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Temporal", "NumberOfTemporalPositions", "1", false},
+   {0x0020, 0x0110, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Temporal Resolution", "TemporalResolution", "1", false},
+   {0x0020, 0x0200, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Frame of Reference", "SynchronizationFrameOfReferenceUID", "1", false},
+   {0x0020, 0x0242, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Concatenation", "SOPInstanceUIDOfConcatenationSource", "1", false},
+   {0x0020, 0x1000, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Series in Study", "SeriesInStudy", "1", true},
+   {0x0020, 0x1001, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Acquisitions in", "AcquisitionsInSeries", "1", true},
+   {0x0020, 0x1002, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Images in", "ImagesInAcquisition", "1", false},
+   {0x0020, 0x1003, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Images in Series", "ImagesInSeries", "1", true},
+   {0x0020, 0x1004, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Acquisitions in", "AcquisitionsInStudy", "1", true},
+   {0x0020, 0x1005, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Images in Study", "ImagesInStudy", "1", true},
+   {0x0020, 0x1020, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Reference", "Reference", "1-", true},
+   {0x0020, 0x1040, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Position Reference", "PositionReferenceIndicator", "1", false},
+   {0x0020, 0x1041, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Slice Location", "SliceLocation", "1", false},
+   {0x0020, 0x1070, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Other Study Numbers", "OtherStudyNumbers", "1-", true},
+   {0x0020, 0x1200, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Patient", "NumberOfPatientRelatedStudies", "1", false},
+   {0x0020, 0x1202, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Patient", "NumberOfPatientRelatedSeries", "1", false},
+   {0x0020, 0x1204, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Patient", "NumberOfPatientRelatedInstances", "1", false},
+   {0x0020, 0x1206, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Study", "NumberOfStudyRelatedSeries", "1", false},
+   {0x0020, 0x1208, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Study", "NumberOfStudyRelatedInstances", "1", false},
+   {0x0020, 0x1209, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Series", "NumberOfSeriesRelatedInstances", "1", false},
+   {0x0020, 0x3100, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Source Image IDs", "SourceImageIDs", "1-", true},
+   {0x0020, 0x3401, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Modifying Device ID", "ModifyingDeviceID", "1", true},
+   {0x0020, 0x3402, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Modified Image ID", "ModifiedImageID", "1", true},
+   {0x0020, 0x3403, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Modified Image Date", "ModifiedImageDate", "1", true},
+   {0x0020, 0x3404, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Modifying Device", "ModifyingDeviceManufacturer", "1", true},
+   {0x0020, 0x3405, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Modified Image Time", "ModifiedImageTime", "1", true},
+   {0x0020, 0x3406, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Modified Image", "ModifiedImageDescription", "1", true},
+   {0x0020, 0x4000, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Image Comments", "ImageComments", "1", false},
+   {0x0020, 0x5000, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Original Image", "OriginalImageIdentification", "1-", true},
+   {0x0020, 0x5002, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Identification", "OriginalImageIdentificationNomenclature", "n", true},
+   {0x0020, 0x9056, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Stack ID", "StackID", "1", false},
+   {0x0020, 0x9057, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "In-Stack Position", "InStackPositionNumber", "1", false},
+   {0x0020, 0x9071, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Anatomy", "FrameAnatomySequence", "1", false},
+   {0x0020, 0x9072, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Frame Laterality", "FrameLaterality", "1", false},
+   {0x0020, 0x9111, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Content", "FrameContentSequence", "1", false},
+   {0x0020, 0x9113, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Plane Position", "PlanePositionSequence", "1", false},
+   {0x0020, 0x9116, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Plane Orientation", "PlaneOrientationSequence", "1", false},
+   {0x0020, 0x9128, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Temporal Position", "TemporalPositionIndex", "1", false},
+   {0x0020, 0x9153, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Nominal Cardiac", "NominalCardiacTriggerDelayTime", "1", false},
+   {0x0020, 0x9154, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Trigger Time Prior", "NominalCardiacTriggerTimePriorToRPeak", "1", false},
+   {0x0020, 0x9155, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Trigger Time Prior", "ActualCardiacTriggerTimePriorToRPeak", "1", false},
+   {0x0020, 0x9156, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Frame Acquisition", "FrameAcquisitionNumber", "1", false},
+   {0x0020, 0x9157, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Dimension Index", "DimensionIndexValues", "1-", false},
+   {0x0020, 0x9158, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Frame Comments", "FrameComments", "1", false},
+   {0x0020, 0x9161, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Concatenation UID", "ConcatenationUID", "1", false},
+   {0x0020, 0x9162, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "In-concatenation", "InConcatenationNumber", "1", false},
+   {0x0020, 0x9163, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "In-concatenation", "InConcatenationTotalNumber", "1", false},
+   {0x0020, 0x9164, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Dimension", "DimensionOrganizationUID", "1", false},
+   {0x0020, 0x9165, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Dimension Index", "DimensionIndexPointer", "1", false},
+   {0x0020, 0x9167, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Functional Group", "FunctionalGroupPointer", "1", false},
+   {0x0020, 0x9213, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Dimension Index", "DimensionIndexPrivateCreator", "1", false},
+   {0x0020, 0x9221, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Organization", "DimensionOrganizationSequence", "1", false},
+   {0x0020, 0x9222, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Dimension Index", "DimensionIndexSequence", "1", false},
+   {0x0020, 0x9228, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Concatenation Frame", "ConcatenationFrameOffsetNumber", "1", false},
+   {0x0020, 0x9238, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Functional Group", "FunctionalGroupPrivateCreator", "1", false},
+   {0x0020, 0x9241, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Nominal Percentage", "NominalPercentageOfCardiacPhase", "1", false},
+   {0x0020, 0x9245, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "of Respiratory", "NominalPercentageOfRespiratoryPhase", "1", false},
+   {0x0020, 0x9246, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Respiratory", "StartingRespiratoryAmplitude", "1", false},
+   {0x0020, 0x9247, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Starting", "StartingRespiratoryPhase", "1", false},
+   {0x0020, 0x9248, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Ending Respiratory", "EndingRespiratoryAmplitude", "1", false},
+   {0x0020, 0x9249, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Ending Respiratory", "EndingRespiratoryPhase", "1", false},
+   {0x0020, 0x9250, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Respiratory Trigger", "RespiratoryTriggerType", "1", false},
+   {0x0020, 0x9251, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "R-R Interval Time", "RRIntervalTimeNominal", "1", false},
+   {0x0020, 0x9252, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Actual Cardiac", "ActualCardiacTriggerDelayTime", "1", false},
+   {0x0020, 0x9253, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Synchronization", "RespiratorySynchronizationSequence", "1", false},
+   {0x0020, 0x9254, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Respiratory", "RespiratoryIntervalTime", "1", false},
+   {0x0020, 0x9255, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Nominal Respiratory", "NominalRespiratoryTriggerDelayTime", "1", false},
+   {0x0020, 0x9256, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Respiratory Trigger", "RespiratoryTriggerDelayThreshold", "1", false},
+   {0x0020, 0x9257, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Actual Respiratory", "ActualRespiratoryTriggerDelayTime", "1", false},
+   {0x0020, 0x9301, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Image Position", "ImagePositionVolume", "3", false},
+   {0x0020, 0x9302, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Image Orientation", "ImageOrientationVolume", "6", false},
+   {0x0020, 0x9307, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "UltrasoundAcquisitionGeometry", "1", false},
+   {0x0020, 0x9308, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Apex Position", "ApexPosition", "3", false},
+   {0x0020, 0x9309, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Transducer Mapping", "VolumeToTransducerMappingMatrix", "16", false},
+   {0x0020, 0x930a, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Volume to Table", "VolumeToTableMappingMatrix", "16", false},
+   {0x0020, 0x930c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patient Frame of", "PatientFrameOfReferenceSource", "1", false},
+   {0x0020, 0x930d, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Temporal Position", "TemporalPositionTimeOffset", "1", false},
+   {0x0020, 0x930e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Plane Position", "PlanePositionVolumeSequence", "1", false},
+   {0x0020, 0x930f, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Plane Orientation", "PlaneOrientationVolumeSequence", "1", false},
+   {0x0020, 0x9310, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Temporal Position", "TemporalPositionSequence", "1", false},
+   {0x0020, 0x9311, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Dimension", "DimensionOrganizationType", "1", false},
+   {0x0020, 0x9312, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Volume Frame of", "VolumeFrameOfReferenceUID", "1", false},
+   {0x0020, 0x9313, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Table Frame of", "TableFrameOfReferenceUID", "1", false},
+   {0x0020, 0x9421, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Dimension", "DimensionDescriptionLabel", "1", false},
+   {0x0020, 0x9450, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Patient Orientation", "PatientOrientationInFrameSequence", "1", false},
+   {0x0020, 0x9453, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Frame Label", "FrameLabel", "1", false},
+   {0x0020, 0x9518, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Acquisition Index", "AcquisitionIndex", "1-", false},
+   {0x0020, 0x9529, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Instances Reference", "ContributingSOPInstancesReferenceSequence", "1", false},
+   {0x0020, 0x9536, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "ReconstructionIndex", "1", false},
+   {0x0022, 0x0001, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pass-Through", "LightPathFilterPassThroughWavelength", "1", false},
+   {0x0022, 0x0002, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Light Path Filter", "LightPathFilterPassBand", "2", false},
+   {0x0022, 0x0003, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pass-Through", "ImagePathFilterPassThroughWavelength", "1", false},
+   {0x0022, 0x0004, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Path Filter", "ImagePathFilterPassBand", "2", false},
+   {0x0022, 0x0005, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patient Eye", "PatientEyeMovementCommanded", "1", false},
+   {0x0022, 0x0006, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Movement Command", "PatientEyeMovementCommandCodeSequence", "1", false},
+   {0x0022, 0x0007, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Spherical Lens", "SphericalLensPower", "1", false},
+   {0x0022, 0x0008, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Cylinder Lens Power", "CylinderLensPower", "1", false},
+   {0x0022, 0x0009, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Cylinder Axis", "CylinderAxis", "1", false},
+   {0x0022, 0x000a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Emmetropic", "EmmetropicMagnification", "1", false},
+   {0x0022, 0x000b, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Intra Ocular", "IntraOcularPressure", "1", false},
+   {0x0022, 0x000c, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Horizontal Field of", "HorizontalFieldOfView", "1", false},
+   {0x0022, 0x000d, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Pupil Dilated", "PupilDilated", "1", false},
+   {0x0022, 0x000e, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Degree of Dilation", "DegreeOfDilation", "1", false},
+   {0x0022, 0x0010, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Stereo Baseline", "StereoBaselineAngle", "1", false},
+   {0x0022, 0x0011, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Stereo Baseline", "StereoBaselineDisplacement", "1", false},
+   {0x0022, 0x0012, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Stereo Horizontal", "StereoHorizontalPixelOffset", "1", false},
+   {0x0022, 0x0013, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Stereo Vertical", "StereoVerticalPixelOffset", "1", false},
+   {0x0022, 0x0014, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Stereo Rotation", "StereoRotation", "1", false},
+   {0x0022, 0x0015, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Acquisition Device", "AcquisitionDeviceTypeCodeSequence", "1", false},
+   {0x0022, 0x0016, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Illumination Type", "IlluminationTypeCodeSequence", "1", false},
+   {0x0022, 0x0017, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Type Stack Code", "LightPathFilterTypeStackCodeSequence", "1", false},
+   {0x0022, 0x0018, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Type Stack Code", "ImagePathFilterTypeStackCodeSequence", "1", false},
+   {0x0022, 0x0019, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Lenses Code", "LensesCodeSequence", "1", false},
+   {0x0022, 0x001a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Channel Description", "ChannelDescriptionCodeSequence", "1", false},
+   {0x0022, 0x001b, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Refractive State", "RefractiveStateSequence", "1", false},
+   {0x0022, 0x001c, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Mydriatic Agent", "MydriaticAgentCodeSequence", "1", false},
+   {0x0022, 0x001d, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Position Code", "RelativeImagePositionCodeSequence", "1", false},
+   {0x0022, 0x001e, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Camera Angle of", "CameraAngleOfView", "1", false},
+   {0x0022, 0x0020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Stereo Pairs", "StereoPairsSequence", "1", false},
+   {0x0022, 0x0021, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Left Image Sequence", "LeftImageSequence", "1", false},
+   {0x0022, 0x0022, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Right Image", "RightImageSequence", "1", false},
+   {0x0022, 0x0030, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Axial Length of the", "AxialLengthOfTheEye", "1", false},
+   {0x0022, 0x0031, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Frame", "OphthalmicFrameLocationSequence", "1", false},
+   {0x0022, 0x0032, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Reference", "ReferenceCoordinates", "2-", false},
+   {0x0022, 0x0035, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Depth Spatial", "DepthSpatialResolution", "1", false},
+   {0x0022, 0x0036, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Maximum Depth", "MaximumDepthDistortion", "1", false},
+   {0x0022, 0x0037, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Along-scan Spatial", "AlongScanSpatialResolution", "1", false},
+   {0x0022, 0x0038, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Maximum Along-scan", "MaximumAlongScanDistortion", "1", false},
+   {0x0022, 0x0039, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Image", "OphthalmicImageOrientation", "1", false},
+   {0x0022, 0x0041, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Depth of Transverse", "DepthOfTransverseImage", "1", false},
+   {0x0022, 0x0042, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Concentration Units", "MydriaticAgentConcentrationUnitsSequence", "1", false},
+   {0x0022, 0x0048, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Across-scan Spatial", "AcrossScanSpatialResolution", "1", false},
+   {0x0022, 0x0049, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Maximum Across-scan", "MaximumAcrossScanDistortion", "1", false},
+   {0x0022, 0x004e, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Mydriatic Agent", "MydriaticAgentConcentration", "1", false},
+   {0x0022, 0x0055, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Illumination Wave", "IlluminationWaveLength", "1", false},
+   {0x0022, 0x0056, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Illumination Power", "IlluminationPower", "1", false},
+   {0x0022, 0x0057, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Illumination", "IlluminationBandwidth", "1", false},
+   {0x0022, 0x0058, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Mydriatic Agent", "MydriaticAgentSequence", "1", false},
+   {0x0022, 0x1007, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Measurements Right", "OphthalmicAxialMeasurementsRightEyeSequence", "1", false},
+   {0x0022, 0x1008, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Measurements Left", "OphthalmicAxialMeasurementsLeftEyeSequence", "1", false},
+   {0x0022, 0x1010, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Length Measurements", "OphthalmicAxialLengthMeasurementsType", "1", false},
+   {0x0022, 0x1019, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "OphthalmicAxialLength", "1", false},
+   {0x0022, 0x1024, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Lens Status Code", "LensStatusCodeSequence", "1", false},
+   {0x0022, 0x1025, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Vitreous Status", "VitreousStatusCodeSequence", "1", false},
+   {0x0022, 0x1028, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "IOL Formula Code", "IOLFormulaCodeSequence", "1", false},
+   {0x0022, 0x1029, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "IOL Formula Detail", "IOLFormulaDetail", "1", false},
+   {0x0022, 0x1033, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Keratometer Index", "KeratometerIndex", "1", false},
+   {0x0022, 0x1035, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "SourceOfOphthalmicAxialLengthCodeSequence", "1", false},
+   {0x0022, 0x1037, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Target Refraction", "TargetRefraction", "1", false},
+   {0x0022, 0x1039, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Refractive", "RefractiveProcedureOccurred", "1", false},
+   {0x0022, 0x1040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Refractive Surgery", "RefractiveSurgeryTypeCodeSequence", "1", false},
+   {0x0022, 0x1044, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ultrasound Axial", "OphthalmicUltrasoundAxialMeasurementsTypeCodeSequence", "1", false},
+   {0x0022, 0x1050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Length Measurements", "OphthalmicAxialLengthMeasurementsSequence", "1", false},
+   {0x0022, 0x1053, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "IOL Power", "IOLPower", "1", false},
+   {0x0022, 0x1054, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Predicted", "PredictedRefractiveError", "1", false},
+   {0x0022, 0x1059, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "OphthalmicAxialLengthVelocity", "1", false},
+   {0x0022, 0x1065, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Lens Status", "LensStatusDescription", "1", false},
+   {0x0022, 0x1066, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Vitreous Status", "VitreousStatusDescription", "1", false},
+   {0x0022, 0x1090, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "IOL Power Sequence", "IOLPowerSequence", "1", false},
+   {0x0022, 0x1092, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Lens Constant", "LensConstantSequence", "1", false},
+   {0x0022, 0x1093, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "IOL Manufacturer", "IOLManufacturer", "1", false},
+   {0x0022, 0x1094, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Lens Constant", "LensConstantDescription", "1", false},
+   {0x0022, 0x1096, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Measurement Type", "KeratometryMeasurementTypeCodeSequence", "1", false},
+   {0x0022, 0x1100, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "ReferencedOphthalmicAxialMeasurementsSequence", "1", false},
+   {0x0022, 0x1101, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Length Measurements", "OphthalmicAxialLengthMeasurementsSegmentNameCodeSequence", "1", false},
+   {0x0022, 0x1103, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Before Refractive", "RefractiveErrorBeforeRefractiveSurgeryCodeSequence", "1", false},
+   {0x0022, 0x1121, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "IOL Power For Exact", "IOLPowerForExactEmmetropia", "1", false},
+   {0x0022, 0x1122, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "IOL Power For Exact", "IOLPowerForExactTargetRefraction", "1", false},
+   {0x0022, 0x1125, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Depth Definition", "AnteriorChamberDepthDefinitionCodeSequence", "1", false},
+   {0x0022, 0x1130, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Lens Thickness", "LensThickness", "1", false},
+   {0x0022, 0x1131, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Anterior Chamber", "AnteriorChamberDepth", "1", false},
+   {0x0022, 0x1132, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Thickness Data Code", "SourceOfLensThicknessDataCodeSequence", "1", false},
+   {0x0022, 0x1133, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Chamber Depth Data", "SourceOfAnteriorChamberDepthDataCodeSequence", "1", false},
+   {0x0022, 0x1135, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Refractive Error", "SourceOfRefractiveErrorDataCodeSequence", "1", false},
+   {0x0022, 0x1140, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Length Measurement", "OphthalmicAxialLengthMeasurementModified", "1", false},
+   {0x0022, 0x1150, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Length Data Source", "OphthalmicAxialLengthDataSourceCodeSequence", "1", false},
+   {0x0022, 0x1153, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Length Acquisition", "OphthalmicAxialLengthAcquisitionMethodCodeSequence", "1", false},
+   {0x0022, 0x1155, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Signal to Noise", "SignalToNoiseRatio", "1", false},
+   {0x0022, 0x1159, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Length Data Source", "OphthalmicAxialLengthDataSourceDescription", "1", false},
+   {0x0022, 0x1210, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Length Measurements", "OphthalmicAxialLengthMeasurementsTotalLengthSequence", "1", false},
+   {0x0022, 0x1211, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Length Measurements", "OphthalmicAxialLengthMeasurementsSegmentalLengthSequence", "1", false},
+   {0x0022, 0x1212, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Length Measurements", "OphthalmicAxialLengthMeasurementsLengthSummationSequence", "1", false},
+   {0x0022, 0x1220, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "UltrasoundOphthalmicAxialLengthMeasurementsSequence", "1", false},
+   {0x0022, 0x1225, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Axial Length", "OpticalOphthalmicAxialLengthMeasurementsSequence", "1", false},
+   {0x0022, 0x1230, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "UltrasoundSelectedOphthalmicAxialLengthSequence", "1", false},
+   {0x0022, 0x1250, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Length Selection", "OphthalmicAxialLengthSelectionMethodCodeSequence", "1", false},
+   {0x0022, 0x1255, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "OpticalSelectedOphthalmicAxialLengthSequence", "1", false},
+   {0x0022, 0x1257, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "SelectedSegmentalOphthalmicAxialLengthSequence", "1", false},
+   {0x0022, 0x1260, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "SelectedTotalOphthalmicAxialLengthSequence", "1", false},
+   {0x0022, 0x1262, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Length Quality", "OphthalmicAxialLengthQualityMetricSequence", "1", false},
+   {0x0022, 0x1273, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Length Quality", "OphthalmicAxialLengthQualityMetricTypeDescription", "1", false},
+   {0x0022, 0x1300, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Calculations Right", "IntraocularLensCalculationsRightEyeSequence", "1", false},
+   {0x0022, 0x1310, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Calculations Left", "IntraocularLensCalculationsLeftEyeSequence", "1", false},
+   {0x0022, 0x1330, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ophthalmic Axial", "ReferencedOphthalmicAxialLengthMeasurementQCImageSequence", "1", false},
+   {0x0024, 0x0010, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Visual Field", "VisualFieldHorizontalExtent", "1", false},
+   {0x0024, 0x0011, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Visual Field", "VisualFieldVerticalExtent", "1", false},
+   {0x0024, 0x0012, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Visual Field Shape", "VisualFieldShape", "1", false},
+   {0x0024, 0x0016, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Screening Test Mode", "ScreeningTestModeCodeSequence", "1", false},
+   {0x0024, 0x0018, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Maximum Stimulus", "MaximumStimulusLuminance", "1", false},
+   {0x0024, 0x0020, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Background", "BackgroundLuminance", "1", false},
+   {0x0024, 0x0021, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Stimulus Color Code", "StimulusColorCodeSequence", "1", false},
+   {0x0024, 0x0024, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Illumination Color", "BackgroundIlluminationColorCodeSequence", "1", false},
+   {0x0024, 0x0025, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Stimulus Area", "StimulusArea", "1", false},
+   {0x0024, 0x0028, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Stimulus", "StimulusPresentationTime", "1", false},
+   {0x0024, 0x0032, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fixation Sequence", "FixationSequence", "1", false},
+   {0x0024, 0x0033, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fixation Monitoring", "FixationMonitoringCodeSequence", "1", false},
+   {0x0024, 0x0034, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Visual Field Catch", "VisualFieldCatchTrialSequence", "1", false},
+   {0x0024, 0x0035, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Fixation Checked", "FixationCheckedQuantity", "1", false},
+   {0x0024, 0x0036, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Properly Fixated", "PatientNotProperlyFixatedQuantity", "1", false},
+   {0x0024, 0x0037, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Presented Visual", "PresentedVisualStimuliDataFlag", "1", false},
+   {0x0024, 0x0038, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Visual", "NumberOfVisualStimuli", "1", false},
+   {0x0024, 0x0039, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Excessive Fixation", "ExcessiveFixationLossesDataFlag", "1", false},
+   {0x0024, 0x0040, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Excessive Fixation", "ExcessiveFixationLosses", "1", false},
+   {0x0024, 0x0042, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Stimuli Retesting", "StimuliRetestingQuantity", "1", false},
+   {0x0024, 0x0044, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Patients", "CommentsOnPatientPerformanceOfVisualField", "1", false},
+   {0x0024, 0x0045, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "False Negatives", "FalseNegativesEstimateFlag", "1", false},
+   {0x0024, 0x0046, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "False Negatives", "FalseNegativesEstimate", "1", false},
+   {0x0024, 0x0048, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Negative Catch", "NegativeCatchTrialsQuantity", "1", false},
+   {0x0024, 0x0050, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "False Negatives", "FalseNegativesQuantity", "1", false},
+   {0x0024, 0x0051, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Excessive False", "ExcessiveFalseNegativesDataFlag", "1", false},
+   {0x0024, 0x0052, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Excessive False", "ExcessiveFalseNegatives", "1", false},
+   {0x0024, 0x0053, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "False Positives", "FalsePositivesEstimateFlag", "1", false},
+   {0x0024, 0x0054, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "False Positives", "FalsePositivesEstimate", "1", false},
+   {0x0024, 0x0055, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Catch Trials Data", "CatchTrialsDataFlag", "1", false},
+   {0x0024, 0x0056, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Positive Catch", "PositiveCatchTrialsQuantity", "1", false},
+   {0x0024, 0x0057, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Test Point Normals", "TestPointNormalsDataFlag", "1", false},
+   {0x0024, 0x0058, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Test Point Normals", "TestPointNormalsSequence", "1", false},
+   {0x0024, 0x0059, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Probability Normals", "GlobalDeviationProbabilityNormalsFlag", "1", false},
+   {0x0024, 0x0060, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "False Positives", "FalsePositivesQuantity", "1", false},
+   {0x0024, 0x0061, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Excessive False", "ExcessiveFalsePositivesDataFlag", "1", false},
+   {0x0024, 0x0062, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Excessive False", "ExcessiveFalsePositives", "1", false},
+   {0x0024, 0x0063, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Visual Field Test", "VisualFieldTestNormalsFlag", "1", false},
+   {0x0024, 0x0064, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Results Normals", "ResultsNormalsSequence", "1", false},
+   {0x0024, 0x0065, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Sensitivity", "AgeCorrectedSensitivityDeviationAlgorithmSequence", "1", false},
+   {0x0024, 0x0066, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Global Deviation", "GlobalDeviationFromNormal", "1", false},
+   {0x0024, 0x0067, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Sensitivity", "GeneralizedDefectSensitivityDeviationAlgorithmSequence", "1", false},
+   {0x0024, 0x0068, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Localized Deviation", "LocalizedDeviationfromNormal", "1", false},
+   {0x0024, 0x0069, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patient Reliability", "PatientReliabilityIndicator", "1", false},
+   {0x0024, 0x0070, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Visual Field Mean", "VisualFieldMeanSensitivity", "1", false},
+   {0x0024, 0x0071, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Global Deviation", "GlobalDeviationProbability", "1", false},
+   {0x0024, 0x0072, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Probability Normals", "LocalDeviationProbabilityNormalsFlag", "1", false},
+   {0x0024, 0x0073, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Localized Deviation", "LocalizedDeviationProbability", "1", false},
+   {0x0024, 0x0074, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Fluctuation", "ShortTermFluctuationCalculated", "1", false},
+   {0x0024, 0x0075, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Short Term", "ShortTermFluctuation", "1", false},
+   {0x0024, 0x0076, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Fluctuation", "ShortTermFluctuationProbabilityCalculated", "1", false},
+   {0x0024, 0x0077, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Fluctuation", "ShortTermFluctuationProbability", "1", false},
+   {0x0024, 0x0078, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Deviation From", "CorrectedLocalizedDeviationFromNormalCalculated", "1", false},
+   {0x0024, 0x0079, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Deviation From", "CorrectedLocalizedDeviationFromNormal", "1", false},
+   {0x0024, 0x0080, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Deviation From", "CorrectedLocalizedDeviationFromNormalProbabilityCalculated", "1", false},
+   {0x0024, 0x0081, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Deviation From", "CorrectedLocalizedDeviationFromNormalProbability", "1", false},
+   {0x0024, 0x0083, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Probability", "GlobalDeviationProbabilitySequence", "1", false},
+   {0x0024, 0x0085, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Probability", "LocalizedDeviationProbabilitySequence", "1", false},
+   {0x0024, 0x0086, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Foveal Sensitivity", "FovealSensitivityMeasured", "1", false},
+   {0x0024, 0x0087, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Foveal Sensitivity", "FovealSensitivity", "1", false},
+   {0x0024, 0x0088, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Visual Field Test", "VisualFieldTestDuration", "1", false},
+   {0x0024, 0x0089, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Visual Field Test", "VisualFieldTestPointSequence", "1", false},
+   {0x0024, 0x0090, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Visual Field Test", "VisualFieldTestPointXCoordinate", "1", false},
+   {0x0024, 0x0091, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Visual Field Test", "VisualFieldTestPointYCoordinate", "1", false},
+   {0x0024, 0x0092, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Sensitivity", "AgeCorrectedSensitivityDeviationValue", "1", false},
+   {0x0024, 0x0093, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Stimulus Results", "StimulusResults", "1", false},
+   {0x0024, 0x0094, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Sensitivity Value", "SensitivityValue", "1", false},
+   {0x0024, 0x0095, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Retest Stimulus", "RetestStimulusSeen", "1", false},
+   {0x0024, 0x0096, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Retest Sensitivity", "RetestSensitivityValue", "1", false},
+   {0x0024, 0x0097, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Point Normals", "VisualFieldTestPointNormalsSequence", "1", false},
+   {0x0024, 0x0098, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Quantified Defect", "QuantifiedDefect", "1", false},
+   {0x0024, 0x0100, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Sensitivity", "AgeCorrectedSensitivityDeviationProbabilityValue", "1", false},
+   {0x0024, 0x0102, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Corrected", "GeneralizedDefectCorrectedSensitivityDeviationFlag", "1", false},
+   {0x0024, 0x0103, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Corrected", "GeneralizedDefectCorrectedSensitivityDeviationValue", "1", false},
+   {0x0024, 0x0104, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Sensitivity", "GeneralizedDefectCorrectedSensitivityDeviationProbabilityValue", "1", false},
+   {0x0024, 0x0105, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Minimum Sensitivity", "MinimumSensitivityValue", "1", false},
+   {0x0024, 0x0106, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Blind Spot", "BlindSpotLocalized", "1", false},
+   {0x0024, 0x0107, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Blind Spot X-", "BlindSpotXCoordinate", "1", false},
+   {0x0024, 0x0108, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Blind Spot Y-", "BlindSpotYCoordinate", "1", false},
+   {0x0024, 0x0110, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Measurement", "VisualAcuityMeasurementSequence", "1", false},
+   {0x0024, 0x0112, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Parameters Used on", "RefractiveParametersUsedOnPatientSequence", "1", false},
+   {0x0024, 0x0113, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Measurement", "MeasurementLaterality", "1", false},
+   {0x0024, 0x0114, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Clinical", "OphthalmicPatientClinicalInformationLeftEyeSequence", "1", false},
+   {0x0024, 0x0115, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Clinical", "OphthalmicPatientClinicalInformationRightEyeSequence", "1", false},
+   {0x0024, 0x0117, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Foveal Point", "FovealPointNormativeDataFlag", "1", false},
+   {0x0024, 0x0118, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Foveal Point", "FovealPointProbabilityValue", "1", false},
+   {0x0024, 0x0120, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Screening Baseline", "ScreeningBaselineMeasured", "1", false},
+   {0x0024, 0x0122, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Screening Baseline", "ScreeningBaselineMeasuredSequence", "1", false},
+   {0x0024, 0x0124, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Screening Baseline", "ScreeningBaselineType", "1", false},
+   {0x0024, 0x0126, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Screening Baseline", "ScreeningBaselineValue", "1", false},
+   {0x0024, 0x0202, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Algorithm Source", "AlgorithmSource", "1", false},
+   {0x0024, 0x0306, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Data Set Name", "DataSetName", "1", false},
+   {0x0024, 0x0307, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Data Set Version", "DataSetVersion", "1", false},
+   {0x0024, 0x0308, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Data Set Source", "DataSetSource", "1", false},
+   {0x0024, 0x0309, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Data Set", "DataSetDescription", "1", false},
+   {0x0024, 0x0317, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Reliability Global", "VisualFieldTestReliabilityGlobalIndexSequence", "1", false},
+   {0x0024, 0x0320, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Results Index", "VisualFieldGlobalResultsIndexSequence", "1", false},
+   {0x0024, 0x0325, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Data Observation", "DataObservationSequence", "1", false},
+   {0x0024, 0x0338, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Index Normals Flag", "IndexNormalsFlag", "1", false},
+   {0x0024, 0x0341, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Index Probability", "IndexProbability", "1", false},
+   {0x0024, 0x0344, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Index Probability", "IndexProbabilitySequence", "1", false},
+   {0x0028, 0x0002, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Samples per Pixel", "SamplesPerPixel", "1", false},
+   {0x0028, 0x0003, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Samples per Pixel", "SamplesPerPixelUsed", "1", false},
+   {0x0028, 0x0004, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Photometric", "PhotometricInterpretation", "1", false},
+   {0x0028, 0x0005, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Dimensions", "ImageDimensions", "1", true},
+   {0x0028, 0x0006, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Planar", "PlanarConfiguration", "1", false},
+   {0x0028, 0x0008, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Frames", "NumberOfFrames", "1", false},
+   {0x0028, 0x0009, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Frame Increment", "FrameIncrementPointer", "1-", false},
+   {0x0028, 0x000a, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Frame Dimension", "FrameDimensionPointer", "1-", false},
+   {0x0028, 0x0010, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Rows", "Rows", "1", false},
+   {0x0028, 0x0011, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Columns", "Columns", "1", false},
+   {0x0028, 0x0012, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Planes", "Planes", "1", true},
+   {0x0028, 0x0014, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Ultrasound Color", "UltrasoundColorDataPresent", "1", false},
+   {0x0028, 0x0030, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Pixel Spacing", "PixelSpacing", "2", false},
+   {0x0028, 0x0031, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Zoom Factor", "ZoomFactor", "2", false},
+   {0x0028, 0x0032, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Zoom Center", "ZoomCenter", "2", false},
+   {0x0028, 0x0034, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Pixel Aspect Ratio", "PixelAspectRatio", "2", false},
+   {0x0028, 0x0040, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Format", "ImageFormat", "1", true},
+   {0x0028, 0x0050, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Manipulated Image", "ManipulatedImage", "1-", true},
+   {0x0028, 0x0051, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Corrected Image", "CorrectedImage", "1-", false},
+   {0x0028, 0x005f, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Compression", "CompressionRecognitionCode", "1", true},
+   {0x0028, 0x0060, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compression Code", "CompressionCode", "1", true},
+   {0x0028, 0x0061, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Compression", "CompressionOriginator", "1", true},
+   {0x0028, 0x0062, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Compression Label", "CompressionLabel", "1", true},
+   {0x0028, 0x0063, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Compression", "CompressionDescription", "1", true},
+   {0x0028, 0x0065, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compression", "CompressionSequence", "1-", true},
+   {0x0028, 0x0066, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Compression Step", "CompressionStepPointers", "1-", true},
+   {0x0028, 0x0068, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Repeat Interval", "RepeatInterval", "1", true},
+   {0x0028, 0x0069, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Bits Grouped", "BitsGrouped", "1", true},
+   {0x0028, 0x0070, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Perimeter Table", "PerimeterTable", "1-", true},
+   {0x0028, 0x0071, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Perimeter Value", "PerimeterValue", "1", true},
+   {0x0028, 0x0080, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Predictor Rows", "PredictorRows", "1", true},
+   {0x0028, 0x0081, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Predictor Columns", "PredictorColumns", "1", true},
+   {0x0028, 0x0082, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Predictor Constants", "PredictorConstants", "1-", true},
+   {0x0028, 0x0090, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Blocked Pixels", "BlockedPixels", "1", true},
+   {0x0028, 0x0091, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Block Rows", "BlockRows", "1", true},
+   {0x0028, 0x0092, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Block Columns", "BlockColumns", "1", true},
+   {0x0028, 0x0093, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Row Overlap", "RowOverlap", "1", true},
+   {0x0028, 0x0094, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Column Overlap", "ColumnOverlap", "1", true},
+   {0x0028, 0x0100, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Bits Allocated", "BitsAllocated", "1", false},
+   {0x0028, 0x0101, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Bits Stored", "BitsStored", "1", false},
+   {0x0028, 0x0102, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "High Bit", "HighBit", "1", false},
+   {0x0028, 0x0103, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pixel", "PixelRepresentation", "1", false},
+   {0x0028, 0x0104, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Pixel Value", "SmallestValidPixelValue", "1", true},
+   {0x0028, 0x0105, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Value", "LargestValidPixelValue", "1", true},
+   {0x0028, 0x0106, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Pixel Value", "SmallestImagePixelValue", "1", false},
+   {0x0028, 0x0107, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Value", "LargestImagePixelValue", "1", false},
+   {0x0028, 0x0108, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Value in Series", "SmallestPixelValueInSeries", "1", false},
+   {0x0028, 0x0109, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "in Series", "LargestPixelValueInSeries", "1", false},
+   {0x0028, 0x0110, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Pixel Value in", "SmallestImagePixelValueInPlane", "1", true},
+   {0x0028, 0x0111, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Value in Plane", "LargestImagePixelValueInPlane", "1", true},
+   {0x0028, 0x0120, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Pixel Padding Value", "PixelPaddingValue", "1", false},
+   {0x0028, 0x0121, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Limit", "PixelPaddingRangeLimit", "1", false},
+   {0x0028, 0x0200, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Location", "ImageLocation", "1", true},
+   {0x0028, 0x0300, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Quality Control", "QualityControlImage", "1", false},
+   {0x0028, 0x0301, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Burned In", "BurnedInAnnotation", "1", false},
+   {0x0028, 0x0302, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Recognizable Visual", "RecognizableVisualFeatures", "1", false},
+   {0x0028, 0x0303, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Temporal", "LongitudinalTemporalInformationModified", "1", false},
+   {0x0028, 0x0400, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Transform Label", "TransformLabel", "1", true},
+   {0x0028, 0x0401, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Transform Version", "TransformVersionNumber", "1", true},
+   {0x0028, 0x0402, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Transform", "NumberOfTransformSteps", "1", true},
+   {0x0028, 0x0403, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Sequence of", "SequenceOfCompressedData", "1-", true},
+   {0x0028, 0x0404, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Details of", "DetailsOfCoefficients", "1-", true},
+   {0x0028, 0x0700, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "DCT Label", "DCTLabel", "1", true},
+   {0x0028, 0x0701, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Data Block", "DataBlockDescription", "1-", true},
+   {0x0028, 0x0702, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Data Block", "DataBlock", "1-", true},
+   {0x0028, 0x0710, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Normalization", "NormalizationFactorFormat", "1", true},
+   {0x0028, 0x0720, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Zonal Map Number", "ZonalMapNumberFormat", "1", true},
+   {0x0028, 0x0721, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Zonal Map Location", "ZonalMapLocation", "1-", true},
+   {0x0028, 0x0722, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Zonal Map Format", "ZonalMapFormat", "1", true},
+   {0x0028, 0x0730, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Adaptive Map Format", "AdaptiveMapFormat", "1", true},
+   {0x0028, 0x0740, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Code Number Format", "CodeNumberFormat", "1", true},
+   {0x0028, 0x0a02, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Pixel Spacing", "PixelSpacingCalibrationType", "1", false},
+   {0x0028, 0x0a04, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Calibration", "PixelSpacingCalibrationDescription", "1", false},
+   {0x0028, 0x1040, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Pixel Intensity", "PixelIntensityRelationship", "1", false},
+   {0x0028, 0x1041, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Pixel Intensity", "PixelIntensityRelationshipSign", "1", false},
+   {0x0028, 0x1050, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Window Center", "WindowCenter", "1-", false},
+   {0x0028, 0x1051, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Window Width", "WindowWidth", "1-", false},
+   {0x0028, 0x1052, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Rescale Intercept", "RescaleIntercept", "1", false},
+   {0x0028, 0x1053, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Rescale Slope", "RescaleSlope", "1", false},
+   {0x0028, 0x1054, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Rescale Type", "RescaleType", "1", false},
+   {0x0028, 0x1055, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Window Center &amp", "", "WindowCenterWidthExplanation", false},
+   {0x0028, 0x1056, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "VOI LUT Function", "VOILUTFunction", "1", false},
+   {0x0028, 0x1080, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Gray Scale", "GrayScale", "1", true},
+   {0x0028, 0x1090, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Recommended Viewing", "RecommendedViewingMode", "1", false},
+   {0x0028, 0x1100, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Gray Lookup Table Descriptor", "GrayLookupTableDescriptor", "3", true},
+   {0x0028, 0x1101, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Lookup Table", "RedPaletteColorLookupTableDescriptor", "3", false},
+   {0x0028, 0x1102, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Lookup Table", "GreenPaletteColorLookupTableDescriptor", "3", false},
+   {0x0028, 0x1103, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Lookup Table", "BluePaletteColorLookupTableDescriptor", "3", false},
+   {0x0028, 0x1104, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Lookup Table", "AlphaPaletteColorLookupTableDescriptor", "3", false},
+   {0x0028, 0x1111, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Color Lookup Table", "LargeRedPaletteColorLookupTableDescriptor", "4", true},
+   {0x0028, 0x1112, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Color Lookup Table", "LargeGreenPaletteColorLookupTableDescriptor", "4", true},
+   {0x0028, 0x1113, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Color Lookup Table", "LargeBluePaletteColorLookupTableDescriptor", "4", true},
+   {0x0028, 0x1199, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Palette Color", "PaletteColorLookupTableUID", "1", false},
+   {0x0028, 0x1200, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::OW}, "Data", "GrayLookupTableData", "n", true},
+   {0x0028, 0x1201, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Red Palette Color", "RedPaletteColorLookupTableData", "1", false},
+   {0x0028, 0x1202, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Green Palette Color", "GreenPaletteColorLookupTableData", "1", false},
+   {0x0028, 0x1203, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Blue Palette Color", "BluePaletteColorLookupTableData", "1", false},
+   {0x0028, 0x1204, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Alpha Palette Color", "AlphaPaletteColorLookupTableData", "1", false},
+   {0x0028, 0x1211, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Color Lookup Table", "LargeRedPaletteColorLookupTableData", "1", true},
+   {0x0028, 0x1212, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Color Lookup Table", "LargeGreenPaletteColorLookupTableData", "1", true},
+   {0x0028, 0x1213, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Color Lookup Table", "LargeBluePaletteColorLookupTableData", "1", true},
+   {0x0028, 0x1214, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Large Palette Color", "LargePaletteColorLookupTableUID", "1", true},
+   {0x0028, 0x1221, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Palette Color", "SegmentedRedPaletteColorLookupTableData", "1", false},
+   {0x0028, 0x1222, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Palette Color", "SegmentedGreenPaletteColorLookupTableData", "1", false},
+   {0x0028, 0x1223, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Palette Color", "SegmentedBluePaletteColorLookupTableData", "1", false},
+   {0x0028, 0x1300, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Breast Implant", "BreastImplantPresent", "1", false},
+   {0x0028, 0x1350, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Partial View", "PartialView", "1", false},
+   {0x0028, 0x1351, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Partial View", "PartialViewDescription", "1", false},
+   {0x0028, 0x1352, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Partial View Code", "PartialViewCodeSequence", "1", false},
+   {0x0028, 0x135a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Spatial Locations", "SpatialLocationsPreserved", "1", false},
+   {0x0028, 0x1401, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Data Frame", "DataFrameAssignmentSequence", "1", false},
+   {0x0028, 0x1402, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Data Path", "DataPathAssignment", "1", false},
+   {0x0028, 0x1403, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Bits Mapped to", "BitsMappedToColorLookupTable", "1", false},
+   {0x0028, 0x1404, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Blending LUT 1", "BlendingLUT1Sequence", "1", false},
+   {0x0028, 0x1405, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Blending LUT 1", "BlendingLUT1TransferFunction", "1", false},
+   {0x0028, 0x1406, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Blending Weight", "BlendingWeightConstant", "1", false},
+   {0x0028, 0x1407, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Blending Lookup", "BlendingLookupTableDescriptor", "3", false},
+   {0x0028, 0x1408, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Blending Lookup", "BlendingLookupTableData", "1", false},
+   {0x0028, 0x140b, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Color Lookup Table", "EnhancedPaletteColorLookupTableSequence", "1", false},
+   {0x0028, 0x140c, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Blending LUT 2", "BlendingLUT2Sequence", "1", false},
+   {0x0028, 0x140d, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Blending LUT 2", "BlendingLUT2TransferFunction", "1", false},
+   {0x0028, 0x140e, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Data Path ID", "DataPathID", "1", false},
+   {0x0028, 0x140f, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "RGB LUT Transfer", "RGBLUTTransferFunction", "1", false},
+   {0x0028, 0x1410, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Alpha LUT Transfer", "AlphaLUTTransferFunction", "1", false},
+   {0x0028, 0x2000, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "ICC Profile", "ICCProfile", "1", false},
+   {0x0028, 0x2110, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Lossy Image", "LossyImageCompression", "1", false},
+   {0x0028, 0x2112, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Lossy Image", "LossyImageCompressionRatio", "1-", false},
+   {0x0028, 0x2114, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Lossy Image", "LossyImageCompressionMethod", "1-", false},
+   {0x0028, 0x3000, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Modality LUT", "ModalityLUTSequence", "1", false},
+   {0x0028, 0x3002, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "LUT Descriptor", "LUTDescriptor", "3", false},
+   {0x0028, 0x3003, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "LUT Explanation", "LUTExplanation", "1", false},
+   {0x0028, 0x3004, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Modality LUT Type", "ModalityLUTType", "1", false},
+   {0x0028, 0x3006, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::OW, attribute::VR::NN}, "LUT Data", "LUTData", "n", false},
+   {0x0028, 0x3010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "VOI LUT Sequence", "VOILUTSequence", "1", false},
+   {0x0028, 0x3110, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Softcopy VOI LUT", "SoftcopyVOILUTSequence", "1", false},
+   {0x0028, 0x4000, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Image Presentation", "ImagePresentationComments", "1", true},
+   {0x0028, 0x5000, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Acquisition", "BiPlaneAcquisitionSequence", "1", true},
+   {0x0028, 0x6010, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Representative", "RepresentativeFrameNumber", "1", false},
+   {0x0028, 0x6020, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Frame Numbers of", "FrameNumbersOfInterest", "1-", false},
+   {0x0028, 0x6022, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Frame of Interest", "FrameOfInterestDescription", "1-", false},
+   {0x0028, 0x6023, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Frame of Interest", "FrameOfInterestType", "1-", false},
+   {0x0028, 0x6030, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Mask Pointer(s)", "MaskPointers", "1-", true},
+   {0x0028, 0x6040, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "R Wave Pointer", "RWavePointer", "1-", false},
+   {0x0028, 0x6100, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Mask Subtraction", "MaskSubtractionSequence", "1", false},
+   {0x0028, 0x6101, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Mask Operation", "MaskOperation", "1", false},
+   {0x0028, 0x6102, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Applicable Frame", "ApplicableFrameRange", "2-", false},
+   {0x0028, 0x6110, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Mask Frame Numbers", "MaskFrameNumbers", "1-", false},
+   {0x0028, 0x6112, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Contrast Frame", "ContrastFrameAveraging", "1", false},
+   {0x0028, 0x6114, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Mask Sub-pixel", "MaskSubPixelShift", "2", false},
+   {0x0028, 0x6120, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "TID Offset", "TIDOffset", "1", false},
+   {0x0028, 0x6190, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Mask Operation", "MaskOperationExplanation", "1", false},
+   {0x0028, 0x7fe0, 0xffff, 0xffff, {attribute::VR::UT, attribute::VR::NN, attribute::VR::NN}, "Pixel Data Provider", "PixelDataProviderURL", "1", false},
+   {0x0028, 0x9001, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Data Point Rows", "DataPointRows", "1", false},
+   {0x0028, 0x9002, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Data Point Columns", "DataPointColumns", "1", false},
+   {0x0028, 0x9003, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Signal Domain", "SignalDomainColumns", "1", false},
+   {0x0028, 0x9099, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Largest Monochrome", "LargestMonochromePixelValue", "1", true},
+   {0x0028, 0x9108, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Data Representation", "DataRepresentation", "1", false},
+   {0x0028, 0x9110, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pixel Measures", "PixelMeasuresSequence", "1", false},
+   {0x0028, 0x9132, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame VOI LUT", "FrameVOILUTSequence", "1", false},
+   {0x0028, 0x9145, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Transformation", "PixelValueTransformationSequence", "1", false},
+   {0x0028, 0x9235, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Signal Domain Rows", "SignalDomainRows", "1", false},
+   {0x0028, 0x9411, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Display Filter", "DisplayFilterPercentage", "1", false},
+   {0x0028, 0x9415, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Pixel Shift", "FramePixelShiftSequence", "1", false},
+   {0x0028, 0x9416, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Subtraction Item ID", "SubtractionItemID", "1", false},
+   {0x0028, 0x9422, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Relationship LUT", "PixelIntensityRelationshipLUTSequence", "1", false},
+   {0x0028, 0x9443, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Pixel Data", "FramePixelDataPropertiesSequence", "1", false},
+   {0x0028, 0x9444, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Geometrical", "GeometricalProperties", "1", false},
+   {0x0028, 0x9445, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Geometric Maximum", "GeometricMaximumDistortion", "1", false},
+   {0x0028, 0x9446, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Processing", "ImageProcessingApplied", "1-", false},
+   {0x0028, 0x9454, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Mask Selection Mode", "MaskSelectionMode", "1", false},
+   {0x0028, 0x9474, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "LUT Function", "LUTFunction", "1", false},
+   {0x0028, 0x9478, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Mask Visibility", "MaskVisibilityPercentage", "1", false},
+   {0x0028, 0x9501, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pixel Shift", "PixelShiftSequence", "1", false},
+   {0x0028, 0x9502, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Region Pixel Shift", "RegionPixelShiftSequence", "1", false},
+   {0x0028, 0x9503, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Vertices of the", "VerticesOfTheRegion", "2-", false},
+   {0x0028, 0x9505, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Presentation", "MultiFramePresentationSequence", "1", false},
+   {0x0028, 0x9506, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pixel Shift Frame", "PixelShiftFrameRange", "2-", false},
+   {0x0028, 0x9507, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "LUT Frame Range", "LUTFrameRange", "2-", false},
+   {0x0028, 0x9520, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Image to Equipment", "ImageToEquipmentMappingMatrix", "16", false},
+   {0x0028, 0x9537, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "EquipmentCoordinateSystemIdentification", "1", false},
+   {0x0032, 0x000a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Study Status ID", "StudyStatusID", "1", true},
+   {0x0032, 0x000c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Study Priority ID", "StudyPriorityID", "1", true},
+   {0x0032, 0x0012, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Study ID Issuer", "StudyIDIssuer", "1", true},
+   {0x0032, 0x0032, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Study Verified Date", "StudyVerifiedDate", "1", true},
+   {0x0032, 0x0033, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Study Verified Time", "StudyVerifiedTime", "1", true},
+   {0x0032, 0x0034, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Study Read Date", "StudyReadDate", "1", true},
+   {0x0032, 0x0035, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Study Read Time", "StudyReadTime", "1", true},
+   {0x0032, 0x1000, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Scheduled Study", "ScheduledStudyStartDate", "1", true},
+   {0x0032, 0x1001, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Scheduled Study", "ScheduledStudyStartTime", "1", true},
+   {0x0032, 0x1010, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Scheduled Study", "ScheduledStudyStopDate", "1", true},
+   {0x0032, 0x1011, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Scheduled Study", "ScheduledStudyStopTime", "1", true},
+   {0x0032, 0x1020, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Scheduled Study", "ScheduledStudyLocation", "1", true},
+   {0x0032, 0x1021, 0xffff, 0xffff, {attribute::VR::AE, attribute::VR::NN, attribute::VR::NN}, "Scheduled Study", "ScheduledStudyLocationAETitle", "1-", true},
+   {0x0032, 0x1030, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Reason for Study", "ReasonForStudy", "1", true},
+   {0x0032, 0x1031, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Physician", "RequestingPhysicianIdentificationSequence", "1", false},
+   {0x0032, 0x1032, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Requesting", "RequestingPhysician", "1", false},
+   {0x0032, 0x1033, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Requesting Service", "RequestingService", "1", false},
+   {0x0032, 0x1034, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Requesting Service", "RequestingServiceCodeSequence", "1", false},
+   {0x0032, 0x1040, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Study Arrival Date", "StudyArrivalDate", "1", true},
+   {0x0032, 0x1041, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Study Arrival Time", "StudyArrivalTime", "1", true},
+   {0x0032, 0x1050, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Study Completion", "StudyCompletionDate", "1", true},
+   {0x0032, 0x1051, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Study Completion", "StudyCompletionTime", "1", true},
+   {0x0032, 0x1055, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Study Component", "StudyComponentStatusID", "1", true},
+   {0x0032, 0x1060, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Requested Procedure", "RequestedProcedureDescription", "1", false},
+   {0x0032, 0x1064, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Requested Procedure", "RequestedProcedureCodeSequence", "1", false},
+   {0x0032, 0x1070, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Requested Contrast", "RequestedContrastAgent", "1", false},
+   {0x0032, 0x4000, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Study Comments", "StudyComments", "1", true},
+   {0x0038, 0x0004, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Patient", "ReferencedPatientAliasSequence", "1", false},
+   {0x0038, 0x0008, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Visit Status ID", "VisitStatusID", "1", false},
+   {0x0038, 0x0010, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Admission ID", "AdmissionID", "1", false},
+   {0x0038, 0x0011, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Issuer of Admission", "IssuerOfAdmissionID", "1", true},
+   {0x0038, 0x0014, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Issuer of Admission", "IssuerOfAdmissionIDSequence", "1", false},
+   {0x0038, 0x0016, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Route of Admissions", "RouteOfAdmissions", "1", false},
+   {0x0038, 0x001a, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Scheduled Admission", "ScheduledAdmissionDate", "1", true},
+   {0x0038, 0x001b, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Scheduled Admission", "ScheduledAdmissionTime", "1", true},
+   {0x0038, 0x001c, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Scheduled Discharge", "ScheduledDischargeDate", "1", true},
+   {0x0038, 0x001d, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Scheduled Discharge", "ScheduledDischargeTime", "1", true},
+   {0x0038, 0x001e, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Institution", "ScheduledPatientInstitutionResidence", "1", true},
+   {0x0038, 0x0020, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Admitting Date", "AdmittingDate", "1", false},
+   {0x0038, 0x0021, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Admitting Time", "AdmittingTime", "1", false},
+   {0x0038, 0x0030, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Discharge Date", "DischargeDate", "1", true},
+   {0x0038, 0x0032, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Discharge Time", "DischargeTime", "1", true},
+   {0x0038, 0x0040, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Discharge Diagnosis", "DischargeDiagnosisDescription", "1", true},
+   {0x0038, 0x0044, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Discharge Diagnosis", "DischargeDiagnosisCodeSequence", "1", true},
+   {0x0038, 0x0050, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Special Needs", "SpecialNeeds", "1", false},
+   {0x0038, 0x0060, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Service Episode ID", "ServiceEpisodeID", "1", false},
+   {0x0038, 0x0061, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Issuer of Service", "IssuerOfServiceEpisodeID", "1", true},
+   {0x0038, 0x0062, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Service Episode", "ServiceEpisodeDescription", "1", false},
+   {0x0038, 0x0064, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Issuer of Service", "IssuerOfServiceEpisodeIDSequence", "1", false},
+   {0x0038, 0x0100, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pertinent Documents", "PertinentDocumentsSequence", "1", false},
+   {0x0038, 0x0300, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Current Patient", "CurrentPatientLocation", "1", false},
+   {0x0038, 0x0400, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Institution", "PatientInstitutionResidence", "1", false},
+   {0x0038, 0x0500, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patient State", "PatientState", "1", false},
+   {0x0038, 0x0502, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Trial Participation", "PatientClinicalTrialParticipationSequence", "1", false},
+   {0x0038, 0x4000, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Visit Comments", "VisitComments", "1", false},
+   {0x003a, 0x0004, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Waveform", "WaveformOriginality", "1", false},
+   {0x003a, 0x0005, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Waveform", "NumberOfWaveformChannels", "1", false},
+   {0x003a, 0x0010, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Number of Waveform", "NumberOfWaveformSamples", "1", false},
+   {0x003a, 0x001a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Sampling Frequency", "SamplingFrequency", "1", false},
+   {0x003a, 0x0020, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Multiplex Group", "MultiplexGroupLabel", "1", false},
+   {0x003a, 0x0200, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Channel Definition", "ChannelDefinitionSequence", "1", false},
+   {0x003a, 0x0202, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Waveform Channel", "WaveformChannelNumber", "1", false},
+   {0x003a, 0x0203, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Channel Label", "ChannelLabel", "1", false},
+   {0x003a, 0x0205, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Channel Status", "ChannelStatus", "1-", false},
+   {0x003a, 0x0208, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Channel Source", "ChannelSourceSequence", "1", false},
+   {0x003a, 0x0209, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Channel Source", "ChannelSourceModifiersSequence", "1", false},
+   {0x003a, 0x020a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Source Waveform", "SourceWaveformSequence", "1", false},
+   {0x003a, 0x020c, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Channel Derivation", "ChannelDerivationDescription", "1", false},
+   {0x003a, 0x0210, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Channel Sensitivity", "ChannelSensitivity", "1", false},
+   {0x003a, 0x0211, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Channel Sensitivity", "ChannelSensitivityUnitsSequence", "1", false},
+   {0x003a, 0x0212, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Channel Sensitivity", "ChannelSensitivityCorrectionFactor", "1", false},
+   {0x003a, 0x0213, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Channel Baseline", "ChannelBaseline", "1", false},
+   {0x003a, 0x0214, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Channel Time Skew", "ChannelTimeSkew", "1", false},
+   {0x003a, 0x0215, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Channel Sample Skew", "ChannelSampleSkew", "1", false},
+   {0x003a, 0x0218, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Channel Offset", "ChannelOffset", "1", false},
+   {0x003a, 0x021a, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Waveform Bits", "WaveformBitsStored", "1", false},
+   {0x003a, 0x0220, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Filter Low", "FilterLowFrequency", "1", false},
+   {0x003a, 0x0221, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Filter High", "FilterHighFrequency", "1", false},
+   {0x003a, 0x0222, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Notch Filter", "NotchFilterFrequency", "1", false},
+   {0x003a, 0x0223, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Notch Filter", "NotchFilterBandwidth", "1", false},
+   {0x003a, 0x0230, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Waveform Data", "WaveformDataDisplayScale", "1", false},
+   {0x003a, 0x0231, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Background CIELab", "WaveformDisplayBackgroundCIELabValue", "3", false},
+   {0x003a, 0x0240, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Presentation Group", "WaveformPresentationGroupSequence", "1", false},
+   {0x003a, 0x0241, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Presentation Group", "PresentationGroupNumber", "1", false},
+   {0x003a, 0x0242, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Channel Display", "ChannelDisplaySequence", "1", false},
+   {0x003a, 0x0244, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Display CIELab", "ChannelRecommendedDisplayCIELabValue", "3", false},
+   {0x003a, 0x0245, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Channel Position", "ChannelPosition", "1", false},
+   {0x003a, 0x0246, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Display Shading", "DisplayShadingFlag", "1", false},
+   {0x003a, 0x0247, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Fractional Channel", "FractionalChannelDisplayScale", "1", false},
+   {0x003a, 0x0248, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Absolute Channel", "AbsoluteChannelDisplayScale", "1", false},
+   {0x003a, 0x0300, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Channels", "MultiplexedAudioChannelsDescriptionCodeSequence", "1", false},
+   {0x003a, 0x0301, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Channel", "ChannelIdentificationCode", "1", false},
+   {0x003a, 0x0302, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Channel Mode", "ChannelMode", "1", false},
+   {0x0040, 0x0001, 0xffff, 0xffff, {attribute::VR::AE, attribute::VR::NN, attribute::VR::NN}, "Scheduled Station", "ScheduledStationAETitle", "1-", false},
+   {0x0040, 0x0002, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepStartDate", "1", false},
+   {0x0040, 0x0003, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepStartTime", "1", false},
+   {0x0040, 0x0004, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepEndDate", "1", false},
+   {0x0040, 0x0005, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepEndTime", "1", false},
+   {0x0040, 0x0006, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Performing", "ScheduledPerformingPhysicianName", "1", false},
+   {0x0040, 0x0007, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepDescription", "1", false},
+   {0x0040, 0x0008, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Scheduled Protocol", "ScheduledProtocolCodeSequence", "1", false},
+   {0x0040, 0x0009, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepID", "1", false},
+   {0x0040, 0x000a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Stage Code Sequence", "StageCodeSequence", "1", false},
+   {0x0040, 0x000b, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Physician", "ScheduledPerformingPhysicianIdentificationSequence", "1", false},
+   {0x0040, 0x0010, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Scheduled Station", "ScheduledStationName", "1-", false},
+   {0x0040, 0x0011, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepLocation", "1", false},
+   {0x0040, 0x0012, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Pre-Medication", "PreMedication", "1", false},
+   {0x0040, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepStatus", "1", false},
+   {0x0040, 0x0026, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Order Placer", "OrderPlacerIdentifierSequence", "1", false},
+   {0x0040, 0x0027, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Order Filler", "OrderFillerIdentifierSequence", "1", false},
+   {0x0040, 0x0031, 0xffff, 0xffff, {attribute::VR::UT, attribute::VR::NN, attribute::VR::NN}, "Local Namespace", "LocalNamespaceEntityID", "1", false},
+   {0x0040, 0x0032, 0xffff, 0xffff, {attribute::VR::UT, attribute::VR::NN, attribute::VR::NN}, "Universal Entity ID", "UniversalEntityID", "1", false},
+   {0x0040, 0x0033, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Universal Entity ID", "UniversalEntityIDType", "1", false},
+   {0x0040, 0x0035, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Identifier Type", "IdentifierTypeCode", "1", false},
+   {0x0040, 0x0036, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Assigning Facility", "AssigningFacilitySequence", "1", false},
+   {0x0040, 0x0039, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Jurisdiction Code", "AssigningJurisdictionCodeSequence", "1", false},
+   {0x0040, 0x003a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Department Code", "AssigningAgencyOrDepartmentCodeSequence", "1", false},
+   {0x0040, 0x0100, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepSequence", "1", false},
+   {0x0040, 0x0220, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Image Composite SOP", "ReferencedNonImageCompositeSOPInstanceSequence", "1", false},
+   {0x0040, 0x0241, 0xffff, 0xffff, {attribute::VR::AE, attribute::VR::NN, attribute::VR::NN}, "Performed Station", "PerformedStationAETitle", "1", false},
+   {0x0040, 0x0242, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Performed Station", "PerformedStationName", "1", false},
+   {0x0040, 0x0243, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Performed Location", "PerformedLocation", "1", false},
+   {0x0040, 0x0244, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureStepStartDate", "1", false},
+   {0x0040, 0x0245, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureStepStartTime", "1", false},
+   {0x0040, 0x0250, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureStepEndDate", "1", false},
+   {0x0040, 0x0251, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureStepEndTime", "1", false},
+   {0x0040, 0x0252, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureStepStatus", "1", false},
+   {0x0040, 0x0253, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureStepID", "1", false},
+   {0x0040, 0x0254, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureStepDescription", "1", false},
+   {0x0040, 0x0255, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureTypeDescription", "1", false},
+   {0x0040, 0x0260, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Performed Protocol", "PerformedProtocolCodeSequence", "1", false},
+   {0x0040, 0x0261, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Performed Protocol", "PerformedProtocolType", "1", false},
+   {0x0040, 0x0270, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Scheduled Step", "ScheduledStepAttributesSequence", "1", false},
+   {0x0040, 0x0275, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Request Attributes", "RequestAttributesSequence", "1", false},
+   {0x0040, 0x0280, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "CommentsOnThePerformedProcedureStep", "1", false},
+   {0x0040, 0x0281, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Discontinuation", "PerformedProcedureStepDiscontinuationReasonCodeSequence", "1", false},
+   {0x0040, 0x0293, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Quantity Sequence", "QuantitySequence", "1", false},
+   {0x0040, 0x0294, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Quantity", "Quantity", "1", false},
+   {0x0040, 0x0295, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Measuring Units", "MeasuringUnitsSequence", "1", false},
+   {0x0040, 0x0296, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Billing Item", "BillingItemSequence", "1", false},
+   {0x0040, 0x0300, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Total Time of", "TotalTimeOfFluoroscopy", "1", false},
+   {0x0040, 0x0301, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Total Number of", "TotalNumberOfExposures", "1", false},
+   {0x0040, 0x0302, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Entrance Dose", "EntranceDose", "1", false},
+   {0x0040, 0x0303, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Exposed Area", "ExposedArea", "1-", false},
+   {0x0040, 0x0306, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Distance Source to", "DistanceSourceToEntrance", "1", false},
+   {0x0040, 0x0307, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Distance Source to", "DistanceSourceToSupport", "1", true},
+   {0x0040, 0x030e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Exposure Dose", "ExposureDoseSequence", "1", false},
+   {0x0040, 0x0310, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Comments on", "CommentsOnRadiationDose", "1", false},
+   {0x0040, 0x0312, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "X-Ray Output", "XRayOutput", "1", false},
+   {0x0040, 0x0314, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Half Value Layer", "HalfValueLayer", "1", false},
+   {0x0040, 0x0316, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Organ Dose", "OrganDose", "1", false},
+   {0x0040, 0x0318, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Organ Exposed", "OrganExposed", "1", false},
+   {0x0040, 0x0320, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Billing Procedure", "BillingProcedureStepSequence", "1", false},
+   {0x0040, 0x0321, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Film Consumption", "FilmConsumptionSequence", "1", false},
+   {0x0040, 0x0324, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "and Devices", "BillingSuppliesAndDevicesSequence", "1", false},
+   {0x0040, 0x0330, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Procedure Step", "ReferencedProcedureStepSequence", "1", true},
+   {0x0040, 0x0340, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Performed Series", "PerformedSeriesSequence", "1", false},
+   {0x0040, 0x0400, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "CommentsOnTheScheduledProcedureStep", "1", false},
+   {0x0040, 0x0440, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Protocol Context", "ProtocolContextSequence", "1", false},
+   {0x0040, 0x0441, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Content Item", "ContentItemModifierSequence", "1", false},
+   {0x0040, 0x0500, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Scheduled Specimen", "ScheduledSpecimenSequence", "1", false},
+   {0x0040, 0x050a, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Specimen Accession", "SpecimenAccessionNumber", "1", true},
+   {0x0040, 0x0512, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Container", "ContainerIdentifier", "1", false},
+   {0x0040, 0x0513, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Container", "IssuerOfTheContainerIdentifierSequence", "1", false},
+   {0x0040, 0x0515, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Alternate Container", "AlternateContainerIdentifierSequence", "1", false},
+   {0x0040, 0x0518, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Container Type Code", "ContainerTypeCodeSequence", "1", false},
+   {0x0040, 0x051a, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Container", "ContainerDescription", "1", false},
+   {0x0040, 0x0520, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Container Component", "ContainerComponentSequence", "1", false},
+   {0x0040, 0x0550, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Specimen Sequence", "SpecimenSequence", "1", true},
+   {0x0040, 0x0551, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Specimen Identifier", "SpecimenIdentifier", "1", false},
+   {0x0040, 0x0552, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Description", "SpecimenDescriptionSequenceTrial", "1", true},
+   {0x0040, 0x0553, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Specimen", "SpecimenDescriptionTrial", "1", true},
+   {0x0040, 0x0554, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Specimen UID", "SpecimenUID", "1", false},
+   {0x0040, 0x0555, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Acquisition Context", "AcquisitionContextSequence", "1", false},
+   {0x0040, 0x0556, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Acquisition Context", "AcquisitionContextDescription", "1", false},
+   {0x0040, 0x0560, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Description", "SpecimenDescriptionSequence", "1", false},
+   {0x0040, 0x0562, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Specimen Identifier", "IssuerOfTheSpecimenIdentifierSequence", "1", false},
+   {0x0040, 0x059a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Specimen Type Code", "SpecimenTypeCodeSequence", "1", false},
+   {0x0040, 0x0600, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Specimen Short", "SpecimenShortDescription", "1", false},
+   {0x0040, 0x0602, 0xffff, 0xffff, {attribute::VR::UT, attribute::VR::NN, attribute::VR::NN}, "Specimen Detailed", "SpecimenDetailedDescription", "1", false},
+   {0x0040, 0x0610, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Preparation", "SpecimenPreparationSequence", "1", false},
+   {0x0040, 0x0612, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Preparation Step", "SpecimenPreparationStepContentItemSequence", "1", false},
+   {0x0040, 0x0620, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Localization", "SpecimenLocalizationContentItemSequence", "1", false},
+   {0x0040, 0x06fa, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Slide Identifier", "SlideIdentifier", "1", true},
+   {0x0040, 0x071a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Coordinates", "ImageCenterPointCoordinatesSequence", "1", false},
+   {0x0040, 0x072a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "X Offset in Slide", "XOffsetInSlideCoordinateSystem", "1", false},
+   {0x0040, 0x073a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Y Offset in Slide", "YOffsetInSlideCoordinateSystem", "1", false},
+   {0x0040, 0x074a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Z Offset in Slide", "ZOffsetInSlideCoordinateSystem", "1", false},
+   {0x0040, 0x08d8, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pixel Spacing", "PixelSpacingSequence", "1", true},
+   {0x0040, 0x08da, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Coordinate System", "CoordinateSystemAxisCodeSequence", "1", true},
+   {0x0040, 0x08ea, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Measurement Units", "MeasurementUnitsCodeSequence", "1", false},
+   {0x0040, 0x09f8, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Vital Stain Code", "VitalStainCodeSequenceTrial", "1", true},
+   {0x0040, 0x1001, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Requested Procedure", "RequestedProcedureID", "1", false},
+   {0x0040, 0x1002, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Reason for the", "ReasonForTheRequestedProcedure", "1", false},
+   {0x0040, 0x1003, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Requested Procedure", "RequestedProcedurePriority", "1", false},
+   {0x0040, 0x1004, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patient Transport", "PatientTransportArrangements", "1", false},
+   {0x0040, 0x1005, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Requested Procedure", "RequestedProcedureLocation", "1", false},
+   {0x0040, 0x1006, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Placer Order Number", "PlacerOrderNumberProcedure", "1", true},
+   {0x0040, 0x1007, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Filler Order Number", "FillerOrderNumberProcedure", "1", true},
+   {0x0040, 0x1008, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Confidentiality", "ConfidentialityCode", "1", false},
+   {0x0040, 0x1009, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Reporting Priority", "ReportingPriority", "1", false},
+   {0x0040, 0x100a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Requested Procedure", "ReasonForRequestedProcedureCodeSequence", "1", false},
+   {0x0040, 0x1010, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Recipients of", "NamesOfIntendedRecipientsOfResults", "n", false},
+   {0x0040, 0x1011, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "of Results", "IntendedRecipientsOfResultsIdentificationSequence", "1", false},
+   {0x0040, 0x1012, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "ReasonForPerformedProcedureCodeSequence", "1", false},
+   {0x0040, 0x1060, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Requested Procedure", "RequestedProcedureDescriptionTrial", "1", true},
+   {0x0040, 0x1101, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification Code", "PersonIdentificationCodeSequence", "1", false},
+   {0x0040, 0x1102, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Persons Address", "PersonAddress", "1", false},
+   {0x0040, 0x1103, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Persons", "PersonTelephoneNumbers", "1-", false},
+   {0x0040, 0x1400, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Requested Procedure", "RequestedProcedureComments", "1", false},
+   {0x0040, 0x2001, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Imaging Service", "ReasonForTheImagingServiceRequest", "1", true},
+   {0x0040, 0x2004, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Imaging Service", "IssueDateOfImagingServiceRequest", "1", false},
+   {0x0040, 0x2005, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Imaging Service", "IssueTimeOfImagingServiceRequest", "1", false},
+   {0x0040, 0x2006, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "/ Imaging Service", "PlacerOrderNumberImagingServiceRequestRetired", "1", true},
+   {0x0040, 0x2007, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "/ Imaging Service", "FillerOrderNumberImagingServiceRequestRetired", "1", true},
+   {0x0040, 0x2008, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Order Entered By", "OrderEnteredBy", "1", false},
+   {0x0040, 0x2009, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Order Enterers", "OrderEntererLocation", "1", false},
+   {0x0040, 0x2010, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Order Callback", "OrderCallbackPhoneNumber", "1", false},
+   {0x0040, 0x2016, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "/ Imaging Service", "PlacerOrderNumberImagingServiceRequest", "1", false},
+   {0x0040, 0x2017, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "/ Imaging Service", "FillerOrderNumberImagingServiceRequest", "1", false},
+   {0x0040, 0x2400, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Imaging Service", "ImagingServiceRequestComments", "1", false},
+   {0x0040, 0x3001, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Constraint on", "ConfidentialityConstraintOnPatientDataDescription", "1", false},
+   {0x0040, 0x4001, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "GeneralPurposeScheduledProcedureStepStatus", "1", false},
+   {0x0040, 0x4002, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "GeneralPurposePerformedProcedureStepStatus", "1", false},
+   {0x0040, 0x4003, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "GeneralPurposeScheduledProcedureStepPriority", "1", false},
+   {0x0040, 0x4004, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Processing", "ScheduledProcessingApplicationsCodeSequence", "1", false},
+   {0x0040, 0x4005, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepStartDateTime", "1", false},
+   {0x0040, 0x4006, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Multiple Copies", "MultipleCopiesFlag", "1", false},
+   {0x0040, 0x4007, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Processing", "PerformedProcessingApplicationsCodeSequence", "1", false},
+   {0x0040, 0x4009, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Human Performer", "HumanPerformerCodeSequence", "1", false},
+   {0x0040, 0x4010, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Step Modification", "ScheduledProcedureStepModificationDateTime", "1", false},
+   {0x0040, 0x4011, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Expected Completion", "ExpectedCompletionDateTime", "1", false},
+   {0x0040, 0x4015, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Purpose Performed", "ResultingGeneralPurposePerformedProcedureStepsSequence", "1", false},
+   {0x0040, 0x4016, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Purpose Scheduled", "ReferencedGeneralPurposeScheduledProcedureStepSequence", "1", false},
+   {0x0040, 0x4018, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Scheduled Workitem", "ScheduledWorkitemCodeSequence", "1", false},
+   {0x0040, 0x4019, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Performed Workitem", "PerformedWorkitemCodeSequence", "1", false},
+   {0x0040, 0x4020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Input Availability", "InputAvailabilityFlag", "1", false},
+   {0x0040, 0x4021, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Input Information", "InputInformationSequence", "1", false},
+   {0x0040, 0x4022, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Information", "RelevantInformationSequence", "1", false},
+   {0x0040, 0x4023, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Purpose Scheduled", "ReferencedGeneralPurposeScheduledProcedureStepTransactionUID", "1", false},
+   {0x0040, 0x4025, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Scheduled Station", "ScheduledStationNameCodeSequence", "1", false},
+   {0x0040, 0x4026, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Scheduled Station", "ScheduledStationClassCodeSequence", "1", false},
+   {0x0040, 0x4027, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Geographic Location", "ScheduledStationGeographicLocationCodeSequence", "1", false},
+   {0x0040, 0x4028, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Performed Station", "PerformedStationNameCodeSequence", "1", false},
+   {0x0040, 0x4029, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Performed Station", "PerformedStationClassCodeSequence", "1", false},
+   {0x0040, 0x4030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Geographic Location", "PerformedStationGeographicLocationCodeSequence", "1", false},
+   {0x0040, 0x4031, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Subsequent Workitem", "RequestedSubsequentWorkitemCodeSequence", "1", false},
+   {0x0040, 0x4032, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Non-DICOM Output", "NonDICOMOutputCodeSequence", "1", false},
+   {0x0040, 0x4033, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Output Information", "OutputInformationSequence", "1", false},
+   {0x0040, 0x4034, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Scheduled Human", "ScheduledHumanPerformersSequence", "1", false},
+   {0x0040, 0x4035, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Actual Human", "ActualHumanPerformersSequence", "1", false},
+   {0x0040, 0x4036, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Human Performers", "HumanPerformerOrganization", "1", false},
+   {0x0040, 0x4037, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Human Performers", "HumanPerformerName", "1", false},
+   {0x0040, 0x4040, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Raw Data Handling", "RawDataHandling", "1", false},
+   {0x0040, 0x4041, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Input Readiness", "InputReadinessState", "1", false},
+   {0x0040, 0x4050, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureStepStartDateTime", "1", false},
+   {0x0040, 0x4051, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureStepEndDateTime", "1", false},
+   {0x0040, 0x4052, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Cancellation", "ProcedureStepCancellationDateTime", "1", false},
+   {0x0040, 0x8302, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Entrance Dose in", "EntranceDoseInmGy", "1", false},
+   {0x0040, 0x9094, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Real World Value", "ReferencedImageRealWorldValueMappingSequence", "1", false},
+   {0x0040, 0x9096, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Real World Value", "RealWorldValueMappingSequence", "1", false},
+   {0x0040, 0x9098, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pixel Value Mapping", "PixelValueMappingCodeSequence", "1", false},
+   {0x0040, 0x9210, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "LUT Label", "LUTLabel", "1", false},
+   {0x0040, 0x9211, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Last Value Mapped", "RealWorldValueLastValueMapped", "1", false},
+   {0x0040, 0x9212, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Real World Value", "RealWorldValueLUTData", "1-", false},
+   {0x0040, 0x9216, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "First Value Mapped", "RealWorldValueFirstValueMapped", "1", false},
+   {0x0040, 0x9224, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Real World Value", "RealWorldValueIntercept", "1", false},
+   {0x0040, 0x9225, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Real World Value", "RealWorldValueSlope", "1", false},
+   {0x0040, 0xa007, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Findings Flag", "FindingsFlagTrial", "1", true},
+   {0x0040, 0xa010, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Relationship Type", "RelationshipType", "1", false},
+   {0x0040, 0xa020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Findings Sequence", "FindingsSequenceTrial", "1", true},
+   {0x0040, 0xa021, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Findings Group UID", "FindingsGroupUIDTrial", "1", true},
+   {0x0040, 0xa022, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Referenced Findings", "ReferencedFindingsGroupUIDTrial", "1", true},
+   {0x0040, 0xa023, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Recording Date", "FindingsGroupRecordingDateTrial", "1", true},
+   {0x0040, 0xa024, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Recording Time", "FindingsGroupRecordingTimeTrial", "1", true},
+   {0x0040, 0xa026, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Category Code", "FindingsSourceCategoryCodeSequenceTrial", "1", true},
+   {0x0040, 0xa027, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Verifying", "VerifyingOrganization", "1", false},
+   {0x0040, 0xa028, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Organization", "DocumentingOrganizationIdentifierCodeSequenceTrial", "1", true},
+   {0x0040, 0xa030, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Verification Date", "VerificationDateTime", "1", false},
+   {0x0040, 0xa032, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Observation Date", "ObservationDateTime", "1", false},
+   {0x0040, 0xa040, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Value Type", "ValueType", "1", false},
+   {0x0040, 0xa043, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Concept Name Code", "ConceptNameCodeSequence", "1", false},
+   {0x0040, 0xa047, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Precision", "MeasurementPrecisionDescriptionTrial", "1", true},
+   {0x0040, 0xa050, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Continuity Of", "ContinuityOfContent", "1", false},
+   {0x0040, 0xa057, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Urgency or Priority", "UrgencyOrPriorityAlertsTrial", "1-", true},
+   {0x0040, 0xa060, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Sequencing", "SequencingIndicatorTrial", "1", true},
+   {0x0040, 0xa066, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Code Sequence", "DocumentIdentifierCodeSequenceTrial", "1", true},
+   {0x0040, 0xa067, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Document Author", "DocumentAuthorTrial", "1", true},
+   {0x0040, 0xa068, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identifier Code", "DocumentAuthorIdentifierCodeSequenceTrial", "1", true},
+   {0x0040, 0xa070, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identifier Code", "IdentifierCodeSequenceTrial", "1", true},
+   {0x0040, 0xa073, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Verifying Observer", "VerifyingObserverSequence", "1", false},
+   {0x0040, 0xa074, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Object Binary", "ObjectBinaryIdentifierTrial", "1", true},
+   {0x0040, 0xa075, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Verifying Observer", "VerifyingObserverName", "1", false},
+   {0x0040, 0xa076, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Observer Identifier", "DocumentingObserverIdentifierCodeSequenceTrial", "1", true},
+   {0x0040, 0xa078, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Author Observer", "AuthorObserverSequence", "1", false},
+   {0x0040, 0xa07a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Participant", "ParticipantSequence", "1", false},
+   {0x0040, 0xa07c, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Organization", "CustodialOrganizationSequence", "1", false},
+   {0x0040, 0xa080, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Participation Type", "ParticipationType", "1", false},
+   {0x0040, 0xa082, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Participation", "ParticipationDateTime", "1", false},
+   {0x0040, 0xa084, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Observer Type", "ObserverType", "1", false},
+   {0x0040, 0xa085, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identifier Code", "ProcedureIdentifierCodeSequenceTrial", "1", true},
+   {0x0040, 0xa088, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification Code", "VerifyingObserverIdentificationCodeSequence", "1", false},
+   {0x0040, 0xa089, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Binary Identifier", "ObjectDirectoryBinaryIdentifierTrial", "1", true},
+   {0x0040, 0xa090, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Equivalent CDA", "EquivalentCDADocumentSequence", "1", true},
+   {0x0040, 0xa0b0, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Referenced Waveform", "ReferencedWaveformChannels", "2-", false},
+   {0x0040, 0xa110, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Verbal Transaction", "DateOfDocumentOrVerbalTransactionTrial", "1", true},
+   {0x0040, 0xa112, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Creation or Verbal", "TimeOfDocumentCreationOrVerbalTransactionTrial", "1", true},
+   {0x0040, 0xa120, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "DateTime", "DateTime", "1", false},
+   {0x0040, 0xa121, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Date", "Date", "1", false},
+   {0x0040, 0xa122, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Time", "Time", "1", false},
+   {0x0040, 0xa123, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Person Name", "PersonName", "1", false},
+   {0x0040, 0xa124, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "UID", "UID", "1", false},
+   {0x0040, 0xa125, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Report Status ID", "ReportStatusIDTrial", "2", true},
+   {0x0040, 0xa130, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Temporal Range Type", "TemporalRangeType", "1", false},
+   {0x0040, 0xa132, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Referenced Sample", "ReferencedSamplePositions", "1-", false},
+   {0x0040, 0xa136, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Referenced Frame", "ReferencedFrameNumbers", "1-", false},
+   {0x0040, 0xa138, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Referenced Time", "ReferencedTimeOffsets", "1-", false},
+   {0x0040, 0xa13a, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Referenced DateTime", "ReferencedDateTime", "1-", false},
+   {0x0040, 0xa160, 0xffff, 0xffff, {attribute::VR::UT, attribute::VR::NN, attribute::VR::NN}, "Text Value", "TextValue", "1", false},
+   {0x0040, 0xa167, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Category Code", "ObservationCategoryCodeSequenceTrial", "1", true},
+   {0x0040, 0xa168, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Concept Code", "ConceptCodeSequence", "1", false},
+   {0x0040, 0xa16a, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Bibliographic", "BibliographicCitationTrial", "1", true},
+   {0x0040, 0xa170, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Reference Code", "PurposeOfReferenceCodeSequence", "1", false},
+   {0x0040, 0xa171, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Observation UID", "ObservationUIDTrial", "1", true},
+   {0x0040, 0xa172, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Observation UID", "ReferencedObservationUIDTrial", "1", true},
+   {0x0040, 0xa173, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Observation Class", "ReferencedObservationClassTrial", "1", true},
+   {0x0040, 0xa174, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Observation Class", "ReferencedObjectObservationClassTrial", "1", true},
+   {0x0040, 0xa180, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Annotation Group", "AnnotationGroupNumber", "1", false},
+   {0x0040, 0xa192, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Observation Date", "ObservationDateTrial", "1", true},
+   {0x0040, 0xa193, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Observation Time", "ObservationTimeTrial", "1", true},
+   {0x0040, 0xa194, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Measurement", "MeasurementAutomationTrial", "1", true},
+   {0x0040, 0xa195, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Modifier Code", "ModifierCodeSequence", "1", false},
+   {0x0040, 0xa224, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Identification", "IdentificationDescriptionTrial", "1", true},
+   {0x0040, 0xa290, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Geometric Type", "CoordinatesSetGeometricTypeTrial", "1", true},
+   {0x0040, 0xa296, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Algorithm Code", "AlgorithmCodeSequenceTrial", "1", true},
+   {0x0040, 0xa297, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Algorithm", "AlgorithmDescriptionTrial", "1", true},
+   {0x0040, 0xa29a, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Pixel Coordinates", "PixelCoordinatesSetTrial", "2-", true},
+   {0x0040, 0xa300, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Measured Value", "MeasuredValueSequence", "1", false},
+   {0x0040, 0xa301, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Qualifier Code", "NumericValueQualifierCodeSequence", "1", false},
+   {0x0040, 0xa307, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Current Observer", "CurrentObserverTrial", "1", true},
+   {0x0040, 0xa30a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Numeric Value", "NumericValue", "1-", false},
+   {0x0040, 0xa313, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Accession Sequence", "ReferencedAccessionSequenceTrial", "1", true},
+   {0x0040, 0xa33a, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Report Status", "ReportStatusCommentTrial", "1", true},
+   {0x0040, 0xa340, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Procedure Context", "ProcedureContextSequenceTrial", "1", true},
+   {0x0040, 0xa352, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Verbal Source", "VerbalSourceTrial", "1", true},
+   {0x0040, 0xa353, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Address (Trial)", "AddressTrial", "1", true},
+   {0x0040, 0xa354, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Telephone Number", "TelephoneNumberTrial", "1", true},
+   {0x0040, 0xa358, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identifier Code", "VerbalSourceIdentifierCodeSequenceTrial", "1", true},
+   {0x0040, 0xa360, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Predecessor", "PredecessorDocumentsSequence", "1", false},
+   {0x0040, 0xa370, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Request", "ReferencedRequestSequence", "1", false},
+   {0x0040, 0xa372, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Performed Procedure", "PerformedProcedureCodeSequence", "1", false},
+   {0x0040, 0xa375, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Procedure Evidence", "CurrentRequestedProcedureEvidenceSequence", "1", false},
+   {0x0040, 0xa380, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Report Detail", "ReportDetailSequenceTrial", "1", true},
+   {0x0040, 0xa385, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Pertinent Other", "PertinentOtherEvidenceSequence", "1", false},
+   {0x0040, 0xa390, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Document Reference", "HL7StructuredDocumentReferenceSequence", "1", false},
+   {0x0040, 0xa402, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Observation Subject", "ObservationSubjectUIDTrial", "1", true},
+   {0x0040, 0xa403, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Observation Subject", "ObservationSubjectClassTrial", "1", true},
+   {0x0040, 0xa404, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Type Code Sequence", "ObservationSubjectTypeCodeSequenceTrial", "1", true},
+   {0x0040, 0xa491, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Completion Flag", "CompletionFlag", "1", false},
+   {0x0040, 0xa492, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Completion Flag", "CompletionFlagDescription", "1", false},
+   {0x0040, 0xa493, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Verification Flag", "VerificationFlag", "1", false},
+   {0x0040, 0xa494, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Archive Requested", "ArchiveRequested", "1", false},
+   {0x0040, 0xa496, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Preliminary Flag", "PreliminaryFlag", "1", false},
+   {0x0040, 0xa504, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Content Template", "ContentTemplateSequence", "1", false},
+   {0x0040, 0xa525, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identical Documents", "IdenticalDocumentsSequence", "1", false},
+   {0x0040, 0xa600, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Context Flag", "ObservationSubjectContextFlagTrial", "1", true},
+   {0x0040, 0xa601, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Observer Context", "ObserverContextFlagTrial", "1", true},
+   {0x0040, 0xa603, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Procedure Context", "ProcedureContextFlagTrial", "1", true},
+   {0x0040, 0xa730, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Content Sequence", "ContentSequence", "1", false},
+   {0x0040, 0xa731, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Relationship", "RelationshipSequenceTrial", "1", true},
+   {0x0040, 0xa732, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Code Sequence", "RelationshipTypeCodeSequenceTrial", "1", true},
+   {0x0040, 0xa744, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Language Code", "LanguageCodeSequenceTrial", "1", true},
+   {0x0040, 0xa992, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Uniform Resource", "UniformResourceLocatorTrial", "1", true},
+   {0x0040, 0xb020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Waveform Annotation", "WaveformAnnotationSequence", "1", false},
+   {0x0040, 0xdb00, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Template Identifier", "TemplateIdentifier", "1", false},
+   {0x0040, 0xdb06, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Template Version", "TemplateVersion", "1", true},
+   {0x0040, 0xdb07, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Template Local", "TemplateLocalVersion", "1", true},
+   {0x0040, 0xdb0b, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Template Extension", "TemplateExtensionFlag", "1", true},
+   {0x0040, 0xdb0c, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Template Extension", "TemplateExtensionOrganizationUID", "1", true},
+   {0x0040, 0xdb0d, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Template Extension", "TemplateExtensionCreatorUID", "1", true},
+   {0x0040, 0xdb73, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Referenced Content", "ReferencedContentItemIdentifier", "1-", false},
+   {0x0040, 0xe001, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "HL7 Instance", "HL7InstanceIdentifier", "1", false},
+   {0x0040, 0xe004, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "HL7 Document", "HL7DocumentEffectiveTime", "1", false},
+   {0x0040, 0xe006, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "HL7 Document Type", "HL7DocumentTypeCodeSequence", "1", false},
+   {0x0040, 0xe008, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Document Class Code", "DocumentClassCodeSequence", "1", false},
+   {0x0040, 0xe010, 0xffff, 0xffff, {attribute::VR::UT, attribute::VR::NN, attribute::VR::NN}, "Retrieve URI", "RetrieveURI", "1", false},
+   {0x0040, 0xe011, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Retrieve Location", "RetrieveLocationUID", "1", false},
+   {0x0040, 0xe020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Type of Instances", "TypeOfInstances", "1", false},
+   {0x0040, 0xe021, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "DICOM Retrieval", "DICOMRetrievalSequence", "1", false},
+   {0x0040, 0xe022, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "DICOM Media", "DICOMMediaRetrievalSequence", "1", false},
+   {0x0040, 0xe023, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "WADO Retrieval", "WADORetrievalSequence", "1", false},
+   {0x0040, 0xe024, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "XDS Retrieval", "XDSRetrievalSequence", "1", false},
+   {0x0040, 0xe030, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Repository Unique", "RepositoryUniqueID", "1", false},
+   {0x0040, 0xe031, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Home Community ID", "HomeCommunityID", "1", false},
+   {0x0042, 0x0010, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Document Title", "DocumentTitle", "1", false},
+   {0x0042, 0x0011, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Encapsulated", "EncapsulatedDocument", "1", false},
+   {0x0042, 0x0012, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Encapsulated", "MIMETypeOfEncapsulatedDocument", "1", false},
+   {0x0042, 0x0013, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Source Instance", "SourceInstanceSequence", "1", false},
+   {0x0042, 0x0014, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "List of MIME Types", "ListOfMIMETypes", "1-", false},
+   {0x0044, 0x0001, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Product Package", "ProductPackageIdentifier", "1", false},
+   {0x0044, 0x0002, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Administration", "SubstanceAdministrationApproval", "1", false},
+   {0x0044, 0x0003, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Approval Status", "ApprovalStatusFurtherDescription", "1", false},
+   {0x0044, 0x0004, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Approval Status", "ApprovalStatusDateTime", "1", false},
+   {0x0044, 0x0007, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Product Type Code", "ProductTypeCodeSequence", "1", false},
+   {0x0044, 0x0008, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Product Name", "ProductName", "1-", false},
+   {0x0044, 0x0009, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Product Description", "ProductDescription", "1", false},
+   {0x0044, 0x000a, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Product Lot", "ProductLotIdentifier", "1", false},
+   {0x0044, 0x000b, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Product Expiration", "ProductExpirationDateTime", "1", false},
+   {0x0044, 0x0010, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Administration", "SubstanceAdministrationDateTime", "1", false},
+   {0x0044, 0x0011, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Administration", "SubstanceAdministrationNotes", "1", false},
+   {0x0044, 0x0012, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Administration", "SubstanceAdministrationDeviceID", "1", false},
+   {0x0044, 0x0013, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Product Parameter", "ProductParameterSequence", "1", false},
+   {0x0044, 0x0019, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Administration", "SubstanceAdministrationParameterSequence", "1", false},
+   {0x0046, 0x0012, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Lens Description", "LensDescription", "1", false},
+   {0x0046, 0x0014, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Right Lens Sequence", "RightLensSequence", "1", false},
+   {0x0046, 0x0015, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Left Lens Sequence", "LeftLensSequence", "1", false},
+   {0x0046, 0x0016, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Laterality Lens", "UnspecifiedLateralityLensSequence", "1", false},
+   {0x0046, 0x0018, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Cylinder Sequence", "CylinderSequence", "1", false},
+   {0x0046, 0x0028, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Prism Sequence", "PrismSequence", "1", false},
+   {0x0046, 0x0030, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Horizontal Prism", "HorizontalPrismPower", "1", false},
+   {0x0046, 0x0032, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Horizontal Prism", "HorizontalPrismBase", "1", false},
+   {0x0046, 0x0034, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Vertical Prism", "VerticalPrismPower", "1", false},
+   {0x0046, 0x0036, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Vertical Prism Base", "VerticalPrismBase", "1", false},
+   {0x0046, 0x0038, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Lens Segment Type", "LensSegmentType", "1", false},
+   {0x0046, 0x0040, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Optical", "OpticalTransmittance", "1", false},
+   {0x0046, 0x0042, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Channel Width", "ChannelWidth", "1", false},
+   {0x0046, 0x0044, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Pupil Size", "PupilSize", "1", false},
+   {0x0046, 0x0046, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Corneal Size", "CornealSize", "1", false},
+   {0x0046, 0x0050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Autorefraction", "AutorefractionRightEyeSequence", "1", false},
+   {0x0046, 0x0052, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Autorefraction Left", "AutorefractionLeftEyeSequence", "1", false},
+   {0x0046, 0x0060, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Distance Pupillary", "DistancePupillaryDistance", "1", false},
+   {0x0046, 0x0062, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Near Pupillary", "NearPupillaryDistance", "1", false},
+   {0x0046, 0x0063, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Intermediate", "IntermediatePupillaryDistance", "1", false},
+   {0x0046, 0x0064, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Other Pupillary", "OtherPupillaryDistance", "1", false},
+   {0x0046, 0x0070, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Keratometry Right", "KeratometryRightEyeSequence", "1", false},
+   {0x0046, 0x0071, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Keratometry Left", "KeratometryLeftEyeSequence", "1", false},
+   {0x0046, 0x0074, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Steep Keratometric", "SteepKeratometricAxisSequence", "1", false},
+   {0x0046, 0x0075, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Radius of Curvature", "RadiusOfCurvature", "1", false},
+   {0x0046, 0x0076, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Keratometric Power", "KeratometricPower", "1", false},
+   {0x0046, 0x0077, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Keratometric Axis", "KeratometricAxis", "1", false},
+   {0x0046, 0x0080, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Flat Keratometric", "FlatKeratometricAxisSequence", "1", false},
+   {0x0046, 0x0092, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Background Color", "BackgroundColor", "1", false},
+   {0x0046, 0x0094, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Optotype", "Optotype", "1", false},
+   {0x0046, 0x0095, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Optotype", "OptotypePresentation", "1", false},
+   {0x0046, 0x0097, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Refraction Right", "SubjectiveRefractionRightEyeSequence", "1", false},
+   {0x0046, 0x0098, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Refraction Left Eye", "SubjectiveRefractionLeftEyeSequence", "1", false},
+   {0x0046, 0x0100, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Add Near Sequence", "AddNearSequence", "1", false},
+   {0x0046, 0x0101, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Add Intermediate", "AddIntermediateSequence", "1", false},
+   {0x0046, 0x0102, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Add Other Sequence", "AddOtherSequence", "1", false},
+   {0x0046, 0x0104, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Add Power", "AddPower", "1", false},
+   {0x0046, 0x0106, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Viewing Distance", "ViewingDistance", "1", false},
+   {0x0046, 0x0121, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Visual Acuity Type", "VisualAcuityTypeCodeSequence", "1", false},
+   {0x0046, 0x0122, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Visual Acuity Right", "VisualAcuityRightEyeSequence", "1", false},
+   {0x0046, 0x0123, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Visual Acuity Left", "VisualAcuityLeftEyeSequence", "1", false},
+   {0x0046, 0x0124, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Visual Acuity Both", "VisualAcuityBothEyesOpenSequence", "1", false},
+   {0x0046, 0x0125, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Viewing Distance", "ViewingDistanceType", "1", false},
+   {0x0046, 0x0135, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Visual Acuity", "VisualAcuityModifiers", "2", false},
+   {0x0046, 0x0137, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Decimal Visual", "DecimalVisualAcuity", "1", false},
+   {0x0046, 0x0139, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Optotype Detailed", "OptotypeDetailedDefinition", "1", false},
+   {0x0046, 0x0145, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Refractive", "ReferencedRefractiveMeasurementsSequence", "1", false},
+   {0x0046, 0x0146, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Sphere Power", "SpherePower", "1", false},
+   {0x0046, 0x0147, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Cylinder Power", "CylinderPower", "1", false},
+   {0x0048, 0x0001, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Imaged Volume Width", "ImagedVolumeWidth", "1", false},
+   {0x0048, 0x0002, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Imaged Volume", "ImagedVolumeHeight", "1", false},
+   {0x0048, 0x0003, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Imaged Volume Depth", "ImagedVolumeDepth", "1", false},
+   {0x0048, 0x0006, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Total Pixel Matrix", "TotalPixelMatrixColumns", "1", false},
+   {0x0048, 0x0007, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Total Pixel Matrix", "TotalPixelMatrixRows", "1", false},
+   {0x0048, 0x0008, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Total Pixel Matrix", "TotalPixelMatrixOriginSequence", "1", false},
+   {0x0048, 0x0010, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Specimen Label in", "SpecimenLabelInImage", "1", false},
+   {0x0048, 0x0011, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Focus Method", "FocusMethod", "1", false},
+   {0x0048, 0x0012, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Extended Depth of", "ExtendedDepthOfField", "1", false},
+   {0x0048, 0x0013, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Focal", "NumberOfFocalPlanes", "1", false},
+   {0x0048, 0x0014, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Distance Between", "DistanceBetweenFocalPlanes", "1", false},
+   {0x0048, 0x0015, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Recommended Absent", "RecommendedAbsentPixelCIELabValue", "3", false},
+   {0x0048, 0x0100, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Illuminator Type", "IlluminatorTypeCodeSequence", "1", false},
+   {0x0048, 0x0102, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Image Orientation", "ImageOrientationSlide", "6", false},
+   {0x0048, 0x0105, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Optical Path", "OpticalPathSequence", "1", false},
+   {0x0048, 0x0106, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Optical Path", "OpticalPathIdentifier", "1", false},
+   {0x0048, 0x0107, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Optical Path", "OpticalPathDescription", "1", false},
+   {0x0048, 0x0108, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Illumination Color", "IlluminationColorCodeSequence", "1", false},
+   {0x0048, 0x0110, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Specimen Reference", "SpecimenReferenceSequence", "1", false},
+   {0x0048, 0x0111, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Condenser Lens", "CondenserLensPower", "1", false},
+   {0x0048, 0x0112, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Objective Lens", "ObjectiveLensPower", "1", false},
+   {0x0048, 0x0113, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Objective Lens", "ObjectiveLensNumericalAperture", "1", false},
+   {0x0048, 0x0120, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Lookup Table", "PaletteColorLookupTableSequence", "1", false},
+   {0x0048, 0x0200, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Image", "ReferencedImageNavigationSequence", "1", false},
+   {0x0048, 0x0201, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Corner of Localizer", "TopLeftHandCornerOfLocalizerArea", "2", false},
+   {0x0048, 0x0202, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Corner of Localizer", "BottomRightHandCornerOfLocalizerArea", "2", false},
+   {0x0048, 0x0207, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification", "OpticalPathIdentificationSequence", "1", false},
+   {0x0048, 0x021a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Plane Position", "PlanePositionSlideSequence", "1", false},
+   {0x0048, 0x021e, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Total Image Pixel", "RowPositionInTotalImagePixelMatrix", "1", false},
+   {0x0048, 0x021f, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Total Image Pixel", "ColumnPositionInTotalImagePixelMatrix", "1", false},
+   {0x0048, 0x0301, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Pixel Origin", "PixelOriginInterpretation", "1", false},
+   {0x0050, 0x0004, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Calibration Image", "CalibrationImage", "1", false},
+   {0x0050, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Device Sequence", "DeviceSequence", "1", false},
+   {0x0050, 0x0012, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Container Component", "ContainerComponentTypeCodeSequence", "1", false},
+   {0x0050, 0x0013, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Container Component", "ContainerComponentThickness", "1", false},
+   {0x0050, 0x0014, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Device Length", "DeviceLength", "1", false},
+   {0x0050, 0x0015, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Container Component", "ContainerComponentWidth", "1", false},
+   {0x0050, 0x0016, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Device Diameter", "DeviceDiameter", "1", false},
+   {0x0050, 0x0017, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Device Diameter", "DeviceDiameterUnits", "1", false},
+   {0x0050, 0x0018, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Device Volume", "DeviceVolume", "1", false},
+   {0x0050, 0x0019, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Inter-Marker", "InterMarkerDistance", "1", false},
+   {0x0050, 0x001a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Container Component", "ContainerComponentMaterial", "1", false},
+   {0x0050, 0x001b, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Container Component", "ContainerComponentID", "1", false},
+   {0x0050, 0x001c, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Container Component", "ContainerComponentLength", "1", false},
+   {0x0050, 0x001d, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Container Component", "ContainerComponentDiameter", "1", false},
+   {0x0050, 0x001e, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Container Component", "ContainerComponentDescription", "1", false},
+   {0x0050, 0x0020, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Device Description", "DeviceDescription", "1", false},
+   {0x0052, 0x0001, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Ingredient Percent", "ContrastBolusIngredientPercentByVolume", "1", false},
+   {0x0052, 0x0002, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "OCT Focal Distance", "OCTFocalDistance", "1", false},
+   {0x0052, 0x0003, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Beam Spot Size", "BeamSpotSize", "1", false},
+   {0x0052, 0x0004, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Effective", "EffectiveRefractiveIndex", "1", false},
+   {0x0052, 0x0006, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "OCT Acquisition", "OCTAcquisitionDomain", "1", false},
+   {0x0052, 0x0007, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "OCT Optical Center", "OCTOpticalCenterWavelength", "1", false},
+   {0x0052, 0x0008, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Axial Resolution", "AxialResolution", "1", false},
+   {0x0052, 0x0009, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Ranging Depth", "RangingDepth", "1", false},
+   {0x0052, 0x0011, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "A-line Rate", "ALineRate", "1", false},
+   {0x0052, 0x0012, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "A-lines Per Frame", "ALinesPerFrame", "1", false},
+   {0x0052, 0x0013, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Catheter Rotational", "CatheterRotationalRate", "1", false},
+   {0x0052, 0x0014, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "A-line Pixel", "ALinePixelSpacing", "1", false},
+   {0x0052, 0x0016, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Percutaneous Access", "ModeOfPercutaneousAccessSequence", "1", false},
+   {0x0052, 0x0025, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Intravascular OCT", "IntravascularOCTFrameTypeSequence", "1", false},
+   {0x0052, 0x0026, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "OCT Z Offset", "OCTZOffsetApplied", "1", false},
+   {0x0052, 0x0027, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Intravascular Frame", "IntravascularFrameContentSequence", "1", false},
+   {0x0052, 0x0028, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Longitudinal", "IntravascularLongitudinalDistance", "1", false},
+   {0x0052, 0x0029, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Frame Content", "IntravascularOCTFrameContentSequence", "1", false},
+   {0x0052, 0x0030, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "OCT Z Offset", "OCTZOffsetCorrection", "1", false},
+   {0x0052, 0x0031, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Catheter Direction", "CatheterDirectionOfRotation", "1", false},
+   {0x0052, 0x0033, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Seam Line Location", "SeamLineLocation", "1", false},
+   {0x0052, 0x0034, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "First A-line", "FirstALineLocation", "1", false},
+   {0x0052, 0x0036, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Seam Line Index", "SeamLineIndex", "1", false},
+   {0x0052, 0x0038, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Padded A-", "NumberOfPaddedAlines", "1", false},
+   {0x0052, 0x0039, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Interpolation Type", "InterpolationType", "1", false},
+   {0x0052, 0x003a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Refractive Index", "RefractiveIndexApplied", "1", false},
+   {0x0054, 0x0010, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Energy Window", "EnergyWindowVector", "1-", false},
+   {0x0054, 0x0011, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Energy", "NumberOfEnergyWindows", "1", false},
+   {0x0054, 0x0012, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Information", "EnergyWindowInformationSequence", "1", false},
+   {0x0054, 0x0013, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Energy Window Range", "EnergyWindowRangeSequence", "1", false},
+   {0x0054, 0x0014, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Energy Window Lower", "EnergyWindowLowerLimit", "1", false},
+   {0x0054, 0x0015, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Energy Window Upper", "EnergyWindowUpperLimit", "1", false},
+   {0x0054, 0x0016, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Information", "RadiopharmaceuticalInformationSequence", "1", false},
+   {0x0054, 0x0017, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Residual Syringe", "ResidualSyringeCounts", "1", false},
+   {0x0054, 0x0018, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Energy Window Name", "EnergyWindowName", "1", false},
+   {0x0054, 0x0020, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Detector Vector", "DetectorVector", "1-", false},
+   {0x0054, 0x0021, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Detectors", "NumberOfDetectors", "1", false},
+   {0x0054, 0x0022, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Information", "DetectorInformationSequence", "1", false},
+   {0x0054, 0x0030, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Phase Vector", "PhaseVector", "1-", false},
+   {0x0054, 0x0031, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Phases", "NumberOfPhases", "1", false},
+   {0x0054, 0x0032, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Phase Information", "PhaseInformationSequence", "1", false},
+   {0x0054, 0x0033, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Frames in", "NumberOfFramesInPhase", "1", false},
+   {0x0054, 0x0036, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Phase Delay", "PhaseDelay", "1", false},
+   {0x0054, 0x0038, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Pause Between", "PauseBetweenFrames", "1", false},
+   {0x0054, 0x0039, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Phase Description", "PhaseDescription", "1", false},
+   {0x0054, 0x0050, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Rotation Vector", "RotationVector", "1-", false},
+   {0x0054, 0x0051, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Rotations", "NumberOfRotations", "1", false},
+   {0x0054, 0x0052, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Information", "RotationInformationSequence", "1", false},
+   {0x0054, 0x0053, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Frames in", "NumberOfFramesInRotation", "1", false},
+   {0x0054, 0x0060, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "R-R Interval Vector", "RRIntervalVector", "1-", false},
+   {0x0054, 0x0061, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of R-", "NumberOfRRIntervals", "1", false},
+   {0x0054, 0x0062, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Gated Information", "GatedInformationSequence", "1", false},
+   {0x0054, 0x0063, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Data Information", "DataInformationSequence", "1", false},
+   {0x0054, 0x0070, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Time Slot Vector", "TimeSlotVector", "1-", false},
+   {0x0054, 0x0071, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Time", "NumberOfTimeSlots", "1", false},
+   {0x0054, 0x0072, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Information", "TimeSlotInformationSequence", "1", false},
+   {0x0054, 0x0073, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Time Slot Time", "TimeSlotTime", "1", false},
+   {0x0054, 0x0080, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Slice Vector", "SliceVector", "1-", false},
+   {0x0054, 0x0081, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Slices", "NumberOfSlices", "1", false},
+   {0x0054, 0x0090, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Angular View Vector", "AngularViewVector", "1-", false},
+   {0x0054, 0x0100, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Time Slice Vector", "TimeSliceVector", "1-", false},
+   {0x0054, 0x0101, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Time", "NumberOfTimeSlices", "1", false},
+   {0x0054, 0x0200, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Start Angle", "StartAngle", "1", false},
+   {0x0054, 0x0202, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Type of Detector", "TypeOfDetectorMotion", "1", false},
+   {0x0054, 0x0210, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Trigger Vector", "TriggerVector", "1-", false},
+   {0x0054, 0x0211, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Triggers", "NumberOfTriggersInPhase", "1", false},
+   {0x0054, 0x0220, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "View Code Sequence", "ViewCodeSequence", "1", false},
+   {0x0054, 0x0222, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "View Modifier Code", "ViewModifierCodeSequence", "1", false},
+   {0x0054, 0x0300, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Radionuclide Code", "RadionuclideCodeSequence", "1", false},
+   {0x0054, 0x0302, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Administration", "AdministrationRouteCodeSequence", "1", false},
+   {0x0054, 0x0304, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Radiopharmaceutical", "RadiopharmaceuticalCodeSequence", "1", false},
+   {0x0054, 0x0306, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Calibration Data", "CalibrationDataSequence", "1", false},
+   {0x0054, 0x0308, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Energy Window", "EnergyWindowNumber", "1", false},
+   {0x0054, 0x0400, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Image ID", "ImageID", "1", false},
+   {0x0054, 0x0410, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Patient Orientation", "PatientOrientationCodeSequence", "1", false},
+   {0x0054, 0x0412, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Modifier Code", "PatientOrientationModifierCodeSequence", "1", false},
+   {0x0054, 0x0414, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Relationship Code", "PatientGantryRelationshipCodeSequence", "1", false},
+   {0x0054, 0x0500, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Slice Progression", "SliceProgressionDirection", "1", false},
+   {0x0054, 0x1000, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Series Type", "SeriesType", "2", false},
+   {0x0054, 0x1001, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Units", "Units", "1", false},
+   {0x0054, 0x1002, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Counts Source", "CountsSource", "1", false},
+   {0x0054, 0x1004, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Reprojection Method", "ReprojectionMethod", "1", false},
+   {0x0054, 0x1006, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "SUV Type", "SUVType", "1", false},
+   {0x0054, 0x1100, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Randoms Correction", "RandomsCorrectionMethod", "1", false},
+   {0x0054, 0x1101, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Attenuation", "AttenuationCorrectionMethod", "1", false},
+   {0x0054, 0x1102, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Decay Correction", "DecayCorrection", "1", false},
+   {0x0054, 0x1103, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Reconstruction", "ReconstructionMethod", "1", false},
+   {0x0054, 0x1104, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Detector Lines of", "DetectorLinesOfResponseUsed", "1", false},
+   {0x0054, 0x1105, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Scatter Correction", "ScatterCorrectionMethod", "1", false},
+   {0x0054, 0x1200, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Axial Acceptance", "AxialAcceptance", "1", false},
+   {0x0054, 0x1201, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Axial Mash", "AxialMash", "2", false},
+   {0x0054, 0x1202, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Transverse Mash", "TransverseMash", "1", false},
+   {0x0054, 0x1203, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Detector Element", "DetectorElementSize", "2", false},
+   {0x0054, 0x1210, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Coincidence Window", "CoincidenceWindowWidth", "1", false},
+   {0x0054, 0x1220, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Secondary Counts", "SecondaryCountsType", "1-", false},
+   {0x0054, 0x1300, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Frame Reference", "FrameReferenceTime", "1", false},
+   {0x0054, 0x1310, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Primary (Prompts)", "PrimaryPromptsCountsAccumulated", "1", false},
+   {0x0054, 0x1311, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Secondary Counts", "SecondaryCountsAccumulated", "1-", false},
+   {0x0054, 0x1320, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Slice Sensitivity", "SliceSensitivityFactor", "1", false},
+   {0x0054, 0x1321, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Decay Factor", "DecayFactor", "1", false},
+   {0x0054, 0x1322, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Dose Calibration", "DoseCalibrationFactor", "1", false},
+   {0x0054, 0x1323, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Scatter Fraction", "ScatterFractionFactor", "1", false},
+   {0x0054, 0x1324, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Dead Time Factor", "DeadTimeFactor", "1", false},
+   {0x0054, 0x1330, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Index", "ImageIndex", "1", false},
+   {0x0054, 0x1400, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Counts Included", "CountsIncluded", "1-", true},
+   {0x0054, 0x1401, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Dead Time", "DeadTimeCorrectionFlag", "1", true},
+   {0x0060, 0x3000, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Histogram Sequence", "HistogramSequence", "1", false},
+   {0x0060, 0x3002, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Histogram Number of", "HistogramNumberOfBins", "1", false},
+   {0x0060, 0x3004, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Value", "HistogramFirstBinValue", "1", false},
+   {0x0060, 0x3006, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::SS, attribute::VR::NN}, "Value", "HistogramLastBinValue", "1", false},
+   {0x0060, 0x3008, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Histogram Bin Width", "HistogramBinWidth", "1", false},
+   {0x0060, 0x3010, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Histogram", "HistogramExplanation", "1", false},
+   {0x0060, 0x3020, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Histogram Data", "HistogramData", "1-", false},
+   {0x0062, 0x0001, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Segmentation Type", "SegmentationType", "1", false},
+   {0x0062, 0x0002, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Segment Sequence", "SegmentSequence", "1", false},
+   {0x0062, 0x0003, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Category Code", "SegmentedPropertyCategoryCodeSequence", "1", false},
+   {0x0062, 0x0004, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Segment Number", "SegmentNumber", "1", false},
+   {0x0062, 0x0005, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Segment Label", "SegmentLabel", "1", false},
+   {0x0062, 0x0006, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Segment Description", "SegmentDescription", "1", false},
+   {0x0062, 0x0008, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Segment Algorithm", "SegmentAlgorithmType", "1", false},
+   {0x0062, 0x0009, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Segment Algorithm", "SegmentAlgorithmName", "1", false},
+   {0x0062, 0x000a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification", "SegmentIdentificationSequence", "1", false},
+   {0x0062, 0x000b, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Referenced Segment", "ReferencedSegmentNumber", "1-", false},
+   {0x0062, 0x000c, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Recommended Display", "RecommendedDisplayGrayscaleValue", "1", false},
+   {0x0062, 0x000d, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Recommended Display", "RecommendedDisplayCIELabValue", "3", false},
+   {0x0062, 0x000e, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Maximum Fractional", "MaximumFractionalValue", "1", false},
+   {0x0062, 0x000f, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Segmented Property", "SegmentedPropertyTypeCodeSequence", "1", false},
+   {0x0062, 0x0010, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Segmentation", "SegmentationFractionalType", "1", false},
+   {0x0064, 0x0002, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Registration", "DeformableRegistrationSequence", "1", false},
+   {0x0064, 0x0003, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Source Frame of", "SourceFrameOfReferenceUID", "1", false},
+   {0x0064, 0x0005, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Registration Grid", "DeformableRegistrationGridSequence", "1", false},
+   {0x0064, 0x0007, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Grid Dimensions", "GridDimensions", "3", false},
+   {0x0064, 0x0008, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Grid Resolution", "GridResolution", "3", false},
+   {0x0064, 0x0009, 0xffff, 0xffff, {attribute::VR::OF, attribute::VR::NN, attribute::VR::NN}, "Vector Grid Data", "VectorGridData", "1", false},
+   {0x0064, 0x000f, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Matrix Registration", "PreDeformationMatrixRegistrationSequence", "1", false},
+   {0x0064, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Matrix Registration", "PostDeformationMatrixRegistrationSequence", "1", false},
+   {0x0066, 0x0001, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Number of Surfaces", "NumberOfSurfaces", "1", false},
+   {0x0066, 0x0002, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Surface Sequence", "SurfaceSequence", "1", false},
+   {0x0066, 0x0003, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Surface Number", "SurfaceNumber", "1", false},
+   {0x0066, 0x0004, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Surface Comments", "SurfaceComments", "1", false},
+   {0x0066, 0x0009, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Surface Processing", "SurfaceProcessing", "1", false},
+   {0x0066, 0x000a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Surface Processing", "SurfaceProcessingRatio", "1", false},
+   {0x0066, 0x000b, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Surface Processing", "SurfaceProcessingDescription", "1", false},
+   {0x0066, 0x000c, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Presentation", "RecommendedPresentationOpacity", "1", false},
+   {0x0066, 0x000d, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Recommended", "RecommendedPresentationType", "1", false},
+   {0x0066, 0x000e, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Finite Volume", "FiniteVolume", "1", false},
+   {0x0066, 0x0010, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Manifold", "Manifold", "1", false},
+   {0x0066, 0x0011, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Surface Points", "SurfacePointsSequence", "1", false},
+   {0x0066, 0x0012, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Surface Points", "SurfacePointsNormalsSequence", "1", false},
+   {0x0066, 0x0013, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Surface Mesh", "SurfaceMeshPrimitivesSequence", "1", false},
+   {0x0066, 0x0015, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Number of Surface", "NumberOfSurfacePoints", "1", false},
+   {0x0066, 0x0016, 0xffff, 0xffff, {attribute::VR::OF, attribute::VR::NN, attribute::VR::NN}, "Point Coordinates", "PointCoordinatesData", "1", false},
+   {0x0066, 0x0017, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Point Position", "PointPositionAccuracy", "3", false},
+   {0x0066, 0x0018, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Mean Point Distance", "MeanPointDistance", "1", false},
+   {0x0066, 0x0019, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Maximum Point", "MaximumPointDistance", "1", false},
+   {0x0066, 0x001a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Points Bounding Box", "PointsBoundingBoxCoordinates", "6", false},
+   {0x0066, 0x001b, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Axis of Rotation", "AxisOfRotation", "3", false},
+   {0x0066, 0x001c, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Center of Rotation", "CenterOfRotation", "3", false},
+   {0x0066, 0x001e, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Number of Vectors", "NumberOfVectors", "1", false},
+   {0x0066, 0x001f, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Vector", "VectorDimensionality", "1", false},
+   {0x0066, 0x0020, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Vector Accuracy", "VectorAccuracy", "1-", false},
+   {0x0066, 0x0021, 0xffff, 0xffff, {attribute::VR::OF, attribute::VR::NN, attribute::VR::NN}, "Vector Coordinate", "VectorCoordinateData", "1", false},
+   {0x0066, 0x0023, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Triangle Point", "TrianglePointIndexList", "1", false},
+   {0x0066, 0x0024, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Edge Point Index", "EdgePointIndexList", "1", false},
+   {0x0066, 0x0025, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Vertex Point Index", "VertexPointIndexList", "1", false},
+   {0x0066, 0x0026, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Triangle Strip", "TriangleStripSequence", "1", false},
+   {0x0066, 0x0027, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Triangle Fan", "TriangleFanSequence", "1", false},
+   {0x0066, 0x0028, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Line Sequence", "LineSequence", "1", false},
+   {0x0066, 0x0029, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Primitive Point", "PrimitivePointIndexList", "1", false},
+   {0x0066, 0x002a, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Surface Count", "SurfaceCount", "1", false},
+   {0x0066, 0x002b, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Surface", "ReferencedSurfaceSequence", "1", false},
+   {0x0066, 0x002c, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Referenced Surface", "ReferencedSurfaceNumber", "1", false},
+   {0x0066, 0x002d, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Algorithm", "SegmentSurfaceGenerationAlgorithmIdentificationSequence", "1", false},
+   {0x0066, 0x002e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Source Instance", "SegmentSurfaceSourceInstanceSequence", "1", false},
+   {0x0066, 0x002f, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Algorithm Family", "AlgorithmFamilyCodeSequence", "1", false},
+   {0x0066, 0x0030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Algorithm Name Code", "AlgorithmNameCodeSequence", "1", false},
+   {0x0066, 0x0031, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Algorithm Version", "AlgorithmVersion", "1", false},
+   {0x0066, 0x0032, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Algorithm", "AlgorithmParameters", "1", false},
+   {0x0066, 0x0034, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Facet Sequence", "FacetSequence", "1", false},
+   {0x0066, 0x0035, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Algorithm", "SurfaceProcessingAlgorithmIdentificationSequence", "1", false},
+   {0x0066, 0x0036, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Algorithm Name", "AlgorithmName", "1", false},
+   {0x0068, 0x6210, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Implant Size", "ImplantSize", "1", false},
+   {0x0068, 0x6221, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Implant Template", "ImplantTemplateVersion", "1", false},
+   {0x0068, 0x6222, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Replaced Implant", "ReplacedImplantTemplateSequence", "1", false},
+   {0x0068, 0x6223, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Implant Type", "ImplantType", "1", false},
+   {0x0068, 0x6224, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Derivation Implant", "DerivationImplantTemplateSequence", "1", false},
+   {0x0068, 0x6225, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Original Implant", "OriginalImplantTemplateSequence", "1", false},
+   {0x0068, 0x6226, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Effective DateTime", "EffectiveDateTime", "1", false},
+   {0x0068, 0x6230, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Implant Target", "ImplantTargetAnatomySequence", "1", false},
+   {0x0068, 0x6260, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Manufacturer", "InformationFromManufacturerSequence", "1", false},
+   {0x0068, 0x6265, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Manufacturer", "NotificationFromManufacturerSequence", "1", false},
+   {0x0068, 0x6270, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Information Issue", "InformationIssueDateTime", "1", false},
+   {0x0068, 0x6280, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Information Summary", "InformationSummary", "1", false},
+   {0x0068, 0x62a0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Disapproval Code", "ImplantRegulatoryDisapprovalCodeSequence", "1", false},
+   {0x0068, 0x62a5, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Overall Template", "OverallTemplateSpatialTolerance", "1", false},
+   {0x0068, 0x62c0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "HPGL Document", "HPGLDocumentSequence", "1", false},
+   {0x0068, 0x62d0, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "HPGL Document ID", "HPGLDocumentID", "1", false},
+   {0x0068, 0x62d5, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "HPGL Document Label", "HPGLDocumentLabel", "1", false},
+   {0x0068, 0x62e0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "View Orientation", "ViewOrientationCodeSequence", "1", false},
+   {0x0068, 0x62f0, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "View Orientation", "ViewOrientationModifier", "9", false},
+   {0x0068, 0x62f2, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "HPGL Document", "HPGLDocumentScaling", "1", false},
+   {0x0068, 0x6300, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "HPGL Document", "HPGLDocument", "1", false},
+   {0x0068, 0x6310, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "HPGL Contour Pen", "HPGLContourPenNumber", "1", false},
+   {0x0068, 0x6320, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "HPGL Pen Sequence", "HPGLPenSequence", "1", false},
+   {0x0068, 0x6330, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "HPGL Pen Number", "HPGLPenNumber", "1", false},
+   {0x0068, 0x6340, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "HPGL Pen Label", "HPGLPenLabel", "1", false},
+   {0x0068, 0x6345, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "HPGL Pen", "HPGLPenDescription", "1", false},
+   {0x0068, 0x6346, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Recommended", "RecommendedRotationPoint", "2", false},
+   {0x0068, 0x6347, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Bounding Rectangle", "BoundingRectangle", "4", false},
+   {0x0068, 0x6350, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Model Surface", "ImplantTemplate3DModelSurfaceNumber", "n", false},
+   {0x0068, 0x6360, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Description", "SurfaceModelDescriptionSequence", "1", false},
+   {0x0068, 0x6380, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Surface Model Label", "SurfaceModelLabel", "1", false},
+   {0x0068, 0x6390, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Surface Model", "SurfaceModelScalingFactor", "1", false},
+   {0x0068, 0x63a0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Materials Code", "MaterialsCodeSequence", "1", false},
+   {0x0068, 0x63a4, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Coating Materials", "CoatingMaterialsCodeSequence", "1", false},
+   {0x0068, 0x63a8, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Implant Type Code", "ImplantTypeCodeSequence", "1", false},
+   {0x0068, 0x63ac, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fixation Method", "FixationMethodCodeSequence", "1", false},
+   {0x0068, 0x63b0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Mating Feature Sets", "MatingFeatureSetsSequence", "1", false},
+   {0x0068, 0x63c0, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Mating Feature Set", "MatingFeatureSetID", "1", false},
+   {0x0068, 0x63d0, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Mating Feature Set", "MatingFeatureSetLabel", "1", false},
+   {0x0068, 0x63e0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Mating Feature", "MatingFeatureSequence", "1", false},
+   {0x0068, 0x63f0, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Mating Feature ID", "MatingFeatureID", "1", false},
+   {0x0068, 0x6400, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Degree of Freedom", "MatingFeatureDegreeOfFreedomSequence", "1", false},
+   {0x0068, 0x6410, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Degree of Freedom", "DegreeOfFreedomID", "1", false},
+   {0x0068, 0x6420, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Degree of Freedom", "DegreeOfFreedomType", "1", false},
+   {0x0068, 0x6430, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Coordinates", "TwoDMatingFeatureCoordinatesSequence", "1", false},
+   {0x0068, 0x6440, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Referenced HPGL", "ReferencedHPGLDocumentID", "1", false},
+   {0x0068, 0x6450, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "2D Mating Point", "TwoDMatingPoint", "2", false},
+   {0x0068, 0x6460, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "2D Mating Axes", "TwoDMatingAxes", "4", false},
+   {0x0068, 0x6470, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "2D Degree of", "TwoDDegreeOfFreedomSequence", "1", false},
+   {0x0068, 0x6490, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "3D Degree of", "ThreeDDegreeOfFreedomAxis", "3", false},
+   {0x0068, 0x64a0, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Range of Freedom", "RangeOfFreedom", "2", false},
+   {0x0068, 0x64c0, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "3D Mating Point", "ThreeDMatingPoint", "3", false},
+   {0x0068, 0x64d0, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "3D Mating Axes", "ThreeDMatingAxes", "9", false},
+   {0x0068, 0x64f0, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "2D Degree of", "TwoDDegreeOfFreedomAxis", "3", false},
+   {0x0068, 0x6500, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Planning Landmark", "PlanningLandmarkPointSequence", "1", false},
+   {0x0068, 0x6510, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Planning Landmark", "PlanningLandmarkLineSequence", "1", false},
+   {0x0068, 0x6520, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Planning Landmark", "PlanningLandmarkPlaneSequence", "1", false},
+   {0x0068, 0x6530, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Planning Landmark", "PlanningLandmarkID", "1", false},
+   {0x0068, 0x6540, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Planning Landmark", "PlanningLandmarkDescription", "1", false},
+   {0x0068, 0x6545, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification Code", "PlanningLandmarkIdentificationCodeSequence", "1", false},
+   {0x0068, 0x6550, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Coordinates", "TwoDPointCoordinatesSequence", "1", false},
+   {0x0068, 0x6560, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "2D Point", "TwoDPointCoordinates", "2", false},
+   {0x0068, 0x6590, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "3D Point", "ThreeDPointCoordinates", "3", false},
+   {0x0068, 0x65a0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "2D Line Coordinates", "TwoDLineCoordinatesSequence", "1", false},
+   {0x0068, 0x65b0, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "2D Line Coordinates", "TwoDLineCoordinates", "4", false},
+   {0x0068, 0x65d0, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "3D Line Coordinates", "ThreeDLineCoordinates", "6", false},
+   {0x0068, 0x65e0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Coordinates", "TwoDPlaneCoordinatesSequence", "1", false},
+   {0x0068, 0x65f0, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "2D Plane", "TwoDPlaneIntersection", "4", false},
+   {0x0068, 0x6610, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "3D Plane Origin", "ThreeDPlaneOrigin", "3", false},
+   {0x0068, 0x6620, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "3D Plane Normal", "ThreeDPlaneNormal", "3", false},
+   {0x0070, 0x0001, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Graphic Annotation", "GraphicAnnotationSequence", "1", false},
+   {0x0070, 0x0002, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Graphic Layer", "GraphicLayer", "1", false},
+   {0x0070, 0x0003, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Bounding Box", "BoundingBoxAnnotationUnits", "1", false},
+   {0x0070, 0x0004, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Anchor Point", "AnchorPointAnnotationUnits", "1", false},
+   {0x0070, 0x0005, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Graphic Annotation", "GraphicAnnotationUnits", "1", false},
+   {0x0070, 0x0006, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Unformatted Text", "UnformattedTextValue", "1", false},
+   {0x0070, 0x0008, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Text Object", "TextObjectSequence", "1", false},
+   {0x0070, 0x0009, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Graphic Object", "GraphicObjectSequence", "1", false},
+   {0x0070, 0x0010, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Bounding Box Top", "BoundingBoxTopLeftHandCorner", "2", false},
+   {0x0070, 0x0011, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Bounding Box Bottom", "BoundingBoxBottomRightHandCorner", "2", false},
+   {0x0070, 0x0012, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Horizontal", "BoundingBoxTextHorizontalJustification", "1", false},
+   {0x0070, 0x0014, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Anchor Point", "AnchorPoint", "2", false},
+   {0x0070, 0x0015, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Anchor Point", "AnchorPointVisibility", "1", false},
+   {0x0070, 0x0020, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Graphic Dimensions", "GraphicDimensions", "1", false},
+   {0x0070, 0x0021, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Graphic", "NumberOfGraphicPoints", "1", false},
+   {0x0070, 0x0022, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Graphic Data", "GraphicData", "2-", false},
+   {0x0070, 0x0023, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Graphic Type", "GraphicType", "1", false},
+   {0x0070, 0x0024, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Graphic Filled", "GraphicFilled", "1", false},
+   {0x0070, 0x0040, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Image Rotation", "ImageRotationRetired", "1", true},
+   {0x0070, 0x0041, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Horizontal", "ImageHorizontalFlip", "1", false},
+   {0x0070, 0x0042, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Rotation", "ImageRotation", "1", false},
+   {0x0070, 0x0050, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Left Hand Corner", "DisplayedAreaTopLeftHandCornerTrial", "2", true},
+   {0x0070, 0x0051, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Bottom Right Hand", "DisplayedAreaBottomRightHandCornerTrial", "2", true},
+   {0x0070, 0x0052, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Displayed Area Top", "DisplayedAreaTopLeftHandCorner", "2", false},
+   {0x0070, 0x0053, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Bottom Right Hand", "DisplayedAreaBottomRightHandCorner", "2", false},
+   {0x0070, 0x005a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Displayed Area", "DisplayedAreaSelectionSequence", "1", false},
+   {0x0070, 0x0060, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Graphic Layer", "GraphicLayerSequence", "1", false},
+   {0x0070, 0x0062, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Graphic Layer Order", "GraphicLayerOrder", "1", false},
+   {0x0070, 0x0066, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Recommended Display", "GraphicLayerRecommendedDisplayGrayscaleValue", "1", false},
+   {0x0070, 0x0067, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Recommended Display", "GraphicLayerRecommendedDisplayRGBValue", "3", true},
+   {0x0070, 0x0068, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Graphic Layer", "GraphicLayerDescription", "1", false},
+   {0x0070, 0x0080, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Content Label", "ContentLabel", "1", false},
+   {0x0070, 0x0081, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Content Description", "ContentDescription", "1", false},
+   {0x0070, 0x0082, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Presentation", "PresentationCreationDate", "1", false},
+   {0x0070, 0x0083, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Presentation", "PresentationCreationTime", "1", false},
+   {0x0070, 0x0084, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Content Creators", "ContentCreatorName", "1", false},
+   {0x0070, 0x0086, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification Code", "ContentCreatorIdentificationCodeSequence", "1", false},
+   {0x0070, 0x0087, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Description", "AlternateContentDescriptionSequence", "1", false},
+   {0x0070, 0x0100, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Presentation Size", "PresentationSizeMode", "1", false},
+   {0x0070, 0x0101, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Presentation Pixel", "PresentationPixelSpacing", "2", false},
+   {0x0070, 0x0102, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Presentation Pixel", "PresentationPixelAspectRatio", "2", false},
+   {0x0070, 0x0103, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Presentation Pixel", "PresentationPixelMagnificationRatio", "1", false},
+   {0x0070, 0x0207, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Graphic Group Label", "GraphicGroupLabel", "1", false},
+   {0x0070, 0x0208, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Graphic Group", "GraphicGroupDescription", "1", false},
+   {0x0070, 0x0209, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Compound Graphic", "CompoundGraphicSequence", "1", false},
+   {0x0070, 0x0226, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Compound Graphic", "CompoundGraphicInstanceID", "1", false},
+   {0x0070, 0x0227, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Font Name", "FontName", "1", false},
+   {0x0070, 0x0228, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Font Name Type", "FontNameType", "1", false},
+   {0x0070, 0x0229, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "CSS Font Name", "CSSFontName", "1", false},
+   {0x0070, 0x0230, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Rotation Angle", "RotationAngle", "1", false},
+   {0x0070, 0x0231, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Text Style Sequence", "TextStyleSequence", "1", false},
+   {0x0070, 0x0232, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Line Style Sequence", "LineStyleSequence", "1", false},
+   {0x0070, 0x0233, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fill Style Sequence", "FillStyleSequence", "1", false},
+   {0x0070, 0x0234, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Graphic Group", "GraphicGroupSequence", "1", false},
+   {0x0070, 0x0241, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Text Color CIELab", "TextColorCIELabValue", "3", false},
+   {0x0070, 0x0242, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Horizontal", "HorizontalAlignment", "1", false},
+   {0x0070, 0x0243, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Vertical Alignment", "VerticalAlignment", "1", false},
+   {0x0070, 0x0244, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Shadow Style", "ShadowStyle", "1", false},
+   {0x0070, 0x0245, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Shadow Offset X", "ShadowOffsetX", "1", false},
+   {0x0070, 0x0246, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Shadow Offset Y", "ShadowOffsetY", "1", false},
+   {0x0070, 0x0247, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Shadow Color CIELab", "ShadowColorCIELabValue", "3", false},
+   {0x0070, 0x0248, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Underlined", "Underlined", "1", false},
+   {0x0070, 0x0249, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Bold", "Bold", "1", false},
+   {0x0070, 0x0250, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Italic", "Italic", "1", false},
+   {0x0070, 0x0251, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pattern On Color", "PatternOnColorCIELabValue", "3", false},
+   {0x0070, 0x0252, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pattern Off Color", "PatternOffColorCIELabValue", "3", false},
+   {0x0070, 0x0253, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Line Thickness", "LineThickness", "1", false},
+   {0x0070, 0x0254, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Line Dashing Style", "LineDashingStyle", "1", false},
+   {0x0070, 0x0255, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Line Pattern", "LinePattern", "1", false},
+   {0x0070, 0x0256, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Fill Pattern", "FillPattern", "1", false},
+   {0x0070, 0x0257, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Fill Mode", "FillMode", "1", false},
+   {0x0070, 0x0258, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Shadow Opacity", "ShadowOpacity", "1", false},
+   {0x0070, 0x0261, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Gap Length", "GapLength", "1", false},
+   {0x0070, 0x0262, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Diameter of", "DiameterOfVisibility", "1", false},
+   {0x0070, 0x0273, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Rotation Point", "RotationPoint", "2", false},
+   {0x0070, 0x0274, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Tick Alignment", "TickAlignment", "1", false},
+   {0x0070, 0x0278, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Show Tick Label", "ShowTickLabel", "1", false},
+   {0x0070, 0x0279, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Tick Label", "TickLabelAlignment", "1", false},
+   {0x0070, 0x0282, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compound Graphic", "CompoundGraphicUnits", "1", false},
+   {0x0070, 0x0284, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Pattern On Opacity", "PatternOnOpacity", "1", false},
+   {0x0070, 0x0285, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Pattern Off Opacity", "PatternOffOpacity", "1", false},
+   {0x0070, 0x0287, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Major Ticks", "MajorTicksSequence", "1", false},
+   {0x0070, 0x0288, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Tick Position", "TickPosition", "1", false},
+   {0x0070, 0x0289, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Tick Label", "TickLabel", "1", false},
+   {0x0070, 0x0294, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compound Graphic", "CompoundGraphicType", "1", false},
+   {0x0070, 0x0295, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Graphic Group ID", "GraphicGroupID", "1", false},
+   {0x0070, 0x0306, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Shape Type", "ShapeType", "1", false},
+   {0x0070, 0x0308, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Registration", "RegistrationSequence", "1", false},
+   {0x0070, 0x0309, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Matrix Registration", "MatrixRegistrationSequence", "1", false},
+   {0x0070, 0x030a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Matrix Sequence", "MatrixSequence", "1", false},
+   {0x0070, 0x030c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Transformation", "FrameOfReferenceTransformationMatrixType", "1", false},
+   {0x0070, 0x030d, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Registration Type", "RegistrationTypeCodeSequence", "1", false},
+   {0x0070, 0x030f, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Fiducial", "FiducialDescription", "1", false},
+   {0x0070, 0x0310, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Fiducial Identifier", "FiducialIdentifier", "1", false},
+   {0x0070, 0x0311, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fiducial Identifier", "FiducialIdentifierCodeSequence", "1", false},
+   {0x0070, 0x0312, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Contour Uncertainty", "ContourUncertaintyRadius", "1", false},
+   {0x0070, 0x0314, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Used Fiducials", "UsedFiducialsSequence", "1", false},
+   {0x0070, 0x0318, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Graphic Coordinates", "GraphicCoordinatesDataSequence", "1", false},
+   {0x0070, 0x031a, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Fiducial UID", "FiducialUID", "1", false},
+   {0x0070, 0x031c, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fiducial Set", "FiducialSetSequence", "1", false},
+   {0x0070, 0x031e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fiducial Sequence", "FiducialSequence", "1", false},
+   {0x0070, 0x0401, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Recommended Display", "GraphicLayerRecommendedDisplayCIELabValue", "3", false},
+   {0x0070, 0x0402, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Blending Sequence", "BlendingSequence", "1", false},
+   {0x0070, 0x0403, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Relative Opacity", "RelativeOpacity", "1", false},
+   {0x0070, 0x0404, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Registration", "ReferencedSpatialRegistrationSequence", "1", false},
+   {0x0070, 0x0405, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Blending Position", "BlendingPosition", "1", false},
+   {0x0072, 0x0002, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Hanging Protocol", "HangingProtocolName", "1", false},
+   {0x0072, 0x0004, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Hanging Protocol", "HangingProtocolDescription", "1", false},
+   {0x0072, 0x0006, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Hanging Protocol", "HangingProtocolLevel", "1", false},
+   {0x0072, 0x0008, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Hanging Protocol", "HangingProtocolCreator", "1", false},
+   {0x0072, 0x000a, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Hanging Protocol", "HangingProtocolCreationDateTime", "1", false},
+   {0x0072, 0x000c, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Hanging Protocol", "HangingProtocolDefinitionSequence", "1", false},
+   {0x0072, 0x000e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "User Identification", "HangingProtocolUserIdentificationCodeSequence", "1", false},
+   {0x0072, 0x0010, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Hanging Protocol", "HangingProtocolUserGroupName", "1", false},
+   {0x0072, 0x0012, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Source Hanging", "SourceHangingProtocolSequence", "1", false},
+   {0x0072, 0x0014, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Priors", "NumberOfPriorsReferenced", "1", false},
+   {0x0072, 0x0020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Image Sets Sequence", "ImageSetsSequence", "1", false},
+   {0x0072, 0x0022, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Image Set Selector", "ImageSetSelectorSequence", "1", false},
+   {0x0072, 0x0024, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Set Selector", "ImageSetSelectorUsageFlag", "1", false},
+   {0x0072, 0x0026, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Selector Attribute", "SelectorAttribute", "1", false},
+   {0x0072, 0x0028, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Selector Value", "SelectorValueNumber", "1", false},
+   {0x0072, 0x0030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Time Based Image", "TimeBasedImageSetsSequence", "1", false},
+   {0x0072, 0x0032, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Set Number", "ImageSetNumber", "1", false},
+   {0x0072, 0x0034, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Set Selector", "ImageSetSelectorCategory", "1", false},
+   {0x0072, 0x0038, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Relative Time", "RelativeTime", "2", false},
+   {0x0072, 0x003a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Relative Time Units", "RelativeTimeUnits", "1", false},
+   {0x0072, 0x003c, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Abstract Prior", "AbstractPriorValue", "2", false},
+   {0x0072, 0x003e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Abstract Prior Code", "AbstractPriorCodeSequence", "1", false},
+   {0x0072, 0x0040, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Image Set Label", "ImageSetLabel", "1", false},
+   {0x0072, 0x0050, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Selector Attribute", "SelectorAttributeVR", "1", false},
+   {0x0072, 0x0052, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Selector Sequence", "SelectorSequencePointer", "1-", false},
+   {0x0072, 0x0054, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Pointer Private", "SelectorSequencePointerPrivateCreator", "n", false},
+   {0x0072, 0x0056, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Selector Attribute", "SelectorAttributePrivateCreator", "1", false},
+   {0x0072, 0x0060, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Selector AT Value", "SelectorATValue", "1-", false},
+   {0x0072, 0x0062, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Selector CS Value", "SelectorCSValue", "1-", false},
+   {0x0072, 0x0064, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Selector IS Value", "SelectorISValue", "1-", false},
+   {0x0072, 0x0066, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Selector LO Value", "SelectorLOValue", "1-", false},
+   {0x0072, 0x0068, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Selector LT Value", "SelectorLTValue", "1", false},
+   {0x0072, 0x006a, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Selector PN Value", "SelectorPNValue", "1-", false},
+   {0x0072, 0x006c, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Selector SH Value", "SelectorSHValue", "1-", false},
+   {0x0072, 0x006e, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Selector ST Value", "SelectorSTValue", "1", false},
+   {0x0072, 0x0070, 0xffff, 0xffff, {attribute::VR::UT, attribute::VR::NN, attribute::VR::NN}, "Selector UT Value", "SelectorUTValue", "1", false},
+   {0x0072, 0x0072, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Selector DS Value", "SelectorDSValue", "1-", false},
+   {0x0072, 0x0074, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Selector FD Value", "SelectorFDValue", "1-", false},
+   {0x0072, 0x0076, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Selector FL Value", "SelectorFLValue", "1-", false},
+   {0x0072, 0x0078, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Selector UL Value", "SelectorULValue", "1-", false},
+   {0x0072, 0x007a, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Selector US Value", "SelectorUSValue", "1-", false},
+   {0x0072, 0x007c, 0xffff, 0xffff, {attribute::VR::SL, attribute::VR::NN, attribute::VR::NN}, "Selector SL Value", "SelectorSLValue", "1-", false},
+   {0x0072, 0x007e, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Selector SS Value", "SelectorSSValue", "1-", false},
+   {0x0072, 0x0080, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Selector Code", "SelectorCodeSequenceValue", "1", false},
+   {0x0072, 0x0100, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Screens", "NumberOfScreens", "1", false},
+   {0x0072, 0x0102, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Nominal Screen", "NominalScreenDefinitionSequence", "1", false},
+   {0x0072, 0x0104, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Vertical", "NumberOfVerticalPixels", "1", false},
+   {0x0072, 0x0106, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of", "NumberOfHorizontalPixels", "1", false},
+   {0x0072, 0x0108, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Display Environment", "DisplayEnvironmentSpatialPosition", "4", false},
+   {0x0072, 0x010a, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Screen Minimum", "ScreenMinimumGrayscaleBitDepth", "1", false},
+   {0x0072, 0x010c, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Screen Minimum", "ScreenMinimumColorBitDepth", "1", false},
+   {0x0072, 0x010e, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Application Maximum", "ApplicationMaximumRepaintTime", "1", false},
+   {0x0072, 0x0200, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Display Sets", "DisplaySetsSequence", "1", false},
+   {0x0072, 0x0202, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Display Set Number", "DisplaySetNumber", "1", false},
+   {0x0072, 0x0203, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Display Set Label", "DisplaySetLabel", "1", false},
+   {0x0072, 0x0204, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Display Set", "DisplaySetPresentationGroup", "1", false},
+   {0x0072, 0x0206, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Presentation Group", "DisplaySetPresentationGroupDescription", "1", false},
+   {0x0072, 0x0208, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Partial Data", "PartialDataDisplayHandling", "1", false},
+   {0x0072, 0x0210, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Synchronized", "SynchronizedScrollingSequence", "1", false},
+   {0x0072, 0x0212, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Display Set", "DisplaySetScrollingGroup", "2-", false},
+   {0x0072, 0x0214, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Navigation", "NavigationIndicatorSequence", "1", false},
+   {0x0072, 0x0216, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Navigation Display", "NavigationDisplaySet", "1", false},
+   {0x0072, 0x0218, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Reference Display", "ReferenceDisplaySets", "1-", false},
+   {0x0072, 0x0300, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Image Boxes", "ImageBoxesSequence", "1", false},
+   {0x0072, 0x0302, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Box Number", "ImageBoxNumber", "1", false},
+   {0x0072, 0x0304, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Box Layout", "ImageBoxLayoutType", "1", false},
+   {0x0072, 0x0306, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Horizontal", "ImageBoxTileHorizontalDimension", "1", false},
+   {0x0072, 0x0308, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Box Tile", "ImageBoxTileVerticalDimension", "1", false},
+   {0x0072, 0x0310, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Box Scroll", "ImageBoxScrollDirection", "1", false},
+   {0x0072, 0x0312, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Box Small", "ImageBoxSmallScrollType", "1", false},
+   {0x0072, 0x0314, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Box Small", "ImageBoxSmallScrollAmount", "1", false},
+   {0x0072, 0x0316, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Box Large", "ImageBoxLargeScrollType", "1", false},
+   {0x0072, 0x0318, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Box Large", "ImageBoxLargeScrollAmount", "1", false},
+   {0x0072, 0x0320, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Box Overlap", "ImageBoxOverlapPriority", "1", false},
+   {0x0072, 0x0330, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Cine Relative to", "CineRelativeToRealTime", "1", false},
+   {0x0072, 0x0400, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Filter Operations", "FilterOperationsSequence", "1", false},
+   {0x0072, 0x0402, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Filter-by Category", "FilterByCategory", "1", false},
+   {0x0072, 0x0404, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Filter-by Attribute", "FilterByAttributePresence", "1", false},
+   {0x0072, 0x0406, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Filter-by Operator", "FilterByOperator", "1", false},
+   {0x0072, 0x0420, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Background CIELab", "StructuredDisplayBackgroundCIELabValue", "3", false},
+   {0x0072, 0x0421, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Empty Image Box", "EmptyImageBoxCIELabValue", "3", false},
+   {0x0072, 0x0422, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Structured Display", "StructuredDisplayImageBoxSequence", "1", false},
+   {0x0072, 0x0424, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Structured Display", "StructuredDisplayTextBoxSequence", "1", false},
+   {0x0072, 0x0427, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced First", "ReferencedFirstFrameSequence", "1", false},
+   {0x0072, 0x0430, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Synchronization", "ImageBoxSynchronizationSequence", "1", false},
+   {0x0072, 0x0432, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Synchronized Image", "SynchronizedImageBoxList", "2-", false},
+   {0x0072, 0x0434, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Type of", "TypeOfSynchronization", "1", false},
+   {0x0072, 0x0500, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Blending Operation", "BlendingOperationType", "1", false},
+   {0x0072, 0x0510, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Reformatting", "ReformattingOperationType", "1", false},
+   {0x0072, 0x0512, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Reformatting", "ReformattingThickness", "1", false},
+   {0x0072, 0x0514, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Reformatting", "ReformattingInterval", "1", false},
+   {0x0072, 0x0516, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Operation Initial", "ReformattingOperationInitialViewDirection", "1", false},
+   {0x0072, 0x0520, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "3D Rendering Type", "ThreeDRenderingType", "1-", false},
+   {0x0072, 0x0600, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Sorting Operations", "SortingOperationsSequence", "1", false},
+   {0x0072, 0x0602, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Sort-by Category", "SortByCategory", "1", false},
+   {0x0072, 0x0604, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Sorting Direction", "SortingDirection", "1", false},
+   {0x0072, 0x0700, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Display Set Patient", "DisplaySetPatientOrientation", "2", false},
+   {0x0072, 0x0702, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "VOI Type", "VOIType", "1", false},
+   {0x0072, 0x0704, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Pseudo-Color Type", "PseudoColorType", "1", false},
+   {0x0072, 0x0705, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Palette Instance", "PseudoColorPaletteInstanceReferenceSequence", "1", false},
+   {0x0072, 0x0706, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Show Grayscale", "ShowGrayscaleInverted", "1", false},
+   {0x0072, 0x0710, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Show Image True", "ShowImageTrueSizeFlag", "1", false},
+   {0x0072, 0x0712, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Show Graphic", "ShowGraphicAnnotationFlag", "1", false},
+   {0x0072, 0x0714, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Show Patient", "ShowPatientDemographicsFlag", "1", false},
+   {0x0072, 0x0716, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Show Acquisition", "ShowAcquisitionTechniquesFlag", "1", false},
+   {0x0072, 0x0717, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Horizontal", "DisplaySetHorizontalJustification", "1", false},
+   {0x0072, 0x0718, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Vertical", "DisplaySetVerticalJustification", "1", false},
+   {0x0074, 0x0120, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Continuation Start", "ContinuationStartMeterset", "1", false},
+   {0x0074, 0x0121, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Continuation End", "ContinuationEndMeterset", "1", false},
+   {0x0074, 0x1000, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Procedure Step", "ProcedureStepState", "1", false},
+   {0x0074, 0x1002, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Progress", "ProcedureStepProgressInformationSequence", "1", false},
+   {0x0074, 0x1004, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Procedure Step", "ProcedureStepProgress", "1", false},
+   {0x0074, 0x1006, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Progress", "ProcedureStepProgressDescription", "1", false},
+   {0x0074, 0x1008, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Communications URI", "ProcedureStepCommunicationsURISequence", "1", false},
+   {0x0074, 0x100a, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Contact URI", "ContactURI", "1", false},
+   {0x0074, 0x100c, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Contact Display", "ContactDisplayName", "1", false},
+   {0x0074, 0x100e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Discontinuation", "ProcedureStepDiscontinuationReasonCodeSequence", "1", false},
+   {0x0074, 0x1020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Beam Task Sequence", "BeamTaskSequence", "1", false},
+   {0x0074, 0x1022, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Beam Task Type", "BeamTaskType", "1", false},
+   {0x0074, 0x1024, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Beam Order Index", "BeamOrderIndexTrial", "1", true},
+   {0x0074, 0x1026, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Table Top Vertical", "TableTopVerticalAdjustedPosition", "1", false},
+   {0x0074, 0x1027, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Longitudinal", "TableTopLongitudinalAdjustedPosition", "1", false},
+   {0x0074, 0x1028, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Table Top Lateral", "TableTopLateralAdjustedPosition", "1", false},
+   {0x0074, 0x102a, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Patient Support", "PatientSupportAdjustedAngle", "1", false},
+   {0x0074, 0x102b, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Table Top Eccentric", "TableTopEccentricAdjustedAngle", "1", false},
+   {0x0074, 0x102c, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Table Top Pitch", "TableTopPitchAdjustedAngle", "1", false},
+   {0x0074, 0x102d, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Table Top Roll", "TableTopRollAdjustedAngle", "1", false},
+   {0x0074, 0x1030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Verification Image", "DeliveryVerificationImageSequence", "1", false},
+   {0x0074, 0x1032, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Verification Image", "VerificationImageTiming", "1", false},
+   {0x0074, 0x1034, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Double Exposure", "DoubleExposureFlag", "1", false},
+   {0x0074, 0x1036, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Double Exposure", "DoubleExposureOrdering", "1", false},
+   {0x0074, 0x1038, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Double Exposure", "DoubleExposureMetersetTrial", "1", true},
+   {0x0074, 0x103a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Double Exposure", "DoubleExposureFieldDeltaTrial", "4", true},
+   {0x0074, 0x1040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Related Reference", "RelatedReferenceRTImageSequence", "1", false},
+   {0x0074, 0x1042, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Verification", "GeneralMachineVerificationSequence", "1", false},
+   {0x0074, 0x1044, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Machine", "ConventionalMachineVerificationSequence", "1", false},
+   {0x0074, 0x1046, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Verification", "IonMachineVerificationSequence", "1", false},
+   {0x0074, 0x1048, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Failed Attributes", "FailedAttributesSequence", "1", false},
+   {0x0074, 0x104a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Overridden", "OverriddenAttributesSequence", "1", false},
+   {0x0074, 0x104c, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Control Point", "ConventionalControlPointVerificationSequence", "1", false},
+   {0x0074, 0x104e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Verification", "IonControlPointVerificationSequence", "1", false},
+   {0x0074, 0x1050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Attribute", "AttributeOccurrenceSequence", "1", false},
+   {0x0074, 0x1052, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Attribute", "AttributeOccurrencePointer", "1", false},
+   {0x0074, 0x1054, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Attribute Item", "AttributeItemSelector", "1", false},
+   {0x0074, 0x1056, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Occurrence Private", "AttributeOccurrencePrivateCreator", "1", false},
+   {0x0074, 0x1057, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Selector Sequence", "SelectorSequencePointerItems", "1-", false},
+   {0x0074, 0x1200, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Scheduled Procedure", "ScheduledProcedureStepPriority", "1", false},
+   {0x0074, 0x1202, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Worklist Label", "WorklistLabel", "1", false},
+   {0x0074, 0x1204, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Procedure Step", "ProcedureStepLabel", "1", false},
+   {0x0074, 0x1210, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Processing", "ScheduledProcessingParametersSequence", "1", false},
+   {0x0074, 0x1212, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Processing", "PerformedProcessingParametersSequence", "1", false},
+   {0x0074, 0x1216, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Step Performed", "UnifiedProcedureStepPerformedProcedureSequence", "1", false},
+   {0x0074, 0x1220, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Related Procedure", "RelatedProcedureStepSequence", "1", true},
+   {0x0074, 0x1222, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Procedure Step", "ProcedureStepRelationshipType", "1", true},
+   {0x0074, 0x1224, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Replaced Procedure", "ReplacedProcedureStepSequence", "1", false},
+   {0x0074, 0x1230, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Deletion Lock", "DeletionLock", "1", false},
+   {0x0074, 0x1234, 0xffff, 0xffff, {attribute::VR::AE, attribute::VR::NN, attribute::VR::NN}, "Receiving AE", "ReceivingAE", "1", false},
+   {0x0074, 0x1236, 0xffff, 0xffff, {attribute::VR::AE, attribute::VR::NN, attribute::VR::NN}, "Requesting AE", "RequestingAE", "1", false},
+   {0x0074, 0x1238, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Reason for", "ReasonForCancellation", "1", false},
+   {0x0074, 0x1242, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "SCP Status", "SCPStatus", "1", false},
+   {0x0074, 0x1244, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Subscription List", "SubscriptionListStatus", "1", false},
+   {0x0074, 0x1246, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Unified Procedure", "UnifiedProcedureStepListStatus", "1", false},
+   {0x0074, 0x1324, 0xffff, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Beam Order Index", "BeamOrderIndex", "1", false},
+   {0x0074, 0x1338, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Double Exposure", "DoubleExposureMeterset", "1", false},
+   {0x0074, 0x133a, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Double Exposure", "DoubleExposureFieldDelta", "4", false},
+   {0x0076, 0x0001, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Implant Assembly", "ImplantAssemblyTemplateName", "1", false},
+   {0x0076, 0x0003, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Implant Assembly", "ImplantAssemblyTemplateIssuer", "1", false},
+   {0x0076, 0x0006, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Implant Assembly", "ImplantAssemblyTemplateVersion", "1", false},
+   {0x0076, 0x0008, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Assembly Template", "ReplacedImplantAssemblyTemplateSequence", "1", false},
+   {0x0076, 0x000a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Implant Assembly", "ImplantAssemblyTemplateType", "1", false},
+   {0x0076, 0x000c, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Assembly Template", "OriginalImplantAssemblyTemplateSequence", "1", false},
+   {0x0076, 0x000e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Assembly Template", "DerivationImplantAssemblyTemplateSequence", "1", false},
+   {0x0076, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Template Target", "ImplantAssemblyTemplateTargetAnatomySequence", "1", false},
+   {0x0076, 0x0020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Procedure Type Code", "ProcedureTypeCodeSequence", "1", false},
+   {0x0076, 0x0030, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Surgical Technique", "SurgicalTechnique", "1", false},
+   {0x0076, 0x0032, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Component Types", "ComponentTypesSequence", "1", false},
+   {0x0076, 0x0034, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Component Type Code", "ComponentTypeCodeSequence", "1", false},
+   {0x0076, 0x0036, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Exclusive Component", "ExclusiveComponentType", "1", false},
+   {0x0076, 0x0038, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Mandatory Component", "MandatoryComponentType", "1", false},
+   {0x0076, 0x0040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Component Sequence", "ComponentSequence", "1", false},
+   {0x0076, 0x0055, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Component ID", "ComponentID", "1", false},
+   {0x0076, 0x0060, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Component Assembly", "ComponentAssemblySequence", "1", false},
+   {0x0076, 0x0070, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Component 1", "Component1ReferencedID", "1", false},
+   {0x0076, 0x0080, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Referenced Mating", "Component1ReferencedMatingFeatureSetID", "1", false},
+   {0x0076, 0x0090, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Referenced Mating", "Component1ReferencedMatingFeatureID", "1", false},
+   {0x0076, 0x00a0, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Component 2", "Component2ReferencedID", "1", false},
+   {0x0076, 0x00b0, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Referenced Mating", "Component2ReferencedMatingFeatureSetID", "1", false},
+   {0x0076, 0x00c0, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Referenced Mating", "Component2ReferencedMatingFeatureID", "1", false},
+   {0x0078, 0x0001, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Implant Template", "ImplantTemplateGroupName", "1", false},
+   {0x0078, 0x0010, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Implant Template", "ImplantTemplateGroupDescription", "1", false},
+   {0x0078, 0x0020, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Implant Template", "ImplantTemplateGroupIssuer", "1", false},
+   {0x0078, 0x0024, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Implant Template", "ImplantTemplateGroupVersion", "1", false},
+   {0x0078, 0x0026, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Template Group", "ReplacedImplantTemplateGroupSequence", "1", false},
+   {0x0078, 0x0028, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Group Target", "ImplantTemplateGroupTargetAnatomySequence", "1", false},
+   {0x0078, 0x002a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Group Members", "ImplantTemplateGroupMembersSequence", "1", false},
+   {0x0078, 0x002e, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Implant Template", "ImplantTemplateGroupMemberID", "1", false},
+   {0x0078, 0x0050, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Group Member", "ThreeDImplantTemplateGroupMemberMatchingPoint", "3", false},
+   {0x0078, 0x0060, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Group Member", "ThreeDImplantTemplateGroupMemberMatchingAxes", "9", false},
+   {0x0078, 0x0070, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Matching 2D", "ImplantTemplateGroupMemberMatching2DCoordinatesSequence", "1", false},
+   {0x0078, 0x0090, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Group Member", "TwoDImplantTemplateGroupMemberMatchingPoint", "2", false},
+   {0x0078, 0x00a0, 0xffff, 0xffff, {attribute::VR::FD, attribute::VR::NN, attribute::VR::NN}, "Group Member", "TwoDImplantTemplateGroupMemberMatchingAxes", "4", false},
+   {0x0078, 0x00b0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Group Variation", "ImplantTemplateGroupVariationDimensionSequence", "1", false},
+   {0x0078, 0x00b2, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Group Variation", "ImplantTemplateGroupVariationDimensionName", "1", false},
+   {0x0078, 0x00b4, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Group Variation", "ImplantTemplateGroupVariationDimensionRankSequence", "1", false},
+   {0x0078, 0x00b6, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Template Group", "ReferencedImplantTemplateGroupMemberID", "1", false},
+   {0x0078, 0x00b8, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Group Variation", "ImplantTemplateGroupVariationDimensionRank", "1", false},
+   {0x0088, 0x0130, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Storage Media File-", "StorageMediaFileSetID", "1", false},
+   {0x0088, 0x0140, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Storage Media File-", "StorageMediaFileSetUID", "1", false},
+   {0x0088, 0x0200, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Icon Image Sequence", "IconImageSequence", "1", false},
+   {0x0088, 0x0904, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Topic Title", "TopicTitle", "1", true},
+   {0x0088, 0x0906, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Topic Subject", "TopicSubject", "1", true},
+   {0x0088, 0x0910, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Topic Author", "TopicAuthor", "1", true},
+   {0x0088, 0x0912, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Topic Keywords", "TopicKeywords", "1-", true},
+   {0x0100, 0x0410, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "SOP Instance Status", "SOPInstanceStatus", "1", false},
+   {0x0100, 0x0420, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "SOP Authorization", "SOPAuthorizationDateTime", "1", false},
+   {0x0100, 0x0424, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "SOP Authorization", "SOPAuthorizationComment", "1", false},
+   {0x0100, 0x0426, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Equipment", "AuthorizationEquipmentCertificationNumber", "1", false},
+   {0x0400, 0x0005, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "MAC ID Number", "MACIDNumber", "1", false},
+   {0x0400, 0x0010, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "MAC Calculation", "MACCalculationTransferSyntaxUID", "1", false},
+   {0x0400, 0x0015, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "MAC Algorithm", "MACAlgorithm", "1", false},
+   {0x0400, 0x0020, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Data Elements", "DataElementsSigned", "1-", false},
+   {0x0400, 0x0100, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Digital Signature", "DigitalSignatureUID", "1", false},
+   {0x0400, 0x0105, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Digital Signature", "DigitalSignatureDateTime", "1", false},
+   {0x0400, 0x0110, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Certificate Type", "CertificateType", "1", false},
+   {0x0400, 0x0115, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Certificate of", "CertificateOfSigner", "1", false},
+   {0x0400, 0x0120, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Signature", "Signature", "1", false},
+   {0x0400, 0x0305, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Certified Timestamp", "CertifiedTimestampType", "1", false},
+   {0x0400, 0x0310, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Certified Timestamp", "CertifiedTimestamp", "1", false},
+   {0x0400, 0x0401, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Purpose Code", "DigitalSignaturePurposeCodeSequence", "1", false},
+   {0x0400, 0x0402, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Digital", "ReferencedDigitalSignatureSequence", "1", false},
+   {0x0400, 0x0403, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Instance MAC", "ReferencedSOPInstanceMACSequence", "1", false},
+   {0x0400, 0x0404, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "MAC", "MAC", "1", false},
+   {0x0400, 0x0500, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Encrypted", "EncryptedAttributesSequence", "1", false},
+   {0x0400, 0x0510, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Encrypted Content", "EncryptedContentTransferSyntaxUID", "1", false},
+   {0x0400, 0x0520, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Encrypted Content", "EncryptedContent", "1", false},
+   {0x0400, 0x0550, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Modified Attributes", "ModifiedAttributesSequence", "1", false},
+   {0x0400, 0x0561, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Original Attributes", "OriginalAttributesSequence", "1", false},
+   {0x0400, 0x0562, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Modification", "AttributeModificationDateTime", "1", false},
+   {0x0400, 0x0563, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Modifying System", "ModifyingSystem", "1", false},
+   {0x0400, 0x0564, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Source of Previous", "SourceOfPreviousValues", "1", false},
+   {0x0400, 0x0565, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Attribute", "ReasonForTheAttributeModification", "1", false},
+   {0x2000, 0x0010, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Copies", "NumberOfCopies", "1", false},
+   {0x2000, 0x001e, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Configuration", "PrinterConfigurationSequence", "1", false},
+   {0x2000, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Print Priority", "PrintPriority", "1", false},
+   {0x2000, 0x0030, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Medium Type", "MediumType", "1", false},
+   {0x2000, 0x0040, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Film Destination", "FilmDestination", "1", false},
+   {0x2000, 0x0050, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Film Session Label", "FilmSessionLabel", "1", false},
+   {0x2000, 0x0060, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Memory Allocation", "MemoryAllocation", "1", false},
+   {0x2000, 0x0061, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Maximum Memory", "MaximumMemoryAllocation", "1", false},
+   {0x2000, 0x0062, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Color Image", "ColorImagePrintingFlag", "1", true},
+   {0x2000, 0x0063, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Collation Flag", "CollationFlag", "1", true},
+   {0x2000, 0x0065, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Annotation Flag", "AnnotationFlag", "1", true},
+   {0x2000, 0x0067, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Image Overlay Flag", "ImageOverlayFlag", "1", true},
+   {0x2000, 0x0069, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Presentation LUT", "PresentationLUTFlag", "1", true},
+   {0x2000, 0x006a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Presentation LUT", "ImageBoxPresentationLUTFlag", "1", true},
+   {0x2000, 0x00a0, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Memory Bit Depth", "MemoryBitDepth", "1", false},
+   {0x2000, 0x00a1, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Printing Bit Depth", "PrintingBitDepth", "1", false},
+   {0x2000, 0x00a2, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Media Installed", "MediaInstalledSequence", "1", false},
+   {0x2000, 0x00a4, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Other Media", "OtherMediaAvailableSequence", "1", false},
+   {0x2000, 0x00a8, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Display Formats", "SupportedImageDisplayFormatsSequence", "1", false},
+   {0x2000, 0x0500, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Film Box", "ReferencedFilmBoxSequence", "1", false},
+   {0x2000, 0x0510, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Stored", "ReferencedStoredPrintSequence", "1", true},
+   {0x2010, 0x0010, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Image Display", "ImageDisplayFormat", "1", false},
+   {0x2010, 0x0030, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Annotation Display", "AnnotationDisplayFormatID", "1", false},
+   {0x2010, 0x0040, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Film Orientation", "FilmOrientation", "1", false},
+   {0x2010, 0x0050, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Film Size ID", "FilmSizeID", "1", false},
+   {0x2010, 0x0052, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Printer Resolution", "PrinterResolutionID", "1", false},
+   {0x2010, 0x0054, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Default Printer", "DefaultPrinterResolutionID", "1", false},
+   {0x2010, 0x0060, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Magnification Type", "MagnificationType", "1", false},
+   {0x2010, 0x0080, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Smoothing Type", "SmoothingType", "1", false},
+   {0x2010, 0x00a6, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Default", "DefaultMagnificationType", "1", false},
+   {0x2010, 0x00a7, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Other Magnification", "OtherMagnificationTypesAvailable", "1-", false},
+   {0x2010, 0x00a8, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Default Smoothing", "DefaultSmoothingType", "1", false},
+   {0x2010, 0x00a9, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Other Smoothing", "OtherSmoothingTypesAvailable", "1-", false},
+   {0x2010, 0x0100, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Border Density", "BorderDensity", "1", false},
+   {0x2010, 0x0110, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Empty Image Density", "EmptyImageDensity", "1", false},
+   {0x2010, 0x0120, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Min Density", "MinDensity", "1", false},
+   {0x2010, 0x0130, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Max Density", "MaxDensity", "1", false},
+   {0x2010, 0x0140, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Trim", "Trim", "1", false},
+   {0x2010, 0x0150, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Configuration", "ConfigurationInformation", "1", false},
+   {0x2010, 0x0152, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Information", "ConfigurationInformationDescription", "1", false},
+   {0x2010, 0x0154, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Maximum Collated", "MaximumCollatedFilms", "1", false},
+   {0x2010, 0x015e, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Illumination", "Illumination", "1", false},
+   {0x2010, 0x0160, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Reflected Ambient", "ReflectedAmbientLight", "1", false},
+   {0x2010, 0x0376, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Printer Pixel", "PrinterPixelSpacing", "2", false},
+   {0x2010, 0x0500, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Film", "ReferencedFilmSessionSequence", "1", false},
+   {0x2010, 0x0510, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Image", "ReferencedImageBoxSequence", "1", false},
+   {0x2010, 0x0520, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Annotation Box", "ReferencedBasicAnnotationBoxSequence", "1", false},
+   {0x2020, 0x0010, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Box Position", "ImageBoxPosition", "1", false},
+   {0x2020, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Polarity", "Polarity", "1", false},
+   {0x2020, 0x0030, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Requested Image", "RequestedImageSize", "1", false},
+   {0x2020, 0x0040, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Requested Decimate/", "RequestedDecimateCropBehavior", "1", false},
+   {0x2020, 0x0050, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Requested", "RequestedResolutionID", "1", false},
+   {0x2020, 0x00a0, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Requested Image", "RequestedImageSizeFlag", "1", false},
+   {0x2020, 0x00a2, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Decimate/Crop", "DecimateCropResult", "1", false},
+   {0x2020, 0x0110, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Basic Grayscale", "BasicGrayscaleImageSequence", "1", false},
+   {0x2020, 0x0111, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Basic Color Image", "BasicColorImageSequence", "1", false},
+   {0x2020, 0x0130, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Overlay Box", "ReferencedImageOverlayBoxSequence", "1", true},
+   {0x2020, 0x0140, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced VOI LUT", "ReferencedVOILUTBoxSequence", "1", true},
+   {0x2030, 0x0010, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Annotation Position", "AnnotationPosition", "1", false},
+   {0x2030, 0x0020, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Text String", "TextString", "1", false},
+   {0x2040, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Overlay", "ReferencedOverlayPlaneSequence", "1", true},
+   {0x2040, 0x0011, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Referenced Overlay", "ReferencedOverlayPlaneGroups", "1-", true},
+   {0x2040, 0x0020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Overlay Pixel Data", "OverlayPixelDataSequence", "1", true},
+   {0x2040, 0x0060, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay", "OverlayMagnificationType", "1", true},
+   {0x2040, 0x0070, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay Smoothing", "OverlaySmoothingType", "1", true},
+   {0x2040, 0x0072, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay or Image", "OverlayOrImageMagnification", "1", true},
+   {0x2040, 0x0074, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Magnify to Number", "MagnifyToNumberOfColumns", "1", true},
+   {0x2040, 0x0080, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay Foreground", "OverlayForegroundDensity", "1", true},
+   {0x2040, 0x0082, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay Background", "OverlayBackgroundDensity", "1", true},
+   {0x2040, 0x0090, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay Mode", "OverlayMode", "1", true},
+   {0x2040, 0x0100, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Threshold Density", "ThresholdDensity", "1", true},
+   {0x2040, 0x0500, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Box Sequence", "ReferencedImageBoxSequenceRetired", "1", true},
+   {0x2050, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Presentation LUT", "PresentationLUTSequence", "1", false},
+   {0x2050, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Presentation LUT", "PresentationLUTShape", "1", false},
+   {0x2050, 0x0500, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Presentation LUT", "ReferencedPresentationLUTSequence", "1", false},
+   {0x2100, 0x0010, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Print Job ID", "PrintJobID", "1", true},
+   {0x2100, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Execution Status", "ExecutionStatus", "1", false},
+   {0x2100, 0x0030, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Execution Status", "ExecutionStatusInfo", "1", false},
+   {0x2100, 0x0040, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Creation Date", "CreationDate", "1", false},
+   {0x2100, 0x0050, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Creation Time", "CreationTime", "1", false},
+   {0x2100, 0x0070, 0xffff, 0xffff, {attribute::VR::AE, attribute::VR::NN, attribute::VR::NN}, "Originator", "Originator", "1", false},
+   {0x2100, 0x0140, 0xffff, 0xffff, {attribute::VR::AE, attribute::VR::NN, attribute::VR::NN}, "Destination AE", "DestinationAE", "1", true},
+   {0x2100, 0x0160, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Owner ID", "OwnerID", "1", false},
+   {0x2100, 0x0170, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Films", "NumberOfFilms", "1", false},
+   {0x2100, 0x0500, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Job Sequence (Pull", "ReferencedPrintJobSequencePullStoredPrint", "1", true},
+   {0x2110, 0x0010, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Printer Status", "PrinterStatus", "1", false},
+   {0x2110, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Printer Status Info", "PrinterStatusInfo", "1", false},
+   {0x2110, 0x0030, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Printer Name", "PrinterName", "1", false},
+   {0x2110, 0x0099, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Print Queue ID", "PrintQueueID", "1", true},
+   {0x2120, 0x0010, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Queue Status", "QueueStatus", "1", true},
+   {0x2120, 0x0050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Description", "PrintJobDescriptionSequence", "1", true},
+   {0x2120, 0x0070, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Print", "ReferencedPrintJobSequence", "1", true},
+   {0x2130, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Capabilities", "PrintManagementCapabilitiesSequence", "1", true},
+   {0x2130, 0x0015, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Characteristics", "PrinterCharacteristicsSequence", "1", true},
+   {0x2130, 0x0030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Film Box Content", "FilmBoxContentSequence", "1", true},
+   {0x2130, 0x0040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Image Box Content", "ImageBoxContentSequence", "1", true},
+   {0x2130, 0x0050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Annotation Content", "AnnotationContentSequence", "1", true},
+   {0x2130, 0x0060, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Image Overlay Box", "ImageOverlayBoxContentSequence", "1", true},
+   {0x2130, 0x0080, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Presentation LUT", "PresentationLUTContentSequence", "1", true},
+   {0x2130, 0x00a0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Proposed Study", "ProposedStudySequence", "1", true},
+   {0x2130, 0x00c0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Original Image", "OriginalImageSequence", "1", true},
+   {0x2200, 0x0001, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Information", "LabelUsingInformationExtractedFromInstances", "1", false},
+   {0x2200, 0x0002, 0xffff, 0xffff, {attribute::VR::UT, attribute::VR::NN, attribute::VR::NN}, "Label Text", "LabelText", "1", false},
+   {0x2200, 0x0003, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Label Style", "LabelStyleSelection", "1", false},
+   {0x2200, 0x0004, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Media Disposition", "MediaDisposition", "1", false},
+   {0x2200, 0x0005, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Barcode Value", "BarcodeValue", "1", false},
+   {0x2200, 0x0006, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Barcode Symbology", "BarcodeSymbology", "1", false},
+   {0x2200, 0x0007, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Allow Media", "AllowMediaSplitting", "1", false},
+   {0x2200, 0x0008, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Include Non-DICOM", "IncludeNonDICOMObjects", "1", false},
+   {0x2200, 0x0009, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Include Display", "IncludeDisplayApplication", "1", false},
+   {0x2200, 0x000a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Instances After", "PreserveCompositeInstancesAfterMediaCreation", "1", false},
+   {0x2200, 0x000b, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Pieces of Media", "TotalNumberOfPiecesOfMediaCreated", "1", false},
+   {0x2200, 0x000c, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Requested Media", "RequestedMediaApplicationProfile", "1", false},
+   {0x2200, 0x000d, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Storage", "ReferencedStorageMediaSequence", "1", false},
+   {0x2200, 0x000e, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Failure Attributes", "FailureAttributes", "1-", false},
+   {0x2200, 0x000f, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Allow Lossy", "AllowLossyCompression", "1", false},
+   {0x2200, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Request Priority", "RequestPriority", "1", false},
+   {0x3002, 0x0002, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "RT Image Label", "RTImageLabel", "1", false},
+   {0x3002, 0x0003, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "RT Image Name", "RTImageName", "1", false},
+   {0x3002, 0x0004, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "RT Image", "RTImageDescription", "1", false},
+   {0x3002, 0x000a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Reported Values", "ReportedValuesOrigin", "1", false},
+   {0x3002, 0x000c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "RT Image Plane", "RTImagePlane", "1", false},
+   {0x3002, 0x000d, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Receptor", "XRayImageReceptorTranslation", "3", false},
+   {0x3002, 0x000e, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "X-Ray Image", "XRayImageReceptorAngle", "1", false},
+   {0x3002, 0x0010, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "RT Image", "RTImageOrientation", "6", false},
+   {0x3002, 0x0011, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Image Plane Pixel", "ImagePlanePixelSpacing", "2", false},
+   {0x3002, 0x0012, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "RT Image Position", "RTImagePosition", "2", false},
+   {0x3002, 0x0020, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Radiation Machine", "RadiationMachineName", "1", false},
+   {0x3002, 0x0022, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Radiation Machine", "RadiationMachineSAD", "1", false},
+   {0x3002, 0x0024, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Radiation Machine", "RadiationMachineSSD", "1", false},
+   {0x3002, 0x0026, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "RT Image SID", "RTImageSID", "1", false},
+   {0x3002, 0x0028, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Source to Reference", "SourceToReferenceObjectDistance", "1", false},
+   {0x3002, 0x0029, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Fraction Number", "FractionNumber", "1", false},
+   {0x3002, 0x0030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Exposure Sequence", "ExposureSequence", "1", false},
+   {0x3002, 0x0032, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Meterset Exposure", "MetersetExposure", "1", false},
+   {0x3002, 0x0034, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Diaphragm Position", "DiaphragmPosition", "4", false},
+   {0x3002, 0x0040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fluence Map", "FluenceMapSequence", "1", false},
+   {0x3002, 0x0041, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Fluence Data Source", "FluenceDataSource", "1", false},
+   {0x3002, 0x0042, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Fluence Data Scale", "FluenceDataScale", "1", false},
+   {0x3002, 0x0050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Primary Fluence", "PrimaryFluenceModeSequence", "1", false},
+   {0x3002, 0x0051, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Fluence Mode", "FluenceMode", "1", false},
+   {0x3002, 0x0052, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Fluence Mode ID", "FluenceModeID", "1", false},
+   {0x3004, 0x0001, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "DVH Type", "DVHType", "1", false},
+   {0x3004, 0x0002, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Dose Units", "DoseUnits", "1", false},
+   {0x3004, 0x0004, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Dose Type", "DoseType", "1", false},
+   {0x3004, 0x0006, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Dose Comment", "DoseComment", "1", false},
+   {0x3004, 0x0008, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Normalization Point", "NormalizationPoint", "3", false},
+   {0x3004, 0x000a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Dose Summation Type", "DoseSummationType", "1", false},
+   {0x3004, 0x000c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Grid Frame Offset", "GridFrameOffsetVector", "2-", false},
+   {0x3004, 0x000e, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Dose Grid Scaling", "DoseGridScaling", "1", false},
+   {0x3004, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "RT Dose ROI", "RTDoseROISequence", "1", false},
+   {0x3004, 0x0012, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Dose Value", "DoseValue", "1", false},
+   {0x3004, 0x0014, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Heterogeneity", "TissueHeterogeneityCorrection", "3", false},
+   {0x3004, 0x0040, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DVH Normalization", "DVHNormalizationPoint", "3", false},
+   {0x3004, 0x0042, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DVH Normalization", "DVHNormalizationDoseValue", "1", false},
+   {0x3004, 0x0050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "DVH Sequence", "DVHSequence", "1", false},
+   {0x3004, 0x0052, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DVH Dose Scaling", "DVHDoseScaling", "1", false},
+   {0x3004, 0x0054, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "DVH Volume Units", "DVHVolumeUnits", "1", false},
+   {0x3004, 0x0056, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "DVH Number of Bins", "DVHNumberOfBins", "1", false},
+   {0x3004, 0x0058, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DVH Data", "DVHData", "2-", false},
+   {0x3004, 0x0060, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "DVH Referenced ROI", "DVHReferencedROISequence", "1", false},
+   {0x3004, 0x0062, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "DVH ROI", "DVHROIContributionType", "1", false},
+   {0x3004, 0x0070, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DVH Minimum Dose", "DVHMinimumDose", "1", false},
+   {0x3004, 0x0072, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DVH Maximum Dose", "DVHMaximumDose", "1", false},
+   {0x3004, 0x0074, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "DVH Mean Dose", "DVHMeanDose", "1", false},
+   {0x3006, 0x0002, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Structure Set Label", "StructureSetLabel", "1", false},
+   {0x3006, 0x0004, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Structure Set Name", "StructureSetName", "1", false},
+   {0x3006, 0x0006, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Structure Set", "StructureSetDescription", "1", false},
+   {0x3006, 0x0008, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Structure Set Date", "StructureSetDate", "1", false},
+   {0x3006, 0x0009, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Structure Set Time", "StructureSetTime", "1", false},
+   {0x3006, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Frame of", "ReferencedFrameOfReferenceSequence", "1", false},
+   {0x3006, 0x0012, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "RT Referenced Study", "RTReferencedStudySequence", "1", false},
+   {0x3006, 0x0014, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "RT Referenced", "RTReferencedSeriesSequence", "1", false},
+   {0x3006, 0x0016, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Contour Image", "ContourImageSequence", "1", false},
+   {0x3006, 0x0020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Structure Set ROI", "StructureSetROISequence", "1", false},
+   {0x3006, 0x0022, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "ROI Number", "ROINumber", "1", false},
+   {0x3006, 0x0024, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Referenced Frame of", "ReferencedFrameOfReferenceUID", "1", false},
+   {0x3006, 0x0026, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "ROI Name", "ROIName", "1", false},
+   {0x3006, 0x0028, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "ROI Description", "ROIDescription", "1", false},
+   {0x3006, 0x002a, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "ROI Display Color", "ROIDisplayColor", "3", false},
+   {0x3006, 0x002c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "ROI Volume", "ROIVolume", "1", false},
+   {0x3006, 0x0030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "RT Related ROI", "RTRelatedROISequence", "1", false},
+   {0x3006, 0x0033, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "RT ROI Relationship", "RTROIRelationship", "1", false},
+   {0x3006, 0x0036, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "ROI Generation", "ROIGenerationAlgorithm", "1", false},
+   {0x3006, 0x0038, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "ROI Generation", "ROIGenerationDescription", "1", false},
+   {0x3006, 0x0039, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "ROI Contour", "ROIContourSequence", "1", false},
+   {0x3006, 0x0040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Contour Sequence", "ContourSequence", "1", false},
+   {0x3006, 0x0042, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Contour Geometric", "ContourGeometricType", "1", false},
+   {0x3006, 0x0044, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Contour Slab", "ContourSlabThickness", "1", false},
+   {0x3006, 0x0045, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Contour Offset", "ContourOffsetVector", "3", false},
+   {0x3006, 0x0046, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Contour", "NumberOfContourPoints", "1", false},
+   {0x3006, 0x0048, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Contour Number", "ContourNumber", "1", false},
+   {0x3006, 0x0049, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Attached Contours", "AttachedContours", "1-", false},
+   {0x3006, 0x0050, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Contour Data", "ContourData", "3-", false},
+   {0x3006, 0x0080, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "RT ROI Observations", "RTROIObservationsSequence", "1", false},
+   {0x3006, 0x0082, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Observation Number", "ObservationNumber", "1", false},
+   {0x3006, 0x0084, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced ROI", "ReferencedROINumber", "1", false},
+   {0x3006, 0x0085, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "ROI Observation", "ROIObservationLabel", "1", false},
+   {0x3006, 0x0086, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Identification Code", "RTROIIdentificationCodeSequence", "1", false},
+   {0x3006, 0x0088, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "ROI Observation", "ROIObservationDescription", "1", false},
+   {0x3006, 0x00a0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Observations", "RelatedRTROIObservationsSequence", "1", false},
+   {0x3006, 0x00a4, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "RT ROI Interpreted", "RTROIInterpretedType", "1", false},
+   {0x3006, 0x00a6, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "ROI Interpreter", "ROIInterpreter", "1", false},
+   {0x3006, 0x00b0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "ROI Physical", "ROIPhysicalPropertiesSequence", "1", false},
+   {0x3006, 0x00b2, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "ROI Physical", "ROIPhysicalProperty", "1", false},
+   {0x3006, 0x00b4, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "ROI Physical", "ROIPhysicalPropertyValue", "1", false},
+   {0x3006, 0x00b6, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Composition", "ROIElementalCompositionSequence", "1", false},
+   {0x3006, 0x00b7, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Composition Atomic", "ROIElementalCompositionAtomicNumber", "1", false},
+   {0x3006, 0x00b8, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Composition Atomic", "ROIElementalCompositionAtomicMassFraction", "1", false},
+   {0x3006, 0x00c0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Relationship", "FrameOfReferenceRelationshipSequence", "1", false},
+   {0x3006, 0x00c2, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Related Frame of", "RelatedFrameOfReferenceUID", "1", false},
+   {0x3006, 0x00c4, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Frame of Reference", "FrameOfReferenceTransformationType", "1", false},
+   {0x3006, 0x00c6, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Transformation", "FrameOfReferenceTransformationMatrix", "16", false},
+   {0x3006, 0x00c8, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Transformation", "FrameOfReferenceTransformationComment", "1", false},
+   {0x3008, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Measured Dose", "MeasuredDoseReferenceSequence", "1", false},
+   {0x3008, 0x0012, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Measured Dose", "MeasuredDoseDescription", "1", false},
+   {0x3008, 0x0014, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Measured Dose Type", "MeasuredDoseType", "1", false},
+   {0x3008, 0x0016, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Measured Dose Value", "MeasuredDoseValue", "1", false},
+   {0x3008, 0x0020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Treatment Session", "TreatmentSessionBeamSequence", "1", false},
+   {0x3008, 0x0021, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Treatment Session", "TreatmentSessionIonBeamSequence", "1", false},
+   {0x3008, 0x0022, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Current Fraction", "CurrentFractionNumber", "1", false},
+   {0x3008, 0x0024, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Treatment Control", "TreatmentControlPointDate", "1", false},
+   {0x3008, 0x0025, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Treatment Control", "TreatmentControlPointTime", "1", false},
+   {0x3008, 0x002a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Treatment", "TreatmentTerminationStatus", "1", false},
+   {0x3008, 0x002b, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Treatment", "TreatmentTerminationCode", "1", false},
+   {0x3008, 0x002c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Treatment", "TreatmentVerificationStatus", "1", false},
+   {0x3008, 0x0030, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Treatment Record", "ReferencedTreatmentRecordSequence", "1", false},
+   {0x3008, 0x0032, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Specified Primary", "SpecifiedPrimaryMeterset", "1", false},
+   {0x3008, 0x0033, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Specified Secondary", "SpecifiedSecondaryMeterset", "1", false},
+   {0x3008, 0x0036, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Delivered Primary", "DeliveredPrimaryMeterset", "1", false},
+   {0x3008, 0x0037, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Delivered Secondary", "DeliveredSecondaryMeterset", "1", false},
+   {0x3008, 0x003a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Specified Treatment", "SpecifiedTreatmentTime", "1", false},
+   {0x3008, 0x003b, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Delivered Treatment", "DeliveredTreatmentTime", "1", false},
+   {0x3008, 0x0040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Control Point", "ControlPointDeliverySequence", "1", false},
+   {0x3008, 0x0041, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ion Control Point", "IonControlPointDeliverySequence", "1", false},
+   {0x3008, 0x0042, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Specified Meterset", "SpecifiedMeterset", "1", false},
+   {0x3008, 0x0044, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Delivered Meterset", "DeliveredMeterset", "1", false},
+   {0x3008, 0x0045, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Meterset Rate Set", "MetersetRateSet", "1", false},
+   {0x3008, 0x0046, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Meterset Rate", "MetersetRateDelivered", "1", false},
+   {0x3008, 0x0047, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Scan Spot Metersets", "ScanSpotMetersetsDelivered", "1-", false},
+   {0x3008, 0x0048, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Dose Rate Delivered", "DoseRateDelivered", "1", false},
+   {0x3008, 0x0050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Calculated Dose", "TreatmentSummaryCalculatedDoseReferenceSequence", "1", false},
+   {0x3008, 0x0052, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Cumulative Dose to", "CumulativeDoseToDoseReference", "1", false},
+   {0x3008, 0x0054, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "First Treatment", "FirstTreatmentDate", "1", false},
+   {0x3008, 0x0056, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Most Recent", "MostRecentTreatmentDate", "1", false},
+   {0x3008, 0x005a, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Fractions", "NumberOfFractionsDelivered", "1", false},
+   {0x3008, 0x0060, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Override Sequence", "OverrideSequence", "1", false},
+   {0x3008, 0x0061, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Parameter Sequence", "ParameterSequencePointer", "1", false},
+   {0x3008, 0x0062, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Override Parameter", "OverrideParameterPointer", "1", false},
+   {0x3008, 0x0063, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Parameter Item", "ParameterItemIndex", "1", false},
+   {0x3008, 0x0064, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Measured Dose", "MeasuredDoseReferenceNumber", "1", false},
+   {0x3008, 0x0065, 0xffff, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Parameter Pointer", "ParameterPointer", "1", false},
+   {0x3008, 0x0066, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Override Reason", "OverrideReason", "1", false},
+   {0x3008, 0x0068, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Corrected Parameter", "CorrectedParameterSequence", "1", false},
+   {0x3008, 0x006a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Correction Value", "CorrectionValue", "1", false},
+   {0x3008, 0x0070, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Calculated Dose", "CalculatedDoseReferenceSequence", "1", false},
+   {0x3008, 0x0072, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Calculated Dose", "CalculatedDoseReferenceNumber", "1", false},
+   {0x3008, 0x0074, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Reference", "CalculatedDoseReferenceDescription", "1", false},
+   {0x3008, 0x0076, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Reference Dose", "CalculatedDoseReferenceDoseValue", "1", false},
+   {0x3008, 0x0078, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Start Meterset", "StartMeterset", "1", false},
+   {0x3008, 0x007a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "End Meterset", "EndMeterset", "1", false},
+   {0x3008, 0x0080, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Dose Reference", "ReferencedMeasuredDoseReferenceSequence", "1", false},
+   {0x3008, 0x0082, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Dose Reference", "ReferencedMeasuredDoseReferenceNumber", "1", false},
+   {0x3008, 0x0090, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Calculated Dose", "ReferencedCalculatedDoseReferenceSequence", "1", false},
+   {0x3008, 0x0092, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Calculated Dose", "ReferencedCalculatedDoseReferenceNumber", "1", false},
+   {0x3008, 0x00a0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Device Leaf Pairs", "BeamLimitingDeviceLeafPairsSequence", "1", false},
+   {0x3008, 0x00b0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Recorded Wedge", "RecordedWedgeSequence", "1", false},
+   {0x3008, 0x00c0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Compensator", "RecordedCompensatorSequence", "1", false},
+   {0x3008, 0x00d0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Recorded Block", "RecordedBlockSequence", "1", false},
+   {0x3008, 0x00e0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Measured Dose", "TreatmentSummaryMeasuredDoseReferenceSequence", "1", false},
+   {0x3008, 0x00f0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Recorded Snout", "RecordedSnoutSequence", "1", false},
+   {0x3008, 0x00f2, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Recorded Range", "RecordedRangeShifterSequence", "1", false},
+   {0x3008, 0x00f4, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Spreading Device", "RecordedLateralSpreadingDeviceSequence", "1", false},
+   {0x3008, 0x00f6, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Recorded Range", "RecordedRangeModulatorSequence", "1", false},
+   {0x3008, 0x0100, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Recorded Source", "RecordedSourceSequence", "1", false},
+   {0x3008, 0x0105, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Source Serial", "SourceSerialNumber", "1", false},
+   {0x3008, 0x0110, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Application Setup", "TreatmentSessionApplicationSetupSequence", "1", false},
+   {0x3008, 0x0116, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Application Setup", "ApplicationSetupCheck", "1", false},
+   {0x3008, 0x0120, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Accessory Device", "RecordedBrachyAccessoryDeviceSequence", "1", false},
+   {0x3008, 0x0122, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Accessory Device", "ReferencedBrachyAccessoryDeviceNumber", "1", false},
+   {0x3008, 0x0130, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Recorded Channel", "RecordedChannelSequence", "1", false},
+   {0x3008, 0x0132, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Specified Channel", "SpecifiedChannelTotalTime", "1", false},
+   {0x3008, 0x0134, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Delivered Channel", "DeliveredChannelTotalTime", "1", false},
+   {0x3008, 0x0136, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Specified Number of", "SpecifiedNumberOfPulses", "1", false},
+   {0x3008, 0x0138, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Delivered Number of", "DeliveredNumberOfPulses", "1", false},
+   {0x3008, 0x013a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Specified Pulse", "SpecifiedPulseRepetitionInterval", "1", false},
+   {0x3008, 0x013c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Delivered Pulse", "DeliveredPulseRepetitionInterval", "1", false},
+   {0x3008, 0x0140, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Recorded Source", "RecordedSourceApplicatorSequence", "1", false},
+   {0x3008, 0x0142, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Source", "ReferencedSourceApplicatorNumber", "1", false},
+   {0x3008, 0x0150, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Recorded Channel", "RecordedChannelShieldSequence", "1", false},
+   {0x3008, 0x0152, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Channel", "ReferencedChannelShieldNumber", "1", false},
+   {0x3008, 0x0160, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Point Delivered", "BrachyControlPointDeliveredSequence", "1", false},
+   {0x3008, 0x0162, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Safe Position Exit", "SafePositionExitDate", "1", false},
+   {0x3008, 0x0164, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Safe Position Exit", "SafePositionExitTime", "1", false},
+   {0x3008, 0x0166, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Safe Position", "SafePositionReturnDate", "1", false},
+   {0x3008, 0x0168, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Safe Position", "SafePositionReturnTime", "1", false},
+   {0x3008, 0x0200, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Current Treatment", "CurrentTreatmentStatus", "1", false},
+   {0x3008, 0x0202, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Treatment Status", "TreatmentStatusComment", "1", false},
+   {0x3008, 0x0220, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fraction Group", "FractionGroupSummarySequence", "1", false},
+   {0x3008, 0x0223, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Fraction", "ReferencedFractionNumber", "1", false},
+   {0x3008, 0x0224, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Fraction Group Type", "FractionGroupType", "1", false},
+   {0x3008, 0x0230, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Beam Stopper", "BeamStopperPosition", "1", false},
+   {0x3008, 0x0240, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fraction Status", "FractionStatusSummarySequence", "1", false},
+   {0x3008, 0x0250, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Treatment Date", "TreatmentDate", "1", false},
+   {0x3008, 0x0251, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Treatment Time", "TreatmentTime", "1", false},
+   {0x300a, 0x0002, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "RT Plan Label", "RTPlanLabel", "1", false},
+   {0x300a, 0x0003, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "RT Plan Name", "RTPlanName", "1", false},
+   {0x300a, 0x0004, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "RT Plan Description", "RTPlanDescription", "1", false},
+   {0x300a, 0x0006, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "RT Plan Date", "RTPlanDate", "1", false},
+   {0x300a, 0x0007, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "RT Plan Time", "RTPlanTime", "1", false},
+   {0x300a, 0x0009, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Treatment Protocols", "TreatmentProtocols", "1-", false},
+   {0x300a, 0x000a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Plan Intent", "PlanIntent", "1", false},
+   {0x300a, 0x000b, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Treatment Sites", "TreatmentSites", "1-", false},
+   {0x300a, 0x000c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "RT Plan Geometry", "RTPlanGeometry", "1", false},
+   {0x300a, 0x000e, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Prescription", "PrescriptionDescription", "1", false},
+   {0x300a, 0x0010, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Dose Reference", "DoseReferenceSequence", "1", false},
+   {0x300a, 0x0012, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Dose Reference", "DoseReferenceNumber", "1", false},
+   {0x300a, 0x0013, 0xffff, 0xffff, {attribute::VR::UI, attribute::VR::NN, attribute::VR::NN}, "Dose Reference UID", "DoseReferenceUID", "1", false},
+   {0x300a, 0x0014, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Dose Reference", "DoseReferenceStructureType", "1", false},
+   {0x300a, 0x0015, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Nominal Beam Energy", "NominalBeamEnergyUnit", "1", false},
+   {0x300a, 0x0016, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Dose Reference", "DoseReferenceDescription", "1", false},
+   {0x300a, 0x0018, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Dose Reference", "DoseReferencePointCoordinates", "3", false},
+   {0x300a, 0x001a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Nominal Prior Dose", "NominalPriorDose", "1", false},
+   {0x300a, 0x0020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Dose Reference Type", "DoseReferenceType", "1", false},
+   {0x300a, 0x0021, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Constraint Weight", "ConstraintWeight", "1", false},
+   {0x300a, 0x0022, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Delivery Warning", "DeliveryWarningDose", "1", false},
+   {0x300a, 0x0023, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Delivery Maximum", "DeliveryMaximumDose", "1", false},
+   {0x300a, 0x0025, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Target Minimum Dose", "TargetMinimumDose", "1", false},
+   {0x300a, 0x0026, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Target Prescription", "TargetPrescriptionDose", "1", false},
+   {0x300a, 0x0027, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Target Maximum Dose", "TargetMaximumDose", "1", false},
+   {0x300a, 0x0028, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Target Underdose", "TargetUnderdoseVolumeFraction", "1", false},
+   {0x300a, 0x002a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Organ at Risk Full-", "OrganAtRiskFullVolumeDose", "1", false},
+   {0x300a, 0x002b, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Organ at Risk Limit", "OrganAtRiskLimitDose", "1", false},
+   {0x300a, 0x002c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Organ at Risk", "OrganAtRiskMaximumDose", "1", false},
+   {0x300a, 0x002d, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Overdose Volume", "OrganAtRiskOverdoseVolumeFraction", "1", false},
+   {0x300a, 0x0040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Tolerance Table", "ToleranceTableSequence", "1", false},
+   {0x300a, 0x0042, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Tolerance Table", "ToleranceTableNumber", "1", false},
+   {0x300a, 0x0043, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Tolerance Table", "ToleranceTableLabel", "1", false},
+   {0x300a, 0x0044, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Gantry Angle", "GantryAngleTolerance", "1", false},
+   {0x300a, 0x0046, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Device Angle", "BeamLimitingDeviceAngleTolerance", "1", false},
+   {0x300a, 0x0048, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Device Tolerance", "BeamLimitingDeviceToleranceSequence", "1", false},
+   {0x300a, 0x004a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Device Position", "BeamLimitingDevicePositionTolerance", "1", false},
+   {0x300a, 0x004b, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Snout Position", "SnoutPositionTolerance", "1", false},
+   {0x300a, 0x004c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Patient Support", "PatientSupportAngleTolerance", "1", false},
+   {0x300a, 0x004e, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Top Eccentric", "TableTopEccentricAngleTolerance", "1", false},
+   {0x300a, 0x004f, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table Top Pitch", "TableTopPitchAngleTolerance", "1", false},
+   {0x300a, 0x0050, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table Top Roll", "TableTopRollAngleTolerance", "1", false},
+   {0x300a, 0x0051, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Top Vertical", "TableTopVerticalPositionTolerance", "1", false},
+   {0x300a, 0x0052, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Longitudinal", "TableTopLongitudinalPositionTolerance", "1", false},
+   {0x300a, 0x0053, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Top Lateral", "TableTopLateralPositionTolerance", "1", false},
+   {0x300a, 0x0055, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "RT Plan", "RTPlanRelationship", "1", false},
+   {0x300a, 0x0070, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fraction Group", "FractionGroupSequence", "1", false},
+   {0x300a, 0x0071, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Fraction Group", "FractionGroupNumber", "1", false},
+   {0x300a, 0x0072, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Fraction Group", "FractionGroupDescription", "1", false},
+   {0x300a, 0x0078, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Fractions", "NumberOfFractionsPlanned", "1", false},
+   {0x300a, 0x0079, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Pattern Digits Per", "NumberOfFractionPatternDigitsPerDay", "1", false},
+   {0x300a, 0x007a, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Repeat Fraction", "RepeatFractionCycleLength", "1", false},
+   {0x300a, 0x007b, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Fraction Pattern", "FractionPattern", "1", false},
+   {0x300a, 0x0080, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Beams", "NumberOfBeams", "1", false},
+   {0x300a, 0x0082, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Beam Dose", "BeamDoseSpecificationPoint", "3", false},
+   {0x300a, 0x0084, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Beam Dose", "BeamDose", "1", false},
+   {0x300a, 0x0086, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Beam Meterset", "BeamMeterset", "1", false},
+   {0x300a, 0x0088, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Beam Dose Point", "BeamDosePointDepth", "1", false},
+   {0x300a, 0x0089, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Beam Dose Point", "BeamDosePointEquivalentDepth", "1", false},
+   {0x300a, 0x008a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Beam Dose Point SSD", "BeamDosePointSSD", "1", false},
+   {0x300a, 0x00a0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Brachy", "NumberOfBrachyApplicationSetups", "1", false},
+   {0x300a, 0x00a2, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Setup Dose", "BrachyApplicationSetupDoseSpecificationPoint", "3", false},
+   {0x300a, 0x00a4, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Brachy Application", "BrachyApplicationSetupDose", "1", false},
+   {0x300a, 0x00b0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Beam Sequence", "BeamSequence", "1", false},
+   {0x300a, 0x00b2, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Treatment Machine", "TreatmentMachineName", "1", false},
+   {0x300a, 0x00b3, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Primary Dosimeter", "PrimaryDosimeterUnit", "1", false},
+   {0x300a, 0x00b4, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Source-Axis", "SourceAxisDistance", "1", false},
+   {0x300a, 0x00b6, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Beam Limiting", "BeamLimitingDeviceSequence", "1", false},
+   {0x300a, 0x00b8, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "RT Beam Limiting", "RTBeamLimitingDeviceType", "1", false},
+   {0x300a, 0x00ba, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Limiting Device", "SourceToBeamLimitingDeviceDistance", "1", false},
+   {0x300a, 0x00bb, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Limiting Device", "IsocenterToBeamLimitingDeviceDistance", "1", false},
+   {0x300a, 0x00bc, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Leaf/Jaw", "NumberOfLeafJawPairs", "1", false},
+   {0x300a, 0x00be, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Leaf Position", "LeafPositionBoundaries", "3-", false},
+   {0x300a, 0x00c0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Beam Number", "BeamNumber", "1", false},
+   {0x300a, 0x00c2, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Beam Name", "BeamName", "1", false},
+   {0x300a, 0x00c3, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Beam Description", "BeamDescription", "1", false},
+   {0x300a, 0x00c4, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Beam Type", "BeamType", "1", false},
+   {0x300a, 0x00c6, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Radiation Type", "RadiationType", "1", false},
+   {0x300a, 0x00c7, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "High-Dose Technique", "HighDoseTechniqueType", "1", false},
+   {0x300a, 0x00c8, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Reference Image", "ReferenceImageNumber", "1", false},
+   {0x300a, 0x00ca, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Verification Image", "PlannedVerificationImageSequence", "1", false},
+   {0x300a, 0x00cc, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Specific", "ImagingDeviceSpecificAcquisitionParameters", "1-", false},
+   {0x300a, 0x00ce, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Treatment Delivery", "TreatmentDeliveryType", "1", false},
+   {0x300a, 0x00d0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Wedges", "NumberOfWedges", "1", false},
+   {0x300a, 0x00d1, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Wedge Sequence", "WedgeSequence", "1", false},
+   {0x300a, 0x00d2, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Wedge Number", "WedgeNumber", "1", false},
+   {0x300a, 0x00d3, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Wedge Type", "WedgeType", "1", false},
+   {0x300a, 0x00d4, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Wedge ID", "WedgeID", "1", false},
+   {0x300a, 0x00d5, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Wedge Angle", "WedgeAngle", "1", false},
+   {0x300a, 0x00d6, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Wedge Factor", "WedgeFactor", "1", false},
+   {0x300a, 0x00d7, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Water-Equivalent", "TotalWedgeTrayWaterEquivalentThickness", "1", false},
+   {0x300a, 0x00d8, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Wedge Orientation", "WedgeOrientation", "1", false},
+   {0x300a, 0x00d9, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Isocenter to Wedge", "IsocenterToWedgeTrayDistance", "1", false},
+   {0x300a, 0x00da, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Source to Wedge", "SourceToWedgeTrayDistance", "1", false},
+   {0x300a, 0x00db, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Wedge Thin Edge", "WedgeThinEdgePosition", "1", false},
+   {0x300a, 0x00dc, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Bolus ID", "BolusID", "1", false},
+   {0x300a, 0x00dd, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Bolus Description", "BolusDescription", "1", false},
+   {0x300a, 0x00e0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of", "NumberOfCompensators", "1", false},
+   {0x300a, 0x00e1, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Material ID", "MaterialID", "1", false},
+   {0x300a, 0x00e2, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Total Compensator", "TotalCompensatorTrayFactor", "1", false},
+   {0x300a, 0x00e3, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Compensator", "CompensatorSequence", "1", false},
+   {0x300a, 0x00e4, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Compensator Number", "CompensatorNumber", "1", false},
+   {0x300a, 0x00e5, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Compensator ID", "CompensatorID", "1", false},
+   {0x300a, 0x00e6, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Compensator Tray", "SourceToCompensatorTrayDistance", "1", false},
+   {0x300a, 0x00e7, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Compensator Rows", "CompensatorRows", "1", false},
+   {0x300a, 0x00e8, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Compensator Columns", "CompensatorColumns", "1", false},
+   {0x300a, 0x00e9, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Compensator Pixel", "CompensatorPixelSpacing", "2", false},
+   {0x300a, 0x00ea, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Compensator", "CompensatorPosition", "2", false},
+   {0x300a, 0x00eb, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Compensator", "CompensatorTransmissionData", "1-", false},
+   {0x300a, 0x00ec, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Compensator", "CompensatorThicknessData", "1-", false},
+   {0x300a, 0x00ed, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Boli", "NumberOfBoli", "1", false},
+   {0x300a, 0x00ee, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compensator Type", "CompensatorType", "1", false},
+   {0x300a, 0x00f0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Blocks", "NumberOfBlocks", "1", false},
+   {0x300a, 0x00f2, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Total Block Tray", "TotalBlockTrayFactor", "1", false},
+   {0x300a, 0x00f3, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Water-Equivalent", "TotalBlockTrayWaterEquivalentThickness", "1", false},
+   {0x300a, 0x00f4, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Block Sequence", "BlockSequence", "1", false},
+   {0x300a, 0x00f5, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Block Tray ID", "BlockTrayID", "1", false},
+   {0x300a, 0x00f6, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Source to Block", "SourceToBlockTrayDistance", "1", false},
+   {0x300a, 0x00f7, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Isocenter to Block", "IsocenterToBlockTrayDistance", "1", false},
+   {0x300a, 0x00f8, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Block Type", "BlockType", "1", false},
+   {0x300a, 0x00f9, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Accessory Code", "AccessoryCode", "1", false},
+   {0x300a, 0x00fa, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Block Divergence", "BlockDivergence", "1", false},
+   {0x300a, 0x00fb, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Block Mounting", "BlockMountingPosition", "1", false},
+   {0x300a, 0x00fc, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Block Number", "BlockNumber", "1", false},
+   {0x300a, 0x00fe, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Block Name", "BlockName", "1", false},
+   {0x300a, 0x0100, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Block Thickness", "BlockThickness", "1", false},
+   {0x300a, 0x0102, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Block Transmission", "BlockTransmission", "1", false},
+   {0x300a, 0x0104, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Block Number of", "BlockNumberOfPoints", "1", false},
+   {0x300a, 0x0106, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Block Data", "BlockData", "2-", false},
+   {0x300a, 0x0107, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Applicator Sequence", "ApplicatorSequence", "1", false},
+   {0x300a, 0x0108, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Applicator ID", "ApplicatorID", "1", false},
+   {0x300a, 0x0109, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Applicator Type", "ApplicatorType", "1", false},
+   {0x300a, 0x010a, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Applicator", "ApplicatorDescription", "1", false},
+   {0x300a, 0x010c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Reference", "CumulativeDoseReferenceCoefficient", "1", false},
+   {0x300a, 0x010e, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Final Cumulative", "FinalCumulativeMetersetWeight", "1", false},
+   {0x300a, 0x0110, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Control", "NumberOfControlPoints", "1", false},
+   {0x300a, 0x0111, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Control Point", "ControlPointSequence", "1", false},
+   {0x300a, 0x0112, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Control Point Index", "ControlPointIndex", "1", false},
+   {0x300a, 0x0114, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Nominal Beam Energy", "NominalBeamEnergy", "1", false},
+   {0x300a, 0x0115, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Dose Rate Set", "DoseRateSet", "1", false},
+   {0x300a, 0x0116, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Wedge Position", "WedgePositionSequence", "1", false},
+   {0x300a, 0x0118, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Wedge Position", "WedgePosition", "1", false},
+   {0x300a, 0x011a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Device Position", "BeamLimitingDevicePositionSequence", "1", false},
+   {0x300a, 0x011c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Leaf/Jaw Positions", "LeafJawPositions", "2-", false},
+   {0x300a, 0x011e, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Gantry Angle", "GantryAngle", "1", false},
+   {0x300a, 0x011f, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Gantry Rotation", "GantryRotationDirection", "1", false},
+   {0x300a, 0x0120, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Beam Limiting", "BeamLimitingDeviceAngle", "1", false},
+   {0x300a, 0x0121, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Device Rotation", "BeamLimitingDeviceRotationDirection", "1", false},
+   {0x300a, 0x0122, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Patient Support", "PatientSupportAngle", "1", false},
+   {0x300a, 0x0123, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patient Support", "PatientSupportRotationDirection", "1", false},
+   {0x300a, 0x0124, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Top Eccentric", "TableTopEccentricAxisDistance", "1", false},
+   {0x300a, 0x0125, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Top Eccentric", "TableTopEccentricAngle", "1", false},
+   {0x300a, 0x0126, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Table Top Eccentric", "TableTopEccentricRotationDirection", "1", false},
+   {0x300a, 0x0128, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Top Vertical", "TableTopVerticalPosition", "1", false},
+   {0x300a, 0x0129, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Longitudinal", "TableTopLongitudinalPosition", "1", false},
+   {0x300a, 0x012a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Top Lateral", "TableTopLateralPosition", "1", false},
+   {0x300a, 0x012c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Isocenter Position", "IsocenterPosition", "3", false},
+   {0x300a, 0x012e, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Surface Entry Point", "SurfaceEntryPoint", "3", false},
+   {0x300a, 0x0130, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Source to Surface", "SourceToSurfaceDistance", "1", false},
+   {0x300a, 0x0134, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Cumulative Meterset", "CumulativeMetersetWeight", "1", false},
+   {0x300a, 0x0140, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table Top Pitch", "TableTopPitchAngle", "1", false},
+   {0x300a, 0x0142, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Table Top Pitch", "TableTopPitchRotationDirection", "1", false},
+   {0x300a, 0x0144, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Table Top Roll", "TableTopRollAngle", "1", false},
+   {0x300a, 0x0146, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Table Top Roll", "TableTopRollRotationDirection", "1", false},
+   {0x300a, 0x0148, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Head Fixation Angle", "HeadFixationAngle", "1", false},
+   {0x300a, 0x014a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Gantry Pitch Angle", "GantryPitchAngle", "1", false},
+   {0x300a, 0x014c, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Gantry Pitch", "GantryPitchRotationDirection", "1", false},
+   {0x300a, 0x014e, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Gantry Pitch Angle", "GantryPitchAngleTolerance", "1", false},
+   {0x300a, 0x0180, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Patient Setup", "PatientSetupSequence", "1", false},
+   {0x300a, 0x0182, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Patient Setup", "PatientSetupNumber", "1", false},
+   {0x300a, 0x0183, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patient Setup Label", "PatientSetupLabel", "1", false},
+   {0x300a, 0x0184, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patient Additional", "PatientAdditionalPosition", "1", false},
+   {0x300a, 0x0190, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Fixation Device", "FixationDeviceSequence", "1", false},
+   {0x300a, 0x0192, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Fixation Device", "FixationDeviceType", "1", false},
+   {0x300a, 0x0194, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Fixation Device", "FixationDeviceLabel", "1", false},
+   {0x300a, 0x0196, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Fixation Device", "FixationDeviceDescription", "1", false},
+   {0x300a, 0x0198, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Fixation Device", "FixationDevicePosition", "1", false},
+   {0x300a, 0x0199, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Fixation Device", "FixationDevicePitchAngle", "1", false},
+   {0x300a, 0x019a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Fixation Device", "FixationDeviceRollAngle", "1", false},
+   {0x300a, 0x01a0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Shielding Device", "ShieldingDeviceSequence", "1", false},
+   {0x300a, 0x01a2, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Shielding Device", "ShieldingDeviceType", "1", false},
+   {0x300a, 0x01a4, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Shielding Device", "ShieldingDeviceLabel", "1", false},
+   {0x300a, 0x01a6, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Shielding Device", "ShieldingDeviceDescription", "1", false},
+   {0x300a, 0x01a8, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Shielding Device", "ShieldingDevicePosition", "1", false},
+   {0x300a, 0x01b0, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Setup Technique", "SetupTechnique", "1", false},
+   {0x300a, 0x01b2, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Setup Technique", "SetupTechniqueDescription", "1", false},
+   {0x300a, 0x01b4, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Setup Device", "SetupDeviceSequence", "1", false},
+   {0x300a, 0x01b6, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Setup Device Type", "SetupDeviceType", "1", false},
+   {0x300a, 0x01b8, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Setup Device Label", "SetupDeviceLabel", "1", false},
+   {0x300a, 0x01ba, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Setup Device", "SetupDeviceDescription", "1", false},
+   {0x300a, 0x01bc, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Setup Device", "SetupDeviceParameter", "1", false},
+   {0x300a, 0x01d0, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Setup Reference", "SetupReferenceDescription", "1", false},
+   {0x300a, 0x01d2, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Top Vertical", "TableTopVerticalSetupDisplacement", "1", false},
+   {0x300a, 0x01d4, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Longitudinal Setup", "TableTopLongitudinalSetupDisplacement", "1", false},
+   {0x300a, 0x01d6, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Table Top Lateral", "TableTopLateralSetupDisplacement", "1", false},
+   {0x300a, 0x0200, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Brachy Treatment", "BrachyTreatmentTechnique", "1", false},
+   {0x300a, 0x0202, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Brachy Treatment", "BrachyTreatmentType", "1", false},
+   {0x300a, 0x0206, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Treatment Machine", "TreatmentMachineSequence", "1", false},
+   {0x300a, 0x0210, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Source Sequence", "SourceSequence", "1", false},
+   {0x300a, 0x0212, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Source Number", "SourceNumber", "1", false},
+   {0x300a, 0x0214, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Source Type", "SourceType", "1", false},
+   {0x300a, 0x0216, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Source Manufacturer", "SourceManufacturer", "1", false},
+   {0x300a, 0x0218, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Active Source", "ActiveSourceDiameter", "1", false},
+   {0x300a, 0x021a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Active Source", "ActiveSourceLength", "1", false},
+   {0x300a, 0x0222, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Encapsulation", "SourceEncapsulationNominalThickness", "1", false},
+   {0x300a, 0x0224, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Encapsulation", "SourceEncapsulationNominalTransmission", "1", false},
+   {0x300a, 0x0226, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Source Isotope Name", "SourceIsotopeName", "1", false},
+   {0x300a, 0x0228, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Source Isotope Half", "SourceIsotopeHalfLife", "1", false},
+   {0x300a, 0x0229, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Source Strength", "SourceStrengthUnits", "1", false},
+   {0x300a, 0x022a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Reference Air Kerma", "ReferenceAirKermaRate", "1", false},
+   {0x300a, 0x022b, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Source Strength", "SourceStrength", "1", false},
+   {0x300a, 0x022c, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Source Strength", "SourceStrengthReferenceDate", "1", false},
+   {0x300a, 0x022e, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Source Strength", "SourceStrengthReferenceTime", "1", false},
+   {0x300a, 0x0230, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Application Setup", "ApplicationSetupSequence", "1", false},
+   {0x300a, 0x0232, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Application Setup", "ApplicationSetupType", "1", false},
+   {0x300a, 0x0234, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Application Setup", "ApplicationSetupNumber", "1", false},
+   {0x300a, 0x0236, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Application Setup", "ApplicationSetupName", "1", false},
+   {0x300a, 0x0238, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Application Setup", "ApplicationSetupManufacturer", "1", false},
+   {0x300a, 0x0240, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Template Number", "TemplateNumber", "1", false},
+   {0x300a, 0x0242, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Template Type", "TemplateType", "1", false},
+   {0x300a, 0x0244, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Template Name", "TemplateName", "1", false},
+   {0x300a, 0x0250, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Total Reference Air", "TotalReferenceAirKerma", "1", false},
+   {0x300a, 0x0260, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Brachy Accessory", "BrachyAccessoryDeviceSequence", "1", false},
+   {0x300a, 0x0262, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Brachy Accessory", "BrachyAccessoryDeviceNumber", "1", false},
+   {0x300a, 0x0263, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Brachy Accessory", "BrachyAccessoryDeviceID", "1", false},
+   {0x300a, 0x0264, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Brachy Accessory", "BrachyAccessoryDeviceType", "1", false},
+   {0x300a, 0x0266, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Brachy Accessory", "BrachyAccessoryDeviceName", "1", false},
+   {0x300a, 0x026a, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Device Nominal", "BrachyAccessoryDeviceNominalThickness", "1", false},
+   {0x300a, 0x026c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Device Nominal", "BrachyAccessoryDeviceNominalTransmission", "1", false},
+   {0x300a, 0x0280, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Channel Sequence", "ChannelSequence", "1", false},
+   {0x300a, 0x0282, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Channel Number", "ChannelNumber", "1", false},
+   {0x300a, 0x0284, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Channel Length", "ChannelLength", "1", false},
+   {0x300a, 0x0286, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Channel Total Time", "ChannelTotalTime", "1", false},
+   {0x300a, 0x0288, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Source Movement", "SourceMovementType", "1", false},
+   {0x300a, 0x028a, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Pulses", "NumberOfPulses", "1", false},
+   {0x300a, 0x028c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Pulse Repetition", "PulseRepetitionInterval", "1", false},
+   {0x300a, 0x0290, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Source Applicator", "SourceApplicatorNumber", "1", false},
+   {0x300a, 0x0291, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Source Applicator", "SourceApplicatorID", "1", false},
+   {0x300a, 0x0292, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Source Applicator", "SourceApplicatorType", "1", false},
+   {0x300a, 0x0294, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Source Applicator", "SourceApplicatorName", "1", false},
+   {0x300a, 0x0296, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Source Applicator", "SourceApplicatorLength", "1", false},
+   {0x300a, 0x0298, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Source Applicator", "SourceApplicatorManufacturer", "1", false},
+   {0x300a, 0x029c, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Wall Nominal", "SourceApplicatorWallNominalThickness", "1", false},
+   {0x300a, 0x029e, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Wall Nominal", "SourceApplicatorWallNominalTransmission", "1", false},
+   {0x300a, 0x02a0, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Source Applicator", "SourceApplicatorStepSize", "1", false},
+   {0x300a, 0x02a2, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Transfer Tube", "TransferTubeNumber", "1", false},
+   {0x300a, 0x02a4, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Transfer Tube", "TransferTubeLength", "1", false},
+   {0x300a, 0x02b0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Channel Shield", "ChannelShieldSequence", "1", false},
+   {0x300a, 0x02b2, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Channel Shield", "ChannelShieldNumber", "1", false},
+   {0x300a, 0x02b3, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Channel Shield ID", "ChannelShieldID", "1", false},
+   {0x300a, 0x02b4, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Channel Shield Name", "ChannelShieldName", "1", false},
+   {0x300a, 0x02b8, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Channel Shield", "ChannelShieldNominalThickness", "1", false},
+   {0x300a, 0x02ba, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Nominal", "ChannelShieldNominalTransmission", "1", false},
+   {0x300a, 0x02c8, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Final Cumulative", "FinalCumulativeTimeWeight", "1", false},
+   {0x300a, 0x02d0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Brachy Control", "BrachyControlPointSequence", "1", false},
+   {0x300a, 0x02d2, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Control Point", "ControlPointRelativePosition", "1", false},
+   {0x300a, 0x02d4, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Control Point 3D", "ControlPoint3DPosition", "3", false},
+   {0x300a, 0x02d6, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Cumulative Time", "CumulativeTimeWeight", "1", false},
+   {0x300a, 0x02e0, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compensator", "CompensatorDivergence", "1", false},
+   {0x300a, 0x02e1, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compensator", "CompensatorMountingPosition", "1", false},
+   {0x300a, 0x02e2, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Compensator", "SourceToCompensatorDistance", "n", false},
+   {0x300a, 0x02e3, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Tray Water-", "TotalCompensatorTrayWaterEquivalentThickness", "1", false},
+   {0x300a, 0x02e4, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Compensator Tray", "IsocenterToCompensatorTrayDistance", "1", false},
+   {0x300a, 0x02e5, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Compensator Column", "CompensatorColumnOffset", "1", false},
+   {0x300a, 0x02e6, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Compensator", "IsocenterToCompensatorDistances", "n", false},
+   {0x300a, 0x02e7, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Relative Stopping", "CompensatorRelativeStoppingPowerRatio", "1", false},
+   {0x300a, 0x02e8, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Compensator Milling", "CompensatorMillingToolDiameter", "1", false},
+   {0x300a, 0x02ea, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Compensator", "IonRangeCompensatorSequence", "1", false},
+   {0x300a, 0x02eb, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Compensator", "CompensatorDescription", "1", false},
+   {0x300a, 0x0302, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Radiation Mass", "RadiationMassNumber", "1", false},
+   {0x300a, 0x0304, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Radiation Atomic", "RadiationAtomicNumber", "1", false},
+   {0x300a, 0x0306, 0xffff, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Radiation Charge", "RadiationChargeState", "1", false},
+   {0x300a, 0x0308, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Scan Mode", "ScanMode", "1", false},
+   {0x300a, 0x030a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Virtual Source-Axis", "VirtualSourceAxisDistances", "2", false},
+   {0x300a, 0x030c, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Snout Sequence", "SnoutSequence", "1", false},
+   {0x300a, 0x030d, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Snout Position", "SnoutPosition", "1", false},
+   {0x300a, 0x030f, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Snout ID", "SnoutID", "1", false},
+   {0x300a, 0x0312, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Range", "NumberOfRangeShifters", "1", false},
+   {0x300a, 0x0314, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Range Shifter", "RangeShifterSequence", "1", false},
+   {0x300a, 0x0316, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Range Shifter", "RangeShifterNumber", "1", false},
+   {0x300a, 0x0318, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Range Shifter ID", "RangeShifterID", "1", false},
+   {0x300a, 0x0320, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Range Shifter Type", "RangeShifterType", "1", false},
+   {0x300a, 0x0322, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Range Shifter", "RangeShifterDescription", "1", false},
+   {0x300a, 0x0330, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Lateral", "NumberOfLateralSpreadingDevices", "1", false},
+   {0x300a, 0x0332, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Lateral Spreading", "LateralSpreadingDeviceSequence", "1", false},
+   {0x300a, 0x0334, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Lateral Spreading", "LateralSpreadingDeviceNumber", "1", false},
+   {0x300a, 0x0336, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Lateral Spreading", "LateralSpreadingDeviceID", "1", false},
+   {0x300a, 0x0338, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Lateral Spreading", "LateralSpreadingDeviceType", "1", false},
+   {0x300a, 0x033a, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Lateral Spreading", "LateralSpreadingDeviceDescription", "1", false},
+   {0x300a, 0x033c, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Device Water", "LateralSpreadingDeviceWaterEquivalentThickness", "1", false},
+   {0x300a, 0x0340, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Range", "NumberOfRangeModulators", "1", false},
+   {0x300a, 0x0342, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Range Modulator", "RangeModulatorSequence", "1", false},
+   {0x300a, 0x0344, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Range Modulator", "RangeModulatorNumber", "1", false},
+   {0x300a, 0x0346, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Range Modulator ID", "RangeModulatorID", "1", false},
+   {0x300a, 0x0348, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Range Modulator", "RangeModulatorType", "1", false},
+   {0x300a, 0x034a, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Range Modulator", "RangeModulatorDescription", "1", false},
+   {0x300a, 0x034c, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Beam Current", "BeamCurrentModulationID", "1", false},
+   {0x300a, 0x0350, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Patient Support", "PatientSupportType", "1", false},
+   {0x300a, 0x0352, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Patient Support ID", "PatientSupportID", "1", false},
+   {0x300a, 0x0354, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Patient Support", "PatientSupportAccessoryCode", "1", false},
+   {0x300a, 0x0356, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Fixation Light", "FixationLightAzimuthalAngle", "1", false},
+   {0x300a, 0x0358, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Fixation Light", "FixationLightPolarAngle", "1", false},
+   {0x300a, 0x035a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Meterset Rate", "MetersetRate", "1", false},
+   {0x300a, 0x0360, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Range Shifter", "RangeShifterSettingsSequence", "1", false},
+   {0x300a, 0x0362, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Range Shifter", "RangeShifterSetting", "1", false},
+   {0x300a, 0x0364, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Isocenter to Range", "IsocenterToRangeShifterDistance", "1", false},
+   {0x300a, 0x0366, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Equivalent", "RangeShifterWaterEquivalentThickness", "1", false},
+   {0x300a, 0x0370, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Device Settings", "LateralSpreadingDeviceSettingsSequence", "1", false},
+   {0x300a, 0x0372, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Lateral Spreading", "LateralSpreadingDeviceSetting", "1", false},
+   {0x300a, 0x0374, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Lateral Spreading", "IsocenterToLateralSpreadingDeviceDistance", "1", false},
+   {0x300a, 0x0380, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Range Modulator", "RangeModulatorSettingsSequence", "1", false},
+   {0x300a, 0x0382, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Range Modulator", "RangeModulatorGatingStartValue", "1", false},
+   {0x300a, 0x0384, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Range Modulator", "RangeModulatorGatingStopValue", "1", false},
+   {0x300a, 0x0386, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Gating Start Water", "RangeModulatorGatingStartWaterEquivalentThickness", "1", false},
+   {0x300a, 0x0388, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Gating Stop Water", "RangeModulatorGatingStopWaterEquivalentThickness", "1", false},
+   {0x300a, 0x038a, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Isocenter to Range", "IsocenterToRangeModulatorDistance", "1", false},
+   {0x300a, 0x0390, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Scan Spot Tune ID", "ScanSpotTuneID", "1", false},
+   {0x300a, 0x0392, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Scan Spot", "NumberOfScanSpotPositions", "1", false},
+   {0x300a, 0x0394, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Scan Spot Position", "ScanSpotPositionMap", "1-", false},
+   {0x300a, 0x0396, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Scan Spot Meterset", "ScanSpotMetersetWeights", "1-", false},
+   {0x300a, 0x0398, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Scanning Spot Size", "ScanningSpotSize", "2", false},
+   {0x300a, 0x039a, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Paintings", "NumberOfPaintings", "1", false},
+   {0x300a, 0x03a0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ion Tolerance Table", "IonToleranceTableSequence", "1", false},
+   {0x300a, 0x03a2, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ion Beam Sequence", "IonBeamSequence", "1", false},
+   {0x300a, 0x03a4, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ion Beam Limiting", "IonBeamLimitingDeviceSequence", "1", false},
+   {0x300a, 0x03a6, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ion Block Sequence", "IonBlockSequence", "1", false},
+   {0x300a, 0x03a8, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ion Control Point", "IonControlPointSequence", "1", false},
+   {0x300a, 0x03aa, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ion Wedge Sequence", "IonWedgeSequence", "1", false},
+   {0x300a, 0x03ac, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Ion Wedge Position", "IonWedgePositionSequence", "1", false},
+   {0x300a, 0x0401, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Setup", "ReferencedSetupImageSequence", "1", false},
+   {0x300a, 0x0402, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Setup Image Comment", "SetupImageComment", "1", false},
+   {0x300a, 0x0410, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Synchronization", "MotionSynchronizationSequence", "1", false},
+   {0x300a, 0x0412, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Control Point", "ControlPointOrientation", "3", false},
+   {0x300a, 0x0420, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "General Accessory", "GeneralAccessorySequence", "1", false},
+   {0x300a, 0x0421, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "General Accessory", "GeneralAccessoryID", "1", false},
+   {0x300a, 0x0422, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "General Accessory", "GeneralAccessoryDescription", "1", false},
+   {0x300a, 0x0423, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "General Accessory", "GeneralAccessoryType", "1", false},
+   {0x300a, 0x0424, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "General Accessory", "GeneralAccessoryNumber", "1", false},
+   {0x300a, 0x0431, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Applicator Geometry", "ApplicatorGeometrySequence", "1", false},
+   {0x300a, 0x0432, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Applicator Aperture", "ApplicatorApertureShape", "1", false},
+   {0x300a, 0x0433, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Applicator Opening", "ApplicatorOpening", "1", false},
+   {0x300a, 0x0434, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Applicator Opening", "ApplicatorOpeningX", "1", false},
+   {0x300a, 0x0435, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Applicator Opening", "ApplicatorOpeningY", "1", false},
+   {0x300a, 0x0436, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Applicator Mounting", "SourceToApplicatorMountingPositionDistance", "1", false},
+   {0x300c, 0x0002, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced RT Plan", "ReferencedRTPlanSequence", "1", false},
+   {0x300c, 0x0004, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Beam", "ReferencedBeamSequence", "1", false},
+   {0x300c, 0x0006, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Beam", "ReferencedBeamNumber", "1", false},
+   {0x300c, 0x0007, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Reference Image", "ReferencedReferenceImageNumber", "1", false},
+   {0x300c, 0x0008, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "Start Cumulative", "StartCumulativeMetersetWeight", "1", false},
+   {0x300c, 0x0009, 0xffff, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "End Cumulative", "EndCumulativeMetersetWeight", "1", false},
+   {0x300c, 0x000a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Application Setup", "ReferencedBrachyApplicationSetupSequence", "1", false},
+   {0x300c, 0x000c, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Application Setup", "ReferencedBrachyApplicationSetupNumber", "1", false},
+   {0x300c, 0x000e, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Source", "ReferencedSourceNumber", "1", false},
+   {0x300c, 0x0020, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Fraction", "ReferencedFractionGroupSequence", "1", false},
+   {0x300c, 0x0022, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Fraction", "ReferencedFractionGroupNumber", "1", false},
+   {0x300c, 0x0040, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Verification Image", "ReferencedVerificationImageSequence", "1", false},
+   {0x300c, 0x0042, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Reference Image", "ReferencedReferenceImageSequence", "1", false},
+   {0x300c, 0x0050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Dose", "ReferencedDoseReferenceSequence", "1", false},
+   {0x300c, 0x0051, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Dose", "ReferencedDoseReferenceNumber", "1", false},
+   {0x300c, 0x0055, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Dose Reference", "BrachyReferencedDoseReferenceSequence", "1", false},
+   {0x300c, 0x0060, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Structure Set", "ReferencedStructureSetSequence", "1", false},
+   {0x300c, 0x006a, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Patient", "ReferencedPatientSetupNumber", "1", false},
+   {0x300c, 0x0080, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Dose", "ReferencedDoseSequence", "1", false},
+   {0x300c, 0x00a0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Tolerance Table", "ReferencedToleranceTableNumber", "1", false},
+   {0x300c, 0x00b0, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Bolus", "ReferencedBolusSequence", "1", false},
+   {0x300c, 0x00c0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Wedge", "ReferencedWedgeNumber", "1", false},
+   {0x300c, 0x00d0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced", "ReferencedCompensatorNumber", "1", false},
+   {0x300c, 0x00e0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Block", "ReferencedBlockNumber", "1", false},
+   {0x300c, 0x00f0, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Control", "ReferencedControlPointIndex", "1", false},
+   {0x300c, 0x00f2, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Referenced Control", "ReferencedControlPointSequence", "1", false},
+   {0x300c, 0x00f4, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Start", "ReferencedStartControlPointIndex", "1", false},
+   {0x300c, 0x00f6, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Stop", "ReferencedStopControlPointIndex", "1", false},
+   {0x300c, 0x0100, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Range", "ReferencedRangeShifterNumber", "1", false},
+   {0x300c, 0x0102, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Spreading Device", "ReferencedLateralSpreadingDeviceNumber", "1", false},
+   {0x300c, 0x0104, 0xffff, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Referenced Range", "ReferencedRangeModulatorNumber", "1", false},
+   {0x300e, 0x0002, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Approval Status", "ApprovalStatus", "1", false},
+   {0x300e, 0x0004, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Review Date", "ReviewDate", "1", false},
+   {0x300e, 0x0005, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Review Time", "ReviewTime", "1", false},
+   {0x300e, 0x0008, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Reviewer Name", "ReviewerName", "1", false},
+   {0x4000, 0x0010, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Arbitrary", "Arbitrary", "1", true},
+   {0x4000, 0x4000, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Text Comments", "TextComments", "1", true},
+   {0x4008, 0x0040, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Results ID", "ResultsID", "1", true},
+   {0x4008, 0x0042, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Results ID Issuer", "ResultsIDIssuer", "1", true},
+   {0x4008, 0x0050, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "ReferencedInterpretationSequence", "1", true},
+   {0x4008, 0x00ff, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Report Production", "ReportProductionStatusTrial", "1", true},
+   {0x4008, 0x0100, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationRecordedDate", "1", true},
+   {0x4008, 0x0101, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationRecordedTime", "1", true},
+   {0x4008, 0x0102, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationRecorder", "1", true},
+   {0x4008, 0x0103, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Reference to", "ReferenceToRecordedSound", "1", true},
+   {0x4008, 0x0108, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationTranscriptionDate", "1", true},
+   {0x4008, 0x0109, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationTranscriptionTime", "1", true},
+   {0x4008, 0x010a, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationTranscriber", "1", true},
+   {0x4008, 0x010b, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Interpretation Text", "InterpretationText", "1", true},
+   {0x4008, 0x010c, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationAuthor", "1", true},
+   {0x4008, 0x0111, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationApproverSequence", "1", true},
+   {0x4008, 0x0112, 0xffff, 0xffff, {attribute::VR::DA, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationApprovalDate", "1", true},
+   {0x4008, 0x0113, 0xffff, 0xffff, {attribute::VR::TM, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationApprovalTime", "1", true},
+   {0x4008, 0x0114, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Physician Approving", "PhysicianApprovingInterpretation", "1", true},
+   {0x4008, 0x0115, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Diagnosis", "InterpretationDiagnosisDescription", "1", true},
+   {0x4008, 0x0117, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Diagnosis Code", "InterpretationDiagnosisCodeSequence", "1", true},
+   {0x4008, 0x0118, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Distribution List", "ResultsDistributionListSequence", "1", true},
+   {0x4008, 0x0119, 0xffff, 0xffff, {attribute::VR::PN, attribute::VR::NN, attribute::VR::NN}, "Distribution Name", "DistributionName", "1", true},
+   {0x4008, 0x011a, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Distribution", "DistributionAddress", "1", true},
+   {0x4008, 0x0200, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Interpretation ID", "InterpretationID", "1", true},
+   {0x4008, 0x0202, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Interpretation ID", "InterpretationIDIssuer", "1", true},
+   {0x4008, 0x0210, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Interpretation Type", "InterpretationTypeID", "1", true},
+   {0x4008, 0x0212, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Interpretation", "InterpretationStatusID", "1", true},
+   {0x4008, 0x0300, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Impressions", "Impressions", "1", true},
+   {0x4008, 0x4000, 0xffff, 0xffff, {attribute::VR::ST, attribute::VR::NN, attribute::VR::NN}, "Results Comments", "ResultsComments", "1", true},
+   {0x4010, 0x0001, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Low Energy", "LowEnergyDetectors", "1", false},
+   {0x4010, 0x0002, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "High Energy", "HighEnergyDetectors", "1", false},
+   {0x4010, 0x0004, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Detector Geometry", "DetectorGeometrySequence", "1", false},
+   {0x4010, 0x1001, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Threat ROI Voxel", "ThreatROIVoxelSequence", "1", false},
+   {0x4010, 0x1004, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Threat ROI Base", "ThreatROIBase", "3", false},
+   {0x4010, 0x1005, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Threat ROI Extents", "ThreatROIExtents", "3", false},
+   {0x4010, 0x1006, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Threat ROI Bitmap", "ThreatROIBitmap", "1", false},
+   {0x4010, 0x1007, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Route Segment ID", "RouteSegmentID", "1", false},
+   {0x4010, 0x1008, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Gantry Type", "GantryType", "1", false},
+   {0x4010, 0x1009, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "OOI Owner Type", "OOIOwnerType", "1", false},
+   {0x4010, 0x100a, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Route Segment", "RouteSegmentSequence", "1", false},
+   {0x4010, 0x1010, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Potential Threat", "PotentialThreatObjectID", "1", false},
+   {0x4010, 0x1011, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Threat Sequence", "ThreatSequence", "1", false},
+   {0x4010, 0x1012, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Threat Category", "ThreatCategory", "1", false},
+   {0x4010, 0x1013, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Threat Category", "ThreatCategoryDescription", "1", false},
+   {0x4010, 0x1014, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "ATD Ability", "ATDAbilityAssessment", "1", false},
+   {0x4010, 0x1015, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "ATD Assessment Flag", "ATDAssessmentFlag", "1", false},
+   {0x4010, 0x1016, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "ATD Assessment", "ATDAssessmentProbability", "1", false},
+   {0x4010, 0x1017, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Mass", "Mass", "1", false},
+   {0x4010, 0x1018, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Density", "Density", "1", false},
+   {0x4010, 0x1019, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Z Effective", "ZEffective", "1", false},
+   {0x4010, 0x101a, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Boarding Pass ID", "BoardingPassID", "1", false},
+   {0x4010, 0x101b, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Center of Mass", "CenterOfMass", "3", false},
+   {0x4010, 0x101c, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Center of PTO", "CenterOfPTO", "3", false},
+   {0x4010, 0x101d, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Bounding Polygon", "BoundingPolygon", "6-", false},
+   {0x4010, 0x101e, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Route Segment Start", "RouteSegmentStartLocationID", "1", false},
+   {0x4010, 0x101f, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Route Segment End", "RouteSegmentEndLocationID", "1", false},
+   {0x4010, 0x1020, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Route Segment", "RouteSegmentLocationIDType", "1", false},
+   {0x4010, 0x1021, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Abort Reason", "AbortReason", "1-", false},
+   {0x4010, 0x1023, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Volume of PTO", "VolumeOfPTO", "1", false},
+   {0x4010, 0x1024, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Abort Flag", "AbortFlag", "1", false},
+   {0x4010, 0x1025, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Route Segment Start", "RouteSegmentStartTime", "1", false},
+   {0x4010, 0x1026, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Route Segment End", "RouteSegmentEndTime", "1", false},
+   {0x4010, 0x1027, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "TDR Type", "TDRType", "1", false},
+   {0x4010, 0x1028, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "International Route", "InternationalRouteSegment", "1", false},
+   {0x4010, 0x1029, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Algorithm and", "ThreatDetectionAlgorithmandVersion", "n", false},
+   {0x4010, 0x102a, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Assigned Location", "AssignedLocation", "1", false},
+   {0x4010, 0x102b, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "Alarm Decision Time", "AlarmDecisionTime", "1", false},
+   {0x4010, 0x1031, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Alarm Decision", "AlarmDecision", "1", false},
+   {0x4010, 0x1033, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Total", "NumberOfTotalObjects", "1", false},
+   {0x4010, 0x1034, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Alarm", "NumberOfAlarmObjects", "1", false},
+   {0x4010, 0x1037, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "PTO Representation", "PTORepresentationSequence", "1", false},
+   {0x4010, 0x1038, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "ATD Assessment", "ATDAssessmentSequence", "1", false},
+   {0x4010, 0x1039, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "TIP Type", "TIPType", "1", false},
+   {0x4010, 0x103a, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "DICOS Version", "DICOSVersion", "1", false},
+   {0x4010, 0x1041, 0xffff, 0xffff, {attribute::VR::DT, attribute::VR::NN, attribute::VR::NN}, "OOI Owner Creation", "OOIOwnerCreationTime", "1", false},
+   {0x4010, 0x1042, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "OOI Type", "OOIType", "1", false},
+   {0x4010, 0x1043, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "OOI Size", "OOISize", "3", false},
+   {0x4010, 0x1044, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Acquisition Status", "AcquisitionStatus", "1", false},
+   {0x4010, 0x1045, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Basis Materials", "BasisMaterialsCodeSequence", "1", false},
+   {0x4010, 0x1046, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Phantom Type", "PhantomType", "1", false},
+   {0x4010, 0x1047, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "OOI Owner Sequence", "OOIOwnerSequence", "1", false},
+   {0x4010, 0x1048, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Scan Type", "ScanType", "1", false},
+   {0x4010, 0x1051, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Itinerary ID", "ItineraryID", "1", false},
+   {0x4010, 0x1052, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Itinerary ID Type", "ItineraryIDType", "1", false},
+   {0x4010, 0x1053, 0xffff, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Itinerary ID", "ItineraryIDAssigningAuthority", "1", false},
+   {0x4010, 0x1054, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Route ID", "RouteID", "1", false},
+   {0x4010, 0x1055, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Route ID Assigning", "RouteIDAssigningAuthority", "1", false},
+   {0x4010, 0x1056, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Inbound Arrival", "InboundArrivalType", "1", false},
+   {0x4010, 0x1058, 0xffff, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Carrier ID", "CarrierID", "1", false},
+   {0x4010, 0x1059, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Carrier ID", "CarrierIDAssigningAuthority", "1", false},
+   {0x4010, 0x1060, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Source Orientation", "SourceOrientation", "3", false},
+   {0x4010, 0x1061, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Source Position", "SourcePosition", "3", false},
+   {0x4010, 0x1062, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Belt Height", "BeltHeight", "1", false},
+   {0x4010, 0x1064, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Algorithm Routing", "AlgorithmRoutingCodeSequence", "1", false},
+   {0x4010, 0x1067, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Transport", "TransportClassification", "1", false},
+   {0x4010, 0x1068, 0xffff, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "OOI Type Descriptor", "OOITypeDescriptor", "1", false},
+   {0x4010, 0x1069, 0xffff, 0xffff, {attribute::VR::FL, attribute::VR::NN, attribute::VR::NN}, "Total Processing", "TotalProcessingTime", "1", false},
+   {0x4010, 0x106c, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Detector", "DetectorCalibrationData", "1", false},
+   {0x4ffe, 0x0001, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "MAC Parameters", "MACParametersSequence", "1", false},
+   {0x5200, 0x9229, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Shared Functional", "SharedFunctionalGroupsSequence", "1", false},
+   {0x5200, 0x9230, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Functional Groups", "PerFrameFunctionalGroupsSequence", "1", false},
+   {0x5400, 0x0100, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Waveform Sequence", "WaveformSequence", "1", false},
+   {0x5400, 0x0110, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Channel Minimum", "ChannelMinimumValue", "1", false},
+   {0x5400, 0x0112, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Channel Maximum", "ChannelMaximumValue", "1", false},
+   {0x5400, 0x1004, 0xffff, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Waveform Bits", "WaveformBitsAllocated", "1", false},
+   {0x5400, 0x1006, 0xffff, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Waveform Sample", "WaveformSampleInterpretation", "1", false},
+   {0x5400, 0x100a, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Waveform Padding", "WaveformPaddingValue", "1", false},
+   {0x5400, 0x1010, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Waveform Data", "WaveformData", "1", false},
+   {0x5600, 0x0010, 0xffff, 0xffff, {attribute::VR::OF, attribute::VR::NN, attribute::VR::NN}, "First Order Phase", "FirstOrderPhaseCorrectionAngle", "1", false},
+   {0x5600, 0x0020, 0xffff, 0xffff, {attribute::VR::OF, attribute::VR::NN, attribute::VR::NN}, "Spectroscopy Data", "SpectroscopyData", "1", false},
+   {0x7fe0, 0x0010, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Pixel Data", "PixelData", "1", false},
+   {0x7fe0, 0x0020, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Coefficients SDVN", "CoefficientsSDVN", "1", true},
+   {0x7fe0, 0x0030, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Coefficients SDHN", "CoefficientsSDHN", "1", true},
+   {0x7fe0, 0x0040, 0xffff, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Coefficients SDDN", "CoefficientsSDDN", "1", true},
+   {0xfffa, 0xfffa, 0xffff, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Signatures", "DigitalSignaturesSequence", "1", false},
+   {0xfffc, 0xfffc, 0xffff, 0xffff, {attribute::VR::OB, attribute::VR::NN, attribute::VR::NN}, "Data Set Trailing", "DataSetTrailingPadding", "1", false},
+   {0xfffe, 0xe000, 0xffff, 0xffff, {attribute::VR::NN, attribute::VR::NN, attribute::VR::NN}, "Item", "Item", "1", false},
+   {0xfffe, 0xe00d, 0xffff, 0xffff, {attribute::VR::NN, attribute::VR::NN, attribute::VR::NN}, "Item Delimitation", "ItemDelimitationItem", "1", false},
+   {0xfffe, 0xe0dd, 0xffff, 0xffff, {attribute::VR::NN, attribute::VR::NN, attribute::VR::NN}, "Sequence", "SequenceDelimitationItem", "1", false},
+};
+
+const std::size_t datadictionary_table_size
+   = sizeof(datadictionary_table) / sizeof(datadictionary_table[0]);
+
+const datadictionary_table_entry datadictionary_masked_table[] =
+{
+   {0x0028, 0x0400, 0xffff, 0xff0f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Rows For Nth Order", "RowsForNthOrderCoefficients", "1", true},
+   {0x0028, 0x0401, 0xffff, 0xff0f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Columns For Nth", "ColumnsForNthOrderCoefficients", "1", true},
+   {0x0028, 0x0402, 0xffff, 0xff0f, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Coefficient Coding", "CoefficientCoding", "1-", true},
+   {0x0028, 0x0403, 0xffff, 0xff0f, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Coefficient Coding", "CoefficientCodingPointers", "1-", true},
+   {0x0028, 0x0800, 0xffff, 0xff0f, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Code Label", "CodeLabel", "1-", true},
+   {0x0028, 0x0802, 0xffff, 0xff0f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Tables", "NumberOfTables", "1", true},
+   {0x0028, 0x0803, 0xffff, 0xff0f, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Code Table Location", "CodeTableLocation", "1-", true},
+   {0x0028, 0x0804, 0xffff, 0xff0f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Bits For Code Word", "BitsForCodeWord", "1", true},
+   {0x0028, 0x0808, 0xffff, 0xff0f, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Image Data Location", "ImageDataLocation", "1-", true},
+   {0x1000, 0x0000, 0xffff, 0x000f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Escape Triplet", "EscapeTriplet", "3", true},
+   {0x1000, 0x0001, 0xffff, 0x000f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Run Length Triplet", "RunLengthTriplet", "3", true},
+   {0x1000, 0x0002, 0xffff, 0x000f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Huffman Table Size", "HuffmanTableSize", "1", true},
+   {0x1000, 0x0003, 0xffff, 0x000f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Huffman Table", "HuffmanTableTriplet", "3", true},
+   {0x1000, 0x0004, 0xffff, 0x000f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Shift Table Size", "ShiftTableSize", "1", true},
+   {0x1000, 0x0005, 0xffff, 0x000f, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Shift Table Triplet", "ShiftTableTriplet", "3", true},
+   {0x1010, 0x0000, 0xffff, 0x0000, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Zonal Map", "ZonalMap", "1-", true},
+   {0x5000, 0x0005, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Curve Dimensions", "CurveDimensions", "1", true},
+   {0x5000, 0x0010, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of Points", "NumberOfPoints", "1", true},
+   {0x5000, 0x0020, 0xff00, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Type of Data", "TypeOfData", "1", true},
+   {0x5000, 0x0022, 0xff00, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Curve Description", "CurveDescription", "1", true},
+   {0x5000, 0x0030, 0xff00, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Axis Units", "AxisUnits", "1-n", true},
+   {0x5000, 0x0040, 0xff00, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Axis Labels", "AxisLabels", "1-n", true},
+   {0x5000, 0x0103, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Data Value", "DataValueRepresentation", "1", true},
+   {0x5000, 0x0104, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Minimum", "MinimumCoordinateValue", "1-n", true},
+   {0x5000, 0x0105, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Maximum", "MaximumCoordinateValue", "1-n", true},
+   {0x5000, 0x0106, 0xff00, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Curve Range", "CurveRange", "1-n", true},
+   {0x5000, 0x0110, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Curve Data", "CurveDataDescriptor", "1-n", true},
+   {0x5000, 0x0112, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Coordinate Start", "CoordinateStartValue", "1-n", true},
+   {0x5000, 0x0114, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Coordinate Step", "CoordinateStepValue", "1-n", true},
+   {0x5000, 0x1001, 0xff00, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Curve Activation", "CurveActivationLayer", "1", true},
+   {0x5000, 0x2000, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Audio Type", "AudioType", "1", true},
+   {0x5000, 0x2002, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Audio Sample", "AudioSampleFormat", "1", true},
+   {0x5000, 0x2004, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Number of", "NumberOfChannels", "1", true},
+   {0x5000, 0x2006, 0xff00, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Number of Samples", "NumberOfSamples", "1", true},
+   {0x5000, 0x2008, 0xff00, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Sample Rate", "SampleRate", "1", true},
+   {0x5000, 0x200a, 0xff00, 0xffff, {attribute::VR::UL, attribute::VR::NN, attribute::VR::NN}, "Total Time", "TotalTime", "1", true},
+   {0x5000, 0x200c, 0xff00, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Audio Sample Data", "AudioSampleData", "1", true},
+   {0x5000, 0x200e, 0xff00, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Audio Comments", "AudioComments", "1", true},
+   {0x5000, 0x2500, 0xff00, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Curve Label", "CurveLabel", "1", true},
+   {0x5000, 0x2600, 0xff00, 0xffff, {attribute::VR::SQ, attribute::VR::NN, attribute::VR::NN}, "Curve Referenced", "CurveReferencedOverlaySequence", "1", true},
+   {0x5000, 0x2610, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Curve Referenced", "CurveReferencedOverlayGroup", "1", true},
+   {0x5000, 0x3000, 0xff00, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Curve Data", "CurveData", "1", true},
+   {0x6000, 0x0010, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Rows", "OverlayRows", "1", false},
+   {0x6000, 0x0011, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Columns", "OverlayColumns", "1", false},
+   {0x6000, 0x0012, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Planes", "OverlayPlanes", "1", true},
+   {0x6000, 0x0015, 0xff00, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "Number of Frames", "NumberOfFramesInOverlay", "1", false},
+   {0x6000, 0x0022, 0xff00, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Overlay", "OverlayDescription", "1", false},
+   {0x6000, 0x0040, 0xff00, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay Type", "OverlayType", "1", false},
+   {0x6000, 0x0045, 0xff00, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Overlay Subtype", "OverlaySubtype", "1", false},
+   {0x6000, 0x0050, 0xff00, 0xffff, {attribute::VR::SS, attribute::VR::NN, attribute::VR::NN}, "Overlay Origin", "OverlayOrigin", "2", false},
+   {0x6000, 0x0051, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Image Frame", "ImageFrameOrigin", "1", false},
+   {0x6000, 0x0052, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Plane", "OverlayPlaneOrigin", "1", true},
+   {0x6000, 0x0060, 0xff00, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay", "OverlayCompressionCode", "1", true},
+   {0x6000, 0x0061, 0xff00, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Compression", "OverlayCompressionOriginator", "1", true},
+   {0x6000, 0x0062, 0xff00, 0xffff, {attribute::VR::SH, attribute::VR::NN, attribute::VR::NN}, "Overlay", "OverlayCompressionLabel", "1", true},
+   {0x6000, 0x0063, 0xff00, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Compression", "OverlayCompressionDescription", "1", true},
+   {0x6000, 0x0066, 0xff00, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Compression Step", "OverlayCompressionStepPointers", "1-n", true},
+   {0x6000, 0x0068, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Repeat", "OverlayRepeatInterval", "1", true},
+   {0x6000, 0x0069, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Bits", "OverlayBitsGrouped", "1", true},
+   {0x6000, 0x0100, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Bits", "OverlayBitsAllocated", "1", false},
+   {0x6000, 0x0102, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Bit", "OverlayBitPosition", "1", false},
+   {0x6000, 0x0110, 0xff00, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay Format", "OverlayFormat", "1", true},
+   {0x6000, 0x0200, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Location", "OverlayLocation", "1", true},
+   {0x6000, 0x0800, 0xff00, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay Code", "OverlayCodeLabel", "1-n", true},
+   {0x6000, 0x0802, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Number of", "OverlayNumberOfTables", "1", true},
+   {0x6000, 0x0803, 0xff00, 0xffff, {attribute::VR::AT, attribute::VR::NN, attribute::VR::NN}, "Overlay Code", "OverlayCodeTableLocation", "1-n", true},
+   {0x6000, 0x0804, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay Bits For", "OverlayBitsForCodeWord", "1", true},
+   {0x6000, 0x1001, 0xff00, 0xffff, {attribute::VR::CS, attribute::VR::NN, attribute::VR::NN}, "Overlay", "OverlayActivationLayer", "1", false},
+   {0x6000, 0x1100, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay", "OverlayDescriptorGray", "1", true},
+   {0x6000, 0x1101, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay", "OverlayDescriptorRed", "1", true},
+   {0x6000, 0x1102, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Descriptor -", "OverlayDescriptorGreen", "1", true},
+   {0x6000, 0x1103, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlay", "OverlayDescriptorBlue", "1", true},
+   {0x6000, 0x1200, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlays - Gray", "OverlaysGray", "1-n", true},
+   {0x6000, 0x1201, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlays - Red", "OverlaysRed", "1-n", true},
+   {0x6000, 0x1202, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlays - Green", "OverlaysGreen", "1-n", true},
+   {0x6000, 0x1203, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Overlays - Blue", "OverlaysBlue", "1-n", true},
+   {0x6000, 0x1301, 0xff00, 0xffff, {attribute::VR::IS, attribute::VR::NN, attribute::VR::NN}, "ROI Area", "ROIArea", "1", false},
+   {0x6000, 0x1302, 0xff00, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "ROI Mean", "ROIMean", "1", false},
+   {0x6000, 0x1303, 0xff00, 0xffff, {attribute::VR::DS, attribute::VR::NN, attribute::VR::NN}, "ROI Standard", "ROIStandardDeviation", "1", false},
+   {0x6000, 0x1500, 0xff00, 0xffff, {attribute::VR::LO, attribute::VR::NN, attribute::VR::NN}, "Overlay Label", "OverlayLabel", "1", false},
+   {0x6000, 0x3000, 0xff00, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Overlay Data", "OverlayData", "1", false},
+   {0x6000, 0x4000, 0xff00, 0xffff, {attribute::VR::LT, attribute::VR::NN, attribute::VR::NN}, "Overlay Comments", "OverlayComments", "1", true},
+   {0x7f00, 0x0010, 0xff00, 0xffff, {attribute::VR::OB, attribute::VR::OW, attribute::VR::NN}, "Variable Pixel", "VariablePixelData", "1", true},
+   {0x7f00, 0x0011, 0xff00, 0xffff, {attribute::VR::US, attribute::VR::NN, attribute::VR::NN}, "Variable Next", "VariableNextDataGroup", "1", true},
+   {0x7f00, 0x0020, 0xff00, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Variable", "VariableCoefficientsSDVN", "1", true},
+   {0x7f00, 0x0030, 0xff00, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Variable", "VariableCoefficientsSDHN", "1", true},
+   {0x7f00, 0x0040, 0xff00, 0xffff, {attribute::VR::OW, attribute::VR::NN, attribute::VR::NN}, "Variable", "VariableCoefficientsSDDN", "1", true},
+};
+
+const std::size_t datadictionary_masked_table_size
+   = sizeof(datadictionary_masked_table) / sizeof(datadictionary_masked_table[0]);
+
+}
+
+}
+
+}
@@ -0,0 +1,58 @@
+#ifndef DATADICTIONARY_TABLE_HPP
+#define DATADICTIONARY_TABLE_HPP
+
+#include <cstddef>
+
+#include "dictionary_entry.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dictionary
+{
+
+/**
+ * @brief The datadictionary_table_entry struct is the compiled-in, constant
+ *        initialized representation of a data dictionary entry.
+ * A tag matches the entry if (gid, eid) equals the tag with the group and
+ * element masks applied. Entries of the exact table have both masks set to
+ * 0xffff.
+ */
+struct datadictionary_table_entry
+{
+      unsigned short gid;
+      unsigned short eid;
+      unsigned short gid_mask;
+      unsigned short eid_mask;
+
+      attribute::VR vr[dictionary_entry::max_vr_options];
+      const char* message_field;
+      const char* keyword;
+      const char* vm;
+      bool retired;
+};
+
+/**
+ * datadictionary_table contains all data dictionary entries without repeating
+ * group or element ranges, sorted ascending by tag.
+ */
+extern const datadictionary_table_entry datadictionary_table[];
+extern const std::size_t datadictionary_table_size;
+
+/**
+ * datadictionary_masked_table contains the entries describing ranges of tags,
+ * like the overlay group (60xx,3000).
+ */
+extern const datadictionary_table_entry datadictionary_masked_table[];
+extern const std::size_t datadictionary_masked_table_size;
+
+}
+
+}
+
+}
+
+#endif // DATADICTIONARY_TABLE_HPP
@@ -16,7 +16,8 @@ static dictionary_entry unknown {{attribute::VR::UN}, "UNKNOWN", "UNKNOWN", "*",
 dictionaries::dictionaries(std::string cmddic_path,
                        std::string datadic_path):
    commanddic {cmddic_path, dictionary_dyn::MODE::GREEDY},
-   datadic {datadic_path}
+   datadic {datadic_path},
+   static_datadic {}
 {
 }
 
@@ -30,9 +31,19 @@ dictionary_dyn& dictionaries::get_dyn_datadic()
    return datadic;
 }
 
+const dictionary_static& dictionaries::get_static_datadic() const
+{
+   return static_datadic;
+}
+
 
 dictionary_entry dictionaries::lookup_datadic(attribute::tag_type tag)
 {
+   auto static_entry = static_datadic.lookup(tag);
+   if (static_entry != boost::none) {
+      return *static_entry;
+   }
+
    auto entry = datadic.lookup(tag);
    if (entry == boost::none) {
       return unknown;
@@ -44,22 +55,37 @@ dictionary_entry dictionaries::lookup_datadic(attribute::tag_type tag)
 dictionary_entry dictionaries::lookup(attribute::tag_type tag)
 {
    try {
-      auto found_entry {commanddic.lookup(tag)};
-      if (found_entry == boost::none) {
-         auto found_data_entry {datadic.lookup(tag)};
-         if (found_data_entry == boost::none) {
-            return unknown;
-         } else {
-            return *found_data_entry;
+      // the command dictionary only contains elements of group 0x0000, so
+      // the data dictionary lookups do not need to take its lock.
+      if (tag.group_id == 0x0000) {
+         auto found_entry {commanddic.lookup(tag)};
+         if (found_entry != boost::none) {
+            return *found_entry;
          }
       }
-
-      return *found_entry;
+      return lookup_datadic(tag);
    } catch (std::exception&) {
       return unknown;
    }
 }
 
+attribute::VR dictionaries::lookup_vr(attribute::tag_type tag)
+{
+   if (tag.group_id != 0x0000) {
+      auto vr = static_datadic.lookup_vr(tag);
+      if (vr != boost::none) {
+         return *vr;
+      }
+   }
+   return lookup(tag).vr[0];
+}
+
+attribute::VR dictionaries::lookup_static_vr(attribute::tag_type tag) const
+{
+   auto vr = static_datadic.lookup_vr(tag);
+   return vr != boost::none ? *vr : attribute::VR::UN;
+}
+
 dictionary_entry dictionaries::lookup_commanddic(attribute::tag_type tag)
 {
    auto entry = commanddic.lookup(tag);
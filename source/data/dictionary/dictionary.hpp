@@ -5,6 +5,7 @@
 #include <type_traits>
 
 #include "dictionary_dyn.hpp"
+#include "dictionary_static.hpp"
 #include "datadictionary.hpp"
 #include "commanddictionary.hpp"
 
@@ -54,8 +55,9 @@ class dictionaries
       dictionary_entry lookup_commanddic(attribute::tag_type tag);
 
       /**
-       * @brief lookup_datadic performs a dynamic lookup of the given tag in
-       *        the data dictionary.
+       * @brief lookup_datadic performs a lookup of the given tag in the
+       *        compiled-in data dictionary table, falling back to the dynamic
+       *        data dictionary for tags not contained in it.
        * @param tag
        * @return dictionary entry corresponding the tag
        */
@@ -70,6 +72,27 @@ class dictionaries
        */
       dictionary_entry lookup(attribute::tag_type tag);
 
+      /**
+       * @brief lookup_vr returns the (first) VR of the given tag. Unlike
+       *        lookup(), data dictionary tags contained in the compiled-in
+       *        table are resolved without locking and without constructing a
+       *        dictionary entry.
+       * @param tag
+       * @return VR of the tag, VR::UN if the tag is unknown
+       */
+      attribute::VR lookup_vr(attribute::tag_type tag);
+
+      /**
+       * @brief lookup_static_vr returns the (first) VR of the given tag from
+       *        the compiled-in data dictionary table only. It never locks
+       *        and never reads the dictionary files, so tags which are only
+       *        contained in them, like command or site-specific tags, resolve
+       *        to VR::UN.
+       * @param tag
+       * @return VR of the tag, VR::UN if the tag is not in the table
+       */
+      attribute::VR lookup_static_vr(attribute::tag_type tag) const;
+
       /**
        * @brief lookup_commanddic performs a compile-time lookup of the given tag
        *        in the command dictionary.
@@ -100,10 +123,12 @@ class dictionaries
 
       dictionary_dyn& get_dyn_commanddic();
       dictionary_dyn& get_dyn_datadic();
+      const dictionary_static& get_static_datadic() const;
 
    private:
       dictionary_dyn commanddic;
       dictionary_dyn datadic;
+      dictionary_static static_datadic;
 };
 
 /**
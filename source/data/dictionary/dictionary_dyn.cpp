@@ -160,13 +160,22 @@ boost::optional<dictionary_entry> dictionary_dyn::greedylookup(attribute::tag_ty
 
          std::array<attribute::VR, dictionary_entry::max_vr_options> vrs;
          std::string fields[num_fields-1];
+         bool valid_vr = true;
          for (int i=0; i<num_fields-1; ++i) {
             std::getline(entry, fields[i], ';');
             fields[i] = trim(fields[i]);
             if (i==0) {
-               vrs = get_vrs(fields[i]);
+               try {
+                  vrs = get_vrs(fields[i]);
+               } catch (std::out_of_range&) {
+                  valid_vr = false;
+               }
             }
          }
+         // skip entries without a (valid) VR instead of aborting the buffering
+         if (!valid_vr) {
+            continue;
+         }
          bool retired = fields[num_fields-2] == "RET";
 
          dict_buffer.emplace(tag_type {taggid, tageid}
@@ -0,0 +1,62 @@
+#include "dictionary_static.hpp"
+
+#include <algorithm>
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dictionary
+{
+
+const datadictionary_table_entry* dictionary_static::find(attribute::tag_type tag) const
+{
+   const auto begin = datadictionary_table;
+   const auto end = datadictionary_table + datadictionary_table_size;
+   auto entry = std::lower_bound(begin, end, tag,
+                                 [](const datadictionary_table_entry& e, attribute::tag_type t) {
+      return e.gid < t.group_id || (e.gid == t.group_id && e.eid < t.element_id);
+   });
+   if (entry != end && entry->gid == tag.group_id && entry->eid == tag.element_id) {
+      return entry;
+   }
+
+   const auto masked_end = datadictionary_masked_table + datadictionary_masked_table_size;
+   auto masked = std::find_if(datadictionary_masked_table, masked_end,
+                              [tag](const datadictionary_table_entry& e) {
+      return (tag.group_id & e.gid_mask) == e.gid
+          && (tag.element_id & e.eid_mask) == e.eid;
+   });
+   if (masked != masked_end) {
+      return masked;
+   }
+   return nullptr;
+}
+
+boost::optional<dictionary_entry> dictionary_static::lookup(attribute::tag_type tag) const
+{
+   auto entry = find(tag);
+   if (entry == nullptr) {
+      return boost::none;
+   }
+   return dictionary_entry {{entry->vr[0], entry->vr[1], entry->vr[2]},
+                            entry->message_field, entry->keyword,
+                            entry->vm, entry->retired};
+}
+
+boost::optional<attribute::VR> dictionary_static::lookup_vr(attribute::tag_type tag) const
+{
+   auto entry = find(tag);
+   if (entry == nullptr) {
+      return boost::none;
+   }
+   return entry->vr[0];
+}
+
+}
+
+}
+
+}
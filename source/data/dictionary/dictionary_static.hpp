@@ -0,0 +1,61 @@
+#ifndef DICTIONARY_STATIC_HPP
+#define DICTIONARY_STATIC_HPP
+
+#include <boost/optional.hpp>
+
+#include "dictionary_entry.hpp"
+#include "datadictionary_table.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dictionary
+{
+
+/**
+ * @brief The dictionary_static class performs runtime lookups on the
+ *        compiled-in data dictionary table.
+ * The table is immutable and constant-initialized, so lookups neither lock nor
+ * touch the file system and may be performed concurrently from any thread.
+ * Tags are searched with a binary search over the sorted table first; ranges of
+ * tags (repeating groups) are matched against their masks afterwards.
+ */
+class dictionary_static
+{
+   public:
+      /**
+       * @brief lookup performs a lookup on the tag.
+       * @param tag tag to be looked for
+       * @return dictionary entry corresponding to the tag, boost::none if the
+       *         tag is not contained in the table
+       */
+      boost::optional<dictionary_entry> lookup(attribute::tag_type tag) const;
+
+      /**
+       * @brief lookup_vr returns the first VR of the tag's dictionary entry,
+       *        without constructing the complete dictionary entry.
+       * @param tag tag to be looked for
+       * @return VR of the tag, boost::none if the tag is not contained in the
+       *         table
+       */
+      boost::optional<attribute::VR> lookup_vr(attribute::tag_type tag) const;
+
+   private:
+      /**
+       * @brief find returns the table entry matching the tag
+       * @param tag tag to be looked for
+       * @return pointer to the matching entry or nullptr
+       */
+      const datadictionary_table_entry* find(attribute::tag_type tag) const;
+};
+
+}
+
+}
+
+}
+
+#endif // DICTIONARY_STATIC_HPP
@@ -0,0 +1,288 @@
+#include "batch_reader.hpp"
+
+#include <algorithm>
+#include <condition_variable>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+#include "dicomfile.hpp"
+#include "util/channel_sev_logger.hpp"
+
+using namespace dicom::data::attribute;
+using namespace dicom::data::dataset;
+
+namespace
+{
+
+/**
+ * @brief The work_queues class distributes the indices of a fixed number of
+ *        tasks to the workers.
+ * Each worker owns a deque initialized with a contiguous range of indices and
+ * takes tasks from its front. An idle worker steals from the back of the other
+ * deques, starting with its neighbour. No tasks are added after construction,
+ * so the work is done when all deques are empty.
+ */
+class work_queues
+{
+   public:
+      work_queues(std::size_t workers, std::size_t tasks):
+         queues(workers)
+      {
+         for (std::size_t i=0; i<workers; ++i) {
+            std::size_t begin = tasks * i / workers;
+            std::size_t end = tasks * (i+1) / workers;
+            for (std::size_t task=begin; task<end; ++task) {
+               queues[i].tasks.push_back(task);
+            }
+         }
+      }
+
+      bool pop(std::size_t worker, std::size_t& task)
+      {
+         {
+            auto& own = queues[worker];
+            std::lock_guard<std::mutex> lock {own.lock};
+            if (!own.tasks.empty()) {
+               task = own.tasks.front();
+               own.tasks.pop_front();
+               return true;
+            }
+         }
+         for (std::size_t i=1; i<queues.size(); ++i) {
+            auto& victim = queues[(worker+i) % queues.size()];
+            std::lock_guard<std::mutex> lock {victim.lock};
+            if (!victim.tasks.empty()) {
+               task = victim.tasks.back();
+               victim.tasks.pop_back();
+               return true;
+            }
+         }
+         return false;
+      }
+
+   private:
+      struct queue
+      {
+            std::mutex lock;
+            std::deque<std::size_t> tasks;
+      };
+
+      std::vector<queue> queues;
+};
+
+/**
+ * @brief The memory_budget class bounds the accumulated size of the files in
+ *        flight. A request exceeding the budget is granted as soon as nothing
+ *        else is in flight, so oversized files cannot block the batch.
+ */
+class memory_budget
+{
+   public:
+      explicit memory_budget(std::size_t limit):
+         limit {limit},
+         in_flight {0}
+      {
+      }
+
+      void acquire(std::size_t size)
+      {
+         std::unique_lock<std::mutex> lock {access_lock};
+         released.wait(lock, [this, size]() {
+            return in_flight == 0 || in_flight + size <= limit;
+         });
+         in_flight += size;
+      }
+
+      void release(std::size_t size)
+      {
+         {
+            std::lock_guard<std::mutex> lock {access_lock};
+            in_flight -= size;
+         }
+         released.notify_all();
+      }
+
+   private:
+      std::mutex access_lock;
+      std::condition_variable released;
+      const std::size_t limit;
+      std::size_t in_flight;
+};
+
+/**
+ * @brief The worker_context class holds the transfer processors of one worker
+ *        thread, which are created on first use and reused for all files the
+ *        worker reads.
+ */
+class worker_context
+{
+   public:
+      worker_context(dicom::data::dictionary::dictionaries& dict,
+                     const dicom::filesystem::batch_options& options):
+         dict {dict},
+         options {options},
+         metaheader_proc {dict},
+         logger {"batch_reader"}
+      {
+      }
+
+      void read(dicom::filesystem::batch_result& result, memory_budget& budget,
+                std::size_t& reserved)
+      {
+         std::ifstream is {result.path, std::ios::binary};
+         if (!is) {
+            throw std::runtime_error {"Could not open file " + result.path};
+         }
+         is.seekg(0, std::ios::end);
+         std::size_t size = static_cast<std::size_t>(is.tellg());
+         is.seekg(0, std::ios::beg);
+
+         budget.acquire(size);
+         reserved = size;
+
+         auto buffer = std::make_shared<std::vector<unsigned char>>(size);
+         is.read(reinterpret_cast<char*>(buffer->data()), size);
+         if (!is) {
+            throw std::runtime_error {"Could not read file " + result.path};
+         }
+
+         byte_view data {*buffer};
+         auto layout = dicom::filesystem::locate_part10(data, result.path);
+         result.filemetaheader = metaheader_proc.deserialize(
+                  data.subview(layout.metaheader_offset, layout.metaheader_size));
+
+         std::string transfer_syntax;
+         get_value_field<VR::UI>(result.filemetaheader[{0x0002, 0x0010}], transfer_syntax);
+
+         auto content = data.subview(layout.dataset_offset, data.size()-layout.dataset_offset);
+         auto& proc = processor(transfer_syntax);
+         result.dataset = options.lazy
+               ? proc.deserialize_lazy(content, std::move(buffer), options.filter)
+               : proc.deserialize(content, options.filter);
+      }
+
+      void report(const dicom::filesystem::batch_result& result, const std::exception& err)
+      {
+         using namespace dicom::util::log;
+         BOOST_LOG_SEV(logger, error) << "Error reading file " << result.path << "\n"
+                                      << err.what();
+      }
+
+   private:
+      dicom::data::dictionary::dictionaries& dict;
+      const dicom::filesystem::batch_options& options;
+      little_endian_explicit metaheader_proc;
+      std::map<std::string, std::unique_ptr<transfer_processor>> processors;
+      dicom::util::log::channel_sev_logger logger;
+
+      transfer_processor& processor(std::string transfer_syntax)
+      {
+         transfer_syntax.erase(std::remove(transfer_syntax.begin(), transfer_syntax.end(), '\0'),
+                               transfer_syntax.end());
+         auto it = processors.find(transfer_syntax);
+         if (it == processors.end()) {
+            it = processors.emplace(transfer_syntax,
+                                    make_transfer_processor(transfer_syntax, dict)).first;
+            it->second->set_static_lookup(true);
+         }
+         return *it->second;
+      }
+};
+
+}
+
+namespace dicom
+{
+
+namespace filesystem
+{
+
+batch_reader::batch_reader(data::dictionary::dictionaries& dict, batch_options options):
+   dict {dict},
+   options {std::move(options)}
+{
+}
+
+std::size_t batch_reader::threads() const
+{
+   if (options.threads > 0) {
+      return options.threads;
+   }
+   return std::max(1u, std::thread::hardware_concurrency());
+}
+
+void batch_reader::read(const std::vector<std::string>& paths, const handler& on_result) const
+{
+   if (paths.empty()) {
+      return;
+   }
+
+   const std::size_t workers = std::min(threads(), paths.size());
+   work_queues queues {workers, paths.size()};
+   memory_budget budget {options.memory_budget};
+
+   std::mutex handler_error_lock;
+   std::exception_ptr handler_error;
+
+   auto work = [&](std::size_t id) {
+      worker_context context {dict, options};
+      std::size_t task;
+      while (queues.pop(id, task)) {
+         batch_result result;
+         result.index = task;
+         result.path = paths[task];
+
+         std::size_t reserved = 0;
+         try {
+            context.read(result, budget, reserved);
+         } catch (std::exception& err) {
+            context.report(result, err);
+            result.filemetaheader.clear();
+            result.dataset.clear();
+            result.error = std::current_exception();
+         }
+
+         try {
+            on_result(result);
+         } catch (...) {
+            std::lock_guard<std::mutex> lock {handler_error_lock};
+            if (!handler_error) {
+               handler_error = std::current_exception();
+            }
+         }
+         budget.release(reserved);
+      }
+   };
+
+   std::vector<std::thread> pool;
+   pool.reserve(workers-1);
+   for (std::size_t id=1; id<workers; ++id) {
+      pool.emplace_back(work, id);
+   }
+   work(0);
+   for (auto& worker : pool) {
+      worker.join();
+   }
+
+   if (handler_error) {
+      std::rethrow_exception(handler_error);
+   }
+}
+
+std::vector<batch_result> batch_reader::read(const std::vector<std::string>& paths) const
+{
+   std::vector<batch_result> results(paths.size());
+   read(paths, [&results](batch_result& result) {
+      results[result.index] = std::move(result);
+   });
+   return results;
+}
+
+}
+
+}
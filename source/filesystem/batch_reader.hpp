@@ -0,0 +1,136 @@
+#ifndef BATCH_READER_HPP
+#define BATCH_READER_HPP
+
+#include <string>
+#include <vector>
+#include <functional>
+#include <exception>
+#include <cstddef>
+
+#include "data/dataset/datasets.hpp"
+#include "data/dataset/transfer_processor.hpp"
+#include "data/dictionary/dictionary.hpp"
+
+namespace dicom
+{
+
+namespace filesystem
+{
+
+/**
+ * @brief The batch_options struct configures the parallel reading of a
+ *        batch of DICOM files.
+ */
+struct batch_options
+{
+      /**
+       * number of worker threads, 0 selects the number of hardware threads
+       */
+      std::size_t threads = 0;
+
+      /**
+       * upper bound for the accumulated size of the files which are read,
+       * parsed or handed to the callback at the same time. A file larger than
+       * the budget is still read, but only while no other file is in flight.
+       */
+      std::size_t memory_budget = std::size_t {512} * 1024 * 1024;
+
+      /**
+       * if set, the value fields are decoded lazily from the file buffer,
+       * which is then kept alive by the dataset.
+       */
+      bool lazy = false;
+
+      /**
+       * restriction of the deserialized attributes, applied to each file
+       */
+      dicom::data::dataset::parse_filter filter;
+};
+
+/**
+ * @brief The batch_result struct holds the outcome of reading one file of a
+ *        batch.
+ */
+struct batch_result
+{
+      /**
+       * position of the file in the list passed to the reader
+       */
+      std::size_t index;
+      std::string path;
+      dicom::data::dataset::iod filemetaheader;
+      dicom::data::dataset::iod dataset;
+
+      /**
+       * set if the file could not be read or parsed, the sets are empty then
+       */
+      std::exception_ptr error;
+};
+
+/**
+ * @brief The batch_reader class reads and parses a list of DICOM files in
+ *        parallel.
+ * The files are distributed to the worker threads in contiguous ranges; a
+ * worker which runs out of files steals from the end of the range of another
+ * one, so a few large files do not stall the whole batch. Each worker keeps
+ * its own meta header processor and a transfer processor per transfer syntax
+ * for the whole batch, so neither processors nor their loggers are shared
+ * between threads. The dictionaries are shared; the processors look up the
+ * VRs of data elements in the compiled-in table only (see
+ * transfer_processor::set_static_lookup()), which does not lock, so private
+ * or unknown tags resolve to UN without reading the dictionary file.
+ * A failure to read one file is reported in its result and does not affect
+ * the rest of the batch.
+ */
+class batch_reader
+{
+   public:
+      using handler = std::function<void(batch_result&)>;
+
+      /**
+       * @brief batch_reader constructs a reader
+       * @param dict dictionaries used by the transfer processors, must
+       *        outlive the reader
+       * @param options configuration of the reader
+       */
+      batch_reader(dicom::data::dictionary::dictionaries& dict,
+                   batch_options options = batch_options {});
+
+      /**
+       * @brief read reads all files and passes each result to the handler as
+       *        soon as it is available.
+       * The handler is called concurrently from the worker threads in no
+       * particular order. The file counts towards the memory budget until the
+       * handler returns, so the handler should move the datasets out of the
+       * result if they are kept. Returns when all files have been handled.
+       * Exceptions thrown by the handler are rethrown after the batch is
+       * complete.
+       * @param paths paths of the files to be read
+       * @param on_result handler called for each file
+       */
+      void read(const std::vector<std::string>& paths, const handler& on_result) const;
+
+      /**
+       * @brief read overload which collects the results.
+       * The memory budget only bounds the files being read at the same time,
+       * all datasets are retained in the returned vector.
+       * @param paths paths of the files to be read
+       * @return results in the order of the paths
+       */
+      std::vector<batch_result> read(const std::vector<std::string>& paths) const;
+
+      /**
+       * @brief threads returns the number of worker threads used
+       */
+      std::size_t threads() const;
+
+   private:
+      dicom::data::dictionary::dictionaries& dict;
+      batch_options options;
+};
+
+}
+
+}
+
+#endif // BATCH_READER_HPP
@@ -1,6 +1,10 @@
 #include "dicomfile.hpp"
 
 #include <iterator>
+#include <algorithm>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 
 #include "data/attribute/constants.hpp"
 #include "util/uid.hpp"
@@ -10,7 +14,24 @@ using namespace dicom::data::dataset;
 namespace
 {
 
-std::size_t le_char_to_16b(unsigned char* bs)
+/**
+ * @brief The mapped_file struct owns the mapping of a file, which is shared by
+ *        the lazily decoded values read from it.
+ */
+struct mapped_file
+{
+      boost::interprocess::file_mapping mapping;
+      boost::interprocess::mapped_region region;
+
+      explicit mapped_file(const std::string& path):
+         mapping {path.c_str(), boost::interprocess::read_only},
+         region {mapping, boost::interprocess::read_only}
+      {
+         region.advise(boost::interprocess::mapped_region::advice_sequential);
+      }
+};
+
+std::size_t le_char_to_16b(const unsigned char* bs)
 {
    std::size_t sz = 0;
    sz |= (static_cast<std::size_t>(bs[3]) << 24);
@@ -31,6 +52,24 @@ namespace filesystem
 using namespace dicom::data::attribute;
 using namespace util::log;
 
+part10_layout locate_part10(byte_view data, const std::string& name)
+{
+   // preamble, prefix and the file meta information group length attribute
+   const std::size_t header_start = 128 + 4;
+   const std::size_t group_length_size = 12;
+   if (data.size() < header_start + group_length_size
+       || !std::equal(data.begin()+128, data.begin()+header_start, "DICM")) {
+      throw std::runtime_error {"Not a DICOM file: " + name};
+   }
+
+   std::size_t metaheader_length = le_char_to_16b(data.begin()+header_start+8);
+   std::size_t dataset_start = header_start + group_length_size + metaheader_length;
+   if (dataset_start > data.size()) {
+      throw std::runtime_error {"Truncated file meta header in " + name};
+   }
+   return part10_layout {header_start, group_length_size + metaheader_length, dataset_start};
+}
+
 dicomfile::dicomfile(iod& dataset, data::dictionary::dictionaries& dict):
    dataset_ {dataset},
    preamble {0},
@@ -60,8 +99,9 @@ std::ostream& dicomfile::write_dataset(std::ostream &os)
    BOOST_LOG_SEV(logger, info) << "Starting to write dataset with transfer syntax: "
                                << transfer_proc->get_transfer_syntax();
 
-   auto bytes = transfer_proc->serialize(dataset_);
-   std::copy(std::begin(bytes), std::end(bytes), out);
+   transfer_proc->serialize(dataset_, [&os](byte_view chunk) {
+      os.write(reinterpret_cast<const char*>(chunk.data()), chunk.size());
+   });
 
    BOOST_LOG_SEV(logger, trace) << "Finished writing dataset";
 
@@ -129,19 +169,77 @@ std::istream& dicomfile::read_dataset(std::istream &is)
    is.seekg(current_pos, std::ios::beg);
    is.read((char*)&bytes[0], rest);
 
-   dataset_ = transfer_proc->deserialize(bytes);
+   dataset_ = transfer_proc->deserialize(byte_view {bytes}, filter);
 
    BOOST_LOG_SEV(logger, trace) << "Finished reading dataset";
 
    return is;
 }
 
+void dicomfile::open_mapped(const std::string& path)
+{
+   BOOST_LOG_SEV(logger, trace) << "Mapping file " << path;
+
+   std::shared_ptr<mapped_file> file;
+   try {
+      file = std::make_shared<mapped_file>(path);
+   } catch (std::exception& err) {
+      BOOST_LOG_SEV(logger, error) << "Error mapping file " << path << "\n"
+                                   << err.what();
+      throw std::runtime_error {"Could not map file " + path + ": " + err.what()};
+   }
+
+   byte_view data {static_cast<const unsigned char*>(file->region.get_address()),
+                   file->region.get_size()};
+
+   auto layout = locate_part10(data, path);
+   std::copy_n(data.begin(), 128, std::begin(preamble));
+   std::copy_n(data.begin()+128, 4, std::begin(prefix));
+
+   this->filemetaheader = metaheader_proc->deserialize(
+            data.subview(layout.metaheader_offset, layout.metaheader_size));
+
+   BOOST_LOG_SEV(logger, trace) << "Deserialized meta header\n"
+                                << filemetaheader;
+
+   std::string transfer_syntax = "";
+   try {
+      get_value_field<VR::UI>(filemetaheader[{0x0002, 0x0010}], transfer_syntax);
+      BOOST_LOG_SEV(logger, info) << "Transfer syntax of dataset is " << transfer_syntax;
+      transfer_proc = make_transfer_processor(transfer_syntax, dict);
+   } catch (std::exception& err) {
+      BOOST_LOG_SEV(logger, error) << "Error creating the transfer processor for transfer syntax: "
+                                   << transfer_syntax << "\n"
+                                   << err.what();
+      throw;
+   }
+
+   auto content = data.subview(layout.dataset_offset, data.size()-layout.dataset_offset);
+   mapped = encoded_dataset {content, file, transfer_proc->get_transfer_syntax()};
+   dataset_ = transfer_proc->deserialize_lazy(content, std::move(file), filter);
+
+   BOOST_LOG_SEV(logger, trace) << "Finished reading mapped dataset";
+}
+
+encoded_dataset dicomfile::encoded() const
+{
+   if (!mapped.owner) {
+      throw std::runtime_error {"No file was opened mapped"};
+   }
+   return mapped;
+}
+
 void dicomfile::set_transfer_syntax(std::string transfer_syntax)
 {
    transfer_proc = make_transfer_processor(transfer_syntax, dict);
    filemetaheader[{0x0002, 0x0010}] = make_elementfield<VR::UI>(transfer_proc->get_transfer_syntax());
 }
 
+void dicomfile::set_parse_filter(parse_filter filter)
+{
+   this->filter = std::move(filter);
+}
+
 iod& dicomfile::dataset()
 {
    return dataset_;
@@ -175,8 +273,8 @@ void dicomfile::create_filemetaheader()
       filemetaheader.erase(filemetaheader.find({0x0002, 0x0000}));
    }
    //auto metaheader_size = dataset_size(filemetaheader, true);
-   auto headerbytes = metaheader_proc->serialize(filemetaheader);
-   filemetaheader[{0x0002, 0x0000}] = make_elementfield<VR::UL>(headerbytes.size());
+   auto headersize = metaheader_proc->serialized_size(filemetaheader);
+   filemetaheader[{0x0002, 0x0000}] = make_elementfield<VR::UL>(headersize);
 }
 
 
@@ -16,6 +16,29 @@ namespace dicom
 namespace filesystem
 {
 
+/**
+ * @brief The part10_layout struct describes where the file meta header and
+ *        the dataset are located within a serialized DICOM file.
+ */
+struct part10_layout
+{
+      std::size_t metaheader_offset;
+      std::size_t metaheader_size;
+      std::size_t dataset_offset;
+};
+
+/**
+ * @brief locate_part10 checks the preamble and prefix of a DICOM file in the
+ *        format of part 10 chapter 7 and locates its file meta header by the
+ *        file meta information group length.
+ * @param data serialized file
+ * @param name name of the file used in error messages
+ * @return offsets and sizes of the file meta header and the dataset
+ * @throws std::runtime_error if the data is not a DICOM file or truncated
+ */
+part10_layout locate_part10(dicom::data::attribute::byte_view data,
+                            const std::string& name);
+
 /**
  * @brief The dicomfile class encapsulates a dicom dataset / iod for writing to
  *        and reading from a stream in the format as specified by DICOM standard
@@ -33,6 +56,8 @@ class dicomfile
       dicom::data::dictionary::dictionaries& dict;
       std::unique_ptr<dicom::data::dataset::transfer_processor> metaheader_proc;
       std::unique_ptr<dicom::data::dataset::transfer_processor> transfer_proc;
+      dicom::data::dataset::parse_filter filter;
+      dicom::data::dataset::encoded_dataset mapped;
 
       util::log::channel_sev_logger logger;
 
@@ -66,6 +91,30 @@ class dicomfile
        */
       std::istream& read_dataset(std::istream& is);
 
+      /**
+       * @brief open_mapped maps the file at the given path into memory and
+       *        parses the file meta header and the dataset directly from the
+       *        mapping.
+       * The value fields of the dataset are decoded lazily and keep the
+       * mapping alive, so large values like pixel data are not copied unless
+       * they are accessed. Unmodified values are written from the mapping
+       * when the dataset is serialized again.
+       * @param path path of the file to be read
+       * @throws std::runtime_error if the file cannot be mapped or is not a
+       *         DICOM file
+       */
+      void open_mapped(const std::string& path);
+
+      /**
+       * @brief encoded returns the serialized dataset of the file opened by
+       *        open_mapped(), excluding the file meta header. The view keeps
+       *        the mapping alive, so the dataset can be sent or copied
+       *        without being decoded and serialized again.
+       * @return view on the dataset in the transfer syntax of the file
+       * @throws std::runtime_error if no file was opened mapped
+       */
+      dicom::data::dataset::encoded_dataset encoded() const;
+
       /**
        * @brief set_transfer_syntax explicitly sets the transfer syntax used to
        *        read or write the dataset (excluding the file meta header)
@@ -73,6 +122,14 @@ class dicomfile
        */
       void set_transfer_syntax(std::string transfer_syntax);
 
+      /**
+       * @brief set_parse_filter restricts the attributes of the dataset which
+       *        are read by read_dataset() and open_mapped(), eg. to extract
+       *        the metadata without touching the pixel data.
+       * @param filter restriction of the deserialized attributes
+       */
+      void set_parse_filter(dicom::data::dataset::parse_filter filter);
+
       /**
        * @brief dataset is used to access the dataset, for example to access
        *        dataset read from stream
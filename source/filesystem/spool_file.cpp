@@ -0,0 +1,178 @@
+#include "spool_file.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include "data/attribute/attribute_field_coder.hpp"
+#include "util/uid.hpp"
+
+using namespace dicom::data::attribute;
+using namespace dicom::data::dataset;
+
+namespace dicom
+{
+
+namespace filesystem
+{
+
+/**
+ * @brief unique_part_path returns a temporary file name in the directory of
+ *        the finished file which is not used by another transfer, so that
+ *        concurrent transfers of the same instance do not write into the
+ *        same file
+ */
+static std::string unique_part_path(const std::string& final_path)
+{
+   boost::filesystem::path path {final_path};
+   auto part = path.parent_path() / boost::filesystem::unique_path(
+            path.filename().string() + ".%%%%-%%%%-%%%%-%%%%.part");
+   return part.string();
+}
+
+spool_file::spool_file(std::string path,
+                       data::dictionary::dictionaries& dict,
+                       const std::string& sop_class_uid,
+                       const std::string& sop_instance_uid,
+                       const std::string& transfer_syntax,
+                       std::set<tag_type> header_tags):
+   final_path {std::move(path)},
+   part_path {unique_part_path(final_path)},
+   os {part_path, std::ios::binary | std::ios::trunc},
+   header_tags {std::move(header_tags)},
+   parsing {!this->header_tags.empty()},
+   depth {0},
+   capturing {false},
+   capture_tag {},
+   capture_vr {VR::UN},
+   capture_len {0},
+   written {0},
+   finished {false}
+{
+   if (!os) {
+      throw std::runtime_error {"Could not create file " + part_path};
+   }
+
+   std::string ts {transfer_syntax};
+   ts.erase(std::remove(ts.begin(), ts.end(), '\0'), ts.end());
+   proc = make_transfer_processor(ts, dict);
+   endianness = proc->get_endianness();
+
+   dicom::util::uid uids;
+   iod filemetaheader;
+   filemetaheader[{0x0002, 0x0001}] = make_elementfield<VR::OB>({0x00, 0x01});
+   filemetaheader[{0x0002, 0x0002}] = make_elementfield<VR::UI>(sop_class_uid);
+   filemetaheader[{0x0002, 0x0003}] = make_elementfield<VR::UI>(sop_instance_uid);
+   filemetaheader[{0x0002, 0x0010}] = make_elementfield<VR::UI>(ts);
+   filemetaheader[{0x0002, 0x0012}] = make_elementfield<VR::UI>(uids.generate_uid());
+   filemetaheader[{0x0002, 0x0013}] = make_elementfield<VR::SH>("libdicompp");
+
+   little_endian_explicit metaheader_proc {dict};
+   auto headersize = metaheader_proc.serialized_size(filemetaheader);
+   filemetaheader[{0x0002, 0x0000}] = make_elementfield<VR::UL>(headersize);
+
+   const std::array<char, 128> preamble {};
+   os.write(preamble.data(), preamble.size());
+   os.write("DICM", 4);
+   auto headerbytes = metaheader_proc.serialize(filemetaheader);
+   os.write(reinterpret_cast<const char*>(headerbytes.data()), headerbytes.size());
+   if (!os) {
+      throw std::runtime_error {"Could not write file meta header to " + part_path};
+   }
+
+   if (parsing) {
+      stream_handler handler;
+      handler.element = [this](tag_type tag, VR vr, std::size_t len) {
+         check_leading(tag);
+         capturing = parsing && depth == 0
+               && this->header_tags.find(tag) != this->header_tags.end();
+         capture_tag = tag;
+         capture_vr = vr;
+         capture_len = len;
+      };
+      handler.value = [this](tag_type tag, byte_view chunk, std::size_t offset) {
+         // values up to the parser's buffer size arrive in one piece, larger
+         // ones are not routing information and are skipped
+         if (!capturing || tag != capture_tag || offset != 0 || chunk.size() != capture_len) {
+            capturing = false;
+            return;
+         }
+         header_[tag] = decode_value_field(chunk, endianness, capture_len, capture_vr, "*", 0);
+         capturing = false;
+      };
+      handler.sequence_begin = [this](tag_type tag, std::size_t) {
+         check_leading(tag);
+         capturing = false;
+         ++depth;
+      };
+      handler.sequence_end = [this](tag_type) {
+         --depth;
+      };
+      parser.reset(new stream_parser {*proc, handler});
+   }
+}
+
+spool_file::~spool_file()
+{
+   if (!finished) {
+      os.close();
+      std::remove(part_path.c_str());
+   }
+}
+
+void spool_file::check_leading(tag_type tag)
+{
+   if (depth == 0 && *header_tags.rbegin() < tag) {
+      // the remaining attributes are not parsed
+      parsing = false;
+   }
+}
+
+void spool_file::write(byte_view fragment)
+{
+   os.write(reinterpret_cast<const char*>(fragment.data()), fragment.size());
+   if (!os) {
+      throw std::runtime_error {"Could not write to file " + part_path};
+   }
+   written += fragment.size();
+   if (parsing) {
+      parser->feed(fragment);
+   }
+}
+
+void spool_file::finish()
+{
+   if (parsing) {
+      parser->finish();
+   }
+   os.close();
+   if (!os) {
+      throw std::runtime_error {"Could not complete file " + part_path};
+   }
+   if (std::rename(part_path.c_str(), final_path.c_str()) != 0) {
+      throw std::runtime_error {"Could not rename " + part_path + " to " + final_path};
+   }
+   finished = true;
+}
+
+const std::string& spool_file::path() const
+{
+   return final_path;
+}
+
+const iod& spool_file::header() const
+{
+   return header_;
+}
+
+std::size_t spool_file::dataset_size() const
+{
+   return written;
+}
+
+}
+
+}
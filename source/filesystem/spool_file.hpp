@@ -0,0 +1,121 @@
+#ifndef SPOOL_FILE_HPP
+#define SPOOL_FILE_HPP
+
+#include <string>
+#include <set>
+#include <memory>
+#include <fstream>
+#include <cstddef>
+
+#include "data/attribute/attribute.hpp"
+#include "data/attribute/byte_view.hpp"
+#include "data/dataset/datasets.hpp"
+#include "data/dataset/transfer_processor.hpp"
+#include "data/dataset/stream_parser.hpp"
+#include "data/dictionary/dictionary.hpp"
+
+namespace dicom
+{
+
+namespace filesystem
+{
+
+/**
+ * @brief The spool_file class writes a serialized dataset which arrives in
+ *        fragments, like the data set of a received C-STORE request, into a
+ *        DICOM file in the format of part 10 chapter 7.
+ * The preamble and a file meta header generated from the given UIDs are
+ * written on construction, the fragments are appended unchanged in the
+ * transfer syntax they were encoded in. The top-level attributes listed in
+ * header_tags are decoded while the fragments pass through, so the file may
+ * be routed without reading it again. The memory used is independent of the
+ * size of the dataset.
+ * The file is written under a temporary name, unique to the spool_file, in
+ * the same directory and renamed to the given path by finish(). Concurrent
+ * transfers of the same instance therefore never write into the same file.
+ * An unfinished file is removed when the spool_file is destroyed.
+ */
+class spool_file
+{
+   public:
+      /**
+       * @brief spool_file creates the file and writes the file meta header
+       * @param path path of the finished file
+       * @param dict dictionaries, must outlive the spool_file
+       * @param sop_class_uid SOP class UID of the dataset
+       * @param sop_instance_uid SOP instance UID of the dataset
+       * @param transfer_syntax transfer syntax the dataset is encoded in
+       * @param header_tags top-level attributes to be decoded
+       * @throws std::runtime_error if the file cannot be created
+       */
+      spool_file(std::string path,
+                 dicom::data::dictionary::dictionaries& dict,
+                 const std::string& sop_class_uid,
+                 const std::string& sop_instance_uid,
+                 const std::string& transfer_syntax,
+                 std::set<dicom::data::attribute::tag_type> header_tags = {});
+
+      spool_file(const spool_file&) = delete;
+      spool_file& operator=(const spool_file&) = delete;
+
+      ~spool_file();
+
+      /**
+       * @brief write appends the next fragment of the dataset
+       * @param fragment next part of the serialized dataset
+       * @throws std::runtime_error if the fragment cannot be written or the
+       *         leading attributes cannot be parsed
+       */
+      void write(dicom::data::attribute::byte_view fragment);
+
+      /**
+       * @brief finish completes the file after the last fragment
+       * @throws std::runtime_error if the file cannot be completed
+       */
+      void finish();
+
+      /**
+       * @brief path returns the path of the finished file
+       */
+      const std::string& path() const;
+
+      /**
+       * @brief header returns the decoded attributes of header_tags which
+       *        were present in the dataset
+       */
+      const dicom::data::dataset::iod& header() const;
+
+      /**
+       * @brief dataset_size returns the number of dataset bytes written
+       */
+      std::size_t dataset_size() const;
+
+   private:
+      std::string final_path;
+      std::string part_path;
+      std::ofstream os;
+
+      std::unique_ptr<dicom::data::dataset::transfer_processor> proc;
+      dicom::data::attribute::ENDIANNESS endianness;
+      std::set<dicom::data::attribute::tag_type> header_tags;
+      dicom::data::dataset::iod header_;
+
+      std::unique_ptr<dicom::data::dataset::stream_parser> parser;
+      bool parsing;
+      std::size_t depth;
+      bool capturing;
+      dicom::data::attribute::tag_type capture_tag;
+      dicom::data::attribute::VR capture_vr;
+      std::size_t capture_len;
+
+      std::size_t written;
+      bool finished;
+
+      void check_leading(dicom::data::attribute::tag_type tag);
+};
+
+}
+
+}
+
+#endif // SPOOL_FILE_HPP
@@ -59,6 +59,12 @@ void asio_tcp_connection::write_data(void* data_offset, std::size_t len,
    boost::asio::async_write(*socket, boost::asio::buffer(data_offset, len), on_complete);
 }
 
+void asio_tcp_connection::write_data(std::vector<boost::asio::const_buffer> buffers,
+                                     std::function<void (const boost::system::error_code&, std::size_t)> on_complete)
+{
+   boost::asio::async_write(*socket, buffers, on_complete);
+}
+
 void asio_tcp_connection::read_data(std::shared_ptr<std::vector<unsigned char>> buffer,
                                     std::size_t len,
                                     std::function<void(const boost::system::error_code&, std::size_t)> on_complete)
@@ -66,6 +72,12 @@ void asio_tcp_connection::read_data(std::shared_ptr<std::vector<unsigned char>>
    boost::asio::async_read(*socket, boost::asio::buffer(*buffer), boost::asio::transfer_exactly(len), on_complete);
 }
 
+void asio_tcp_connection::read_data(void* data_offset, std::size_t len,
+                                    std::function<void(const boost::system::error_code&, std::size_t)> on_complete)
+{
+   boost::asio::async_read(*socket, boost::asio::buffer(data_offset, len), boost::asio::transfer_exactly(len), on_complete);
+}
+
 void asio_tcp_connection::read_data(std::shared_ptr<std::vector<unsigned char>> buffer,
                                     std::function<void(const boost::system::error_code&, std::size_t)> on_complete)
 {
@@ -77,6 +89,11 @@ std::unique_ptr<Iinfrastructure_timeout_connection> asio_tcp_connection::timeout
    return std::unique_ptr<Iinfrastructure_timeout_connection> { new timeout_connection {io_s, timeout, on_timeout}};
 }
 
+void asio_tcp_connection::post(std::function<void()> f)
+{
+   io_s.post(f);
+}
+
 void asio_tcp_connection::close()
 {
    io_s.post([this]() {
@@ -77,6 +77,18 @@ struct Iinfrastructure_upperlayer_connection
         virtual void write_data(void* data_offset, std::size_t len,
                         std::function<void (const boost::system::error_code&, std::size_t)> on_complete) = 0;
 
+        /**
+         * @brief write_data writes a sequence of buffers with a single gathering
+         *        write and invokes the completion handler when all of them
+         *        have been written
+         * @param buffers buffers to be written in order
+         * @param on_complete completion handler when data has been written
+         * The invoker has the responsibility that the memory referenced by the
+         * buffers is valid until the completion handler is invoked.
+         */
+        virtual void write_data(std::vector<boost::asio::const_buffer> buffers,
+                        std::function<void (const boost::system::error_code&, std::size_t)> on_complete) = 0;
+
         /**
          * @brief read_data read a certain amount of bytes and store it in the given buffer.
          * @param buffer buffer to store the read data in
@@ -88,6 +100,19 @@ struct Iinfrastructure_upperlayer_connection
         virtual void read_data(std::shared_ptr<std::vector<unsigned char>> buffer, std::size_t len,
                        std::function<void(const boost::system::error_code&, std::size_t)> on_complete) = 0;
 
+        /**
+         * @brief read_data reads a certain amount of bytes into a preallocated
+         *        buffer and invokes the completion handler when finished
+         * @param data_offset pointer to the position in the buffer where the
+         *        data is stored
+         * @param len amount of data to read in bytes
+         * @param on_complete completion handler when data has been read
+         * The invoker has the responsibility that at least len bytes starting
+         * at data_offset are valid until the completion handler is invoked.
+         */
+        virtual void read_data(void* data_offset, std::size_t len,
+                       std::function<void(const boost::system::error_code&, std::size_t)> on_complete) = 0;
+
         /**
          * @brief read_data reads data until eof and stores it in the given buffer.
          * @param buffer buffer to store the read data in
@@ -109,6 +134,13 @@ struct Iinfrastructure_upperlayer_connection
                                          std::chrono::duration<int> timeout,
                                          std::function<void()> on_timeout) = 0;
 
+        /**
+         * @brief post schedules the function for execution on the thread
+         *        which handles the connection. May be called from any thread.
+         * @param f function to be executed
+         */
+        virtual void post(std::function<void()> f) = 0;
+
         /**
          * @brief is_stopped is used to check whether the connection is alive
          * @return true if connection is closed, false otherwise
@@ -140,9 +172,15 @@ class asio_tcp_connection : public Iinfrastructure_upperlayer_connection
       void write_data(void* data_offset, std::size_t len,
                       std::function<void (const boost::system::error_code&, std::size_t)> on_complete) override;
 
+      void write_data(std::vector<boost::asio::const_buffer> buffers,
+                      std::function<void (const boost::system::error_code&, std::size_t)> on_complete) override;
+
       void read_data(std::shared_ptr<std::vector<unsigned char>> buffer, std::size_t len,
                      std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override;
 
+      void read_data(void* data_offset, std::size_t len,
+                     std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override;
+
       void read_data(std::shared_ptr<std::vector<unsigned char>> buffer,
                      std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override;
 
@@ -150,6 +188,8 @@ class asio_tcp_connection : public Iinfrastructure_upperlayer_connection
               std::chrono::duration<int> timeout,
               std::function<void()> on_timeout) override;
 
+      void post(std::function<void()> f) override;
+
       bool is_stopped() const override
       {
          return io_s.stopped();
@@ -1,5 +1,55 @@
 #include "asio_tcp_connection_manager.hpp"
 
+#include <algorithm>
+#include <thread>
+
+namespace
+{
+
+std::vector<std::unique_ptr<boost::asio::io_service>> make_io_pool(std::size_t threads)
+{
+   if (threads == 0) {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+   }
+   std::vector<std::unique_ptr<boost::asio::io_service>> pool;
+   for (std::size_t i=0; i<threads; ++i) {
+      pool.emplace_back(new boost::asio::io_service {});
+   }
+   return pool;
+}
+
+/**
+ * @brief The accept_error class is thrown if accepting connections fails,
+ *        which ends the server, unlike the errors of single connections.
+ */
+class accept_error: public boost::system::system_error
+{
+   public:
+      using boost::system::system_error::system_error;
+};
+
+/**
+ * @brief run_io_service runs an io_service of the pool until it is stopped.
+ *        Exceptions escaping a handler are logged and do not terminate the
+ *        other connections on the io_service. Only an accept_error is
+ *        passed on.
+ */
+void run_io_service(boost::asio::io_service& io_s)
+{
+   for (;;) {
+      try {
+         io_s.run();
+         return;
+      } catch (accept_error&) {
+         throw;
+      } catch (std::exception& err) {
+         BOOST_LOG_TRIVIAL(error) << "Error in connection handler: " << err.what();
+      }
+   }
+}
+
+}
+
 
 Iinfrastructure_server_acceptor::~Iinfrastructure_server_acceptor()
 {
@@ -14,20 +64,51 @@ Iinfrastructure_client_acceptor::~Iinfrastructure_client_acceptor()
 
 asio_tcp_server_acceptor::asio_tcp_server_acceptor(short port,
                                                    std::function<void(Iinfrastructure_upperlayer_connection*)> new_connection,
-                                                   std::function<void(Iinfrastructure_upperlayer_connection*)> end_connection):
+                                                   std::function<void(Iinfrastructure_upperlayer_connection*)> end_connection,
+                                                   std::size_t threads):
    handler_new {new_connection},
    handler_end {end_connection},
-   io_s {},
-   acptr {io_s, boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)}
+   io_pool {make_io_pool(threads)},
+   next_io {0},
+   acptr {*io_pool.front(), boost::asio::ip::tcp::endpoint(boost::asio::ip::tcp::v4(), port)}
 {
-   using namespace std::placeholders;
-   auto socket = std::make_shared<boost::asio::ip::tcp::socket>(acptr.get_io_service());
-   acptr.async_accept(*socket, [socket, this](boost::system::error_code ec) { accept_new(socket, ec); });
+   start_accept();
 }
 
 void asio_tcp_server_acceptor::run()
 {
-   io_s.run();
+   // keep the io_services without pending operations alive until the
+   // acceptor stops
+   std::vector<std::unique_ptr<boost::asio::io_service::work>> work;
+   std::vector<std::thread> threads;
+   for (std::size_t i=1; i<io_pool.size(); ++i) {
+      auto& io_s = *io_pool[i];
+      work.emplace_back(new boost::asio::io_service::work {io_s});
+      threads.emplace_back([&io_s]() { run_io_service(io_s); });
+   }
+
+   auto stop = [&]() {
+      work.clear();
+      for (std::size_t i=1; i<io_pool.size(); ++i) {
+         io_pool[i]->stop();
+      }
+      for (auto& thread : threads) {
+         thread.join();
+      }
+   };
+
+   try {
+      run_io_service(*io_pool.front());
+   } catch (...) {
+      stop();
+      throw;
+   }
+   stop();
+}
+
+void asio_tcp_server_acceptor::stop()
+{
+   io_pool.front()->stop();
 }
 
 void asio_tcp_server_acceptor::set_handler_new(std::function<void(Iinfrastructure_upperlayer_connection*)> handler)
@@ -40,22 +121,43 @@ void asio_tcp_server_acceptor::set_handler_end(std::function<void (Iinfrastructu
    handler_end = handler;
 }
 
-void asio_tcp_server_acceptor::accept_new(std::shared_ptr<boost::asio::ip::tcp::socket> sock, boost::system::error_code ec)
+void asio_tcp_server_acceptor::start_accept()
 {
-   using namespace std::placeholders;
-   if (!ec) {
+   auto& io_s = next_io_service();
+   auto socket = std::make_shared<boost::asio::ip::tcp::socket>(io_s);
+   acptr.async_accept(*socket, [socket, &io_s, this](boost::system::error_code ec) { accept_new(socket, io_s, ec); });
+}
+
+boost::asio::io_service& asio_tcp_server_acceptor::next_io_service()
+{
+   // only called from the accepting io_service, no synchronization needed
+   auto& io_s = *io_pool[next_io];
+   next_io = (next_io + 1) % io_pool.size();
+   return io_s;
+}
+
+void asio_tcp_server_acceptor::accept_new(std::shared_ptr<boost::asio::ip::tcp::socket> sock,
+                                          boost::asio::io_service& io_s,
+                                          boost::system::error_code ec)
+{
+   if (ec) {
+      throw accept_error {ec};
+   }
+
+   Iinfrastructure_upperlayer_connection* conn;
+   {
+      std::lock_guard<std::mutex> lock {connections_lock};
       connections.push_back(std::unique_ptr<asio_tcp_connection>
          {
             new asio_tcp_connection {io_s, sock, handler_end}
          });
-   } else {
-      throw boost::system::system_error(ec);
+      conn = connections.back().get();
    }
 
-   handler_new(connections.back().get());
+   // the connection is handled on the thread of its io_service from the start
+   io_s.post([this, conn]() { handler_new(conn); });
 
-   auto newsock = std::make_shared<boost::asio::ip::tcp::socket>(acptr.get_io_service());
-   acptr.async_accept(*newsock, [newsock, this](boost::system::error_code ec) { accept_new(newsock, ec); });
+   start_accept();
 }
 
 //
@@ -63,6 +165,7 @@ void asio_tcp_server_acceptor::accept_new(std::shared_ptr<boost::asio::ip::tcp::
 asio_tcp_client_acceptor::asio_tcp_client_acceptor(std::string host, std::string port,
                                                    std::function<void(Iinfrastructure_upperlayer_connection*)> new_connection,
                                                    std::function<void(Iinfrastructure_upperlayer_connection*)> end_connection):
+   connection_started {false},
    handler_new {new_connection},
    handler_end {end_connection},
    io_s {},
@@ -90,7 +193,10 @@ void asio_tcp_client_acceptor::accept_new()
 
 void asio_tcp_client_acceptor::run()
 {
-   accept_new();
+   if (!connection_started) {
+      accept_new();
+   }
+   connection_started = false;
    io_s.run();
 }
 
@@ -107,4 +213,22 @@ void asio_tcp_client_acceptor::set_handler_end(std::function<void (Iinfrastructu
 void asio_tcp_client_acceptor::accept_new_conn()
 {
    accept_new();
+   connection_started = true;
+}
+
+void asio_tcp_client_acceptor::stop()
+{
+   io_s.stop();
+}
+
+void asio_tcp_client_acceptor::resume()
+{
+   io_s.restart();
+   io_s.run();
+}
+
+void asio_tcp_client_acceptor::poll()
+{
+   io_s.restart();
+   io_s.poll();
 }
@@ -1,6 +1,9 @@
 #ifndef ASIO_TCP_CONNECTION_MANAGER_HPP
 #define ASIO_TCP_CONNECTION_MANAGER_HPP
 
+#include <mutex>
+#include <vector>
+
 #include "asio_tcp_connection.hpp"
 
 
@@ -66,37 +69,93 @@ struct Iinfrastructure_client_acceptor
        */
       virtual void accept_new_conn() = 0;
 
+      /**
+       * @brief stop makes run() or resume() return without closing the
+       *        connections, eg. to keep an association open for reuse
+       */
+      virtual void stop() = 0;
+
+      /**
+       * @brief resume handles the open connections again after stop(), until
+       *        stop() is called or all connections have ended
+       */
+      virtual void resume() = 0;
+
+      /**
+       * @brief poll handles the events of the open connections which are
+       *        ready, without blocking
+       */
+      virtual void poll() = 0;
+
       virtual ~Iinfrastructure_client_acceptor() = 0;
 };
 
 /**
  * @brief The asio_tcp_server_acceptor class encapsulates functionality to
  *        accept tcp connection as a server using boost asio.
+ * The acceptor may run a pool of io_services, each driven by its own thread.
+ * Accepted connections are assigned to the io_services round-robin and stay
+ * on it for their whole lifetime, so all handlers of a connection, including
+ * the new connection handler, are invoked sequentially on the same thread.
+ * With more than one thread, the new and end connection handlers of different
+ * connections may be invoked concurrently.
  */
 class asio_tcp_server_acceptor : public Iinfrastructure_server_acceptor
 {
     public:
+        /**
+         * @brief asio_tcp_server_acceptor constructs the acceptor and starts
+         *        accepting on the given port
+         * @param port port to listen on
+         * @param new_connection handler for new connections
+         * @param end_connection handler for terminated connections
+         * @param threads number of io_services / threads handling the
+         *        connections, 0 selects the number of hardware threads
+         */
         asio_tcp_server_acceptor(short port,
                                  std::function<void(Iinfrastructure_upperlayer_connection*)> new_connection = nullptr,
-                                 std::function<void(Iinfrastructure_upperlayer_connection*)> end_connection = nullptr);
-
+                                 std::function<void(Iinfrastructure_upperlayer_connection*)> end_connection = nullptr,
+                                 std::size_t threads = 1);
+
+        /**
+         * @brief run runs the io_services of the pool until the acceptor
+         *        stops. The first io_service, which also accepts the
+         *        connections, runs on the calling thread.
+         * An exception escaping the handlers of a connection is logged on
+         * every io_service and does not affect the other connections. Only
+         * a failure to accept connections is thrown by run().
+         */
         void run() override;
 
+        /**
+         * @brief stop makes run() return, closing the connection threads.
+         *        May be called from any thread.
+         */
+        void stop();
+
         void set_handler_new(std::function<void(Iinfrastructure_upperlayer_connection*)> handler) override;
 
         void set_handler_end(std::function<void(Iinfrastructure_upperlayer_connection*)> handler) override;
 
 
     private:
-        void accept_new(std::shared_ptr<boost::asio::ip::tcp::socket> sock, boost::system::error_code ec);
+        void accept_new(std::shared_ptr<boost::asio::ip::tcp::socket> sock,
+                        boost::asio::io_service& io_svc, boost::system::error_code ec);
 
-        std::vector<std::unique_ptr<Iinfrastructure_upperlayer_connection>> connections;
+        void start_accept();
+
+        boost::asio::io_service& next_io_service();
 
         std::function<void(Iinfrastructure_upperlayer_connection*)> handler_new;
         std::function<void(Iinfrastructure_upperlayer_connection*)> handler_end;
 
-        boost::asio::io_service io_s;
+        std::vector<std::unique_ptr<boost::asio::io_service>> io_pool;
+        std::size_t next_io;
         boost::asio::ip::tcp::acceptor acptr;
+
+        // declared after the io_services so the sockets are closed first
+        std::mutex connections_lock;
+        std::vector<std::unique_ptr<Iinfrastructure_upperlayer_connection>> connections;
 };
 
 /**
@@ -111,6 +170,11 @@ class asio_tcp_client_acceptor : public Iinfrastructure_client_acceptor
                                  std::function<void(Iinfrastructure_upperlayer_connection*)> new_connection = nullptr,
                                  std::function<void(Iinfrastructure_upperlayer_connection*)> end_connection = nullptr);
 
+        /**
+         * @brief run starts a connection, unless one was started by
+         *        accept_new_conn() already, and handles the connections
+         *        until they have ended
+         */
         void run() override;
 
         void set_handler_new(std::function<void(Iinfrastructure_upperlayer_connection*)> handler) override;
@@ -119,11 +183,20 @@ class asio_tcp_client_acceptor : public Iinfrastructure_client_acceptor
 
         void accept_new_conn() override;
 
+        void stop() override;
+
+        void resume() override;
+
+        void poll() override;
+
     private:
         void accept_new();
 
         std::vector<std::unique_ptr<Iinfrastructure_upperlayer_connection>> connections;
 
+        // set if accept_new_conn() started a connection before run()
+        bool connection_started;
+
         std::function<void(Iinfrastructure_upperlayer_connection*)> handler_new;
         std::function<void(Iinfrastructure_upperlayer_connection*)> handler_end;
 
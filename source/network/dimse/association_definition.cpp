@@ -95,8 +95,14 @@ upperlayer::a_associate_rq association_definition::get_initial_request() const
    return request;
 }
 
+void association_definition::set_async_ops_window(unsigned short max_invoked, unsigned short max_performed)
+{
+   request.max_ops_invoked = max_invoked;
+   request.max_ops_performed = max_performed;
+}
+
 std::vector<association_definition::presentation_context> make_presentation_contexts(std::vector<SOP_class> sop_classes,
-      std::initializer_list<std::string> transfer_syntaxes,
+      std::vector<std::string> transfer_syntaxes,
       association_definition::DIMSE_MSG_TYPE msg_type)
 {
    std::vector<association_definition::presentation_context> pcs;
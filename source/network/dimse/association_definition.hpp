@@ -92,6 +92,17 @@ class association_definition
        */
       upperlayer::a_associate_rq get_initial_request() const;
 
+      /**
+       * @brief set_async_ops_window sets the asynchronous operations window
+       *        proposed by a requestor, or the maximum accepted by an
+       *        acceptor of the association.
+       * @param max_invoked maximum number of outstanding operations invoked
+       *        by the requestor, 0 for unlimited
+       * @param max_performed maximum number of outstanding operations
+       *        performed by the requestor, 0 for unlimited
+       */
+      void set_async_ops_window(unsigned short max_invoked, unsigned short max_performed = 1);
+
    private:
       upperlayer::a_associate_rq request;
       std::vector<presentation_context> supported_sops;
@@ -107,7 +118,7 @@ class association_definition
  */
 std::vector<association_definition::presentation_context> make_presentation_contexts(
       std::vector<SOP_class> sop_classes,
-      std::initializer_list<std::string> transfer_syntaxes,
+      std::vector<std::string> transfer_syntaxes,
       association_definition::DIMSE_MSG_TYPE msg_type);
 
 /**
@@ -0,0 +1,316 @@
+#include "association_pool.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <tuple>
+#include <stdexcept>
+
+using namespace dicom::data::dataset;
+
+namespace dicom
+{
+
+namespace network
+{
+
+namespace dimse
+{
+
+using namespace util::log;
+
+association_key::association_key(const connection& endpoint,
+                                 const upperlayer::a_associate_rq& request):
+   host {endpoint.host},
+   port {endpoint.port},
+   calling_ae {request.calling_ae},
+   called_ae {request.called_ae},
+   application_context {request.application_context},
+   max_message_length {request.max_message_length},
+   max_ops_invoked {request.max_ops_invoked},
+   max_ops_performed {request.max_ops_performed}
+{
+   for (const auto& pc : request.pres_contexts) {
+      presentation_contexts.emplace_back(pc.abstract_syntax, pc.transfer_syntaxes);
+   }
+}
+
+bool association_key::operator<(const association_key& other) const
+{
+   return std::tie(host, port, calling_ae, called_ae, application_context,
+                   max_message_length, max_ops_invoked, max_ops_performed, presentation_contexts)
+         < std::tie(other.host, other.port, other.calling_ae, other.called_ae, other.application_context,
+                    other.max_message_length, other.max_ops_invoked, other.max_ops_performed,
+                    other.presentation_contexts);
+}
+
+bool association_key::operator==(const association_key& other) const
+{
+   return std::tie(host, port, calling_ae, called_ae, application_context,
+                   max_message_length, max_ops_invoked, max_ops_performed, presentation_contexts)
+         == std::tie(other.host, other.port, other.calling_ae, other.called_ae, other.application_context,
+                     other.max_message_length, other.max_ops_invoked, other.max_ops_performed,
+                     other.presentation_contexts);
+}
+
+
+pooled_association::pooled_association(connection endpoint,
+                                       upperlayer::a_associate_rq request,
+                                       const association_definition& operations,
+                                       data::dictionary::dictionaries& dict,
+                                       std::unique_ptr<Iinfrastructure_client_acceptor> acceptor):
+   key_ {endpoint, request},
+   request {request},
+   acceptor {std::move(acceptor)},
+   current {new association_definition {operations}},
+   scu {*this->acceptor, dict, this->request},
+   manager {scu, forward_to_current(operations), dict},
+   pm {nullptr},
+   started {false},
+   parked {false},
+   parked_at {},
+   logger {"pooled association"}
+{
+}
+
+pooled_association::~pooled_association()
+{
+}
+
+const association_key& pooled_association::key() const
+{
+   return key_;
+}
+
+void pooled_association::use(const association_definition& operations)
+{
+   current.reset(new association_definition {operations});
+}
+
+association_definition pooled_association::forward_to_current(const association_definition& operations)
+{
+   using sop_handler = std::function<void(dimse_pm*, commandset_data, std::unique_ptr<iod>)>;
+
+   std::vector<association_definition::presentation_context> pcs;
+   for (const auto& pc : operations.get_all_SOP()) {
+      auto uid = pc.sop_class.get_SOP_class_UID();
+      auto msg_type = pc.msg_type;
+      std::map<DIMSE_SERVICE_GROUP, sop_handler> handlers;
+      for (auto sg : pc.sop_class.get_service_groups()) {
+         handlers[sg] = [this, uid, msg_type, sg](dimse_pm* pm, commandset_data command, std::unique_ptr<iod> data) {
+            this->pm = pm;
+            for (const auto& target : current->get_SOP_class(uid)) {
+               if (target.msg_type == msg_type) {
+                  target.sop_class(pm, sg, std::move(command), std::move(data));
+                  return;
+               }
+            }
+         };
+      }
+      pcs.emplace_back(SOP_class {uid, handlers}, pc.transfer_syntaxes, msg_type);
+   }
+   return association_definition {request.calling_ae, request.called_ae, pcs,
+                                  static_cast<int>(request.max_message_length),
+                                  request.application_context};
+}
+
+void pooled_association::run()
+{
+   parked = false;
+   if (!started) {
+      started = true;
+      manager.run();
+      return;
+   }
+
+   if (pm == nullptr || manager.active_associations() == 0) {
+      throw std::runtime_error {"Reusing an association which has ended"};
+   }
+   BOOST_LOG_SEV(logger, info) << "Reusing association " << pm;
+   pm->restart_operations();
+   // the operations may have been completed right away
+   if (!parked) {
+      acceptor->resume();
+   }
+}
+
+void pooled_association::park()
+{
+   parked = true;
+   parked_at = std::chrono::steady_clock::now();
+   acceptor->stop();
+}
+
+bool pooled_association::is_open()
+{
+   if (pm == nullptr) {
+      return false;
+   }
+   acceptor->poll();
+   return manager.active_associations() > 0 && pm->is_connected();
+}
+
+void pooled_association::release()
+{
+   if (!is_open()) {
+      return;
+   }
+   BOOST_LOG_SEV(logger, info) << "Releasing association " << pm;
+   pm->release_association();
+   acceptor->resume();
+}
+
+std::chrono::steady_clock::time_point pooled_association::idle_since() const
+{
+   return parked_at;
+}
+
+
+association_pool::association_pool(data::dictionary::dictionaries& dict,
+                                   std::chrono::milliseconds idle_timeout,
+                                   acceptor_factory factory):
+   stopping {false},
+   dict {dict},
+   idle_timeout {idle_timeout},
+   factory {factory},
+   logger {"association pool"}
+{
+   if (!this->factory) {
+      this->factory = [](const connection& endpoint) {
+         return std::unique_ptr<Iinfrastructure_client_acceptor> {
+            new asio_tcp_client_acceptor {endpoint.host, std::to_string(endpoint.port)}
+         };
+      };
+   }
+   reaper = std::thread {[this]() { reap(); }};
+}
+
+association_pool::~association_pool()
+{
+   {
+      std::lock_guard<std::mutex> lock {idle_lock};
+      stopping = true;
+   }
+   idle_changed.notify_one();
+   reaper.join();
+
+   for (auto& entry : idle) {
+      try {
+         entry.second->release();
+      } catch (std::exception& err) {
+         BOOST_LOG_SEV(logger, warning) << "Error releasing association: " << err.what();
+      }
+   }
+}
+
+std::unique_ptr<pooled_association> association_pool::acquire(const connection& endpoint,
+                                                              const upperlayer::a_associate_rq& request,
+                                                              const association_definition& operations)
+{
+   release_expired();
+
+   association_key key {endpoint, request};
+   while (true) {
+      std::unique_ptr<pooled_association> association;
+      {
+         std::lock_guard<std::mutex> lock {idle_lock};
+         auto range = idle.equal_range(key);
+         if (range.first == range.second) {
+            break;
+         }
+         // the most recently used association, the others may expire
+         auto latest = std::prev(range.second);
+         association = std::move(latest->second);
+         idle.erase(latest);
+      }
+
+      if (association->is_open()) {
+         BOOST_LOG_SEV(logger, debug) << "Handing out idle association to " << endpoint.host;
+         association->use(operations);
+         return association;
+      }
+      BOOST_LOG_SEV(logger, debug) << "Discarding idle association closed by the peer";
+   }
+
+   BOOST_LOG_SEV(logger, debug) << "Creating new association to " << endpoint.host;
+   return std::unique_ptr<pooled_association> {
+      new pooled_association {endpoint, request, operations, dict, factory(endpoint)}
+   };
+}
+
+void association_pool::put_back(std::unique_ptr<pooled_association> association)
+{
+   if (!association || !association->is_open()) {
+      BOOST_LOG_SEV(logger, debug) << "Discarding association which has ended";
+      return;
+   }
+   {
+      std::lock_guard<std::mutex> lock {idle_lock};
+      auto key = association->key();
+      idle.emplace(std::move(key), std::move(association));
+   }
+   idle_changed.notify_one();
+}
+
+std::size_t association_pool::idle_associations()
+{
+   std::lock_guard<std::mutex> lock {idle_lock};
+   return idle.size();
+}
+
+void association_pool::release_expired()
+{
+   std::vector<std::unique_ptr<pooled_association>> expired;
+   {
+      std::lock_guard<std::mutex> lock {idle_lock};
+      auto now = std::chrono::steady_clock::now();
+      for (auto it = idle.begin(); it != idle.end(); ) {
+         if (now - it->second->idle_since() >= idle_timeout) {
+            expired.push_back(std::move(it->second));
+            it = idle.erase(it);
+         } else {
+            ++it;
+         }
+      }
+   }
+
+   // releasing waits for the peer, so it is done outside of the lock
+   for (auto& association : expired) {
+      try {
+         association->release();
+      } catch (std::exception& err) {
+         BOOST_LOG_SEV(logger, warning) << "Error releasing association: " << err.what();
+      }
+   }
+}
+
+void association_pool::reap()
+{
+   using entry = std::pair<const association_key, std::unique_ptr<pooled_association>>;
+   std::unique_lock<std::mutex> lock {idle_lock};
+   while (!stopping) {
+      if (idle.empty()) {
+         idle_changed.wait(lock);
+         continue;
+      }
+
+      auto oldest = std::min_element(idle.begin(), idle.end(), [](const entry& lhs, const entry& rhs) {
+         return lhs.second->idle_since() < rhs.second->idle_since();
+      });
+      auto expiry = oldest->second->idle_since() + idle_timeout;
+      if (std::chrono::steady_clock::now() < expiry) {
+         // woken up early by put_back() or the destructor
+         idle_changed.wait_until(lock, expiry);
+         continue;
+      }
+
+      lock.unlock();
+      release_expired();
+      lock.lock();
+   }
+}
+
+}
+
+}
+
+}
@@ -0,0 +1,247 @@
+#ifndef ASSOCIATION_POOL_HPP
+#define ASSOCIATION_POOL_HPP
+
+#include <string>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <chrono>
+#include <functional>
+#include <utility>
+
+#include "dimse_pm.hpp"
+#include "association_definition.hpp"
+#include "network/connection.hpp"
+#include "network/upperlayer/upperlayer.hpp"
+#include "infrastructure/asio_tcp_connection_manager.hpp"
+#include "data/dictionary/dictionary.hpp"
+#include "util/channel_sev_logger.hpp"
+
+namespace dicom
+{
+
+namespace network
+{
+
+namespace dimse
+{
+
+/**
+ * @brief The association_key struct identifies the associations which may be
+ *        used interchangeably: those to the same peer with the same AE
+ *        titles, application context, maximum PDU length and asynchronous
+ *        operations window, proposing the same presentation contexts.
+ */
+struct association_key
+{
+      association_key(const connection& endpoint,
+                      const upperlayer::a_associate_rq& request);
+
+      std::string host;
+      short port;
+      std::string calling_ae;
+      std::string called_ae;
+      std::string application_context;
+      std::size_t max_message_length;
+      unsigned short max_ops_invoked;
+      unsigned short max_ops_performed;
+
+      // abstract syntax and proposed transfer syntaxes of each presentation
+      // context, in the order of their ids
+      std::vector<std::pair<std::string, std::vector<std::string>>> presentation_contexts;
+
+      bool operator<(const association_key& other) const;
+      bool operator==(const association_key& other) const;
+};
+
+/**
+ * @brief The pooled_association class is an association requested by this
+ *        side which is kept open after its operations are done, so another
+ *        series of operations may be performed on it later without
+ *        connecting and negotiating again.
+ * The SOP class handlers of the association are those of the definition
+ * most recently set with use(). Like the other connections, a
+ * pooled_association is only used by one thread at a time.
+ */
+class pooled_association
+{
+   public:
+      pooled_association(connection endpoint,
+                         upperlayer::a_associate_rq request,
+                         const association_definition& operations,
+                         data::dictionary::dictionaries& dict,
+                         std::unique_ptr<Iinfrastructure_client_acceptor> acceptor);
+      pooled_association(const pooled_association&) = delete;
+      pooled_association& operator=(const pooled_association&) = delete;
+
+      ~pooled_association();
+
+      const association_key& key() const;
+
+      /**
+       * @brief use sets the definition whose SOP class handlers are invoked
+       *        by the following run()
+       * @param operations association definition of the caller, must
+       *        propose the same presentation contexts as the one the
+       *        association was created with
+       */
+      void use(const association_definition& operations);
+
+      /**
+       * @brief run connects and negotiates the association on the first
+       *        invocation and restarts its operations on later ones. It
+       *        returns when park() is called by a handler or the association
+       *        ends.
+       */
+      void run();
+
+      /**
+       * @brief park is called from a SOP class handler instead of releasing
+       *        the association when the operations are done. run() returns
+       *        and the association stays open.
+       */
+      void park();
+
+      /**
+       * @brief is_open handles the events which arrived on the parked
+       *        association, like a release request or an abort of the peer,
+       *        and returns true if it is still established
+       */
+      bool is_open();
+
+      /**
+       * @brief release releases the parked association and returns when the
+       *        connection has ended
+       */
+      void release();
+
+      /**
+       * @brief idle_since returns the time the association was parked
+       */
+      std::chrono::steady_clock::time_point idle_since() const;
+
+   private:
+      association_key key_;
+      upperlayer::a_associate_rq request;
+
+      // declared before the connection objects, which reference it
+      std::unique_ptr<Iinfrastructure_client_acceptor> acceptor;
+      std::unique_ptr<association_definition> current;
+      upperlayer::scu scu;
+      dimse_pm_manager manager;
+
+      dimse_pm* pm;
+      bool started;
+      bool parked;
+      std::chrono::steady_clock::time_point parked_at;
+
+      /**
+       * @brief forward_to_current returns a definition with the same
+       *        presentation contexts whose handlers invoke those of the
+       *        current definition
+       */
+      association_definition forward_to_current(const association_definition& operations);
+
+      util::log::channel_sev_logger logger;
+};
+
+/**
+ * @brief The association_pool class keeps associations open after use and
+ *        hands them to later callers with the same association_key, so
+ *        their operations skip the TCP connection setup and the
+ *        A-ASSOCIATE negotiation.
+ * Associations which were idle for longer than the idle timeout are released
+ * by a thread of the pool, whether or not the pool is used again, the
+ * remaining ones when the pool is destroyed. The pool may be shared by
+ * service classes on multiple threads.
+ */
+class association_pool
+{
+   public:
+      /**
+       * acceptor_factory creates the infrastructure of a new association to
+       * the endpoint
+       */
+      using acceptor_factory = std::function<std::unique_ptr<Iinfrastructure_client_acceptor>(const connection& endpoint)>;
+
+      /**
+       * @brief association_pool constructs an empty pool
+       * @param dict dictionaries, must outlive the pool
+       * @param idle_timeout time after which an unused association is
+       *        released
+       * @param factory creates the infrastructure of new associations, TCP
+       *        connections by default
+       */
+      association_pool(data::dictionary::dictionaries& dict,
+                       std::chrono::milliseconds idle_timeout = std::chrono::seconds {30},
+                       acceptor_factory factory = nullptr);
+      association_pool(const association_pool&) = delete;
+      association_pool& operator=(const association_pool&) = delete;
+
+      ~association_pool();
+
+      /**
+       * @brief acquire hands out an open association matching the endpoint
+       *        and request, or a new one which is connected by its first
+       *        run()
+       * @param endpoint remote application entity
+       * @param request request proposed for a new association
+       * @param operations definition with the SOP class handlers of the
+       *        caller
+       * @return association for the exclusive use of the caller
+       */
+      std::unique_ptr<pooled_association> acquire(const connection& endpoint,
+                                                  const upperlayer::a_associate_rq& request,
+                                                  const association_definition& operations);
+
+      /**
+       * @brief put_back returns a parked association to the pool. An
+       *        association which is not open anymore is discarded.
+       * @param association association obtained by acquire()
+       */
+      void put_back(std::unique_ptr<pooled_association> association);
+
+      /**
+       * @brief idle_associations returns the number of associations in the
+       *        pool
+       */
+      std::size_t idle_associations();
+
+      /**
+       * @brief release_expired releases the associations which were idle for
+       *        longer than the idle timeout
+       */
+      void release_expired();
+
+   private:
+      /**
+       * @brief reap runs on the reaper thread and releases the idle
+       *        associations as they expire, until the pool is destroyed
+       */
+      void reap();
+
+      std::mutex idle_lock;
+      std::multimap<association_key, std::unique_ptr<pooled_association>> idle;
+      std::condition_variable idle_changed;
+      bool stopping;
+
+      data::dictionary::dictionaries& dict;
+      std::chrono::milliseconds idle_timeout;
+      acceptor_factory factory;
+
+      util::log::channel_sev_logger logger;
+
+      // started last, as it uses the members above
+      std::thread reaper;
+};
+
+}
+
+}
+
+}
+
+#endif // ASSOCIATION_POOL_HPP
@@ -6,12 +6,13 @@
 #include <functional>
 #include <iostream>
 #include <numeric>
+#include <algorithm>
+#include <limits>
 
 #include "network/upperlayer/upperlayer_properties.hpp"
 #include "network/upperlayer/upperlayer.hpp"
 
 #include "data/dataset/datasets.hpp"
-#include "data/dataset/dataset_iterator.hpp"
 
 #include "data/attribute/constants.hpp"
 
@@ -30,6 +31,30 @@ using namespace data::dictionary;
 using namespace data::dataset;
 using namespace util::log;
 
+namespace
+{
+
+/**
+ * @brief negotiate_window combines two limits of an asynchronous operations
+ *        window, where 0 stands for an unlimited number of operations.
+ */
+unsigned short negotiate_window(unsigned short proposed, unsigned short limit)
+{
+   if (proposed == 0) {
+      return limit;
+   }
+   if (limit == 0) {
+      return proposed;
+   }
+   return std::min(proposed, limit);
+}
+
+}
+
+dataset_stream::~dataset_stream()
+{
+}
+
 dimse_pm_manager::dimse_pm_manager(upperlayer::Iupperlayer_connection_handlers& conn,
                                    association_definition operations,
                                    dictionaries& dict):
@@ -37,6 +62,9 @@ dimse_pm_manager::dimse_pm_manager(upperlayer::Iupperlayer_connection_handlers&
    operations {operations},
    dict {dict},
    error_handler {nullptr},
+   offload_pool {nullptr},
+   offload_max_pending {0},
+   stream_selector {nullptr},
    logger {"dimse pm manager"}
 {
    using namespace upperlayer;
@@ -47,15 +75,35 @@ dimse_pm_manager::dimse_pm_manager(upperlayer::Iupperlayer_connection_handlers&
 
 void dimse_pm_manager::create_dimse(upperlayer::Iupperlayer_comm_ops* scx)
 {
-   protocol_machines[scx] =
-         (std::unique_ptr<dimse_pm> {new dimse_pm {*scx, operations, dict} });
+   std::unique_ptr<dimse_pm> pm {new dimse_pm {*scx, operations, dict}};
+   if (offload_pool) {
+      pm->offload_to(offload_pool, offload_max_pending);
+   }
+   if (stream_selector) {
+      pm->stream_datasets(stream_selector);
+   }
+   std::lock_guard<std::mutex> lock {protocol_machines_lock};
+   protocol_machines[scx] = std::move(pm);
    BOOST_LOG_SEV(logger, info) << "New dimse protocol machine created " << scx;
 }
 
 void dimse_pm_manager::remove_dimse(upperlayer::Iupperlayer_comm_ops* scx)
 {
+   // the protocol machine is destroyed after the lock is released
+   release_dimse(scx);
+}
+
+std::unique_ptr<dimse_pm> dimse_pm_manager::release_dimse(upperlayer::Iupperlayer_comm_ops* scx)
+{
+   std::lock_guard<std::mutex> lock {protocol_machines_lock};
+   auto pm = protocol_machines.find(scx);
+   if (pm == protocol_machines.end()) {
+      return nullptr;
+   }
+   auto released = std::move(pm->second);
+   protocol_machines.erase(pm);
    BOOST_LOG_SEV(logger, info) << "Removed dimse protocol machine " << scx;
-   protocol_machines.erase(scx);
+   return released;
 }
 
 void dimse_pm_manager::run()
@@ -68,6 +116,28 @@ association_definition& dimse_pm_manager::get_operations()
    return operations;
 }
 
+void dimse_pm_manager::offload_to(std::shared_ptr<util::worker_pool> pool, std::size_t max_pending)
+{
+   offload_pool = pool;
+   offload_max_pending = max_pending;
+}
+
+void dimse_pm_manager::stream_datasets(dataset_stream_selector selector)
+{
+   stream_selector = selector;
+}
+
+void dimse_pm_manager::set_async_ops_window(unsigned short max_invoked, unsigned short max_performed)
+{
+   operations.set_async_ops_window(max_invoked, max_performed);
+}
+
+std::size_t dimse_pm_manager::active_associations()
+{
+   std::lock_guard<std::mutex> lock {protocol_machines_lock};
+   return protocol_machines.size();
+}
+
 void dimse_pm_manager::connection_error_handler(std::function<void(dimse_pm*, std::exception_ptr)> handler)
 {
    error_handler = handler;
@@ -75,7 +145,8 @@ void dimse_pm_manager::connection_error_handler(std::function<void(dimse_pm*, st
 
 void dimse_pm_manager::connection_error(upperlayer::Iupperlayer_comm_ops* scx, std::exception_ptr err)
 {
-   auto& dimse_pm = protocol_machines.find(scx)->second;
+   // keep the protocol machine alive until the error handler returns
+   auto dimse_pm = release_dimse(scx);
 
    try {
       if (err) {
@@ -85,7 +156,6 @@ void dimse_pm_manager::connection_error(upperlayer::Iupperlayer_comm_ops* scx, s
       BOOST_LOG_SEV(logger, error) << "Error occured on connection " << dimse_pm.get()
                                    << "Error message: " << excep.what();
    }
-   remove_dimse(scx);
    if (error_handler) {
       error_handler(dimse_pm.get(), err);
    }
@@ -127,6 +197,13 @@ dimse_pm::dimse_pm(upperlayer::Iupperlayer_comm_ops& sc,
    dict {dict},
    transfer_processors {  },
    current_transfer_syntax {},
+   offload_pool {nullptr},
+   max_pending {0},
+   processing {false},
+   release_deferred {false},
+   worker_active {false},
+   stream_selector {nullptr},
+   lifetime {std::make_shared<char>()},
    logger {"dimse pm"}
 {
    using namespace std::placeholders;
@@ -171,59 +248,219 @@ dimse_pm::dimse_pm(upperlayer::Iupperlayer_comm_ops& sc,
 
 dimse_pm::~dimse_pm()
 {
+   // a worker may still be processing a message of this association
+   std::unique_lock<std::mutex> lock {offload_lock};
+   offload_done.wait(lock, [this]() { return !worker_active; });
 }
 
-void dimse_pm::send_response(response r)
+void dimse_pm::offload_to(std::shared_ptr<util::worker_pool> pool, std::size_t max_pending)
+{
+   offload_pool = pool;
+   this->max_pending = std::max(max_pending, std::size_t {1});
+}
+
+void dimse_pm::stream_datasets(dataset_stream_selector selector)
+{
+   stream_selector = selector;
+   if (!selector) {
+      upperlayer_impl.inject_data_stream(nullptr);
+      return;
+   }
+
+   upperlayer_impl.inject_data_stream([this](const upperlayer::p_data_tf& message) -> upperlayer::data_stream {
+      commandset_processor proc {dict};
+      auto command = proc.deserialize(message.command_set);
+      auto transfer_syntax = find_transfer_processor(message.pres_context_id).get_transfer_syntax();
+      auto stream = stream_selector(this, command, transfer_syntax);
+      if (!stream) {
+         return nullptr;
+      }
+
+      BOOST_LOG_SEV(logger, debug) << "Streaming data set of the received message";
+      receiving_stream = stream;
+      return [stream](const unsigned char* fragment, std::size_t len, bool last) {
+         stream->write(fragment, len);
+         if (last) {
+            stream->finish();
+         }
+      };
+   });
+}
+
+std::shared_ptr<dataset_stream> dimse_pm::get_current_stream()
+{
+   return current_stream;
+}
+
+void dimse_pm::send_response(const response& r)
+{
+   if (!offload_pool) {
+      upperlayer_impl.queue_for_write(std::unique_ptr<upperlayer::property>(new upperlayer::p_data_tf {make_message(r)}));
+      return;
+   }
+
+   // the message is built on the connection's thread, which owns the
+   // negotiated presentation contexts
+   auto copy = std::make_shared<response>(r);
+   on_connection_thread([this, copy]() {
+      upperlayer_impl.queue_for_write(std::unique_ptr<upperlayer::property>(new upperlayer::p_data_tf {make_message(*copy)}));
+   });
+}
+
+unsigned short dimse_pm::send_request(const response& r, response_handler on_response)
+{
+   using namespace upperlayer;
+   if (!offload_pool) {
+      auto message = make_message(r);
+
+      commandset_processor proc {dict};
+      auto command = proc.deserialize(message.command_set);
+      unsigned short message_id;
+      get_value_field<VR::US>(command.at(MessageID), message_id);
+      {
+         std::lock_guard<std::mutex> lock {outstanding_lock};
+         outstanding[message_id] = on_response;
+      }
+
+      upperlayer_impl.queue_for_write(std::unique_ptr<property>(new p_data_tf {std::move(message)}));
+      return message_id;
+   }
+
+   // the message id is reserved here so it can be returned, the message is
+   // built with it on the connection's thread
+   unsigned short message_id = static_cast<unsigned short>(next_message_id());
+   {
+      std::lock_guard<std::mutex> lock {outstanding_lock};
+      outstanding[message_id] = on_response;
+   }
+   auto copy = std::make_shared<response>(r);
+   on_connection_thread([this, copy, message_id]() {
+      assigned_message_id = message_id;
+      std::unique_ptr<property> message;
+      try {
+         message.reset(new p_data_tf {make_message(*copy)});
+      } catch (...) {
+         assigned_message_id = boost::none;
+         std::lock_guard<std::mutex> lock {outstanding_lock};
+         outstanding.erase(message_id);
+         throw;
+      }
+      upperlayer_impl.queue_for_write(std::move(message));
+   });
+   return message_id;
+}
+
+std::size_t dimse_pm::outstanding_requests()
+{
+   std::lock_guard<std::mutex> lock {outstanding_lock};
+   return outstanding.size();
+}
+
+std::size_t dimse_pm::max_outstanding_requests() const
+{
+   if (!connection_request.is_initialized() || !connection_properties.is_initialized()) {
+      return 1;
+   }
+   // the window of the requestor is proposed in the request and confirmed
+   // by the acceptor, which performs the requestor's operations
+   auto window = requestor
+         ? negotiate_window(connection_request.get().max_ops_invoked,
+                            connection_properties.get().max_ops_invoked)
+         : connection_properties.get().max_ops_performed;
+   return window == 0 ? std::numeric_limits<unsigned short>::max() : window;
+}
+
+upperlayer::p_data_tf dimse_pm::make_message(const response& r)
 {
    using namespace upperlayer;
    BOOST_LOG_SEV(logger, info) << "User-issued request / response indication "
                                   "of type " << r.get_response_type();
 
    std::string sop_uid;
-   for (auto e : dataset_iterator_adaptor(r.get_command())) {
-      if (e.first == tag_type {0x0000, 0x0002}) {
-         get_value_field<VR::UI>(e.second, sop_uid);
-      }
+   const auto& command = r.get_command();
+   auto sop_class = command.find({0x0000, 0x0002});
+   if (sop_class != command.end()) {
+      get_value_field<VR::UI>(sop_class->second, sop_uid);
    }
 
    BOOST_LOG_SEV(logger, debug) << "SOP UID: \t" << sop_uid << "\n" << r;
 
-   auto pres_contexts = connection_request.get().pres_contexts;
-   auto pres_context = std::find_if(pres_contexts.begin(), pres_contexts.end(),
-                                    [sop_uid](upperlayer::a_associate_rq::presentation_context p) {
-         return p.abstract_syntax == std::string {sop_uid.c_str()};
-   });
-   /** @todo check if presentation context was rejected */
-
-   if (pres_context == pres_contexts.end()) {
-      std::string errormsg {"No presentation context id found corresponding "
-                            "to abstract syntax / SOP uid: " + sop_uid};
-      BOOST_LOG_SEV(logger, warning) << errormsg;
-      throw std::runtime_error(errormsg);
+   // an encoded data set is preferably sent on a presentation context
+   // which was accepted with its own transfer syntax
+   std::string preferred_syntax;
+   if (r.get_encoded_data().is_initialized()) {
+      preferred_syntax = r.get_encoded_data().get().transfer_syntax;
    }
-   
-
-   auto accepted = std::find_if(connection_properties.get().pres_contexts.begin(),
-                connection_properties.get().pres_contexts.end(),
-                [pres_context](upperlayer::a_associate_ac::presentation_context p) {
-         return p.id == pres_context->id;
-   });
-   if (!(accepted->result_ == upperlayer::a_associate_ac::presentation_context::RESULT::ACCEPTANCE)) {
-      std::string errormsg {"Sending data on rejected Presentation Context "
-                            "with id" + std::to_string(accepted->id)};
+   auto pres_context = find_presentation_context(sop_uid, preferred_syntax);
+   if (!pres_context.is_initialized()) {
+      std::string errormsg {"No accepted presentation context corresponding "
+                            "to abstract syntax / SOP uid: " + sop_uid};
       BOOST_LOG_SEV(logger, warning) << errormsg;
       throw std::runtime_error(errormsg);
    }
 
    auto data = assemble_response[r.get_response_type()](this, r, pres_context->id);
 
-   std::vector<unsigned char> dataset;
    if (r.get_data().is_initialized()) {
       auto& tfproc = find_transfer_processor(pres_context->id);
-      dataset = tfproc.serialize(r.get_data().get());
+      data.data_set = tfproc.serialize(r.get_data().get());
+   } else if (r.get_encoded_data().is_initialized()) {
+      auto& tfproc = find_transfer_processor(pres_context->id);
+      const auto& encoded = r.get_encoded_data().get();
+      if (encoded.transfer_syntax == tfproc.get_transfer_syntax()) {
+         // sent from the owner's memory, eg. straight from a mapped file
+         data.set_data_set_view(encoded.data.data(), encoded.data.size(), encoded.owner);
+      } else {
+         BOOST_LOG_SEV(logger, debug) << "Transcoding data set from " << encoded.transfer_syntax
+                                      << " to " << tfproc.get_transfer_syntax();
+         auto source = make_transfer_processor(encoded.transfer_syntax, dict);
+         if (dynamic_cast<data::dataset::encapsulated*>(source.get()) != nullptr) {
+            // the compressed pixel data would be sent unchanged, labelled
+            // with a transfer syntax it is not encoded in
+            std::string errormsg {"Cannot transcode encapsulated data set from "
+                                  + encoded.transfer_syntax + " to " + tfproc.get_transfer_syntax()};
+            BOOST_LOG_SEV(logger, warning) << errormsg;
+            throw std::runtime_error(errormsg);
+         }
+         data.data_set = tfproc.serialize(source->deserialize_lazy(encoded.data, encoded.owner));
+      }
+   }
+   return data;
+}
+
+bool dimse_pm::is_accepted(const std::string& sop_class) const
+{
+   return find_presentation_context(sop_class, "").is_initialized();
+}
+
+boost::optional<upperlayer::a_associate_ac::presentation_context>
+dimse_pm::find_presentation_context(const std::string& sop_uid, const std::string& transfer_syntax) const
+{
+   using RESULT = upperlayer::a_associate_ac::presentation_context::RESULT;
+   boost::optional<upperlayer::a_associate_ac::presentation_context> found;
+   if (!connection_request.is_initialized() || !connection_properties.is_initialized()) {
+      return found;
    }
-   data.data_set = dataset;
-   upperlayer_impl.queue_for_write(std::unique_ptr<property>(new p_data_tf {data}));
+
+   const std::string abstract_syntax {sop_uid.c_str()};
+   const std::string preferred_syntax {transfer_syntax.c_str()};
+   for (const auto& rq : connection_request.get().pres_contexts) {
+      if (rq.abstract_syntax != abstract_syntax) {
+         continue;
+      }
+      for (const auto& ac : connection_properties.get().pres_contexts) {
+         if (ac.id != rq.id || ac.result_ != RESULT::ACCEPTANCE) {
+            continue;
+         }
+         if (std::string {ac.transfer_syntax.c_str()} == preferred_syntax) {
+            return ac;
+         }
+         if (!found.is_initialized()) {
+            found = ac;
+         }
+      }
+   }
+   return found;
 }
 
 void dimse_pm::abort_association()
@@ -231,7 +468,7 @@ void dimse_pm::abort_association()
    using namespace upperlayer;
    using namespace util::log;
    BOOST_LOG_SEV(logger, info) << "User requested association abortion";
-   upperlayer_impl.queue_for_write(std::unique_ptr<property>(new a_abort {}));
+   queue_for_write(std::unique_ptr<property>(new a_abort {}));
 }
 
 void dimse_pm::release_association()
@@ -239,7 +476,7 @@ void dimse_pm::release_association()
    using namespace upperlayer;
    using namespace util::log;
    BOOST_LOG_SEV(logger, info) << "User requested association release";
-   upperlayer_impl.queue_for_write(std::unique_ptr<property>(new a_release_rq {}));
+   queue_for_write(std::unique_ptr<property>(new a_release_rq {}));
 }
 
 void dimse_pm::association_rj_handler(upperlayer::Iupperlayer_comm_ops* sc, std::unique_ptr<upperlayer::property> rq)
@@ -313,6 +550,12 @@ void dimse_pm::association_rq_handler(upperlayer::Iupperlayer_comm_ops* sc, std:
    }
    ac.max_message_length = operations.get_initial_request().max_message_length;
 
+   // the window is only part of the response if it was proposed
+   ac.max_ops_invoked = negotiate_window(arq->max_ops_invoked,
+                                         operations.get_initial_request().max_ops_invoked);
+   ac.max_ops_performed = negotiate_window(arq->max_ops_performed,
+                                           operations.get_initial_request().max_ops_performed);
+
    max_remote_msg_length = arq->max_message_length;
 
    sc->queue_for_write(std::unique_ptr<property>(new a_associate_ac {ac}));
@@ -349,6 +592,26 @@ void dimse_pm::association_ac_handler(upperlayer::Iupperlayer_comm_ops* sc, std:
 
    max_remote_msg_length = asc->max_message_length;
 
+   invoke_initiator();
+}
+
+void dimse_pm::restart_operations()
+{
+   if (state != CONN_STATE::CONNECTED) {
+      throw std::runtime_error {"Restarting the operations of an association which is not established"};
+   }
+   BOOST_LOG_SEV(logger, info) << "Restarting the operations of the association";
+   invoke_initiator();
+}
+
+bool dimse_pm::is_connected() const
+{
+   return state == CONN_STATE::CONNECTED;
+}
+
+void dimse_pm::invoke_initiator()
+{
+   using namespace upperlayer;
    for (auto sop : operations.get_all_SOP()) {
       if (sop.msg_type == dimse::association_definition::DIMSE_MSG_TYPE::INITIATOR) {
          auto request = sop.sop_class;
@@ -377,17 +640,42 @@ void dimse_pm::data_handler(upperlayer::Iupperlayer_comm_ops* sc, std::unique_pt
    assert(d != nullptr); // d == nullptr would imply that this function is bound
                          // to the wrong message type.
 
+   // the stream, if any, received the data set of this message
+   std::shared_ptr<dataset_stream> stream;
+   stream.swap(receiving_stream);
+
+   if (!offload_pool) {
+      auto tfproc = (!d->data_set.empty() || stream) ? &find_transfer_processor(d->pres_context_id) : nullptr;
+      dispatch(*d, tfproc, stream);
+      return;
+   }
+
+   pending_messages.emplace_back(std::move(da), stream);
+   if (pending_messages.size() >= max_pending) {
+      BOOST_LOG_SEV(logger, debug) << "Pausing reception, " << pending_messages.size()
+                                   << " messages pending";
+      upperlayer_impl.pause_reading();
+   }
+   process_next();
+}
+
+void dimse_pm::dispatch(upperlayer::p_data_tf& d, data::dataset::transfer_processor* tfproc,
+                        std::shared_ptr<dataset_stream> stream)
+{
+   using namespace dicom::util::log;
+   using namespace dicom::data::dataset;
+
    commandset_processor proc {dict};
-   commandset_data b = proc.deserialize(d->command_set);
+   commandset_data b = proc.deserialize(d.command_set);
 
    BOOST_LOG_SEV(logger, info) << "Message from peer received";
 
    iod dataset;
-   if (!d->data_set.empty()) {
-      auto& tfproc = find_transfer_processor(d->pres_context_id);
-
-      dataset = tfproc.deserialize(d->data_set);
-      current_transfer_syntax = tfproc.get_transfer_syntax();
+   if (!d.data_set.empty()) {
+      dataset = tfproc->deserialize(d.data_set);
+      current_transfer_syntax = tfproc->get_transfer_syntax();
+   } else if (stream) {
+      current_transfer_syntax = tfproc->get_transfer_syntax();
    }
 
    // TODO handle data on rejected presentation context? -> respond with failure
@@ -410,19 +698,161 @@ void dimse_pm::data_handler(upperlayer::Iupperlayer_comm_ops* sc, std::unique_pt
 
    BOOST_LOG_SEV(logger, info) << "Issuing indication primitive to user";
 
-   auto pcontexts = operations.get_SOP_class(SOP_UID);
-   for (auto pc : pcontexts) {
-      if (pc.msg_type == association_definition::DIMSE_MSG_TYPE::RESPONSE) {
-         auto request = pc.sop_class;
-         auto sop_service_groups = request.get_service_groups();
-         if (sop_service_groups.find(dsg) != sop_service_groups.end()) {
-            request(this, dsg, std::move(b),
-                    d->data_set.empty()
-                    ? nullptr
-                    : std::unique_ptr<iod> {new iod {std::move(dataset)}});
+   // responses to requests sent by send_request() go to their handler
+   response_handler on_response;
+   if (!request) {
+      std::lock_guard<std::mutex> lock {outstanding_lock};
+      auto handler = outstanding.find(message_id);
+      if (handler != outstanding.end()) {
+         on_response = handler->second;
+         unsigned short status = 0x0000;
+         if (b.find(Status) != b.end()) {
+            get_value_field<VR::US>(b.at(Status), status);
+         }
+         if (status != 0xff00 && status != 0xff01) {
+            outstanding.erase(handler);
          }
       }
    }
+
+   current_stream = stream;
+   try {
+      if (on_response) {
+         on_response(this, std::move(b),
+                     d.data_set.empty()
+                     ? nullptr
+                     : std::unique_ptr<iod> {new iod {std::move(dataset)}});
+         current_stream.reset();
+         return;
+      }
+
+      auto pcontexts = operations.get_SOP_class(SOP_UID);
+      for (const auto& pc : pcontexts) {
+         if (pc.msg_type == association_definition::DIMSE_MSG_TYPE::RESPONSE) {
+            const auto& request = pc.sop_class;
+            auto sop_service_groups = request.get_service_groups();
+            if (sop_service_groups.find(dsg) != sop_service_groups.end()) {
+               request(this, dsg, std::move(b),
+                       d.data_set.empty()
+                       ? nullptr
+                       : std::unique_ptr<iod> {new iod {std::move(dataset)}});
+            }
+         }
+      }
+   } catch (...) {
+      current_stream.reset();
+      throw;
+   }
+   current_stream.reset();
+}
+
+void dimse_pm::process_next()
+{
+   if (processing || pending_messages.empty()) {
+      return;
+   }
+
+   std::shared_ptr<upperlayer::property> message {std::move(pending_messages.front().first)};
+   auto stream = pending_messages.front().second;
+   pending_messages.pop_front();
+
+   // the presentation contexts may change on this thread while the worker
+   // runs, so the transfer processor is resolved before submitting
+   auto& d = dynamic_cast<upperlayer::p_data_tf&>(*message);
+   data::dataset::transfer_processor* tfproc = nullptr;
+   try {
+      if (!d.data_set.empty() || stream) {
+         tfproc = &find_transfer_processor(d.pres_context_id);
+      }
+   } catch (...) {
+      processing = true;
+      offload_completed(std::current_exception());
+      return;
+   }
+   processing = true;
+   {
+      std::lock_guard<std::mutex> lock {offload_lock};
+      worker_active = true;
+   }
+
+   std::weak_ptr<char> alive {lifetime};
+   offload_pool->submit([this, message, tfproc, stream, alive]() {
+      std::exception_ptr failure;
+      try {
+         dispatch(dynamic_cast<upperlayer::p_data_tf&>(*message), tfproc, stream);
+      } catch (...) {
+         failure = std::current_exception();
+      }
+      upperlayer_impl.post([this, alive, failure]() {
+         if (!alive.expired()) {
+            offload_completed(failure);
+         }
+      });
+
+      std::lock_guard<std::mutex> lock {offload_lock};
+      worker_active = false;
+      offload_done.notify_all();
+   });
+}
+
+void dimse_pm::offload_completed(std::exception_ptr failure)
+{
+   processing = false;
+
+   if (failure) {
+      try {
+         std::rethrow_exception(failure);
+      } catch (std::exception& excep) {
+         BOOST_LOG_SEV(logger, error) << "Error processing received message, "
+                                         "aborting association\n" << excep.what();
+      }
+      pending_messages.clear();
+      release_deferred = false;
+      upperlayer_impl.queue_for_write(std::unique_ptr<upperlayer::property>(new upperlayer::a_abort {}));
+      return;
+   }
+
+   if (pending_messages.size() < max_pending) {
+      upperlayer_impl.resume_reading();
+   }
+   if (pending_messages.empty() && release_deferred) {
+      release_deferred = false;
+      accept_release();
+   }
+   process_next();
+}
+
+void dimse_pm::queue_for_write(std::unique_ptr<upperlayer::property> p)
+{
+   if (!offload_pool) {
+      upperlayer_impl.queue_for_write(std::move(p));
+      return;
+   }
+
+   // std::function requires a copyable closure, the property is moved out
+   // of the shared holder when the closure runs
+   auto property = std::make_shared<std::unique_ptr<upperlayer::property>>(std::move(p));
+   on_connection_thread([this, property]() {
+      upperlayer_impl.queue_for_write(std::move(*property));
+   });
+}
+
+void dimse_pm::on_connection_thread(std::function<void()> task)
+{
+   using namespace dicom::util::log;
+   std::weak_ptr<char> alive {lifetime};
+   upperlayer_impl.post([this, task, alive]() {
+      if (alive.expired()) {
+         return;
+      }
+      try {
+         task();
+      } catch (std::exception& excep) {
+         BOOST_LOG_SEV(logger, error) << "Error sending message, aborting association\n"
+                                      << excep.what();
+         upperlayer_impl.queue_for_write(std::unique_ptr<upperlayer::property>(new upperlayer::a_abort {}));
+      }
+   });
 }
 
 void dimse_pm::release_rq_handler(upperlayer::Iupperlayer_comm_ops* sc, std::unique_ptr<upperlayer::property>)
@@ -431,7 +861,17 @@ void dimse_pm::release_rq_handler(upperlayer::Iupperlayer_comm_ops* sc, std::uni
    assert(sc == &upperlayer_impl);
    BOOST_LOG_SEV(logger, trace) << "Received release_rq pdu from upperlayer implementation";
 
-   sc->queue_for_write(std::unique_ptr<upperlayer::property>(new upperlayer::a_release_rp));
+   if (processing || !pending_messages.empty()) {
+      BOOST_LOG_SEV(logger, debug) << "Deferring release until the pending messages are processed";
+      release_deferred = true;
+      return;
+   }
+   accept_release();
+}
+
+void dimse_pm::accept_release()
+{
+   upperlayer_impl.queue_for_write(std::unique_ptr<upperlayer::property>(new upperlayer::a_release_rp));
    state = CONN_STATE::IDLE;
    connection_properties = boost::none;
 }
@@ -448,6 +888,7 @@ void dimse_pm::abort_handler(upperlayer::Iupperlayer_comm_ops* sc, std::unique_p
    using namespace dicom::util::log;
    assert(sc == &upperlayer_impl);
    BOOST_LOG_SEV(logger, debug) << "Received a_abort pdu from upperlayer implementation";
+   state = CONN_STATE::IDLE;
 }
 
 void dimse_pm::sent_association_ac(upperlayer::Iupperlayer_comm_ops* sc, upperlayer::property*)
@@ -467,6 +908,7 @@ void dimse_pm::sent_association_rq(upperlayer::Iupperlayer_comm_ops* sc, upperla
    upperlayer::a_associate_rq* rq = dynamic_cast<upperlayer::a_associate_rq*>(r);
    assert(rq != nullptr);
    connection_request = *rq;
+   requestor = true;
 }
 
 void dimse_pm::sent_data_tf(upperlayer::Iupperlayer_comm_ops* sc, upperlayer::property*)
@@ -483,6 +925,7 @@ void dimse_pm::sent_release_rq(upperlayer::Iupperlayer_comm_ops* sc, upperlayer:
    assert(sc == &upperlayer_impl);
    BOOST_LOG_SEV(logger, debug) << "Received send confirmation of release_rq pdu "
                                    "from upperlayer implementation";
+   state = CONN_STATE::IDLE;
 }
 
 void dimse_pm::sent_release_rp(upperlayer::Iupperlayer_comm_ops* sc, upperlayer::property*)
@@ -499,10 +942,16 @@ void dimse_pm::sent_abort(upperlayer::Iupperlayer_comm_ops* sc, upperlayer::prop
    assert(sc == &upperlayer_impl);
    BOOST_LOG_SEV(logger, debug) << "Received send confirmation of a_abort pdu "
                                    "from upperlayer implementation";
+   state = CONN_STATE::IDLE;
 }
 
 int dimse_pm::next_message_id()
 {
+   if (assigned_message_id.is_initialized()) {
+      int id = *assigned_message_id;
+      assigned_message_id = boost::none;
+      return id;
+   }
    return msg_id++;
 }
 
@@ -517,10 +966,15 @@ transfer_processor& dimse_pm::find_transfer_processor(unsigned char presentation
 
 
    // retrieve the negotiated transfer syntax of the presentation context
-   auto pres_contexts = connection_properties.get().pres_contexts;
-   std::string ts_of_presentation_context = (std::find_if(pres_contexts.begin(), pres_contexts.end(),
-      [presentation_context_id](upperlayer::a_associate_ac::presentation_context pc) { return pc.id == presentation_context_id; })
-         )->transfer_syntax;
+   if (!connection_properties.is_initialized()) {
+      throw std::runtime_error {"No association established"};
+   }
+   const auto& pres_contexts = connection_properties.get().pres_contexts;
+   auto pres_context = std::find_if(pres_contexts.begin(), pres_contexts.end(),
+      [presentation_context_id](const upperlayer::a_associate_ac::presentation_context& pc) { return pc.id == presentation_context_id; });
+   if (pres_context == pres_contexts.end()) {
+      throw std::runtime_error {"No presentation context with id " + std::to_string(presentation_context_id)};
+   }
 
    // and return a reference to our corresponding transfer processor instance
 //   return *((std::find_if(transfer_processors.begin(), transfer_processors.end(),
@@ -528,11 +982,11 @@ transfer_processor& dimse_pm::find_transfer_processor(unsigned char presentation
 
    // we might as well throw if there is no such transfer processor for the
    // syntax, association should not have been accepted in the first place
-   return *transfer_processors[ts_of_presentation_context];
+   return *transfer_processors.at(pres_context->transfer_syntax);
 }
 
 
-upperlayer::p_data_tf dimse_pm::assemble_cecho_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cecho_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::attribute;
@@ -540,7 +994,7 @@ upperlayer::p_data_tf dimse_pm::assemble_cecho_rsp(response r, int pres_context_
 
    std::string SOP_uid;
    unsigned short message_id;
-   auto cs = r.get_command();
+   const auto& cs = r.get_command();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);
 
@@ -565,14 +1019,14 @@ upperlayer::p_data_tf dimse_pm::assemble_cecho_rsp(response r, int pres_context_
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_cecho_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cecho_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
    commandset_data cresp;
 
    std::string SOP_uid;
-   auto cs = r.get_command();
+   const auto& cs = r.get_command();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
 
    cresp[AffectedSOPClassUID] = make_elementfield<VR::UI>(SOP_uid);
@@ -596,15 +1050,15 @@ upperlayer::p_data_tf dimse_pm::assemble_cecho_rq(response r, int pres_context_i
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_cfind_rq(response r,  int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cfind_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
    commandset_data cresp;
 
    std::string SOP_uid;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
 
    cresp[AffectedSOPClassUID]    = make_elementfield<VR::UI>(SOP_uid);
@@ -629,7 +1083,7 @@ upperlayer::p_data_tf dimse_pm::assemble_cfind_rq(response r,  int pres_context_
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_cfind_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cfind_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -637,8 +1091,8 @@ upperlayer::p_data_tf dimse_pm::assemble_cfind_rsp(response r, int pres_context_
 
    std::string SOP_uid;
    unsigned short message_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);
 
@@ -663,7 +1117,7 @@ upperlayer::p_data_tf dimse_pm::assemble_cfind_rsp(response r, int pres_context_
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_cstore_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cstore_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -671,8 +1125,8 @@ upperlayer::p_data_tf dimse_pm::assemble_cstore_rq(response r, int pres_context_
 
    std::string SOP_uid, aff_SOP_uid, move_orig_ae;
    unsigned short move_orig_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), aff_SOP_uid);
    get_value_field<VR::AE>(cs.at(MoveOriginatorApplicationEntityTitle), move_orig_ae);
@@ -703,7 +1157,7 @@ upperlayer::p_data_tf dimse_pm::assemble_cstore_rq(response r, int pres_context_
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_cstore_rsp(response r,  int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cstore_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -711,8 +1165,8 @@ upperlayer::p_data_tf dimse_pm::assemble_cstore_rsp(response r,  int pres_contex
 
    std::string SOP_uid, aff_SOP_uid;
    unsigned short message_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), aff_SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);
@@ -739,15 +1193,15 @@ upperlayer::p_data_tf dimse_pm::assemble_cstore_rsp(response r,  int pres_contex
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_cget_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cget_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
    commandset_data cresp;
 
    std::string SOP_uid;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
 
    cresp[AffectedSOPClassUID]    = make_elementfield<VR::UI>(SOP_uid);
@@ -771,7 +1225,7 @@ upperlayer::p_data_tf dimse_pm::assemble_cget_rq(response r, int pres_context_id
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_cget_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cget_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -780,8 +1234,8 @@ upperlayer::p_data_tf dimse_pm::assemble_cget_rsp(response r, int pres_context_i
    std::string SOP_uid;
    unsigned short message_id;
    unsigned short num_remaining_sub, num_completed_sub, num_failed_sub, num_warning_sub;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);
    get_value_field<VR::US>(cs.at(NumberOfRemainingSuboperations), num_remaining_sub);
@@ -814,7 +1268,7 @@ upperlayer::p_data_tf dimse_pm::assemble_cget_rsp(response r, int pres_context_i
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_cmove_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cmove_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -822,8 +1276,8 @@ upperlayer::p_data_tf dimse_pm::assemble_cmove_rq(response r, int pres_context_i
 
    std::string SOP_uid;
    std::string move_destination;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::AE>(cs.at(MoveDestination), move_destination);
 
@@ -849,7 +1303,7 @@ upperlayer::p_data_tf dimse_pm::assemble_cmove_rq(response r, int pres_context_i
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_cmove_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_cmove_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -858,8 +1312,8 @@ upperlayer::p_data_tf dimse_pm::assemble_cmove_rsp(response r, int pres_context_
    std::string SOP_uid;
    unsigned short message_id;
    unsigned short num_remaining_sub, num_completed_sub, num_failed_sub, num_warning_sub;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);/*
    get_value_field<VR::US>(cs.at(NumberOfRemainingSuboperations), num_remaining_sub);
@@ -892,7 +1346,7 @@ upperlayer::p_data_tf dimse_pm::assemble_cmove_rsp(response r, int pres_context_
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_neventreport_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_neventreport_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -900,8 +1354,8 @@ upperlayer::p_data_tf dimse_pm::assemble_neventreport_rq(response r, int pres_co
 
    std::string SOP_uid, aff_SOP_uid;
    unsigned short message_id, event_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), aff_SOP_uid);
    get_value_field<VR::US>(cs.at(MessageIDBeingRespondedTo), message_id);
@@ -929,7 +1383,7 @@ upperlayer::p_data_tf dimse_pm::assemble_neventreport_rq(response r, int pres_co
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_neventreport_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_neventreport_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -937,8 +1391,8 @@ upperlayer::p_data_tf dimse_pm::assemble_neventreport_rsp(response r, int pres_c
 
    std::string SOP_uid, aff_SOP_uid;
    unsigned short message_id, event_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), aff_SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);
@@ -967,15 +1421,15 @@ upperlayer::p_data_tf dimse_pm::assemble_neventreport_rsp(response r, int pres_c
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_nget_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_nget_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
    commandset_data cresp;
 
    std::string SOP_uid, SOP_instance_uid;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(RequestedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(RequestedSOPInstanceUID), SOP_instance_uid);
 
@@ -1000,7 +1454,7 @@ upperlayer::p_data_tf dimse_pm::assemble_nget_rq(response r, int pres_context_id
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_nget_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_nget_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -1008,8 +1462,8 @@ upperlayer::p_data_tf dimse_pm::assemble_nget_rsp(response r, int pres_context_i
 
    std::string SOP_uid, aff_SOP_uid;
    unsigned short message_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), aff_SOP_uid);
@@ -1036,15 +1490,15 @@ upperlayer::p_data_tf dimse_pm::assemble_nget_rsp(response r, int pres_context_i
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_nset_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_nset_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
    commandset_data cresp;
 
    std::string SOP_uid, SOP_instance_uid;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(RequestedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(RequestedSOPInstanceUID), SOP_instance_uid);
 
@@ -1069,15 +1523,15 @@ upperlayer::p_data_tf dimse_pm::assemble_nset_rq(response r, int pres_context_id
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_nset_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_nset_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
    commandset_data cresp;
 
    std::string SOP_uid, aff_SOP_uid;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), aff_SOP_uid);
 
@@ -1103,7 +1557,7 @@ upperlayer::p_data_tf dimse_pm::assemble_nset_rsp(response r, int pres_context_i
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_naction_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_naction_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -1111,8 +1565,8 @@ upperlayer::p_data_tf dimse_pm::assemble_naction_rq(response r, int pres_context
 
    std::string SOP_uid, SOP_instance_uid;
    unsigned short action_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(RequestedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(RequestedSOPInstanceUID), SOP_instance_uid);
    get_value_field<VR::US>(cs.at(ActionTypeID), action_id);
@@ -1140,7 +1594,7 @@ upperlayer::p_data_tf dimse_pm::assemble_naction_rq(response r, int pres_context
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_naction_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_naction_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -1148,8 +1602,8 @@ upperlayer::p_data_tf dimse_pm::assemble_naction_rsp(response r, int pres_contex
 
    std::string SOP_uid, aff_SOP_uid;
    unsigned short message_id, action_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), aff_SOP_uid);
@@ -1178,15 +1632,15 @@ upperlayer::p_data_tf dimse_pm::assemble_naction_rsp(response r, int pres_contex
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_ncreate_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_ncreate_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
    commandset_data cresp;
 
    std::string SOP_uid, SOP_instance_uid;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), SOP_instance_uid);
 
@@ -1211,7 +1665,7 @@ upperlayer::p_data_tf dimse_pm::assemble_ncreate_rq(response r, int pres_context
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_ncreate_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_ncreate_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -1219,8 +1673,8 @@ upperlayer::p_data_tf dimse_pm::assemble_ncreate_rsp(response r, int pres_contex
 
    std::string SOP_uid, aff_SOP_uid;
    unsigned short message_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), aff_SOP_uid);
@@ -1247,15 +1701,15 @@ upperlayer::p_data_tf dimse_pm::assemble_ncreate_rsp(response r, int pres_contex
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_ndelete_rq(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_ndelete_rq(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
    commandset_data cresp;
 
    std::string SOP_uid, SOP_instance_uid;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(RequestedSOPClassUID), SOP_uid);
    get_value_field<VR::UI>(cs.at(RequestedSOPInstanceUID), SOP_instance_uid);
 
@@ -1280,7 +1734,7 @@ upperlayer::p_data_tf dimse_pm::assemble_ndelete_rq(response r, int pres_context
    return presp;
 }
 
-upperlayer::p_data_tf dimse_pm::assemble_ndelete_rsp(response r, int pres_context_id)
+upperlayer::p_data_tf dimse_pm::assemble_ndelete_rsp(const response& r, int pres_context_id)
 {
    using namespace upperlayer;
    using namespace data::dataset;
@@ -1288,8 +1742,8 @@ upperlayer::p_data_tf dimse_pm::assemble_ndelete_rsp(response r, int pres_contex
 
    std::string SOP_uid, aff_SOP_uid;
    unsigned short message_id;
-   auto cs = r.get_command();
-   bool hasdata = r.get_data().is_initialized();
+   const auto& cs = r.get_command();
+   bool hasdata = r.has_data();
    get_value_field<VR::UI>(cs.at(AffectedSOPClassUID), SOP_uid);
    get_value_field<VR::US>(cs.at(MessageID), message_id);
    get_value_field<VR::UI>(cs.at(AffectedSOPInstanceUID), aff_SOP_uid);
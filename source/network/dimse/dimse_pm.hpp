@@ -8,6 +8,11 @@
 #include <vector>
 #include <utility>
 #include <memory>
+#include <mutex>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
 #include <initializer_list>
 
 #include <boost/optional.hpp>
@@ -20,6 +25,7 @@
 #include "data/dictionary/dictionary.hpp"
 
 #include "util/channel_sev_logger.hpp"
+#include "util/worker_pool.hpp"
 
 
 namespace dicom
@@ -33,11 +39,47 @@ namespace dimse
 
 class dimse_pm;
 
+/**
+ * @brief The dataset_stream interface receives the data set of a message
+ *        while it is being received, instead of it being collected and
+ *        decoded by the protocol machine.
+ * The functions are called on the thread of the connection. An exception
+ * thrown from them aborts the association.
+ */
+struct dataset_stream
+{
+      /**
+       * @brief write is called for each fragment of the data set in order
+       * @param fragment pointer to the fragment, only valid during the call
+       * @param len length of the fragment in bytes
+       */
+      virtual void write(const unsigned char* fragment, std::size_t len) = 0;
+
+      /**
+       * @brief finish is called after the last fragment has been written
+       */
+      virtual void finish() = 0;
+
+      virtual ~dataset_stream() = 0;
+};
+
+/**
+ * dataset_stream_selector is invoked with the complete command set of a
+ * received message which has a data set, and returns the stream receiving the
+ * data set or nullptr if it shall be decoded as usual.
+ */
+using dataset_stream_selector = std::function<std::shared_ptr<dataset_stream>(
+      dimse_pm* pm, const data::dataset::commandset_data& command, const std::string& transfer_syntax)>;
+
 /**
  * @brief The dimse_pm_manager class is used to handle new connections and
  *        create instances of the dimse protocol machine.
  * This is mainly relevant for SCPs which can have multiple connections open
  * simultaneously.
+ * Protocol machines may be created and removed concurrently when the
+ * connections are handled by multiple threads. Each protocol machine is only
+ * used on the thread of its connection, so the SOP class handlers of
+ * different associations may run concurrently.
  */
 class dimse_pm_manager
 {
@@ -67,11 +109,46 @@ class dimse_pm_manager
        */
       association_definition& get_operations();
 
+      /**
+       * @brief offload_to makes the protocol machines of new connections
+       *        decode received datasets and run the SOP class handlers on
+       *        the given pool.
+       * @param pool worker pool, may be shared with other managers
+       * @param max_pending see dimse_pm::offload_to()
+       */
+      void offload_to(std::shared_ptr<util::worker_pool> pool, std::size_t max_pending = 2);
+
+      /**
+       * @brief stream_datasets sets the selector of the data set streams for
+       *        the protocol machines of new connections.
+       * @param selector see dimse_pm::stream_datasets()
+       */
+      void stream_datasets(dataset_stream_selector selector);
+
+      /**
+       * @brief set_async_ops_window sets the maximum asynchronous operations
+       *        window accepted for associations requested by peers. Must be
+       *        called before run().
+       * @param max_invoked maximum number of outstanding operations invoked
+       *        by the peer, 0 for unlimited
+       * @param max_performed maximum number of outstanding operations
+       *        performed by the peer, 0 for unlimited
+       */
+      void set_async_ops_window(unsigned short max_invoked, unsigned short max_performed = 1);
+
+      /**
+       * @brief active_associations returns the number of protocol machines
+       *        whose connection has not ended yet
+       */
+      std::size_t active_associations();
+
    private:
+      std::mutex protocol_machines_lock;
       std::map<upperlayer::Iupperlayer_comm_ops*, std::unique_ptr<dimse_pm>> protocol_machines;
 
       void create_dimse(upperlayer::Iupperlayer_comm_ops* scx);
       void remove_dimse(upperlayer::Iupperlayer_comm_ops* scx);
+      std::unique_ptr<dimse_pm> release_dimse(upperlayer::Iupperlayer_comm_ops* scx);
       void connection_error(upperlayer::Iupperlayer_comm_ops* scx, std::exception_ptr err);
 
       upperlayer::Iupperlayer_connection_handlers& conn;
@@ -80,6 +157,11 @@ class dimse_pm_manager
       data::dictionary::dictionaries& dict;
       std::function<void(dimse_pm*, std::exception_ptr)> error_handler;
 
+      std::shared_ptr<util::worker_pool> offload_pool;
+      std::size_t offload_max_pending;
+
+      dataset_stream_selector stream_selector;
+
       util::log::channel_sev_logger logger;
 };
 
@@ -105,7 +187,67 @@ class dimse_pm
        * @brief send_response sends a response to the peer.
        * @param r response data
        */
-      void send_response(response r);
+      void send_response(const response& r);
+
+      /**
+       * response_handler is invoked with the response to a request sent by
+       * send_request().
+       */
+      using response_handler = std::function<void(dimse_pm* pm,
+                                                  data::dataset::commandset_data command,
+                                                  std::unique_ptr<data::dataset::iod> data)>;
+
+      /**
+       * @brief send_request sends a request to the peer without waiting for
+       *        the responses of previously sent requests.
+       * The response is correlated by the message id and passed to
+       * on_response instead of the handler of the SOP class, regardless of
+       * the order in which the responses of outstanding requests arrive.
+       * Pending responses are passed as well, the request is completed by
+       * the first response with a final status. The caller is responsible
+       * for keeping the number of outstanding requests within
+       * max_outstanding_requests().
+       * @param r request data
+       * @param on_response handler for the response(s)
+       * @return message id of the request
+       */
+      unsigned short send_request(const response& r, response_handler on_response);
+
+      /**
+       * @brief outstanding_requests returns the number of requests sent by
+       *        send_request() whose final response is outstanding
+       */
+      std::size_t outstanding_requests();
+
+      /**
+       * @brief max_outstanding_requests returns the maximum number of
+       *        outstanding operations this side may invoke, as negotiated by
+       *        the asynchronous operations window of the association. It is 1
+       *        if no window was negotiated.
+       */
+      std::size_t max_outstanding_requests() const;
+
+      /**
+       * @brief restart_operations invokes the handler of the initiating SOP
+       *        class again, as after the association was accepted, to start
+       *        a new series of operations on an association which was kept
+       *        open.
+       * @throws std::runtime_error if the association is not established
+       */
+      void restart_operations();
+
+      /**
+       * @brief is_connected returns true while the association is
+       *        established
+       */
+      bool is_connected() const;
+
+      /**
+       * @brief is_accepted returns true if a presentation context of the
+       *        SOP class was accepted for the current association
+       * @param sop_class SOP class uid
+       */
+      bool is_accepted(const std::string& sop_class) const;
 
       /**
        * @brief abort_associations aborts the current association by sending an
@@ -119,6 +261,45 @@ class dimse_pm
       void release_association();
 
 
+      /**
+       * @brief offload_to moves the processing of received messages from the
+       *        connection's thread to the worker pool.
+       * The dataset of a message is decoded and the SOP class handler is
+       * invoked on a worker, so other associations handled by the same
+       * thread are not blocked in the meantime. The messages of the
+       * association are processed one after another in the order of
+       * reception, and a received release request is answered after all
+       * preceding messages. Responses and requests issued from the handler
+       * are posted back to the connection's thread, where their messages are
+       * built from the negotiated presentation contexts and serialized.
+       * While max_pending messages are waiting for processing, no further
+       * PDUs are read from the peer; submitting to a full pool blocks the
+       * connection's thread.
+       * @param pool worker pool
+       * @param max_pending maximum number of received messages waiting for
+       *        processing
+       */
+      void offload_to(std::shared_ptr<util::worker_pool> pool, std::size_t max_pending = 2);
+
+      /**
+       * @brief stream_datasets passes the data sets of received messages to
+       *        streams while they are received, eg. to write them to disk
+       *        without holding them in memory.
+       * The selector is invoked on the connection's thread when the command
+       * set of a message with a data set is complete. If it returns a
+       * stream, the SOP class handler is later invoked without a data set
+       * and get_current_stream() returns the stream during the invocation.
+       * @param selector selector of the stream for a message
+       */
+      void stream_datasets(dataset_stream_selector selector);
+
+      /**
+       * @brief get_current_stream returns the stream which received the data
+       *        set of the message currently handled by a SOP class handler
+       * @return stream or nullptr if the data set was not streamed
+       */
+      std::shared_ptr<dataset_stream> get_current_stream();
+
       /**
        * @brief get_current_transfer_syntax returns the transfer syntax of
        *        the current presentation context
@@ -152,6 +333,51 @@ class dimse_pm
        */
       void data_handler(upperlayer::Iupperlayer_comm_ops* sc, std::unique_ptr<upperlayer::property> d);
 
+      /**
+       * @brief dispatch decodes a received message and invokes the handler
+       *        of the SOP class
+       * @param d received data
+       * @param tfproc transfer processor of the presentation context, which
+       *        is resolved by the caller on the connection's thread; may be
+       *        nullptr if the message has no data set
+       * @param stream stream which received the data set, if any
+       */
+      void dispatch(upperlayer::p_data_tf& d, data::dataset::transfer_processor* tfproc,
+                    std::shared_ptr<dataset_stream> stream);
+
+      /**
+       * @brief process_next submits the oldest pending message to the worker
+       *        pool unless a message of the association is being processed
+       */
+      void process_next();
+
+      /**
+       * @brief offload_completed is invoked on the connection's thread when a
+       *        worker has processed a message
+       * @param failure exception thrown during the processing, if any
+       */
+      void offload_completed(std::exception_ptr failure);
+
+      /**
+       * @brief queue_for_write queues the property at the upperlayer, posting
+       *        it to the connection's thread if processing is offloaded
+       * @param p property to be sent
+       */
+      void queue_for_write(std::unique_ptr<upperlayer::property> p);
+
+      /**
+       * @brief on_connection_thread posts the task to the connection's
+       *        thread. It is dropped if this instance is destroyed before, and
+       *        the association is aborted if it throws.
+       * @param task task to be run
+       */
+      void on_connection_thread(std::function<void()> task);
+
+      /**
+       * @brief accept_release sends the a-release-rp
+       */
+      void accept_release();
+
       /**
        * @brief release_rq_handler is called when an a-associate-rq property is
        *        received. An a-associate-rp is transmitted.
@@ -223,6 +449,12 @@ class dimse_pm
        */
       void sent_abort(upperlayer::Iupperlayer_comm_ops* sc, upperlayer::property* r);
 
+      /**
+       * @brief invoke_initiator invokes the first operation of the initiating
+       *        SOP class, which starts the operations of this side
+       */
+      void invoke_initiator();
+
       /**
        * @brief next_message_id returns a free message id
        * @return next free message id
@@ -237,54 +469,110 @@ class dimse_pm
        * @param presentation_context_id presentation context id where data is
        *        to be sent / received.
        * @return reference to a matching transfer processor
+       * @throws std::runtime_error if the presentation context was not
+       *         negotiated, std::out_of_range if its transfer syntax has no
+       *         processor
        */
 
       data::dataset::transfer_processor& find_transfer_processor(unsigned char presentation_context_id);
 
+      /**
+       * @brief find_presentation_context returns an accepted presentation
+       *        context of the SOP class, preferably one accepted with the
+       *        given transfer syntax
+       * @param sop_uid SOP class uid
+       * @param transfer_syntax preferred transfer syntax
+       * @return presentation context or none if none was accepted
+       */
+      boost::optional<upperlayer::a_associate_ac::presentation_context>
+      find_presentation_context(const std::string& sop_uid, const std::string& transfer_syntax) const;
+
+      /**
+       * @brief make_message assembles the p_data_tf of a request or response
+       *        on the presentation context of its SOP class
+       * @param r request or response data
+       * @return message ready to be sent
+       */
+      upperlayer::p_data_tf make_message(const response& r);
+
       //upperlayer::Iupperlayer_sethandlers& upperlayer_handlers;
       upperlayer::Iupperlayer_comm_ops& upperlayer_impl;
-      CONN_STATE state;
+      // read by the SOP class handlers, which may run on a worker thread
+      std::atomic<CONN_STATE> state;
 
       boost::optional<upperlayer::a_associate_rq> connection_request;
       boost::optional<upperlayer::a_associate_ac> connection_properties;
 
       association_definition operations;
 
-      int msg_id = 1;
+      // requests may be sent by SOP class handlers running on a worker
+      std::atomic<int> msg_id {1};
+      // consumed by next_message_id() for a request whose id was reserved
+      // before its message was built
+      boost::optional<unsigned short> assigned_message_id;
+
+      // set if this side requested the association
+      bool requestor = false;
+
+      // handlers of the requests sent by send_request(), by message id
+      std::mutex outstanding_lock;
+      std::map<unsigned short, response_handler> outstanding;
 
       std::size_t max_remote_msg_length;
 
       std::map<data::dataset::DIMSE_SERVICE_GROUP
-         , std::function<upperlayer::p_data_tf(dimse_pm*, response r, int pres_context_id)>> assemble_response;
-
-      upperlayer::p_data_tf assemble_cfind_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_cfind_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_cecho_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_cecho_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_cget_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_cget_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_cmove_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_cmove_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_cstore_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_cstore_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_neventreport_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_neventreport_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_nget_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_nget_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_nset_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_nset_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_naction_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_naction_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_ncreate_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_ncreate_rsp(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_ndelete_rq(response r, int pres_context_id);
-      upperlayer::p_data_tf assemble_ndelete_rsp(response r, int pres_context_id);
+         , std::function<upperlayer::p_data_tf(dimse_pm*, const response& r, int pres_context_id)>> assemble_response;
+
+      upperlayer::p_data_tf assemble_cfind_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_cfind_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_cecho_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_cecho_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_cget_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_cget_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_cmove_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_cmove_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_cstore_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_cstore_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_neventreport_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_neventreport_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_nget_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_nget_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_nset_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_nset_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_naction_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_naction_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_ncreate_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_ncreate_rsp(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_ndelete_rq(const response& r, int pres_context_id);
+      upperlayer::p_data_tf assemble_ndelete_rsp(const response& r, int pres_context_id);
 
       data::dictionary::dictionaries& dict;
 
       std::map<std::string, std::unique_ptr<data::dataset::transfer_processor>> transfer_processors;
       std::string current_transfer_syntax;
 
+      std::shared_ptr<util::worker_pool> offload_pool;
+      std::size_t max_pending;
+      std::deque<std::pair<std::unique_ptr<upperlayer::property>,
+                           std::shared_ptr<dataset_stream>>> pending_messages;
+      bool processing;
+      bool release_deferred;
+
+      // guards worker_active, which is set while a worker uses this instance
+      std::mutex offload_lock;
+      std::condition_variable offload_done;
+      bool worker_active;
+
+      dataset_stream_selector stream_selector;
+      // stream of the message being received and of the message being
+      // handled by a SOP class handler
+      std::shared_ptr<dataset_stream> receiving_stream;
+      std::shared_ptr<dataset_stream> current_stream;
+
+      // expires with this instance, checked by functions posted to the
+      // connection's thread
+      std::shared_ptr<char> lifetime;
+
       util::log::channel_sev_logger logger;
 };
 
@@ -15,14 +15,29 @@ response::response(data::dataset::DIMSE_SERVICE_GROUP dsg,
                    data::dataset::STATUS status,
                    data::dataset::DIMSE_PRIORITY prio):
    response_type {dsg},
-   last_command {last_command},
-   data {data},
+   last_command {std::move(last_command)},
+   data {std::move(data)},
+   encoded_data {boost::none},
    status {status},
    prio {prio}
 
 {
 }
 
+response::response(data::dataset::DIMSE_SERVICE_GROUP dsg,
+                   data::dataset::commandset_data last_command,
+                   data::dataset::encoded_dataset data,
+                   data::dataset::STATUS status,
+                   data::dataset::DIMSE_PRIORITY prio):
+   response_type {dsg},
+   last_command {std::move(last_command)},
+   data {boost::none},
+   encoded_data {std::move(data)},
+   status {status},
+   prio {prio}
+{
+}
+
 data::dataset::DIMSE_SERVICE_GROUP response::get_response_type() const
 {
    return response_type;
@@ -38,6 +53,16 @@ const boost::optional<data::dataset::iod>& response::get_data() const
    return data;
 }
 
+const boost::optional<data::dataset::encoded_dataset>& response::get_encoded_data() const
+{
+   return encoded_data;
+}
+
+bool response::has_data() const
+{
+   return data.is_initialized() || encoded_data.is_initialized();
+}
+
 data::dataset::STATUS response::get_status() const
 {
    return status;
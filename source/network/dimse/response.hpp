@@ -4,6 +4,7 @@
 #include "boost/optional.hpp"
 
 #include "data/dataset/datasets.hpp"
+#include "data/dataset/transfer_processor.hpp"
 
 namespace dicom
 {
@@ -36,18 +37,38 @@ class response
                data::dataset::DIMSE_PRIORITY prio = data::dataset::DIMSE_PRIORITY::MEDIUM
                );
 
+      /**
+       * @brief response constructor for a message whose data set is already
+       *        serialized, eg. in a mapped file. The data set is sent as is
+       *        if its transfer syntax matches the one of the presentation
+       *        context, and transcoded otherwise.
+       * @param dsg service group of the response
+       * @param data serialized data set
+       * @param status optional; status indication, SUCCESS by default
+       * @param prio optional; priority of the response, MEDIUM by default
+       */
+      response(data::dataset::DIMSE_SERVICE_GROUP dsg,
+               data::dataset::commandset_data last_command,
+               data::dataset::encoded_dataset data,
+               data::dataset::STATUS status = data::dataset::STATUS::SUCCESS,
+               data::dataset::DIMSE_PRIORITY prio = data::dataset::DIMSE_PRIORITY::MEDIUM
+               );
+
       data::dataset::DIMSE_SERVICE_GROUP get_response_type() const;
       const data::dataset::commandset_data& get_command() const;
       const boost::optional<data::dataset::iod>& get_data() const;
+      const boost::optional<data::dataset::encoded_dataset>& get_encoded_data() const;
+      bool has_data() const;
       data::dataset::STATUS get_status() const;
       data::dataset::DIMSE_PRIORITY get_priority() const;
 
    private:
-      const data::dataset::DIMSE_SERVICE_GROUP response_type;
-      const data::dataset::commandset_data last_command;
-      const boost::optional<data::dataset::iod> data;
-      const data::dataset::STATUS status;
-      const data::dataset::DIMSE_PRIORITY prio;
+      data::dataset::DIMSE_SERVICE_GROUP response_type;
+      data::dataset::commandset_data last_command;
+      boost::optional<data::dataset::iod> data;
+      boost::optional<data::dataset::encoded_dataset> encoded_data;
+      data::dataset::STATUS status;
+      data::dataset::DIMSE_PRIORITY prio;
 };
 
 std::ostream& operator<<(std::ostream& os, const response& r);
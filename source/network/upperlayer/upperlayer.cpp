@@ -40,20 +40,27 @@ scp::~scp()
 
 void scp::accept_new(Iinfrastructure_upperlayer_connection* conn)
 {
-   scps[conn] = std::unique_ptr<scp_connection>
+   // the connection is set up outside of the lock, as it invokes the new
+   // connection handler
+   std::unique_ptr<scp_connection> sc
    {
          new scp_connection {conn, dict, handler_new_connection, handler_end_connection, [&](Iupperlayer_comm_ops* conn, std::exception_ptr exception) { this->error_handler(conn, exception); }}
    };
+   std::lock_guard<std::mutex> lock {scps_lock};
+   scps[conn] = std::move(sc);
    BOOST_LOG_SEV(logger, info) << "New connection" << conn;
 }
 
 void scp::connection_end(Iinfrastructure_upperlayer_connection* conn)
 {
-   auto& sc = scps.at(conn);
+   std::unique_ptr<scp_connection> sc;
+   {
+      std::lock_guard<std::mutex> lock {scps_lock};
+      sc = std::move(scps.at(conn));
+      scps.erase(conn);
+      BOOST_LOG_SEV(logger, info) << "Connection ended" << conn;
+   }
    handler_end_connection(sc.get());
-   //sc->reset();
-   scps.erase(conn);
-   BOOST_LOG_SEV(logger, info) << "Connection ended" << conn;
 }
 
 void scp::run()
@@ -112,7 +119,9 @@ scu::~scu()
 
 void scu::accept_new(Iinfrastructure_upperlayer_connection* conn)
 {
-   scus[conn] = std::unique_ptr<scu_connection> {new scu_connection {conn, dict, request, handler_new_connection, handler_end_connection, [&](Iupperlayer_comm_ops* conn, std::exception_ptr exception) { this->error_handler(conn, exception); }}};
+   std::unique_ptr<scu_connection> sc {new scu_connection {conn, dict, request, handler_new_connection, handler_end_connection, [&](Iupperlayer_comm_ops* conn, std::exception_ptr exception) { this->error_handler(conn, exception); }}};
+   std::lock_guard<std::mutex> lock {scus_lock};
+   scus[conn] = std::move(sc);
    BOOST_LOG_SEV(logger, info) << "New connection " << conn;
 }
 
@@ -123,11 +132,14 @@ void scu::accept_new()
 
 void scu::connection_end(Iinfrastructure_upperlayer_connection* conn)
 {
-   auto& sc = scus.at(conn);
+   std::unique_ptr<scu_connection> sc;
+   {
+      std::lock_guard<std::mutex> lock {scus_lock};
+      sc = std::move(scus.at(conn));
+      scus.erase(conn);
+      BOOST_LOG_SEV(logger, info) << "Connection ended" << conn;
+   }
    handler_end_connection(sc.get());
-   //sc->reset();
-   scus.erase(conn);
-   BOOST_LOG_SEV(logger, info) << "Connection ended" << conn;
 }
 
 void scu::run()
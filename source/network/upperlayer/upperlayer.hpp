@@ -3,6 +3,8 @@
 
 #include <functional>
 #include <memory>
+#include <map>
+#include <mutex>
 
 #include <boost/log/trivial.hpp>
 
@@ -64,6 +66,9 @@ struct Iupperlayer_connection_handlers
  * @brief The scp class acts as a service class provider which can have
  *        and manages multiple connections simultaneously as specified by the
  *        constructor's parameters.
+ * The connections may be accepted and terminated concurrently if the
+ * acceptor runs multiple threads; each connection itself is only used from
+ * the thread it is handled on.
  */
 class scp: public Iupperlayer_connection_handlers
 {
@@ -86,6 +91,7 @@ class scp: public Iupperlayer_connection_handlers
 
    private:
 
+      std::mutex scps_lock;
       std::map<Iinfrastructure_upperlayer_connection*, std::unique_ptr<scp_connection>> scps;
 
       void accept_new(Iinfrastructure_upperlayer_connection* conn);
@@ -146,6 +152,7 @@ class scu: public Iupperlayer_connection_handlers
 
       Iinfrastructure_client_acceptor& acceptor;
 
+      std::mutex scus_lock;
       std::map<Iinfrastructure_upperlayer_connection*, std::unique_ptr<scu_connection>> scus;
       a_associate_rq& request;
 
@@ -71,7 +71,10 @@ scx::scx(data::dictionary::dictionaries& dict,
    proc {data::dataset::commandset_processor {dict}},
    received_pdu {boost::none},
    handlers {},
-   shutdown_requested {false}
+   shutdown_requested {false},
+   reading_paused {false},
+   read_deferred {false},
+   recv_buffer(6)
 {
    for (const auto p : l) {
       handlers[p.first] = p.second;
@@ -87,8 +90,7 @@ scx::~scx()
 
 void scx::send(property* p)
 {
-   auto pdu = std::make_shared<std::vector<unsigned char>>(p->make_pdu());
-   auto ptype = get_type(*pdu);
+   auto ptype = p->type();
 
    statemachine::EVENT e;
    switch (ptype) {
@@ -121,8 +123,9 @@ void scx::send(property* p)
       // call async_write after each sent property until the queue is
       // empty
       if (ptype != TYPE::P_DATA_TF) {
+         auto pdu = std::make_shared<std::vector<unsigned char>>(p->make_pdu());
          connection()->write_data(pdu,
-            [this, p, ptype](const boost::system::error_code& err, std::size_t bytes) {
+            [this, pdu, p, ptype](const boost::system::error_code& err, std::size_t bytes) {
             try
             {
                if (err) {
@@ -142,40 +145,43 @@ void scx::send(property* p)
       } else {
          auto pdataprop = dynamic_cast<p_data_tf*>(p);
          assert(pdataprop);
-
-         std::size_t len = be_char_to_32b({pdu->begin()+6, pdu->begin()+10});
-         auto commandset = std::make_shared<std::vector<unsigned char>>(pdu->begin(), pdu->begin()+10+len);
-         connection()->write_data(commandset,
-            [this, commandset, len, pdu, p, ptype, pdataprop]
-               (const boost::system::error_code& err, std::size_t bytes) {
+         assert(!pdataprop->command_set.empty());
+
+         // the command and data set are referenced by the buffers instead of
+         // being copied; the property stays in the send queue and therefore
+         // alive until the write has completed.
+         auto buffers = std::make_shared<pdu_buffers>();
+         try
+         {
+            // check if a dataset is present in the message
+            using namespace data::attribute;
+            auto commandset = proc.deserialize(pdataprop->command_set);
+            unsigned short datasetpresent;
+            get_value_field<VR::US>(commandset.at({0x0000, 0x0800}), datasetpresent);
+            pdataprop->make_pdu_buffers(*buffers, datasetpresent != 0x0101);
+         } catch (std::exception& excep) {
+            BOOST_LOG_SEV(logger, error) << "Error occured preparing p_data_tf "
+                                         << "for writing\n"
+                                         << excep.what();
+            error_handler(this, std::current_exception());
+            return;
+         }
+         connection()->write_data(buffers->sequence,
+            [this, buffers, p, ptype](const boost::system::error_code& err, std::size_t bytes) {
             try
             {
                if (err) {
                   throw boost::system::system_error(err);
                }
 
-               BOOST_LOG_SEV(logger, trace) << "Sent data fragment of size " << bytes;
+               BOOST_LOG_SEV(logger, trace) << "Sent " << buffers->sequence.size()/2
+                                            << " data fragments of size " << bytes;
                BOOST_LOG_SEV(logger, info) << "Sent property of type " << ptype;
                BOOST_LOG_SEV(logger, debug) << "Property info: \n" << *p;
-
-               using namespace data::attribute;
-               if (!pdataprop->command_set.empty()) {
-                  // check if a dataset is present in the message
-                  auto commandset = proc.deserialize(pdataprop->command_set);
-                  unsigned short datasetpresent;
-                  get_value_field<VR::US>(commandset.at({0x0000, 0x0800}), datasetpresent);
-                  if (datasetpresent != 0x0101) {
-                     auto dataset = std::make_shared<std::vector<unsigned char>>(pdu->begin()+10+len, pdu->end());
-                     write_complete_dataset(p, dataset);
-                  } else {
-                     handle_pdu_conf(p, TYPE::P_DATA_TF);
-                  }
-               } else {
-                  assert(false);
-               }
+               handle_pdu_conf(p, TYPE::P_DATA_TF);
             } catch (std::exception& excep) {
-               BOOST_LOG_SEV(logger, error) << "Error occured writing command set"
-                                            << "of p_data_tf to connection"
+               BOOST_LOG_SEV(logger, error) << "Error occured writing p_data_tf "
+                                            << "to connection\n"
                                             << excep.what();
                error_handler(this, std::current_exception());
             }
@@ -191,15 +197,21 @@ void scx::handle_pdu(std::unique_ptr<property> p, TYPE ptype)
       handlers[ptype](this, std::move(p));
    }
 
+   read_next();
+}
+
+void scx::read_next()
+{
    if (get_state() == statemachine::CONN_STATE::STA13) {
       close_connection();
    } else {
       // be ready for new data
-      if (!connection()->is_stopped() && !shutdown_requested) {
+      if (reading_paused) {
+         read_deferred = true;
+      } else if (!connection()->is_stopped() && !shutdown_requested) {
          do_read();
       }
    }
-
 }
 
 void scx::handle_pdu_conf(property* p, TYPE ptype)
@@ -213,112 +225,15 @@ void scx::handle_pdu_conf(property* p, TYPE ptype)
    }
 }
 
-void scx::get_complete_dataset(std::shared_ptr<std::vector<unsigned char>> data)
-{
-   auto nextbuflen = std::make_shared<std::vector<unsigned char>>(6);
-   auto nextbufdata = std::make_shared<std::vector<unsigned char>>();
-   auto nextbufcompl = std::make_shared<std::vector<unsigned char>>();
-
-
-   connection()->read_data(nextbuflen, 6, [=] (const boost::system::error_code& err, std::size_t bytes) mutable {
-      try
-      {
-         if (err) {
-            throw boost::system::system_error(err);
-         }
-         std::size_t len = be_char_to_32b({nextbuflen->begin()+2, nextbuflen->begin()+6});
-         nextbufdata->resize(len);
-
-         BOOST_LOG_SEV(logger, trace) << "Size of incoming data unit: " << len;
-
-         connection()->read_data(nextbufdata, [=] (const boost::system::error_code& err, std::size_t bytes) mutable {
-            try
-            {
-               if (err) {
-                  throw boost::system::system_error(err);
-               }
-
-               BOOST_LOG_SEV(logger, trace) << "Read data fragment of size " << bytes;
-
-               nextbufcompl->reserve(len+6);
-               nextbufcompl->insert(nextbufcompl->end(), std::make_move_iterator(nextbuflen->begin()), std::make_move_iterator(nextbuflen->end()));
-               nextbufcompl->insert(nextbufcompl->end(), std::make_move_iterator(nextbufdata->begin()), std::make_move_iterator(nextbufdata->end()));
-               data->insert(data->end(), std::make_move_iterator(nextbufcompl->begin()), std::make_move_iterator(nextbufcompl->end()));
-
-               bool lastsegment = ((*nextbufcompl)[11] & 0x02);
-               if (lastsegment) {
-                  BOOST_LOG_SEV(logger, trace) << "Last data fragment";
-                  auto pdu = make_property(*data);
-                  handle_pdu(std::move(pdu), TYPE::P_DATA_TF);
-               } else {
-                  BOOST_LOG_SEV(logger, trace) << "More data fragments expected";
-                  get_complete_dataset(data);
-               }
-            } catch (std::exception& excep) {
-               BOOST_LOG_SEV(logger, error) << "Error occured reading from connection\n"
-                                            << "For the rest of the data\n"
-                                            << excep.what();
-               error_handler(this, std::current_exception());
-            }
-         });
-      } catch (std::exception& excep) {
-         BOOST_LOG_SEV(logger, error) << "Error occured reading from connection\n"
-                                      << "During read of first 6 bytes (length)\n"
-                                      << excep.what();
-         error_handler(this, std::current_exception());
-      }
-   });
-}
-
-void scx::write_complete_dataset(property* p, std::shared_ptr<std::vector<unsigned char>> data, std::size_t begin)
-{
-   std::size_t len = be_char_to_32b({data->begin()+begin+2, data->begin()+begin+6}) + 6;
-            // 6 bytes header + length
-
-   void* data_offset = (static_cast<void*>(data->data()+begin));
-
-   connection()->write_data(data_offset, len,
-      [this, p, data, len, begin, data_offset](const boost::system::error_code& err, std::size_t bytes) {
-      try
-      {
-         if (err) {
-            throw boost::system::system_error(err);
-         }
-
-         BOOST_LOG_SEV(logger, trace) << "Sent data fragment of size " << bytes;
-
-         bool lastsegment = ((static_cast<unsigned char*>(data_offset))[11] & 0x02);
-         if (lastsegment) {
-            BOOST_LOG_SEV(logger, trace) << "Last data fragment";
-            handle_pdu_conf(p, TYPE::P_DATA_TF);
-         } else {
-            BOOST_LOG_SEV(logger, trace) << "More data fragments to be sent";
-            std::size_t newbegin = begin + len;
-            write_complete_dataset(p, data, newbegin);
-         }
-      } catch (std::exception& excep) {
-         BOOST_LOG_SEV(logger, error) << "Error writing fragment of p_data_tf\n"
-                                      << excep.what();
-         error_handler(this, std::current_exception());
-      }
-   });
-
-}
-
 void scx::do_read()
 {
-   // because the async operations terminate immediately the containers would go out of scope
-   // and async_write would write into "unallocated" memory. To prevent this, reference-counting
-   // shared_ptrs are used, which are captured, copied and therefore held alive by the lambda
-   // passed to the read handler.
-   // There may only be one async_read at a time. This is ensured by calling async_reads _only_
-   // in the read handlers, i.e. when the previous read has completed.
-   auto size = std::make_shared<std::vector<unsigned char>>(6);
-   auto rem_data = std::make_shared<std::vector<unsigned char>>();
-   auto compl_data = std::make_shared<std::vector<unsigned char>>();
-
-
-   connection()->read_data(size, 6, [=](const boost::system::error_code& err, std::size_t bytes)  {
+   // The header of the pdu is read into the front of the receive buffer and
+   // the rest of the pdu behind it. The buffer is a member of the connection
+   // and reused for all pdus; it only grows, so no allocations take place
+   // once it has reached the maximum pdu length.
+   // There may only be one read at a time. This is ensured by calling reads
+   // _only_ in the read handlers, i.e. when the previous read has completed.
+   connection()->read_data(recv_buffer.data(), 6, [this](const boost::system::error_code& err, std::size_t bytes)  {
       try
       {
          if (err) {
@@ -326,25 +241,24 @@ void scx::do_read()
          }
          assert(bytes == 6);
 
-         std::size_t len = be_char_to_32b({size->begin()+2, size->begin()+6});
-         rem_data->resize(len);
+         std::size_t len = be_char_to_32b({recv_buffer.begin()+2, recv_buffer.begin()+6});
+         if (recv_buffer.size() < len+6) {
+            recv_buffer.resize(len+6);
+         }
 
          BOOST_LOG_SEV(logger, trace) << "Size of incoming data unit: " << len;
 
-         connection()->read_data(rem_data, len,
-            [=](const boost::system::error_code& err, std::size_t bytes) {
+         connection()->read_data(recv_buffer.data()+6, len,
+            [this, len](const boost::system::error_code& err, std::size_t bytes) {
             try
             {
                if (err) {
                   throw boost::system::system_error(err);
                }
 
-               compl_data->reserve(size->size() + rem_data->size());
-               compl_data->insert(compl_data->end(), size->begin(), size->end());
-               compl_data->insert(compl_data->end(), rem_data->begin(), rem_data->end());
-               received_pdu = compl_data.get();
+               received_pdu = &recv_buffer;
 
-               auto ptype = get_type(*compl_data);
+               auto ptype = get_type(recv_buffer);
                BOOST_LOG_SEV(logger, info) << "Received property of type " << ptype;
                statemachine::EVENT e;
                switch (ptype) {
@@ -376,34 +290,15 @@ void scx::do_read()
                statem.transition(e); // side effects of the statemachine's transition function
 
                if (received_pdu != boost::none) {
-                  auto property = make_property(*compl_data);
-                  BOOST_LOG_SEV(logger, debug) << "Property info: \n" << *property;
-
                   // PDUs of type p_data_tf may come in fragments and with a
                   // data set, which needs to be received.
                   if (ptype == TYPE::P_DATA_TF) {
                      BOOST_LOG_SEV(logger, trace) << "Read data fragment of size " << bytes;
-                     using namespace data::attribute;
-                     auto pdataprop = dynamic_cast<p_data_tf*>(property.get());
-                     assert(pdataprop);
-                     if (!pdataprop->command_set.empty()) {
-                        // check if a dataset is present in the message
-                        auto commandset = proc.deserialize(pdataprop->command_set);
-                        unsigned short datasetpresent;
-                        get_value_field<VR::US>(commandset.at({0x0000, 0x0800}), datasetpresent);
-                        if (datasetpresent != 0x0101) {
-                           BOOST_LOG_SEV(logger, trace) << "Dataset present in the PDU ("
-                                                        << "(0000,0800) = " << datasetpresent << ")";
-                           get_complete_dataset(compl_data);
-                        } else {
-                           handle_pdu(std::move(property), TYPE::P_DATA_TF);
-                        }
-                     } else {
-                        BOOST_LOG_SEV(logger, warning) << "No commandset present in the received data PDU. " <<
-                                                        "Ignoring Message";
-                     }
+                     receive_data_fragment(len+6);
                   } else {
                      BOOST_LOG_SEV(logger, trace) << "Read PDU of size " << bytes;
+                     auto property = make_property({recv_buffer.begin(), recv_buffer.begin()+len+6});
+                     BOOST_LOG_SEV(logger, debug) << "Property info: \n" << *property;
                      handle_pdu(std::move(property), ptype);
                   }
                }
@@ -423,6 +318,74 @@ void scx::do_read()
    });
 }
 
+void scx::receive_data_fragment(std::size_t size)
+{
+   if (!recv_message) {
+      recv_message.reset(new p_data_tf {});
+   }
+
+   bool complete = false;
+   bool misplaced_data = false;
+   for_each_pdv(recv_buffer.data(), size,
+      [this, &complete, &misplaced_data](unsigned char pcid, unsigned char msg_control,
+                                         const unsigned char* fragment, std::size_t len) {
+      recv_message->pres_context_id = pcid;
+      bool last_fragment = msg_control & 0x02;
+      if (msg_control & 0x01) {
+         auto& command_set = recv_message->command_set;
+         command_set.insert(command_set.end(), fragment, fragment+len);
+         if (!last_fragment) {
+            return;
+         }
+
+         // the command set is complete, check if a dataset is present in the
+         // message
+         using namespace data::attribute;
+         auto commandset = proc.deserialize(command_set);
+         unsigned short datasetpresent;
+         get_value_field<VR::US>(commandset.at({0x0000, 0x0800}), datasetpresent);
+         if (datasetpresent == 0x0101) {
+            complete = true;
+            return;
+         }
+         BOOST_LOG_SEV(logger, trace) << "Dataset present in the PDU ("
+                                      << "(0000,0800) = " << datasetpresent << ")";
+         if (data_stream_selector) {
+            recv_stream = data_stream_selector(*recv_message);
+         }
+      } else if (recv_message->command_set.empty()) {
+         misplaced_data = true;
+      } else {
+         if (recv_stream) {
+            recv_stream(fragment, len, last_fragment);
+         } else {
+            auto& data_set = recv_message->data_set;
+            data_set.insert(data_set.end(), fragment, fragment+len);
+         }
+         complete = last_fragment;
+      }
+   });
+
+   if (misplaced_data) {
+      BOOST_LOG_SEV(logger, warning) << "No commandset present in the received data PDU. " <<
+                                      "Ignoring Message";
+      recv_message.reset();
+      recv_stream = nullptr;
+      read_next();
+      return;
+   }
+
+   if (complete) {
+      BOOST_LOG_SEV(logger, trace) << "Last data fragment";
+      BOOST_LOG_SEV(logger, debug) << "Property info: \n" << *recv_message;
+      recv_stream = nullptr;
+      handle_pdu(std::move(recv_message), TYPE::P_DATA_TF);
+   } else {
+      BOOST_LOG_SEV(logger, trace) << "More data fragments expected";
+      read_next();
+   }
+}
+
 
 void scx::queue_for_write(std::unique_ptr<property> p)
 {
@@ -446,6 +409,27 @@ void scx::queue_for_write_w_prio(std::unique_ptr<property> p)
    send(send_queue.front().get());
 }
 
+void scx::post(std::function<void()> f)
+{
+   connection()->post(f);
+}
+
+void scx::pause_reading()
+{
+   reading_paused = true;
+}
+
+void scx::resume_reading()
+{
+   reading_paused = false;
+   if (read_deferred) {
+      read_deferred = false;
+      if (!connection()->is_stopped() && !shutdown_requested) {
+         do_read();
+      }
+   }
+}
+
 void scx::reset_artim()
 {
    stop_artim();
@@ -514,6 +498,11 @@ void scx::inject_conf(TYPE t, std::function<void(Iupperlayer_comm_ops*, property
    handlers_conf[t] = f;
 }
 
+void scx::inject_data_stream(std::function<data_stream(const p_data_tf&)> f)
+{
+   data_stream_selector = f;
+}
+
 statemachine::CONN_STATE scx::get_state()
 {
    return statem.get_state();
@@ -61,6 +61,12 @@ struct Istate_trans_ops
       virtual ~Istate_trans_ops() = 0;
 };
 
+/**
+ * data_stream receives the fragments of a data set while it is received, last
+ * is set for the final fragment
+ */
+using data_stream = std::function<void(const unsigned char* fragment, std::size_t len, bool last)>;
+
 /**
  * @brief The Iupperlayer_comm_ops struct is an interface used for writing properties and
  *        injecting handlers for received properties
@@ -70,6 +76,28 @@ struct Iupperlayer_comm_ops
       virtual void queue_for_write(std::unique_ptr<property> p) = 0;
       virtual void inject(TYPE t, std::function<void(Iupperlayer_comm_ops*, std::unique_ptr<property>)> f) = 0;
       virtual void inject_conf(TYPE t, std::function<void(Iupperlayer_comm_ops*, property* f)>) = 0;
+
+      /**
+       * @brief inject_data_stream sets a function which is invoked when the
+       *        command set of a received message with a data set is
+       *        complete. If it returns a data_stream, the data set fragments
+       *        are passed to it as they arrive instead of being collected in
+       *        the p_data_tf, whose data_set stays empty.
+       */
+      virtual void inject_data_stream(std::function<data_stream(const p_data_tf&)> f) = 0;
+
+      /**
+       * @brief post schedules f for execution on the thread handling the
+       *        connection. May be called from any thread.
+       */
+      virtual void post(std::function<void()> f) = 0;
+
+      /**
+       * @brief pause_reading stops reading from the peer after the PDU which
+       *        is currently received until resume_reading() is called.
+       */
+      virtual void pause_reading() = 0;
+      virtual void resume_reading() = 0;
       virtual ~Iupperlayer_comm_ops() = 0;
 };
 
@@ -87,6 +115,9 @@ struct Iupperlayer_comm_ops
  * keep the state machine valid. It is not involved in the association
  * negotiation. This has to be done by the user of this class (either a facade
  * or the DIMSE_PM).
+ * An scx instance is not synchronized. All of its operations must be invoked
+ * from the thread which runs the io_service of its connection, which is the
+ * case for the handlers it invokes.
  */
 class scx: public Istate_trans_ops, public Iupperlayer_comm_ops
 {
@@ -125,6 +156,8 @@ class scx: public Istate_trans_ops, public Iupperlayer_comm_ops
        */
       void inject_conf(TYPE t, std::function<void(Iupperlayer_comm_ops*, property*)> f) override;
 
+      void inject_data_stream(std::function<data_stream(const p_data_tf&)> f) override;
+
       /**
        * @brief queue_for_write takes ownership of a property and queues it for
        *        writing
@@ -143,6 +176,12 @@ class scx: public Istate_trans_ops, public Iupperlayer_comm_ops
        */
       void queue_for_write_w_prio(std::unique_ptr<property> p) override;
 
+      void post(std::function<void()> f) override;
+
+      void pause_reading() override;
+
+      void resume_reading() override;
+
       /**
        * @brief reset_artim resets the artim timer
        */
@@ -186,6 +225,7 @@ class scx: public Istate_trans_ops, public Iupperlayer_comm_ops
        * bytes (ie the whole pdu) are received. This second read-handler
        * contains the code which actually processes the pdu (calls the
        * appropriate handler, manages state transitions, ...)
+       * Both reads go into the reusable receive buffer of the connection.
        */
       void do_read();
 
@@ -206,6 +246,8 @@ class scx: public Istate_trans_ops, public Iupperlayer_comm_ops
        * @brief send takes a property and uses its property::make_pdu() function
        *        for serialization. The serialized data is sent to the peer via
        *        the socket.
+       *        A p_data_tf is written as a sequence of PDU headers and views
+       *        into its command and data set with a single gathering write.
        * @param[in] p
        */
       void send(property* p);
@@ -225,19 +267,19 @@ class scx: public Istate_trans_ops, public Iupperlayer_comm_ops
       void handle_pdu_conf(property* p, TYPE ptype);
 
       /**
-       * @brief get_complete_dataset reads the complete dataset and stores it
-       *        in the property's dataset member.
-       * @param[in] data
+       * @brief read_next continues reading from the peer unless reading is
+       *        paused or the connection is being closed
        */
-      void get_complete_dataset(std::shared_ptr<std::vector<unsigned char> > data);
-
+      void read_next();
 
       /**
-       * @brief write_complete_dataset write the complete dataset to the peer
-       * @param p property being written (stored in the write queue)
-       * @param data serialized property being written
+       * @brief receive_data_fragment adds the PDVs of the P-DATA-TF PDU in
+       *        the receive buffer to the message being received, or passes
+       *        the data set fragments to its data stream, and passes the
+       *        message to the handler once it is complete.
+       * @param[in] size size of the PDU in the receive buffer
        */
-      void write_complete_dataset(property* p, std::shared_ptr<std::vector<unsigned char>> data, std::size_t begin = 0);
+      void receive_data_fragment(std::size_t size);
 
 
       /**
@@ -254,6 +296,26 @@ class scx: public Istate_trans_ops, public Iupperlayer_comm_ops
 
       bool shutdown_requested;
 
+      bool reading_paused;
+      bool read_deferred;
+
+      /**
+       * receive buffer holding the pdu being read, reused for all pdus
+       */
+      std::vector<unsigned char> recv_buffer;
+
+      /**
+       * message assembled from the received P-DATA-TF PDUs
+       */
+      std::unique_ptr<p_data_tf> recv_message;
+
+      std::function<data_stream(const p_data_tf&)> data_stream_selector;
+
+      /**
+       * receives the data set of recv_message if it is streamed
+       */
+      data_stream recv_stream;
+
 
    protected:
       virtual Iinfrastructure_upperlayer_connection* connection() = 0;
@@ -5,6 +5,7 @@
 #include <vector>
 #include <string>
 #include <cassert>
+#include <stdexcept>
 
 namespace dicom
 {
@@ -53,8 +54,96 @@ std::vector<uchar> ui_to_32b_be(unsigned val)
    be_val[3] = (val & 0xFF);
    return be_val;
 }
+
+/**
+ * @brief read_user_info reads the sub-items of the user information item at
+ *        pos which are supported, others are skipped.
+ */
+void read_user_info(const std::vector<uchar>& pdu, std::size_t pos,
+                    std::size_t& max_message_length,
+                    unsigned short& max_ops_invoked,
+                    unsigned short& max_ops_performed)
+{
+   assert(pdu[pos] == 0x50);
+   std::size_t end = std::min(pdu.size(),
+                              pos + 4 + be_char_to_16b({pdu.begin()+pos+2, pdu.begin()+pos+4}));
+   pos += 4;
+   while (pos + 4 <= end) {
+      std::size_t item_len = be_char_to_16b({pdu.begin()+pos+2, pdu.begin()+pos+4});
+      if (pos + 4 + item_len > end) {
+         break;
+      }
+      if (pdu[pos] == 0x51 && item_len == 4) {
+         max_message_length = be_char_to_32b({pdu.begin()+pos+4, pdu.begin()+pos+8});
+      } else if (pdu[pos] == 0x53 && item_len == 4) {
+         // asynchronous operations window
+         max_ops_invoked = be_char_to_16b({pdu.begin()+pos+4, pdu.begin()+pos+6});
+         max_ops_performed = be_char_to_16b({pdu.begin()+pos+6, pdu.begin()+pos+8});
+      }
+      pos += 4 + item_len;
+   }
 }
 
+/**
+ * @brief write_user_info appends the user information item. The asynchronous
+ *        operations window is only included if it differs from the default
+ *        of one operation each.
+ */
+void write_user_info(std::vector<uchar>& pack, std::size_t max_message_length,
+                     unsigned short max_ops_invoked, unsigned short max_ops_performed)
+{
+   const bool async_window = max_ops_invoked != 1 || max_ops_performed != 1;
+   pack.insert(pack.end(), {0x50, 0x00});
+   std::vector<uchar> ui_len = ui_to_16b_be(async_window ? 0x10 : 0x08);
+   pack.insert(pack.end(), ui_len.begin(), ui_len.end());
+
+   {
+      // insert maximum length item
+      pack.insert(pack.end(), {0x51, 0x00, 0x00, 0x04});
+      std::vector<uchar> max_len = ui_to_32b_be(max_message_length);
+      pack.insert(pack.end(), max_len.begin(), max_len.end());
+   }
+
+   if (async_window) {
+      pack.insert(pack.end(), {0x53, 0x00, 0x00, 0x04});
+      std::vector<uchar> invoked = ui_to_16b_be(max_ops_invoked);
+      std::vector<uchar> performed = ui_to_16b_be(max_ops_performed);
+      pack.insert(pack.end(), invoked.begin(), invoked.end());
+      pack.insert(pack.end(), performed.begin(), performed.end());
+   }
+}
+}
+
+
+
+void for_each_pdv(const unsigned char* pdu, std::size_t size,
+                  const std::function<void(unsigned char, unsigned char, const unsigned char*, std::size_t)>& handler)
+{
+   auto be_32b = [](const uchar* bs) {
+      return (static_cast<std::size_t>(bs[0]) << 24) | (static_cast<std::size_t>(bs[1]) << 16)
+            | (static_cast<std::size_t>(bs[2]) << 8) | static_cast<std::size_t>(bs[3]);
+   };
+
+   std::size_t pos = 6;
+   while (pos < size) {
+      if (size-pos < 6) {
+         throw std::runtime_error {"Incomplete PDV item in P-DATA-TF PDU"};
+      }
+      std::size_t pdv_len = be_32b(pdu+pos);
+      // message control header and presentation context id are included in
+      // the length
+      if (pdv_len < 2 || pdv_len > size-pos-4) {
+         throw std::runtime_error {"Invalid PDV item length in P-DATA-TF PDU"};
+      }
+      handler(pdu[pos+4], pdu[pos+5], pdu+pos+6, pdv_len-2);
+      pos += 4+pdv_len;
+   }
+}
+
+std::size_t pdu_buffers::size() const
+{
+   return boost::asio::buffer_size(sequence);
+}
 
 
 TYPE get_type(const std::vector<unsigned char>& pdu)
@@ -70,90 +159,100 @@ property::~property()
 
 void p_data_tf::from_pdu(std::vector<unsigned char> pdu)
 {
+   // the pdu may consist of multiple concatenated P-DATA-TF PDUs
    std::size_t pos = 0;
-   bool pdvs_left = true;
-   while (pdvs_left || pos < pdu.size()-1) {
-      pos += 6;
-      std::size_t pdv_len = be_char_to_32b({pdu.begin()+pos, pdu.begin()+pos+4});
-      pos += 4;
-      pres_context_id = pdu[pos];
-
-      unsigned char msg_control = pdu[pos+1];
-
-      pos += 2;
-      if (msg_control & 0x01) {
-         command_set.insert(command_set.end(), pdu.begin()+pos, pdu.begin()+(pos+pdv_len-2));
-      } else {
-         data_set.insert(data_set.end(), pdu.begin()+pos, pdu.begin()+(pos+pdv_len-2));
+   while (pos + 6 <= pdu.size()) {
+      std::size_t pdu_len = be_char_to_32b({pdu.begin()+pos+2, pdu.begin()+pos+6}) + 6;
+      if (pdu_len > pdu.size()-pos) {
+         throw std::runtime_error {"P-DATA-TF PDU exceeds the received data"};
       }
-
-      pdvs_left = !(msg_control & 0x02);
-      pos += pdv_len-2; // message control id and presentation context id are
-                        // included in the length
+      append_pdvs(pdu.data()+pos, pdu_len);
+      pos += pdu_len;
    }
 }
 
+unsigned char p_data_tf::append_pdvs(const unsigned char* pdu, std::size_t size)
+{
+   unsigned char last_msg_control = 0x00;
+   for_each_pdv(pdu, size, [this, &last_msg_control](unsigned char pcid, unsigned char msg_control,
+                                                     const unsigned char* fragment, std::size_t len) {
+      pres_context_id = pcid;
+      last_msg_control = msg_control;
+      auto& target = (msg_control & 0x01) ? command_set : data_set;
+      target.insert(target.end(), fragment, fragment+len);
+   });
+   return last_msg_control;
+}
+
 std::vector<uchar> p_data_tf::make_pdu() const
 {
-   const std::size_t preamble_length = 12;
-   const std::size_t m_length = msg_length-preamble_length;
-   std::vector<uchar> pack;
+   pdu_buffers buffers;
+   make_pdu_buffers(buffers);
 
-   {
-      // insert command part
-      // one extra byte each for message id and message header
-      std::vector<uchar> pdv_len;
-
-      if (!command_set.empty()) {
-         auto begin = pack.end()-pack.begin();
-         pack.push_back(static_cast<uchar>(TYPE::P_DATA_TF));
-         pack.insert(pack.end(), {0x00, 0x00, 0x00, 0x00, 0x00});
-         std::size_t len_pos = begin + 2;
-
-         pdv_len = ui_to_32b_be(command_set.size()+2);
-         pack.insert(pack.end(), pdv_len.begin(), pdv_len.end());
-         pack.push_back(pres_context_id);
-//         if (data_set.empty()) {
-//            pack.push_back(0x03);
-//         } else {
-//            pack.push_back(0x01);
-//         }
-         pack.push_back(0x03);
-         pack.insert(pack.end(), command_set.begin(), command_set.end());
-
-         std::size_t pdu_len = pack.size()-6;
-         std::vector<uchar> plen = ui_to_32b_be(pdu_len);
-         std::copy(plen.begin(), plen.end(), pack.begin()+len_pos);
-      }
+   std::vector<uchar> pack(buffers.size());
+   auto out = pack.begin();
+   for (const auto& buffer : buffers.sequence) {
+      auto data = boost::asio::buffer_cast<const uchar*>(buffer);
+      out = std::copy(data, data+boost::asio::buffer_size(buffer), out);
+   }
+   return pack;
+}
 
-      // insert pack header
-      if (!data_set.empty()) {
-         for (std::size_t pos = 0; pos < data_set.size(); pos += m_length) {
-            auto begin = pack.end()-pack.begin();
-            pack.push_back(static_cast<uchar>(TYPE::P_DATA_TF));
-            pack.insert(pack.end(), {0x00, 0x00, 0x00, 0x00, 0x00});
-            std::size_t len_pos = begin + 2;
-
-            auto remaining = std::min(m_length, data_set.size()-pos);
-            pdv_len = ui_to_32b_be(remaining+2);
-            pack.insert(pack.end(), pdv_len.begin(), pdv_len.end());
-            pack.push_back(pres_context_id);
-
-            if (remaining < m_length) {
-               pack.push_back(0x02);
-            } else {
-               pack.push_back(0x00);
-            }
-            pack.insert(pack.end(), data_set.begin()+pos, data_set.begin()+pos+remaining);
+void p_data_tf::make_pdu_buffers(pdu_buffers& buffers, bool with_dataset) const
+{
+   const std::size_t preamble_length = 12;
+   // one extra byte each for presentation context id and message control
+   // header are included in the pdv length
+   auto put_header = [this, &buffers](std::size_t len, uchar msg_control) {
+      std::vector<uchar> pdu_len = ui_to_32b_be(len+6);
+      std::vector<uchar> pdv_len = ui_to_32b_be(len+2);
+      auto& headers = buffers.headers;
+      headers.push_back(static_cast<uchar>(TYPE::P_DATA_TF));
+      headers.push_back(0x00);
+      headers.insert(headers.end(), pdu_len.begin(), pdu_len.end());
+      headers.insert(headers.end(), pdv_len.begin(), pdv_len.end());
+      headers.push_back(pres_context_id);
+      headers.push_back(msg_control);
+   };
+
+   buffers.headers.clear();
+   buffers.sequence.clear();
+
+   // the headers are completed before the sequence is built, so the buffers
+   // referring to them are not invalidated by a reallocation
+   std::vector<std::pair<const uchar*, std::size_t>> payloads;
+
+   if (!command_set.empty()) {
+      put_header(command_set.size(), 0x03);
+      payloads.emplace_back(command_set.data(), command_set.size());
+   }
 
-            std::size_t pdu_len = remaining+6;
-            std::vector<uchar> plen = ui_to_32b_be(pdu_len);
-            std::copy(plen.begin(), plen.end(), pack.begin()+len_pos);
-         }
+   const uchar* data = data_set_view ? data_set_view : data_set.data();
+   const std::size_t data_size = data_set_view ? data_set_view_size : data_set.size();
+   if (with_dataset && data_size > 0) {
+      assert(msg_length > preamble_length);
+      const std::size_t m_length = msg_length-preamble_length;
+      for (std::size_t pos = 0; pos < data_size; pos += m_length) {
+         auto remaining = std::min(m_length, data_size-pos);
+         put_header(remaining, pos+remaining == data_size ? 0x02 : 0x00);
+         payloads.emplace_back(data+pos, remaining);
       }
    }
 
-   return pack;
+   buffers.sequence.reserve(payloads.size()*2);
+   for (std::size_t i = 0; i < payloads.size(); ++i) {
+      buffers.sequence.emplace_back(buffers.headers.data()+i*preamble_length, preamble_length);
+      buffers.sequence.emplace_back(payloads[i].first, payloads[i].second);
+   }
+}
+
+void p_data_tf::set_data_set_view(const unsigned char* data, std::size_t size,
+                                  std::shared_ptr<const void> owner)
+{
+   data_set.clear();
+   data_set_view = data;
+   data_set_view_size = size;
+   data_set_owner = std::move(owner);
 }
 
 TYPE p_data_tf::type() const
@@ -223,14 +322,7 @@ void a_associate_rq::from_pdu(std::vector<unsigned char> pdu)
       }
 
       // read user info item
-      {
-         assert(pdu[pos] == 0x50);
-         pos += 4;
-         {
-            assert(pdu[pos] == 0x51);
-            max_message_length = be_char_to_32b({pdu.begin()+pos+4, pdu.begin()+pos+8});
-         }
-      }
+      read_user_info(pdu, pos, max_message_length, max_ops_invoked, max_ops_performed);
 
    }
 }
@@ -296,16 +388,7 @@ std::vector<uchar> a_associate_rq::make_pdu() const
       }
 
       // insert user info item
-      pack.insert(pack.end(), {0x50, 0x00});
-      std::vector<uchar> ui_len = ui_to_16b_be(0x08);
-      pack.insert(pack.end(), ui_len.begin(), ui_len.end());
-
-      {
-         // insert maximum length item
-         pack.insert(pack.end(), {0x51, 0x00, 0x00, 0x04});
-         std::vector<uchar> max_len = ui_to_32b_be(max_message_length);
-         pack.insert(pack.end(), max_len.begin(), max_len.end());
-      }
+      write_user_info(pack, max_message_length, max_ops_invoked, max_ops_performed);
    }
 
    std::size_t pdu_len = pack.size()-6;
@@ -326,6 +409,8 @@ std::ostream& a_associate_rq::print(std::ostream& os) const
    os << "Local Application Entity:\t" << called_ae << "\n"
       << "Remote Application Entity:\t" << calling_ae << "\n"
       << "Maximum Message Length:\t\t" << max_message_length << "\n"
+      << "Asynchronous Operations Window:\t" << max_ops_invoked << " invoked, "
+      << max_ops_performed << " performed\n"
       << "Application Context:\t" << application_context << "\n"
       << "Proposed presentation contexts:\n";
    for (const auto pc : pres_contexts) {
@@ -374,14 +459,7 @@ void a_associate_ac::from_pdu(std::vector<unsigned char> pdu)
       }
 
       // read user info item
-      {
-         assert(pdu[pos] == 0x50);
-         pos += 4;
-         {
-            assert(pdu[pos] == 0x51);
-            max_message_length = be_char_to_32b({pdu.begin()+pos+4, pdu.begin()+pos+8});
-         }
-      }
+      read_user_info(pdu, pos, max_message_length, max_ops_invoked, max_ops_performed);
 
    }
 }
@@ -426,16 +504,7 @@ std::vector<uchar> a_associate_ac::make_pdu() const
       }
 
       // insert user info item
-      pack.insert(pack.end(), {0x50, 0x00});
-      std::vector<uchar> ui_len = ui_to_16b_be(0x08);
-      pack.insert(pack.end(), ui_len.begin(), ui_len.end());
-
-      {
-         // insert maximum length item
-         pack.insert(pack.end(), {0x51, 0x00, 0x00, 0x04});
-         std::vector<uchar> max_len = ui_to_32b_be(max_message_length);
-         pack.insert(pack.end(), max_len.begin(), max_len.end());
-      }
+      write_user_info(pack, max_message_length, max_ops_invoked, max_ops_performed);
    }
 
    std::size_t pdu_len = pack.size()-6;
@@ -455,6 +524,8 @@ std::ostream& a_associate_ac::print(std::ostream& os) const
    os << "Local Application Entity:\t" << called_ae << "\n"
       << "Remote Application Entity:\t" << calling_ae << "\n"
       << "Maximum Message Length:\t\t" << max_message_length << "\n"
+      << "Asynchronous Operations Window:\t" << max_ops_invoked << " invoked, "
+      << max_ops_performed << " performed\n"
       << "Application Context:\t" << application_context << "\n"
       << "Status of proposed presentation contexts:\n";
    for (const auto pc : pres_contexts) {
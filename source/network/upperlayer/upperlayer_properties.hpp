@@ -4,6 +4,9 @@
 #include <vector>
 #include <string>
 #include <memory>
+#include <functional>
+
+#include <boost/asio/buffer.hpp>
 
 namespace dicom
 {
@@ -56,11 +59,72 @@ std::unique_ptr<property> make_property(const std::vector<unsigned char>& pdu);
 
 
 
+/**
+ * @brief for_each_pdv invokes the handler for each PDV item contained in a
+ *        single P-DATA-TF PDU.
+ * @param pdu pointer to the beginning of the PDU, including its header
+ * @param size size of the PDU in bytes
+ * @param handler called with the presentation context id, the message control
+ *        header and the fragment of the PDV
+ * @throws std::runtime_error if the PDV items exceed the PDU
+ */
+void for_each_pdv(const unsigned char* pdu, std::size_t size,
+                  const std::function<void(unsigned char pres_context_id, unsigned char msg_control,
+                                           const unsigned char* fragment, std::size_t len)>& handler);
+
+/**
+ * @brief The pdu_buffers struct holds a serialized p_data_tf as a sequence of
+ *        buffers, which can be written with a single gathering write.
+ * Only the PDU and PDV headers are stored in headers, the buffers of the
+ * command and data set refer to the members of the p_data_tf, which must not
+ * be modified or destroyed while the sequence is used.
+ */
+struct pdu_buffers
+{
+      std::vector<unsigned char> headers;
+      std::vector<boost::asio::const_buffer> sequence;
+
+      /**
+       * @brief size returns the accumulated size of the buffers in bytes
+       */
+      std::size_t size() const;
+};
+
 struct p_data_tf: property
 {
       p_data_tf() = default;
       void from_pdu(std::vector<unsigned char> pdu) override;
       std::vector<unsigned char> make_pdu() const override;
+
+      /**
+       * @brief make_pdu_buffers serializes the property like make_pdu(), but
+       *        without copying the command and data set.
+       * @param[out] buffers header storage and resulting buffer sequence
+       * @param[in] with_dataset if false, only the command PDU is serialized
+       */
+      void make_pdu_buffers(pdu_buffers& buffers, bool with_dataset = true) const;
+
+      /**
+       * @brief append_pdvs appends the fragments contained in the PDVs of a
+       *        single P-DATA-TF PDU to the command or data set.
+       * @param pdu pointer to the beginning of the PDU, including its header
+       * @param size size of the PDU in bytes
+       * @return message control header of the last PDV of the PDU
+       */
+      unsigned char append_pdvs(const unsigned char* pdu, std::size_t size);
+
+      /**
+       * @brief set_data_set_view lets the property send a serialized data set
+       *        owned by another object, eg. a mapped file, instead of
+       *        data_set. The data is referenced by the buffers of
+       *        make_pdu_buffers() and written without being copied.
+       * @param data pointer to the serialized data set
+       * @param size size of the data set in bytes
+       * @param owner owner of the data, kept alive by the property
+       */
+      void set_data_set_view(const unsigned char* data, std::size_t size,
+                             std::shared_ptr<const void> owner);
+
       TYPE type() const override;
       std::ostream& print(std::ostream& os) const override;
 
@@ -68,6 +132,11 @@ struct p_data_tf: property
       unsigned char pres_context_id;
       std::vector<unsigned char> command_set;
       std::vector<unsigned char> data_set;
+
+   private:
+      const unsigned char* data_set_view = nullptr;
+      std::size_t data_set_view_size = 0;
+      std::shared_ptr<const void> data_set_owner;
 };
 
 /**
@@ -100,6 +169,15 @@ struct a_associate_rq: property
 
       std::vector<presentation_context> pres_contexts;
       std::size_t max_message_length;
+
+      /**
+       * asynchronous operations window, the maximum number of outstanding
+       * operations the association requestor may invoke and perform. 0
+       * stands for an unlimited number, the default of 1 for synchronous
+       * operation, in which case the sub-item is omitted.
+       */
+      unsigned short max_ops_invoked = 1;
+      unsigned short max_ops_performed = 1;
 };
 
 struct a_associate_ac: property
@@ -132,6 +210,15 @@ struct a_associate_ac: property
 
       std::vector<presentation_context> pres_contexts;
       std::size_t max_message_length;
+
+      /**
+       * asynchronous operations window, the maximum number of outstanding
+       * operations the association requestor may invoke and perform. 0
+       * stands for an unlimited number, the default of 1 for synchronous
+       * operation, in which case the sub-item is omitted.
+       */
+      unsigned short max_ops_invoked = 1;
+      unsigned short max_ops_performed = 1;
 };
 
 std::ostream& operator<<(std::ostream& os, a_associate_ac::presentation_context::RESULT r);
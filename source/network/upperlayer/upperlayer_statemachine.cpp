@@ -1,8 +1,5 @@
 #include "upperlayer_statemachine.hpp"
 
-#include <map>
-#include <functional>
-
 #include <boost/log/trivial.hpp>
 
 #include "upperlayer_properties.hpp"
@@ -19,10 +16,14 @@ namespace upperlayer
 
 using namespace dicom::util::log;
 
+using sm = statemachine;
+
+constexpr std::size_t statemachine::num_events;
+constexpr std::size_t statemachine::num_states;
 
-statemachine::statemachine(Istate_trans_ops* ul):
+statemachine::statemachine(Istate_trans_ops* ul, CONN_STATE initial):
    ul {ul},
-   state {CONN_STATE::STA1},
+   state {initial},
    logger {"upperlayer sm"}
 {
 }
@@ -34,12 +35,12 @@ statemachine::CONN_STATE statemachine::get_state()
 
 statemachine::CONN_STATE statemachine::transition(EVENT e)
 {
-   if (transition_table.find({e, state}) != transition_table.end()) {
-      transition_table[{e, state}](this);
-      return state;
-   } else {
+   auto action = transition_table[static_cast<std::size_t>(e)][static_cast<std::size_t>(state)];
+   if (action == nullptr) {
       return CONN_STATE::INV;
    }
+   (this->*action)();
+   return state;
 }
 
 
@@ -267,151 +268,50 @@ void statemachine::dt2()
 
 
 /**
- * @brief contains the target state as a function of pair of the current state and a primitive received from the user
- *
+ * @brief contains the action for each pair of event (rows) and current state
+ *        (columns Inv, Sta1 to Sta13), as in table 9-10 of the standard.
+ * Empty cells of the standard are null; the event is not valid in that state.
  */
-std::map<std::pair<statemachine::EVENT, statemachine::CONN_STATE>, std::function<void(statemachine*)>> statemachine::transition_table {
-   {{statemachine::EVENT::A_ASSOCIATE_RQ, statemachine::CONN_STATE::STA1}, std::mem_fn(&statemachine::ae1)},
-
-   {{statemachine::EVENT::TRANS_CONN_CONF, statemachine::CONN_STATE::STA4}, std::mem_fn(&statemachine::ae2)},
-
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::ae3)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::aa6)},
-
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::ae4)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::aa6)},
-
-   {{statemachine::EVENT::TRANS_CONN_INDIC, statemachine::CONN_STATE::STA1}, std::mem_fn(&statemachine::ae5)},
-
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::ae6)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_ASSOCIATE_RQ_PDU, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::aa7)},
-
-   {{statemachine::EVENT::LOCL_A_ASSOCIATE_AC_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::ae7)},
-
-   {{statemachine::EVENT::LOCL_A_ASSOCIATE_RJ_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::ae8)},
-
-   {{statemachine::EVENT::LOCL_P_DATA_TF_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::dt1)},
-   {{statemachine::EVENT::LOCL_P_DATA_TF_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::ar7)},
-
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::dt2)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::ar6)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_P_DATA_TF_PDU, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::aa6)},
-
-   {{statemachine::EVENT::LOCL_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::ar1)},
-
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::ar2)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::ar8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RQ_PDU, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::aa6)},
-
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::ar3)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::ar10)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::ar3)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::RECV_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::aa6)},
-
-   {{statemachine::EVENT::LOCL_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::ar4)},
-   {{statemachine::EVENT::LOCL_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::ar9)},
-   {{statemachine::EVENT::LOCL_A_RELEASE_RP_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::ar4)},
-
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA4}, std::mem_fn(&statemachine::aa2)},
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::LOCL_A_ABORT_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa1)},
-
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::aa2)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa3)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::aa3)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::aa3)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::aa3)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa3)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa3)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::aa3)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::aa3)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa3)},
-   {{statemachine::EVENT::RECV_A_ABORT_PDU, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::aa2)},
-
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::aa5)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA4}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa4)},
-   {{statemachine::EVENT::TRANS_CONN_CLOSED, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::ar5)},
-
-   {{statemachine::EVENT::ARTIM_EXPIRED, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::aa2)},
-   {{statemachine::EVENT::ARTIM_EXPIRED, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::aa2)},
-
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA2}, std::mem_fn(&statemachine::aa1)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA3}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA5}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA6}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA7}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA8}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA9}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA10}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA11}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA12}, std::mem_fn(&statemachine::aa8)},
-   {{statemachine::EVENT::UNRECOG_PDU, statemachine::CONN_STATE::STA13}, std::mem_fn(&statemachine::aa7)},
+constexpr statemachine::action statemachine::transition_table[statemachine::num_events][statemachine::num_states] {
+   // Inv     Sta1      Sta2      Sta3      Sta4      Sta5      Sta6      Sta7      Sta8      Sta9      Sta10     Sta11     Sta12     Sta13
+   // A_ASSOCIATE_RQ
+   {nullptr,  &sm::ae1, nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr},
+   // TRANS_CONN_CONF
+   {nullptr,  nullptr,  nullptr,  nullptr,  &sm::ae2, nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr},
+   // RECV_A_ASSOCIATE_AC_PDU
+   {nullptr,  nullptr,  &sm::aa1, &sm::aa8, nullptr,  &sm::ae3, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa6},
+   // RECV_A_ASSOCIATE_RJ_PDU
+   {nullptr,  nullptr,  &sm::aa1, &sm::aa8, nullptr,  &sm::ae4, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa6},
+   // TRANS_CONN_INDIC
+   {nullptr,  &sm::ae5, nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr},
+   // RECV_A_ASSOCIATE_RQ_PDU
+   {nullptr,  nullptr,  &sm::ae6, &sm::aa8, nullptr,  &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa7},
+   // LOCL_A_ASSOCIATE_AC_PDU
+   {nullptr,  nullptr,  nullptr,  &sm::ae7, nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr},
+   // LOCL_A_ASSOCIATE_RJ_PDU
+   {nullptr,  nullptr,  nullptr,  &sm::ae8, nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr},
+   // LOCL_P_DATA_TF_PDU
+   {nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  &sm::dt1, nullptr,  &sm::ar7, nullptr,  nullptr,  nullptr,  nullptr,  nullptr},
+   // RECV_P_DATA_TF_PDU
+   {nullptr,  nullptr,  &sm::aa1, &sm::aa8, nullptr,  &sm::aa8, &sm::dt2, &sm::ar6, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa6},
+   // LOCL_A_RELEASE_RQ_PDU
+   {nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  &sm::ar1, nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr},
+   // RECV_A_RELEASE_RQ_PDU
+   {nullptr,  nullptr,  &sm::aa1, &sm::aa8, nullptr,  &sm::aa8, &sm::ar2, &sm::ar8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa6},
+   // RECV_A_RELEASE_RP_PDU
+   {nullptr,  nullptr,  &sm::aa1, &sm::aa8, nullptr,  &sm::aa8, &sm::aa8, &sm::ar3, &sm::aa8, &sm::aa8, &sm::ar10, &sm::ar3, &sm::aa8, &sm::aa6},
+   // LOCL_A_RELEASE_RP_PDU
+   {nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  &sm::ar4, &sm::ar9, nullptr,  nullptr,  &sm::ar4, nullptr},
+   // LOCL_A_ABORT_PDU
+   {nullptr,  nullptr,  nullptr,  &sm::aa1, &sm::aa2, &sm::aa1, &sm::aa1, &sm::aa1, &sm::aa1, &sm::aa1, &sm::aa1, &sm::aa1, &sm::aa1, nullptr},
+   // RECV_A_ABORT_PDU
+   {nullptr,  nullptr,  &sm::aa2, &sm::aa3, nullptr,  &sm::aa3, &sm::aa3, &sm::aa3, &sm::aa3, &sm::aa3, &sm::aa3, &sm::aa3, &sm::aa3, &sm::aa2},
+   // TRANS_CONN_CLOSED
+   {nullptr,  nullptr,  &sm::aa5, &sm::aa4, &sm::aa4, &sm::aa4, &sm::aa4, &sm::aa4, &sm::aa4, &sm::aa4, &sm::aa4, &sm::aa4, &sm::aa4, &sm::ar5},
+   // ARTIM_EXPIRED
+   {nullptr,  nullptr,  &sm::aa2, nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  nullptr,  &sm::aa2},
+   // UNRECOG_PDU
+   {nullptr,  nullptr,  &sm::aa1, &sm::aa8, nullptr,  &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa8, &sm::aa7}
 };
 
 }
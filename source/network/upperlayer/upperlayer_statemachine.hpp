@@ -1,10 +1,9 @@
 #ifndef UPPERLAYER_TRANSITIONS_HPP
 #define UPPERLAYER_TRANSITIONS_HPP
 
-#include <map>
-#include <functional>
 #include <queue>
 #include <memory>
+#include <cstddef>
 
 #include "util/channel_sev_logger.hpp"
 
@@ -67,7 +66,15 @@ class statemachine
          UNRECOG_PDU
       };
 
-      statemachine(Istate_trans_ops* ul);
+      static constexpr std::size_t num_events = static_cast<std::size_t>(EVENT::UNRECOG_PDU) + 1;
+      static constexpr std::size_t num_states = static_cast<std::size_t>(CONN_STATE::STA13) + 1;
+
+      /**
+       * @brief statemachine constructs the statemachine
+       * @param ul connection performing the operations of the actions
+       * @param initial state the connection starts in
+       */
+      statemachine(Istate_trans_ops* ul, CONN_STATE initial = CONN_STATE::STA1);
 
       CONN_STATE get_state();
       CONN_STATE transition(EVENT e);
@@ -86,7 +93,15 @@ class statemachine
       void dt1();
       void dt2();
 
-      static std::map<std::pair<EVENT, CONN_STATE>, std::function<void(statemachine*)>> transition_table;
+      using action = void (statemachine::*)();
+
+      /**
+       * @brief transition_table contains the action for each event and
+       *        state, indexed by [EVENT][CONN_STATE]. Invalid combinations
+       *        are null.
+       * @see DICOM3 standard table 9-10
+       */
+      static const action transition_table[num_events][num_states];
 
       dicom::util::log::channel_sev_logger logger;
 };
@@ -24,8 +24,9 @@ namespace serviceclass
 find_scu::find_scu(dicom::network::connection endpoint,
                    dicom::data::dictionary::dictionaries& dict,
                    std::function<void(find_scu*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>)> handler):
-   cfind_req {{dataset::DIMSE_SERVICE_GROUP::C_FIND_RQ, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->send_find_request(pm, command, std::move(data)); }}},
-   cfind_resp {{dataset::DIMSE_SERVICE_GROUP::C_FIND_RSP, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->handle_find_response(pm, command, std::move(data)); }}},
+   endpoint {endpoint},
+   cfind_req {{dataset::DIMSE_SERVICE_GROUP::C_FIND_RQ, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->send_find_request(pm, std::move(command), std::move(data)); }}},
+   cfind_resp {{dataset::DIMSE_SERVICE_GROUP::C_FIND_RSP, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->handle_find_response(pm, std::move(command), std::move(data)); }}},
    sop_classes
    {
       {"1.2.840.10008.5.1.4.1.2.1.1", cfind_req},
@@ -60,13 +61,27 @@ find_scu::find_scu(dicom::network::connection endpoint,
 
 void find_scu::set_request(dataset::iod request)
 {
-   sendrequest = request;
-   scu.accept_new();
+   sendrequest = std::move(request);
+   if (!pool) {
+      scu.accept_new();
+   }
+}
+
+void find_scu::set_association_pool(std::shared_ptr<dimse::association_pool> pool)
+{
+   this->pool = pool;
 }
 
 void find_scu::run()
 {
-   dimse_pm.run();
+   if (!pool) {
+      dimse_pm.run();
+      return;
+   }
+
+   pooled = pool->acquire(endpoint, initial_rq, assoc_def);
+   pooled->run();
+   pool->put_back(std::move(pooled));
 }
 
 find_scu::~find_scu()
@@ -76,12 +91,22 @@ find_scu::~find_scu()
 
 void find_scu::send_find_request(dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod>)
 {
-   pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_FIND_RQ, command, sendrequest});
+   pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_FIND_RQ, std::move(command), sendrequest});
 }
 
 void find_scu::handle_find_response(dimse::dimse_pm*, dataset::commandset_data cs, std::unique_ptr<dataset::iod> data)
 {
-   handler(this, cs, std::move(data));
+   unsigned short status = 0;
+   if (dataset::contains_tag(cs, Status)) {
+      get_value_field<VR::US>(cs[Status], status);
+   }
+   handler(this, std::move(cs), std::move(data));
+
+   // the association of the pool is kept for the next query after the final
+   // response
+   if (pooled && status != 0xff00 && status != 0xff01) {
+      pooled->park();
+   }
 }
 
 
@@ -9,6 +9,7 @@
 #include "network/dimse/dimse_pm.hpp"
 #include "network/dimse/sop_class.hpp"
 #include "network/dimse/association_definition.hpp"
+#include "network/dimse/association_pool.hpp"
 #include "network/connection.hpp"
 #include "serviceclass.hpp"
 
@@ -29,9 +30,21 @@ class find_scu : public Iserviceclass
 
       void set_request(dicom::data::dataset::iod request);
 
+      /**
+       * @brief set_association_pool makes run() perform the query on an
+       *        association of the pool, which is returned to the pool after
+       *        the final response. set_request() then only sets the query,
+       *        the association is started by run().
+       * @param pool association pool, may be shared with other service
+       *        classes
+       */
+      void set_association_pool(std::shared_ptr<dicom::network::dimse::association_pool> pool);
+
       ~find_scu() override;
 
     private:
+      dicom::network::connection endpoint;
+
       handlermap cfind_req;
       handlermap cfind_resp;
 
@@ -44,6 +57,10 @@ class find_scu : public Iserviceclass
       asio_tcp_client_acceptor infr_scu;
       dicom::network::upperlayer::scu scu;
       dicom::network::dimse::dimse_pm_manager dimse_pm;
+
+      std::shared_ptr<dicom::network::dimse::association_pool> pool;
+      std::unique_ptr<dicom::network::dimse::pooled_association> pooled;
+
       std::function<void(find_scu*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>)> handler;
 
       void send_find_request(dicom::network::dimse::dimse_pm* pm,
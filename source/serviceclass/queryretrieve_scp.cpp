@@ -52,7 +52,7 @@ class storage_scu_thread
                   {
                      auto response = cmove_handler();
                      if (response.is_initialized()) {
-                        st->set_store_data(*response);
+                        st->set_store_data(std::move(*response));
                         cfind_pm->send_response({dicom::data::dataset::DIMSE_SERVICE_GROUP::C_MOVE_RSP, cmove_cmd, boost::none, 0xff00});
                      } else {
                         st->release();
@@ -74,7 +74,7 @@ class storage_scu_thread
 
 queryretrieve_scp::queryretrieve_scp(connection endpoint, dicom::data::dictionary::dictionaries& dict,
                                      std::function<void(queryretrieve_scp*, dataset::commandset_data, std::shared_ptr<dataset::iod>)> handler):
-   cmove_sop {{ dataset::DIMSE_SERVICE_GROUP::C_MOVE_RQ, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->handle_cfind(pm, command, std::move(data)); }} },
+   cmove_sop {{ dataset::DIMSE_SERVICE_GROUP::C_MOVE_RQ, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->handle_cfind(pm, std::move(command), std::move(data)); }} },
    dict {dict},
    sop_classes {
       {"1.2.840.10008.5.1.4.1.2.1.2", cmove_sop},
@@ -143,7 +143,7 @@ void queryretrieve_scp::run()
 
 void queryretrieve_scp::send_image(boost::optional<dataset::iod> data)
 {
-   response_data = data;
+   response_data = std::move(data);
 }
 
 }
@@ -0,0 +1,385 @@
+#include "storage_fanout.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <deque>
+#include <fstream>
+#include <map>
+#include <stdexcept>
+#include <thread>
+
+#include "storage_scu.hpp"
+#include "data/attribute/constants.hpp"
+#include "filesystem/dicomfile.hpp"
+#include "util/channel_sev_logger.hpp"
+
+using namespace dicom::data::attribute;
+using namespace dicom::data::dataset;
+
+namespace
+{
+
+/**
+ * @brief The instance struct tracks an instance of the batch while it is
+ *        sent.
+ */
+struct instance
+{
+      std::size_t index;
+      std::size_t attempts;
+
+      // number of the association run which failed the instance last, the
+      // instance is retried by another one
+      std::size_t failed_on;
+};
+
+/**
+ * @brief The instance_queue class holds the instances waiting to be sent by
+ *        one of the association runs, and counts those in flight.
+ * Instances which failed are appended again; they are not handed to the
+ * association run which failed them.
+ */
+class instance_queue
+{
+   public:
+      explicit instance_queue(std::size_t count):
+         in_flight {0}
+      {
+         for (std::size_t i=0; i<count; ++i) {
+            waiting.push_back({i, 0, 0});
+         }
+      }
+
+      bool pop(std::size_t run, instance& next)
+      {
+         std::lock_guard<std::mutex> lock {queue_lock};
+         auto it = std::find_if(waiting.begin(), waiting.end(), [run](const instance& i) {
+            return i.failed_on != run;
+         });
+         if (it == waiting.end()) {
+            return false;
+         }
+         next = *it;
+         waiting.erase(it);
+         ++in_flight;
+         return true;
+      }
+
+      void retry(instance failed, std::size_t run)
+      {
+         {
+            std::lock_guard<std::mutex> lock {queue_lock};
+            failed.failed_on = run;
+            waiting.push_back(failed);
+            --in_flight;
+         }
+         changed.notify_all();
+      }
+
+      void complete()
+      {
+         {
+            std::lock_guard<std::mutex> lock {queue_lock};
+            --in_flight;
+         }
+         changed.notify_all();
+      }
+
+      /**
+       * @brief wait_for_work blocks while no instance is waiting but other
+       *        runs still have instances in flight, which may fail
+       * @return false if all instances are complete
+       */
+      bool wait_for_work()
+      {
+         std::unique_lock<std::mutex> lock {queue_lock};
+         changed.wait(lock, [this]() { return !waiting.empty() || in_flight == 0; });
+         return !waiting.empty();
+      }
+
+      std::deque<instance> take_remaining()
+      {
+         std::lock_guard<std::mutex> lock {queue_lock};
+         std::deque<instance> remaining;
+         remaining.swap(waiting);
+         return remaining;
+      }
+
+   private:
+      std::mutex queue_lock;
+      std::condition_variable changed;
+      std::deque<instance> waiting;
+      std::size_t in_flight;
+};
+
+/**
+ * @brief is_failure returns true if the C-STORE status is neither success
+ *        nor a warning
+ */
+bool is_failure(unsigned short status)
+{
+   return status != 0x0000 && status != 0x0001 && status != 0x0107 && status != 0x0116
+         && (status & 0xf000) != 0xb000;
+}
+
+std::size_t file_size(const std::string& path)
+{
+   std::ifstream in {path, std::ios::binary | std::ios::ate};
+   return in ? static_cast<std::size_t>(in.tellg()) : 0;
+}
+
+void add_unique(std::vector<std::string>& uids, const std::string& uid)
+{
+   if (!uid.empty() && std::find(uids.begin(), uids.end(), uid) == uids.end()) {
+      uids.push_back(uid);
+   }
+}
+
+/**
+ * @brief derive_presentation_contexts adds the SOP classes and transfer
+ *        syntaxes of the files to the lists which are empty. Files which
+ *        cannot be read are left to the senders, which report them.
+ */
+void derive_presentation_contexts(const std::vector<std::string>& paths,
+                                  dicom::data::dictionary::dictionaries& dict,
+                                  std::vector<std::string>& sop_classes,
+                                  std::vector<std::string>& transfer_syntaxes)
+{
+   const bool derive_sop_classes = sop_classes.empty();
+   const bool derive_transfer_syntaxes = transfer_syntaxes.empty();
+   if (!derive_sop_classes && !derive_transfer_syntaxes) {
+      return;
+   }
+
+   for (const auto& path : paths) {
+      iod header;
+      parse_filter filter;
+      filter.stop_after = SOPClassUID;
+      dicom::filesystem::dicomfile file {header, dict};
+      file.set_parse_filter(filter);
+      try {
+         file.open_mapped(path);
+      } catch (std::exception&) {
+         continue;
+      }
+
+      if (derive_sop_classes && contains_tag(header, SOPClassUID)) {
+         std::string sop_class;
+         get_value_field<VR::UI>(header[SOPClassUID], sop_class);
+         add_unique(sop_classes, std::string {sop_class.c_str()});
+      }
+      if (derive_transfer_syntaxes) {
+         add_unique(transfer_syntaxes, std::string {file.encoded().transfer_syntax.c_str()});
+      }
+   }
+
+   if (derive_transfer_syntaxes) {
+      for (const auto& native : {"1.2.840.10008.1.2.1", "1.2.840.10008.1.2", "1.2.840.10008.1.2.2"}) {
+         add_unique(transfer_syntaxes, native);
+      }
+   }
+}
+
+}
+
+namespace dicom
+{
+
+namespace serviceclass
+{
+
+transfer_limiter::transfer_limiter(std::size_t max_associations,
+                                   std::size_t max_bytes_per_second):
+   active {0},
+   max_associations {max_associations},
+   max_bytes_per_second {max_bytes_per_second},
+   next_transfer {std::chrono::steady_clock::now()}
+{
+}
+
+void transfer_limiter::begin_association()
+{
+   std::unique_lock<std::mutex> guard {lock};
+   association_ended.wait(guard, [this]() {
+      return max_associations == 0 || active < max_associations;
+   });
+   ++active;
+}
+
+void transfer_limiter::end_association()
+{
+   {
+      std::lock_guard<std::mutex> guard {lock};
+      --active;
+   }
+   association_ended.notify_one();
+}
+
+void transfer_limiter::transfer(std::size_t bytes)
+{
+   if (max_bytes_per_second == 0) {
+      return;
+   }
+
+   std::chrono::steady_clock::time_point start;
+   {
+      std::lock_guard<std::mutex> guard {lock};
+      start = std::max(std::chrono::steady_clock::now(), next_transfer);
+      std::chrono::duration<double> duration {static_cast<double>(bytes) / max_bytes_per_second};
+      next_transfer = start + std::chrono::duration_cast<std::chrono::steady_clock::duration>(duration);
+   }
+   std::this_thread::sleep_until(start);
+}
+
+
+storage_fanout::storage_fanout(dicom::network::connection destination,
+                               dicom::data::dictionary::dictionaries& dict,
+                               fanout_options options):
+   destination {destination},
+   dict {dict},
+   options {options}
+{
+}
+
+void storage_fanout::send(const std::vector<std::string>& paths, const handler& on_result)
+{
+   using namespace dicom::util::log;
+
+   instance_queue queue {paths.size()};
+   std::atomic<std::size_t> next_run {1};
+
+   auto sop_classes = options.sop_classes;
+   auto transfer_syntaxes = options.transfer_syntaxes;
+   derive_presentation_contexts(paths, dict, sop_classes, transfer_syntaxes);
+
+   std::mutex failure_lock;
+   std::exception_ptr handler_failure;
+   auto report = [&](const instance& inst, unsigned short status, std::exception_ptr error) {
+      try {
+         on_result({inst.index, paths[inst.index], status, inst.attempts, error});
+      } catch (...) {
+         std::lock_guard<std::mutex> lock {failure_lock};
+         if (!handler_failure) {
+            handler_failure = std::current_exception();
+         }
+      }
+   };
+
+   auto associations = [&]() {
+      channel_sev_logger logger {"storage fanout"};
+      std::size_t failed_runs = 0;
+      while (failed_runs < std::max(options.max_attempts, std::size_t {1}) && queue.wait_for_work()) {
+         if (options.limiter) {
+            options.limiter->begin_association();
+         }
+         const std::size_t run = next_run++;
+         std::size_t responses = 0;
+         // instances of this run without a response, by their position in
+         // the sequence of files taken by the storage_scu
+         std::map<std::size_t, instance> taken;
+         std::size_t files_taken = 0;
+
+         try {
+            storage_scu scu {destination, dict, [](storage_scu*, commandset_data, std::unique_ptr<iod>) {},
+                             sop_classes, transfer_syntaxes};
+            scu.set_max_outstanding(options.max_outstanding);
+            if (options.pool) {
+               scu.set_association_pool(options.pool);
+            }
+            scu.send_files([&](std::string& path) {
+               instance next;
+               if (!queue.pop(run, next)) {
+                  return false;
+               }
+               ++next.attempts;
+               path = paths[next.index];
+               if (options.limiter) {
+                  options.limiter->transfer(file_size(path));
+               }
+               taken.emplace(files_taken++, next);
+               return true;
+            }, [&](std::size_t file, const std::string& path, commandset_data response, std::exception_ptr error) {
+               auto it = taken.find(file);
+               if (it == taken.end()) {
+                  BOOST_LOG_SEV(logger, warning) << "Ignoring unmatched response for " << path;
+                  return;
+               }
+               auto inst = it->second;
+               taken.erase(it);
+
+               if (error) {
+                  // the file cannot be read, sending it again does not help
+                  queue.complete();
+                  report(inst, 0x0110, error);
+                  return;
+               }
+               ++responses;
+               unsigned short status = 0x0110;
+               if (contains_tag(response, Status)) {
+                  get_value_field<VR::US>(response[Status], status);
+               }
+               if (is_failure(status) && inst.attempts < options.max_attempts) {
+                  BOOST_LOG_SEV(logger, warning) << "Retrying " << path << " after status " << status;
+                  queue.retry(inst, run);
+                  return;
+               }
+               queue.complete();
+               report(inst, status, nullptr);
+            });
+            scu.run();
+         } catch (std::exception& err) {
+            BOOST_LOG_SEV(logger, error) << "Association to " << destination.host << " failed: " << err.what();
+         }
+
+         if (options.limiter) {
+            options.limiter->end_association();
+         }
+
+         // the association ended before these instances were answered
+         for (const auto& file : taken) {
+            const auto& inst = file.second;
+            if (inst.attempts < options.max_attempts) {
+               queue.retry(inst, run);
+            } else {
+               queue.complete();
+               report(inst, 0x0110, std::make_exception_ptr(
+                         std::runtime_error {"Association ended before the response"}));
+            }
+         }
+         failed_runs = responses == 0 ? failed_runs+1 : 0;
+      }
+   };
+
+   std::vector<std::thread> threads;
+   for (std::size_t i=0; i<std::max(options.associations, std::size_t {1}); ++i) {
+      threads.emplace_back(associations);
+   }
+   for (auto& thread : threads) {
+      thread.join();
+   }
+
+   // every association thread gave up
+   for (const auto& inst : queue.take_remaining()) {
+      report(inst, 0x0110, std::make_exception_ptr(
+                std::runtime_error {"No association to " + destination.host + " could be established"}));
+   }
+
+   if (handler_failure) {
+      std::rethrow_exception(handler_failure);
+   }
+}
+
+std::vector<fanout_result> storage_fanout::send(const std::vector<std::string>& paths)
+{
+   std::vector<fanout_result> results(paths.size());
+   std::mutex results_lock;
+   send(paths, [&](const fanout_result& result) {
+      std::lock_guard<std::mutex> lock {results_lock};
+      results[result.index] = result;
+   });
+   return results;
+}
+
+}
+
+}
@@ -0,0 +1,203 @@
+#ifndef STORAGE_FANOUT_HPP
+#define STORAGE_FANOUT_HPP
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <chrono>
+#include <functional>
+#include <exception>
+#include <condition_variable>
+#include <cstddef>
+
+#include "network/connection.hpp"
+#include "network/dimse/association_pool.hpp"
+#include "data/dictionary/dictionary.hpp"
+
+namespace dicom
+{
+
+namespace serviceclass
+{
+
+/**
+ * @brief The transfer_limiter class caps the number of concurrent
+ *        associations and the data rate of the C-STORE senders sharing it,
+ *        eg. all fan-outs of an application.
+ */
+class transfer_limiter
+{
+   public:
+      /**
+       * @brief transfer_limiter constructs the limiter
+       * @param max_associations maximum number of concurrent associations,
+       *        0 for unlimited
+       * @param max_bytes_per_second maximum data rate of the data sets
+       *        sent, 0 for unlimited
+       */
+      explicit transfer_limiter(std::size_t max_associations = 0,
+                                std::size_t max_bytes_per_second = 0);
+
+      /**
+       * @brief begin_association blocks until another association may be
+       *        started
+       */
+      void begin_association();
+
+      /**
+       * @brief end_association is called when an association started after
+       *        begin_association() has ended
+       */
+      void end_association();
+
+      /**
+       * @brief transfer blocks until a data set of the given size may be
+       *        sent without exceeding the data rate
+       * @param bytes size of the data set
+       */
+      void transfer(std::size_t bytes);
+
+   private:
+      std::mutex lock;
+      std::condition_variable association_ended;
+      std::size_t active;
+      const std::size_t max_associations;
+      const std::size_t max_bytes_per_second;
+
+      // time at which the data sent so far is paid off at the maximum rate
+      std::chrono::steady_clock::time_point next_transfer;
+};
+
+/**
+ * @brief The fanout_options struct configures a storage_fanout.
+ */
+struct fanout_options
+{
+      /**
+       * number of parallel associations to the destination
+       */
+      std::size_t associations = 4;
+
+      /**
+       * asynchronous operations window proposed for each association, 0 for
+       * unlimited
+       */
+      unsigned short max_outstanding = 1;
+
+      /**
+       * maximum number of times an instance is sent before its failure is
+       * reported
+       */
+      std::size_t max_attempts = 3;
+
+      /**
+       * SOP classes proposed for each association. If empty, those of the
+       * files of the batch are proposed.
+       */
+      std::vector<std::string> sop_classes;
+
+      /**
+       * transfer syntaxes proposed for each SOP class, in the order of
+       * preference. If empty, the transfer syntaxes of the files of the
+       * batch are proposed, followed by the uncompressed ones a file may
+       * be transcoded to.
+       */
+      std::vector<std::string> transfer_syntaxes;
+
+      /**
+       * limiter shared with other senders, none if not set
+       */
+      std::shared_ptr<transfer_limiter> limiter;
+
+      /**
+       * pool the associations are taken from, new associations are
+       * requested for each run if not set
+       */
+      std::shared_ptr<dicom::network::dimse::association_pool> pool;
+};
+
+/**
+ * @brief The fanout_result struct holds the outcome of sending one instance.
+ */
+struct fanout_result
+{
+      /**
+       * position of the instance in the list passed to send()
+       */
+      std::size_t index;
+      std::string path;
+
+      /**
+       * status of the last C-STORE response, or 0x0110 (processing failure)
+       * if no response was received
+       */
+      unsigned short status;
+
+      /**
+       * number of times the instance was sent
+       */
+      std::size_t attempts;
+
+      /**
+       * set if the instance could not be read or no response was received
+       */
+      std::exception_ptr error;
+};
+
+/**
+ * @brief The storage_fanout class sends a batch of DICOM files to a
+ *        destination over several associations in parallel, eg. for
+ *        forwarding the instances of a C-MOVE or a migration.
+ * Each association runs on its own thread and takes the next instance from
+ * a queue shared by all associations as soon as its asynchronous operations
+ * window has room, so the instances are balanced according to the speed of
+ * the associations. An instance which fails with a failure status, or whose
+ * association ends before the response, is put back into the queue and
+ * retried by another association run. A thread stops starting associations
+ * after max_attempts runs in a row failed to complete any instance, eg.
+ * because the destination cannot be reached.
+ */
+class storage_fanout
+{
+   public:
+      using handler = std::function<void(const fanout_result&)>;
+
+      /**
+       * @brief storage_fanout constructs the sender
+       * @param destination remote application entity receiving the instances
+       * @param dict dictionaries, must outlive the sender
+       * @param options configuration of the sender
+       */
+      storage_fanout(dicom::network::connection destination,
+                     dicom::data::dictionary::dictionaries& dict,
+                     fanout_options options = fanout_options {});
+
+      /**
+       * @brief send sends all files and passes the outcome of each one to
+       *        the handler as soon as it is final.
+       * The handler is called concurrently from the association threads in
+       * no particular order. Returns when all files have been handled.
+       * @param paths paths of the files to be sent
+       * @param on_result handler called for each file
+       */
+      void send(const std::vector<std::string>& paths, const handler& on_result);
+
+      /**
+       * @brief send overload which collects the results
+       * @param paths paths of the files to be sent
+       * @return results in the order of the paths
+       */
+      std::vector<fanout_result> send(const std::vector<std::string>& paths);
+
+   private:
+      dicom::network::connection destination;
+      dicom::data::dictionary::dictionaries& dict;
+      fanout_options options;
+};
+
+}
+
+}
+
+#endif // STORAGE_FANOUT_HPP
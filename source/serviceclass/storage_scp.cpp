@@ -1,11 +1,15 @@
 #include "storage_scp.hpp"
 
+#include <algorithm>
+
 #include "data/dataset/dataset_iterator.hpp"
 #include "data/dictionary/dictionary_dyn.hpp"
 #include "data/dictionary/datadictionary.hpp"
 #include "data/dictionary/dictionary.hpp"
 #include "data/attribute/constants.hpp"
 #include "data/dataset/transfer_processor.hpp"
+#include "filesystem/spool_file.hpp"
+#include "util/uid.hpp"
 
 #include "infrastructure/asio_tcp_connection_manager.hpp"
 
@@ -14,6 +18,88 @@ using namespace dicom::data::attribute;
 using namespace dicom::data::dictionary;
 using namespace dicom::network;
 
+namespace
+{
+
+/**
+ * @brief The spool_stream class writes the data set of a C-STORE request into
+ *        a spool_file. Failures are recorded instead of aborting the
+ *        association, so the request can be answered with an error status.
+ */
+class spool_stream: public dicom::network::dimse::dataset_stream
+{
+   public:
+      spool_stream(std::string path, dictionaries& dict,
+                   const std::string& sop_class_uid, const std::string& sop_instance_uid,
+                   const std::string& transfer_syntax, const std::set<tag_type>& header_tags)
+      {
+         try {
+            file.reset(new dicom::filesystem::spool_file {path, dict, sop_class_uid, sop_instance_uid,
+                                                          transfer_syntax, header_tags});
+         } catch (std::exception& err) {
+            fail(err);
+         }
+      }
+
+      void write(const unsigned char* fragment, std::size_t len) override
+      {
+         if (!file) {
+            return;
+         }
+         try {
+            file->write(byte_view {fragment, len});
+         } catch (std::exception& err) {
+            fail(err);
+         }
+      }
+
+      void finish() override
+      {
+         if (!file) {
+            return;
+         }
+         try {
+            file->finish();
+         } catch (std::exception& err) {
+            fail(err);
+         }
+      }
+
+      bool failed() const
+      {
+         return !file;
+      }
+
+      const std::string& error() const
+      {
+         return error_message;
+      }
+
+      const dicom::filesystem::spool_file& spooled() const
+      {
+         return *file;
+      }
+
+   private:
+      std::unique_ptr<dicom::filesystem::spool_file> file;
+      std::string error_message;
+
+      void fail(const std::exception& err)
+      {
+         error_message = err.what();
+         file.reset();
+      }
+};
+
+std::string without_padding(std::string uid)
+{
+   uid.erase(std::remove(uid.begin(), uid.end(), '\0'), uid.end());
+   uid.erase(std::remove(uid.begin(), uid.end(), ' '), uid.end());
+   return uid;
+}
+
+}
+
 namespace dicom
 {
 
@@ -22,8 +108,9 @@ namespace serviceclass
 
 storage_scp::storage_scp(connection endpoint,
                          dicom::data::dictionary::dictionaries& dict,
-                         std::function<void(storage_scp*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>, std::string)> handler):
-   cstore_sop {{dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->handle_cstore(pm, command, std::move(data)); }}},
+                         std::function<void(storage_scp*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>, std::string)> handler,
+                         std::size_t threads):
+   cstore_sop {{dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->handle_cstore(pm, std::move(command), std::move(data)); }}},
    dict {dict},
    sop_classes
    {
@@ -47,12 +134,15 @@ storage_scp::storage_scp(connection endpoint,
                   "1.2.840.10008.1.2.4.57"},
                dimse::association_definition::DIMSE_MSG_TYPE::RESPONSE),
    },
-   infrstr_scp {endpoint.port, nullptr, nullptr},
+   infrstr_scp {endpoint.port, nullptr, nullptr, threads},
    scp {infrstr_scp, dict},
    dimse_pm {scp, assoc_def, dict},
-   handler {handler}
+   handler {handler},
+   spool_handler {nullptr}
 {
-
+   // requests are handled in order of arrival, so any number of
+   // outstanding requests proposed by the peer can be accepted
+   dimse_pm.set_async_ops_window(0, 1);
 }
 
 storage_scp::~storage_scp()
@@ -64,12 +154,67 @@ void storage_scp::run()
    dimse_pm.run();
 }
 
+void storage_scp::offload_to(std::shared_ptr<dicom::util::worker_pool> pool)
+{
+   dimse_pm.offload_to(pool);
+}
+
+void storage_scp::spool_to(std::string directory,
+                           std::function<void(storage_scp*, dataset::commandset_data, std::unique_ptr<dataset::iod>, std::string)> spool_handler,
+                           std::set<tag_type> header_tags)
+{
+   this->spool_handler = spool_handler;
+   auto& dict = this->dict;
+   dimse_pm.stream_datasets([directory, header_tags, &dict](dimse::dimse_pm*, const dataset::commandset_data& command,
+                                                            const std::string& transfer_syntax)
+                            -> std::shared_ptr<dimse::dataset_stream> {
+      unsigned short command_field = 0;
+      get_value_field<VR::US>(command.at({0x0000, 0x0100}), command_field);
+      if (command_field != static_cast<unsigned short>(dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ)) {
+         return nullptr;
+      }
+
+      std::string sop_class, sop_instance;
+      get_value_field<VR::UI>(command.at({0x0000, 0x0002}), sop_class);
+      get_value_field<VR::UI>(command.at({0x0000, 0x1000}), sop_instance);
+      sop_class = without_padding(sop_class);
+      sop_instance = without_padding(sop_instance);
+
+      // the file name is taken from the peer, only accept valid UIDs
+      std::string name = sop_instance;
+      if (name.empty() || name.find_first_not_of("0123456789.") != std::string::npos) {
+         dicom::util::uid uids;
+         name = uids.generate_uid();
+      }
+      return std::make_shared<spool_stream>(directory + "/" + name + ".dcm", dict,
+                                            sop_class, sop_instance, transfer_syntax, header_tags);
+   });
+}
+
+std::set<tag_type> storage_scp::default_header_tags()
+{
+   return {{0x0008, 0x0016}, {0x0008, 0x0018}, {0x0008, 0x0060},
+           {0x0010, 0x0020}, {0x0020, 0x000d}, {0x0020, 0x000e}};
+}
+
 void storage_scp::handle_cstore(dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data)
 {
+   auto stream = std::dynamic_pointer_cast<spool_stream>(pm->get_current_stream());
+   if (stream) {
+      if (stream->failed()) {
+         pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_STORE_RSP, command, boost::none, 0xa700});
+         return;
+      }
+      auto& file = stream->spooled();
+      spool_handler(this, command, std::unique_ptr<dataset::iod> {new dataset::iod {file.header()}}, file.path());
+      pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_STORE_RSP, command, boost::none, 0x0000});
+      return;
+   }
+
    std::string transfer_syntax = pm->get_current_transfer_syntax();
    handler(this, command, std::move(data), transfer_syntax);
 
-   pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_STORE_RSP, command, boost::none, 0x0000});
+   pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_STORE_RSP, std::move(command), boost::none, 0x0000});
 }
 
 }
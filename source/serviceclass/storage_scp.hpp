@@ -4,6 +4,7 @@
 #include <string>
 #include <functional>
 #include <memory>
+#include <set>
 
 #include "network/upperlayer/upperlayer.hpp"
 #include "network/dimse/dimse_pm.hpp"
@@ -24,14 +25,59 @@ namespace serviceclass
 class storage_scp : public Iserviceclass
 {
    public:
+      /**
+       * @brief storage_scp constructs the scp listening on the port of the
+       *        endpoint
+       * @param endpoint local endpoint
+       * @param dict dictionaries used to process the received data
+       * @param handler handler invoked for each received instance. With more
+       *        than one thread, it is invoked concurrently for different
+       *        associations.
+       * @param threads number of threads the associations are distributed
+       *        to, 0 selects the number of hardware threads
+       */
       storage_scp(dicom::network::connection endpoint,
                   dicom::data::dictionary::dictionaries& dict,
-                  std::function<void(storage_scp*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>, std::string)> handler);
+                  std::function<void(storage_scp*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>, std::string)> handler,
+                  std::size_t threads = 1);
 
       ~storage_scp() override;
 
       virtual void run() override;
 
+      /**
+       * @brief offload_to decodes the received instances and invokes the
+       *        handler on the worker pool instead of the network threads.
+       *        Must be called before run().
+       * @param pool worker pool
+       */
+      void offload_to(std::shared_ptr<dicom::util::worker_pool> pool);
+
+      /**
+       * @brief spool_to writes the data sets of received instances to files
+       *        in the directory while they are received, so the memory used
+       *        per association does not depend on the size of the instances.
+       *        Must be called before run().
+       * The files are named after the SOP instance UID and written in the
+       * transfer syntax they were received in. Instead of the handler given
+       * to the constructor, spool_handler is invoked with the top-level
+       * attributes of header_tags decoded from the data set and the path of
+       * the complete file. If the file cannot be written, the request is
+       * answered with an out of resources status.
+       * @param directory existing directory the files are written to
+       * @param spool_handler handler invoked for each stored file
+       * @param header_tags attributes decoded for routing the file
+       */
+      void spool_to(std::string directory,
+                    std::function<void(storage_scp*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>, std::string)> spool_handler,
+                    std::set<dicom::data::attribute::tag_type> header_tags = default_header_tags());
+
+      /**
+       * @brief default_header_tags returns the SOP class and instance UIDs,
+       *        modality, patient ID, study and series instance UIDs
+       */
+      static std::set<dicom::data::attribute::tag_type> default_header_tags();
+
    private:
       void handle_cstore(dicom::network::dimse::dimse_pm* pm,
                          dicom::data::dataset::commandset_data command,
@@ -47,6 +93,7 @@ class storage_scp : public Iserviceclass
       dicom::network::dimse::dimse_pm_manager dimse_pm;
 
       std::function<void(storage_scp*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>, std::string)> handler;
+      std::function<void(storage_scp*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>, std::string)> spool_handler;
 };
 
 }
@@ -2,12 +2,16 @@
 
 #include <map>
 #include <functional>
+#include <deque>
+#include <memory>
+#include <stdexcept>
 
 #include "data/dataset/dataset_iterator.hpp"
 #include "data/dictionary/dictionary_dyn.hpp"
 #include "data/dictionary/datadictionary.hpp"
 #include "data/dictionary/dictionary.hpp"
 #include "data/attribute/constants.hpp"
+#include "filesystem/dicomfile.hpp"
 
 using namespace dicom::data;
 using namespace dicom::data::attribute;
@@ -20,30 +24,52 @@ namespace dicom
 namespace serviceclass
 {
 
+/**
+ * @brief make_sop_classes returns the SOP classes with the given uids, each
+ *        handled by the handlers
+ */
+static std::vector<dimse::SOP_class> make_sop_classes(const std::vector<std::string>& uids,
+                                                      const handlermap& handlers)
+{
+   std::vector<dimse::SOP_class> sop_classes;
+   for (const auto& uid : uids) {
+      sop_classes.push_back({uid, handlers});
+   }
+   return sop_classes;
+}
+
 storage_scu::storage_scu(connection endpoint,
                          dicom::data::dictionary::dictionaries& dict,
                          std::function<void(storage_scu*, dataset::commandset_data, std::unique_ptr<dataset::iod>)> handler):
-   cstore_req {{dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->send_store_request(pm, command, std::move(data)); }}},
-   cstore_resp {{dataset::DIMSE_SERVICE_GROUP::C_STORE_RSP, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->send_store_request(pm, command, std::move(data)); }}},
-   sop_classes
-   {
-      {"1.2.840.10008.5.1.4.1.1.1", cstore_req}
-   },
-   sop_classes_response
-   {
-      {"1.2.840.10008.5.1.4.1.1.1", cstore_resp}
-   },
+   storage_scu {endpoint, dict, handler,
+                {"1.2.840.10008.5.1.4.1.1.1"},
+                {"1.2.840.10008.1.2", "1.2.840.10008.1.2.1", "1.2.840.10008.1.2.2"}}
+{
+
+}
+
+storage_scu::storage_scu(connection endpoint,
+                         dicom::data::dictionary::dictionaries& dict,
+                         std::function<void(storage_scu*, dataset::commandset_data, std::unique_ptr<dataset::iod>)> handler,
+                         const std::vector<std::string>& sop_class_uids,
+                         const std::vector<std::string>& transfer_syntaxes):
+   endpoint {endpoint},
+   dict {dict},
+   cstore_req {{dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->send_store_request(pm, std::move(command), std::move(data)); }}},
+   cstore_resp {{dataset::DIMSE_SERVICE_GROUP::C_STORE_RSP, [this](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) { this->send_store_request(pm, std::move(command), std::move(data)); }}},
+   sop_classes {make_sop_classes(sop_class_uids, cstore_req)},
+   sop_classes_response {make_sop_classes(sop_class_uids, cstore_resp)},
    assoc_def
    {
       endpoint.calling_ae, endpoint.called_ae,
       dimse::make_presentation_contexts(
          sop_classes_response,
-         {"1.2.840.10008.1.2", "1.2.840.10008.1.2.1", "1.2.840.10008.1.2.2"},
+         transfer_syntaxes,
          dimse::association_definition::DIMSE_MSG_TYPE::RESPONSE)
             + // concatenate
       dimse::make_presentation_contexts(
          sop_classes,
-         {"1.2.840.10008.1.2", "1.2.840.10008.1.2.1", "1.2.840.10008.1.2.2"},
+         transfer_syntaxes,
          dimse::association_definition::DIMSE_MSG_TYPE::INITIATOR)
    },
    initial_rq {assoc_def.get_initial_request()},
@@ -51,8 +77,14 @@ storage_scu::storage_scu(connection endpoint,
    scu {infr_scu, dict, initial_rq},
    dimse_pm {scu, assoc_def, dict},
    senddata {},
+   sendfile {boost::none},
+   next_file {nullptr},
+   on_file_result {nullptr},
+   files_exhausted {true},
+   files_taken {0},
    handler {handler},
-   do_release {false}
+   do_release {false},
+   logger {"storage scu"}
 {
 
 }
@@ -69,19 +101,106 @@ void storage_scu::release()
 
 void storage_scu::send_next_request(dataset::iod data)
 {
-   senddata = data;
-   scu.accept_new();
+   senddata = std::move(data);
+   if (!pool) {
+      scu.accept_new();
+   }
+}
+
+void storage_scu::send_next_file(const std::string& path)
+{
+   set_store_file(path);
+   if (!pool) {
+      scu.accept_new();
+   }
+}
+
+void storage_scu::set_store_file(const std::string& path)
+{
+   dataset::iod header;
+   dataset::parse_filter filter;
+   filter.stop_after = SOPInstanceUID;
+   filesystem::dicomfile file {header, dict};
+   file.set_parse_filter(filter);
+   file.open_mapped(path);
+
+   sendfile_sop_class.clear();
+   if (dataset::contains_tag(header, SOPClassUID)) {
+      get_value_field<VR::UI>(header[SOPClassUID], sendfile_sop_class);
+   }
+   sendfile_instance_uid.clear();
+   if (dataset::contains_tag(header, SOPInstanceUID)) {
+      get_value_field<VR::UI>(header[SOPInstanceUID], sendfile_instance_uid);
+   }
+   sendfile = file.encoded();
+   senddata.clear();
+}
+
+void storage_scu::send_files(std::vector<std::string> paths)
+{
+   auto files = std::make_shared<std::deque<std::string>>(paths.begin(), paths.end());
+   send_files([files](std::string& path) {
+      if (files->empty()) {
+         return false;
+      }
+      path = files->front();
+      files->pop_front();
+      return true;
+   });
+}
+
+void storage_scu::send_files(file_source next_file, file_result_handler on_result)
+{
+   this->next_file = next_file;
+   on_file_result = on_result;
+   files_exhausted = false;
+   files_taken = 0;
+   if (!pool) {
+      scu.accept_new();
+   }
+}
+
+void storage_scu::set_max_outstanding(unsigned short max_outstanding)
+{
+   initial_rq.max_ops_invoked = max_outstanding;
+}
+
+void storage_scu::set_association_pool(std::shared_ptr<dimse::association_pool> pool)
+{
+   this->pool = pool;
 }
 
 void storage_scu::run()
 {
-   dimse_pm.run();
+   if (!pool) {
+      dimse_pm.run();
+      return;
+   }
+
+   pooled = pool->acquire(endpoint, initial_rq, assoc_def);
+   pooled->run();
+   pool->put_back(std::move(pooled));
+}
+
+void storage_scu::finish_association(dimse::dimse_pm* pm)
+{
+   do_release = false;
+   if (pooled) {
+      pooled->park();
+   } else {
+      pm->release_association();
+   }
 }
 
 void storage_scu::send_store_request(dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data)
 {
    assert(data == nullptr);
 
+   if (next_file) {
+      send_pending(pm, command);
+      return;
+   }
+
    std::cout << "Send C_STORE_RQ\n";
    dataset::dataset_type dat, dat2, dat3;
    dataset::iod seq;
@@ -95,14 +214,81 @@ void storage_scu::send_store_request(dimse::dimse_pm* pm, dataset::commandset_da
 
    // handler requested release
    if (do_release) {
-      pm->release_association();
+      finish_association(pm);
       return;
+   } else if (sendfile) {
+      if (!sendfile_sop_class.empty()) {
+         if (!pm->is_accepted(sendfile_sop_class)) {
+            BOOST_LOG_SEV(logger, dicom::util::log::error) << "SOP class " << sendfile_sop_class
+                                         << " of the file was not negotiated";
+            finish_association(pm);
+            return;
+         }
+         command[AffectedSOPClassUID] = make_elementfield<VR::UI>(sendfile_sop_class);
+      }
+      command[AffectedSOPInstanceUID] = dicom::data::attribute::make_elementfield<VR::UI>(sendfile_instance_uid);
+      pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ, std::move(command), sendfile.get()});
    } else {
-      pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ, command, senddata});
+      pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ, std::move(command), senddata});
    }
 }
 
 
+void storage_scu::send_pending(dimse::dimse_pm* pm, dataset::commandset_data command)
+{
+   using namespace dicom::util::log;
+   if (do_release) {
+      files_exhausted = true;
+   }
+
+   while (!files_exhausted && pm->outstanding_requests() < pm->max_outstanding_requests()) {
+      std::string path;
+      if (!next_file(path)) {
+         files_exhausted = true;
+         break;
+      }
+      const std::size_t file = files_taken++;
+      try {
+         set_store_file(path);
+      } catch (std::exception& err) {
+         BOOST_LOG_SEV(logger, error) << "Skipping file " << path << "\n" << err.what();
+         if (on_file_result) {
+            on_file_result(file, path, {}, std::current_exception());
+         }
+         continue;
+      }
+      if (!pm->is_accepted(sendfile_sop_class)) {
+         const std::string reason {"No presentation context was accepted for the SOP class \""
+                                   + sendfile_sop_class + "\" of the file"};
+         BOOST_LOG_SEV(logger, error) << "Skipping file " << path << "\n" << reason;
+         if (on_file_result) {
+            on_file_result(file, path, {}, std::make_exception_ptr(std::runtime_error {reason}));
+         }
+         continue;
+      }
+
+      command[AffectedSOPClassUID] = make_elementfield<VR::UI>(sendfile_sop_class);
+      command[AffectedSOPInstanceUID] = make_elementfield<VR::UI>(sendfile_instance_uid);
+      command[MoveOriginatorApplicationEntityTitle] = make_elementfield<VR::AE>("");
+      command[MoveOriginatorMessageID] = make_elementfield<VR::US>(0);
+      pm->send_request({dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ, command, sendfile.get()},
+                       [this, command, file, path](dimse::dimse_pm* pm, dataset::commandset_data response,
+                                                   std::unique_ptr<dataset::iod> data) {
+         handler(this, response, std::move(data));
+         if (on_file_result) {
+            on_file_result(file, path, response, nullptr);
+         }
+         send_pending(pm, command);
+      });
+   }
+
+   if (files_exhausted && pm->outstanding_requests() == 0) {
+      next_file = nullptr;
+      on_file_result = nullptr;
+      finish_association(pm);
+   }
+}
+
 }
 
 }
@@ -3,13 +3,20 @@
 
 #include <string>
 #include <functional>
+#include <memory>
+#include <exception>
+#include <vector>
+
+#include <boost/optional.hpp>
 
 #include "network/upperlayer/upperlayer.hpp"
 #include "network/dimse/dimse_pm.hpp"
 #include "network/dimse/sop_class.hpp"
 #include "network/dimse/association_definition.hpp"
+#include "network/dimse/association_pool.hpp"
 #include "network/connection.hpp"
 #include "serviceclass.hpp"
+#include "util/channel_sev_logger.hpp"
 
 namespace dicom
 {
@@ -20,10 +27,40 @@ namespace serviceclass
 class storage_scu : public Iserviceclass
 {
    public:
+      /**
+       * file_source sets the path of the next file to be sent and returns
+       * false if there are no more files
+       */
+      using file_source = std::function<bool(std::string& path)>;
+
+      /**
+       * file_result_handler is invoked with the response to the C-STORE
+       * request of a file, or with the error if the file could not be sent.
+       * The file is identified by its zero-based position in the sequence
+       * taken from the source, which tells apart a path taken twice.
+       */
+      using file_result_handler = std::function<void(std::size_t file, const std::string& path,
+                                                     dicom::data::dataset::commandset_data response,
+                                                     std::exception_ptr error)>;
+
       storage_scu(dicom::network::connection endpoint,
                   dicom::data::dictionary::dictionaries& dict,
                   std::function<void(storage_scu*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>)> handler);
 
+      /**
+       * @brief storage_scu constructs a sender proposing a presentation
+       *        context for each of the SOP classes, instead of only the
+       *        one of computed radiography images
+       * @param sop_classes SOP classes of the data sets to be sent
+       * @param transfer_syntaxes transfer syntaxes proposed for each SOP
+       *        class, in the order of preference
+       */
+      storage_scu(dicom::network::connection endpoint,
+                  dicom::data::dictionary::dictionaries& dict,
+                  std::function<void(storage_scu*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>)> handler,
+                  const std::vector<std::string>& sop_classes,
+                  const std::vector<std::string>& transfer_syntaxes);
+
       ~storage_scu();
 
       /**
@@ -40,17 +77,86 @@ class storage_scu : public Iserviceclass
        */
       void set_store_data(dicom::data::dataset::iod data)
       {
-         senddata = data;
+         senddata = std::move(data);
+         sendfile = boost::none;
       }
 
       /**
-       * @brief release sends a release request
+       * @brief send_next_file starts a new association on the connection
+       *        defined in the ctor to send the dataset of a DICOM file
+       * @param path path of the file to be sent
+       * @see set_store_file()
+       */
+      void send_next_file(const std::string& path);
+
+      /**
+       * @brief set_store_file shall be called from the handler and sets the
+       *        file whose dataset is transmitted next.
+       * The file is mapped and only the attributes up to the SOP instance
+       * UID are decoded. The SOP class of the file becomes the affected SOP
+       * class of the request and selects its presentation context. The dataset is written to the connection straight
+       * from the mapping, skipping the file meta header, if the file's
+       * transfer syntax was negotiated, and transcoded otherwise.
+       * @param path path of the file to be sent
+       * @throws std::runtime_error if the file cannot be mapped
+       */
+      void set_store_file(const std::string& path);
+
+      /**
+       * @brief send_files starts a new association on the connection defined
+       *        in the ctor and sends the datasets of the files.
+       * Up to max_outstanding_requests() C-STORE requests of the association
+       * are in flight at the same time, instead of waiting for each response
+       * before sending the next request. The handler is invoked with each
+       * response in the order they arrive, and the association is released
+       * after the last one. Files which cannot be mapped, or whose SOP class
+       * was not negotiated, are skipped.
+       * @param paths paths of the files to be sent
+       */
+      void send_files(std::vector<std::string> paths);
+
+      /**
+       * @brief send_files overload which takes the files from a source while
+       *        the asynchronous operations window has room, so several
+       *        senders may share a queue of files.
+       * @param next_file source of the files, invoked on the connection's
+       *        thread
+       * @param on_result handler invoked for each file taken from the source
+       */
+      void send_files(file_source next_file, file_result_handler on_result = nullptr);
+
+      /**
+       * @brief set_max_outstanding sets the asynchronous operations window
+       *        proposed for subsequent associations. The number of requests
+       *        in flight is limited to the window accepted by the peer.
+       * @param max_outstanding maximum number of outstanding requests, 0 for
+       *        unlimited
+       */
+      void set_max_outstanding(unsigned short max_outstanding);
+
+      /**
+       * @brief set_association_pool makes run() perform the operations on an
+       *        association of the pool, which is returned to the pool
+       *        instead of being released afterwards. The send functions
+       *        then only set the data to be sent, the association is
+       *        started by run().
+       * @param pool association pool, may be shared with other service
+       *        classes
+       */
+      void set_association_pool(std::shared_ptr<dicom::network::dimse::association_pool> pool);
+
+      /**
+       * @brief release sends a release request, or returns the association
+       *        to the pool
        */
       void release();
 
       virtual void run() override;
 
    private:
+      dicom::network::connection endpoint;
+      dicom::data::dictionary::dictionaries& dict;
+
       handlermap cstore_req;
       handlermap cstore_resp;
 
@@ -62,15 +168,44 @@ class storage_scu : public Iserviceclass
       dicom::network::upperlayer::scu scu;
       dicom::network::dimse::dimse_pm_manager dimse_pm;
 
+      std::shared_ptr<dicom::network::dimse::association_pool> pool;
+      std::unique_ptr<dicom::network::dimse::pooled_association> pooled;
+
       dicom::data::dataset::iod senddata;
+      boost::optional<dicom::data::dataset::encoded_dataset> sendfile;
+      std::string sendfile_sop_class;
+      std::string sendfile_instance_uid;
+      file_source next_file;
+      file_result_handler on_file_result;
+      bool files_exhausted;
+      std::size_t files_taken;
 
       void send_store_request(dicom::network::dimse::dimse_pm* pm,
                               dicom::data::dataset::commandset_data command,
                               std::unique_ptr<dicom::data::dataset::iod> data);
 
+      /**
+       * @brief send_pending sends the files of the source until the
+       *        asynchronous operations window is full, and releases the
+       *        association after the last response.
+       * @param pm protocol machine of the association
+       * @param command command set with the affected SOP class
+       */
+      void send_pending(dicom::network::dimse::dimse_pm* pm,
+                        dicom::data::dataset::commandset_data command);
+
+      /**
+       * @brief finish_association releases the association or, if it was
+       *        taken from the pool, parks it for reuse
+       * @param pm protocol machine of the association
+       */
+      void finish_association(dicom::network::dimse::dimse_pm* pm);
+
       std::function<void(storage_scu*, dicom::data::dataset::commandset_data, std::unique_ptr<dicom::data::dataset::iod>)> handler;
 
       bool do_release;
+
+      dicom::util::log::channel_sev_logger logger;
 };
 
 }
@@ -31,7 +31,7 @@ void init_log()
 
 
 channel_sev_logger::channel_sev_logger(std::string channel):
-   src::severity_channel_logger<logging::trivial::severity_level> {keywords::channel = channel}
+   src::severity_channel_logger_mt<logging::trivial::severity_level> {keywords::channel = channel}
 {
 }
 
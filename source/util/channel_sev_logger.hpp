@@ -35,8 +35,13 @@ using namespace logging::trivial;
 void init_log();
 
 
+/**
+ * @brief The channel_sev_logger struct is a thread-safe logger with a
+ *        severity and a channel attribute. Loggers of the network classes may
+ *        be shared by connections handled on different threads.
+ */
 struct channel_sev_logger:
-    src::severity_channel_logger<severity_level>
+    src::severity_channel_logger_mt<severity_level>
 {
     explicit channel_sev_logger(std::string channel);
 };
@@ -0,0 +1,292 @@
+#ifndef SMALL_VECTOR_HPP
+#define SMALL_VECTOR_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <algorithm>
+
+namespace dicom
+{
+
+namespace util
+{
+
+/**
+ * @brief The small_vector class is a contiguous sequence which stores up to N
+ *        elements inside the object and only allocates on the heap when it
+ *        grows beyond that.
+ * It is used for values which usually have very few elements, like the value
+ * fields of the attributes, where a std::vector would allocate for every
+ * single value. Like a std::vector, growing it invalidates pointers to the
+ * elements.
+ * @tparam T element type
+ * @tparam N number of elements stored inline
+ */
+template <typename T, std::size_t N>
+class small_vector
+{
+   public:
+      using value_type = T;
+      using iterator = T*;
+      using const_iterator = const T*;
+
+      small_vector() noexcept:
+         data_ {inline_data()},
+         size_ {0},
+         capacity_ {N}
+      {
+      }
+
+      small_vector(const small_vector& other):
+         small_vector {}
+      {
+         append(other.begin(), other.end());
+      }
+
+      small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value):
+         small_vector {}
+      {
+         take(other);
+      }
+
+      small_vector& operator=(const small_vector& other)
+      {
+         if (this != &other) {
+            clear();
+            append(other.begin(), other.end());
+         }
+         return *this;
+      }
+
+      small_vector& operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible<T>::value)
+      {
+         if (this != &other) {
+            clear();
+            release_heap();
+            take(other);
+         }
+         return *this;
+      }
+
+      ~small_vector()
+      {
+         clear();
+         release_heap();
+      }
+
+      std::size_t size() const { return size_; }
+      bool empty() const { return size_ == 0; }
+      std::size_t capacity() const { return capacity_; }
+
+      /**
+       * @brief is_inline returns true if the elements are stored inside the
+       *        object
+       */
+      bool is_inline() const { return data_ == inline_data(); }
+
+      T* data() { return data_; }
+      const T* data() const { return data_; }
+
+      iterator begin() { return data_; }
+      iterator end() { return data_ + size_; }
+      const_iterator begin() const { return data_; }
+      const_iterator end() const { return data_ + size_; }
+      const_iterator cbegin() const { return data_; }
+      const_iterator cend() const { return data_ + size_; }
+
+      T& operator[](std::size_t i) { return data_[i]; }
+      const T& operator[](std::size_t i) const { return data_[i]; }
+
+      T& back() { return data_[size_-1]; }
+      const T& back() const { return data_[size_-1]; }
+
+      void reserve(std::size_t capacity)
+      {
+         if (capacity <= capacity_) {
+            return;
+         }
+         T* grown = allocate(capacity);
+         try {
+            relocate(grown);
+         } catch (...) {
+            ::operator delete(grown);
+            throw;
+         }
+         adopt(grown, capacity);
+      }
+
+      void push_back(const T& value)
+      {
+         emplace_back(value);
+      }
+
+      void push_back(T&& value)
+      {
+         emplace_back(std::move(value));
+      }
+
+      template <typename... Args>
+      void emplace_back(Args&&... args)
+      {
+         if (size_ < capacity_) {
+            new (data_+size_) T(std::forward<Args>(args)...);
+            ++size_;
+            return;
+         }
+
+         // the arguments may refer to an element, so the new element is
+         // constructed before the old storage is released
+         const std::size_t capacity = std::max(size_ + 1, 2*capacity_);
+         T* grown = allocate(capacity);
+         try {
+            new (grown+size_) T(std::forward<Args>(args)...);
+         } catch (...) {
+            ::operator delete(grown);
+            throw;
+         }
+         try {
+            relocate(grown);
+         } catch (...) {
+            grown[size_].~T();
+            ::operator delete(grown);
+            throw;
+         }
+         adopt(grown, capacity);
+         ++size_;
+      }
+
+      /**
+       * @brief append copies the elements of the range to the end
+       */
+      template <typename Iter>
+      void append(Iter first, Iter last)
+      {
+         grow_for(static_cast<std::size_t>(std::distance(first, last)));
+         for (; first != last; ++first) {
+            new (data_+size_) T(*first);
+            ++size_;
+         }
+      }
+
+      /**
+       * @brief resize value-initializes added elements and destroys removed
+       *        ones
+       */
+      void resize(std::size_t size)
+      {
+         reserve(size);
+         while (size_ < size) {
+            new (data_+size_) T();
+            ++size_;
+         }
+         while (size_ > size) {
+            data_[--size_].~T();
+         }
+      }
+
+      /**
+       * @brief clear destroys the elements, the capacity is kept
+       */
+      void clear()
+      {
+         resize(0);
+      }
+
+   private:
+      typename std::aligned_storage<sizeof(T), alignof(T)>::type inline_storage[N];
+      T* data_;
+      std::size_t size_;
+      std::size_t capacity_;
+
+      T* inline_data() { return reinterpret_cast<T*>(inline_storage); }
+      const T* inline_data() const { return reinterpret_cast<const T*>(inline_storage); }
+
+      void grow_for(std::size_t count)
+      {
+         if (size_ + count > capacity_) {
+            reserve(std::max(size_ + count, 2*capacity_));
+         }
+      }
+
+      static T* allocate(std::size_t capacity)
+      {
+         return static_cast<T*>(::operator new(capacity * sizeof(T)));
+      }
+
+      /**
+       * @brief relocate moves the elements into the uninitialized storage,
+       *        or copies them if moving might throw. The elements constructed
+       *        in grown are destroyed again if it throws.
+       */
+      void relocate(T* grown)
+      {
+         using moves = std::integral_constant<bool, std::is_nothrow_move_constructible<T>::value
+                                                    || !std::is_copy_constructible<T>::value>;
+         relocate(grown, moves {});
+      }
+
+      void relocate(T* grown, std::true_type)
+      {
+         std::uninitialized_copy(std::make_move_iterator(begin()), std::make_move_iterator(end()), grown);
+      }
+
+      void relocate(T* grown, std::false_type)
+      {
+         std::uninitialized_copy(begin(), end(), grown);
+      }
+
+      /**
+       * @brief adopt destroys the elements, which were relocated to grown,
+       *        and makes grown the storage
+       */
+      void adopt(T* grown, std::size_t capacity)
+      {
+         for (std::size_t i=0; i<size_; ++i) {
+            data_[i].~T();
+         }
+         release_heap();
+         data_ = grown;
+         capacity_ = capacity;
+      }
+
+      void release_heap()
+      {
+         if (!is_inline()) {
+            ::operator delete(data_);
+            data_ = inline_data();
+            capacity_ = N;
+         }
+      }
+
+      /**
+       * @brief take moves the elements of other into this empty, inline
+       *        sequence and leaves other empty. Heap storage changes owner.
+       */
+      void take(small_vector& other)
+      {
+         if (!other.is_inline()) {
+            data_ = other.data_;
+            size_ = other.size_;
+            capacity_ = other.capacity_;
+            other.data_ = other.inline_data();
+            other.size_ = 0;
+            other.capacity_ = N;
+            return;
+         }
+         for (std::size_t i=0; i<other.size_; ++i) {
+            new (data_+i) T(std::move(other.data_[i]));
+            ++size_;
+         }
+         other.clear();
+      }
+};
+
+}
+
+}
+
+#endif // SMALL_VECTOR_HPP
@@ -0,0 +1,99 @@
+#include "worker_pool.hpp"
+
+#include <algorithm>
+
+namespace dicom
+{
+
+namespace util
+{
+
+worker_pool::worker_pool(std::size_t threads, std::size_t capacity):
+   capacity {std::max(capacity, std::size_t {1})},
+   stopping {false},
+   logger {"worker pool"}
+{
+   if (threads == 0) {
+      threads = std::max(1u, std::thread::hardware_concurrency());
+   }
+   workers.reserve(threads);
+   for (std::size_t i=0; i<threads; ++i) {
+      workers.emplace_back([this]() { work(); });
+   }
+}
+
+worker_pool::~worker_pool()
+{
+   {
+      std::lock_guard<std::mutex> guard {lock};
+      stopping = true;
+   }
+   not_empty.notify_all();
+   for (auto& worker : workers) {
+      worker.join();
+   }
+}
+
+void worker_pool::submit(std::function<void()> task,
+                         std::function<void(std::exception_ptr)> on_error)
+{
+   {
+      std::unique_lock<std::mutex> guard {lock};
+      not_full.wait(guard, [this]() { return tasks.size() < capacity; });
+      tasks.push_back(queued_task {std::move(task), std::move(on_error)});
+   }
+   not_empty.notify_one();
+}
+
+std::size_t worker_pool::threads() const
+{
+   return workers.size();
+}
+
+void worker_pool::work()
+{
+   for (;;) {
+      queued_task task;
+      {
+         std::unique_lock<std::mutex> guard {lock};
+         not_empty.wait(guard, [this]() { return stopping || !tasks.empty(); });
+         if (tasks.empty()) {
+            return;
+         }
+         task = std::move(tasks.front());
+         tasks.pop_front();
+      }
+      not_full.notify_one();
+
+      try {
+         task.run();
+      } catch (...) {
+         report(task);
+      }
+   }
+}
+
+void worker_pool::report(const queued_task& task)
+{
+   using namespace util::log;
+   std::exception_ptr exception = std::current_exception();
+   if (task.on_error) {
+      try {
+         task.on_error(exception);
+         return;
+      } catch (...) {
+         exception = std::current_exception();
+      }
+   }
+   try {
+      std::rethrow_exception(exception);
+   } catch (std::exception& err) {
+      BOOST_LOG_SEV(logger, error) << "Task failed: " << err.what();
+   } catch (...) {
+      BOOST_LOG_SEV(logger, error) << "Task failed with an unknown exception";
+   }
+}
+
+}
+
+}
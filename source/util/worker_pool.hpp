@@ -0,0 +1,88 @@
+#ifndef WORKER_POOL_HPP
+#define WORKER_POOL_HPP
+
+#include <cstddef>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "channel_sev_logger.hpp"
+
+namespace dicom
+{
+
+namespace util
+{
+
+/**
+ * @brief The worker_pool class runs tasks on a fixed number of threads.
+ * The queue of waiting tasks is bounded: submit() blocks while it is full, so
+ * a producer cannot get arbitrarily far ahead of the workers. Tasks are
+ * started in submission order. The destructor completes the queued tasks
+ * before joining the threads.
+ */
+class worker_pool
+{
+   public:
+      /**
+       * @brief worker_pool starts the worker threads
+       * @param threads number of threads, 0 selects the number of hardware
+       *        threads
+       * @param capacity maximum number of tasks waiting for a thread
+       */
+      explicit worker_pool(std::size_t threads = 0, std::size_t capacity = 64);
+      worker_pool(const worker_pool&) = delete;
+      worker_pool& operator=(const worker_pool&) = delete;
+
+      ~worker_pool();
+
+      /**
+       * @brief submit queues a task, blocking while the queue is full.
+       * @param task task to be run on one of the worker threads
+       * @param on_error invoked on the worker thread with an exception
+       *        escaping the task. Without it, the exception is logged.
+       */
+      void submit(std::function<void()> task,
+                  std::function<void(std::exception_ptr)> on_error = nullptr);
+
+      /**
+       * @brief threads returns the number of worker threads
+       */
+      std::size_t threads() const;
+
+   private:
+      struct queued_task
+      {
+            std::function<void()> run;
+            std::function<void(std::exception_ptr)> on_error;
+      };
+
+      void work();
+
+      /**
+       * @brief report passes the current exception of a failed task to its
+       *        error handler, or logs it
+       */
+      void report(const queued_task& task);
+
+      std::mutex lock;
+      std::condition_variable not_empty;
+      std::condition_variable not_full;
+      std::deque<queued_task> tasks;
+      const std::size_t capacity;
+      bool stopping;
+
+      std::vector<std::thread> workers;
+
+      util::log::channel_sev_logger logger;
+};
+
+}
+
+}
+
+#endif // WORKER_POOL_HPP
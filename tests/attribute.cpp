@@ -2,6 +2,9 @@
 
 #include <string>
 #include <exception>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include "libdicompp/dicomdata.hpp"
 
@@ -455,3 +458,124 @@ SCENARIO("Validation of attributes", "[attributes]")
       }
    }
 }
+
+SCENARIO("Access to the value field of an attribute", "[attributes]")
+{
+   GIVEN("An attribute with multiple values")
+   {
+      auto attr = make_elementfield<VR::US>(4, vmtype<unsigned short> {{512, 256}, {"*"}});
+
+      WHEN("It is accessed through a value_ref")
+      {
+         value_ref<VR::US> ref = attr;
+
+         THEN("The value is not copied")
+         {
+            REQUIRE(&ref.get() == get_value_field_pointer<VR::US>(attr));
+            REQUIRE(ref.get().size() == 2);
+            REQUIRE(*ref.get().cbegin() == 512);
+         }
+      }
+      AND_WHEN("The first value is retrieved")
+      {
+         unsigned short first;
+         get_value_field<VR::US>(attr, first);
+
+         THEN("It is the first of the values")
+         {
+            REQUIRE(first == 512);
+         }
+      }
+      AND_WHEN("It is accessed with another VR")
+      {
+         THEN("An exception is thrown")
+         {
+            REQUIRE_THROWS_AS(get_value_field_ref<VR::SS>(attr), std::runtime_error&);
+            REQUIRE_THROWS_AS(get_value_field_ref<VR::UL>(attr), std::runtime_error&);
+         }
+      }
+   }
+
+   GIVEN("An attribute whose value is decoded on first access")
+   {
+      auto data = std::make_shared<std::vector<unsigned char>>(std::vector<unsigned char> {'A', 'B', 0x5c, 'C', 'D'});
+      auto attr = make_lazy_elementfield(VR::CS, byte_view {data->data(), data->size()}, data, ENDIANNESS::LITTLE);
+
+      WHEN("It is accessed through a value_ref")
+      {
+         const auto& first = get_value_field_ref<VR::CS>(attr);
+         const auto& second = get_value_field_ref<VR::CS>(attr);
+
+         THEN("The value is decoded once and referenced afterwards")
+         {
+            REQUIRE(&first == &second);
+            REQUIRE(first.size() == 2);
+            REQUIRE(first.back() == "CD");
+         }
+      }
+   }
+}
+
+SCENARIO("Copies of large binary values", "[attributes]")
+{
+   GIVEN("An attribute holding a large value of VR OB")
+   {
+      std::vector<unsigned char> pixels(shared_value_threshold, 0x01);
+      elementfield attr = make_elementfield<VR::OB>(pixels);
+
+      WHEN("The attribute is copied")
+      {
+         elementfield copy {attr};
+
+         THEN("The copy shares the value")
+         {
+            REQUIRE(&get_value_field_ref<VR::OB>(copy) == &get_value_field_ref<VR::OB>(attr));
+         }
+         AND_WHEN("The copy is modified")
+         {
+            boost::get<std::vector<unsigned char>>(*get_value_field_pointer<VR::OB>(copy))[0] = 0x02;
+
+            THEN("The value is copied first and the original is left unchanged")
+            {
+               REQUIRE(&get_value_field_ref<VR::OB>(copy) != &get_value_field_ref<VR::OB>(attr));
+               std::vector<unsigned char> original;
+               get_value_field<VR::OB>(attr, original);
+               REQUIRE(original == pixels);
+               std::vector<unsigned char> modified;
+               get_value_field<VR::OB>(copy, modified);
+               REQUIRE(modified[0] == 0x02);
+            }
+         }
+      }
+      AND_WHEN("A pointer to the value is kept while the attribute is copied")
+      {
+         auto value = get_value_field_pointer<VR::OB>(attr);
+         elementfield copy {attr};
+         boost::get<std::vector<unsigned char>>(*value)[0] = 0x02;
+
+         THEN("Writing through the pointer does not change the copy")
+         {
+            std::vector<unsigned char> copied;
+            get_value_field<VR::OB>(copy, copied);
+            REQUIRE(copied == pixels);
+            std::vector<unsigned char> modified;
+            get_value_field<VR::OB>(attr, modified);
+            REQUIRE(modified[0] == 0x02);
+         }
+      }
+   }
+   GIVEN("An attribute holding a small value of VR OB")
+   {
+      elementfield attr = make_elementfield<VR::OB>({0x01, 0x02});
+
+      WHEN("The attribute is copied")
+      {
+         elementfield copy {attr};
+
+         THEN("The value is copied")
+         {
+            REQUIRE(&get_value_field_ref<VR::OB>(copy) != &get_value_field_ref<VR::OB>(attr));
+         }
+      }
+   }
+}
@@ -261,3 +261,91 @@ SCENARIO("Finding and retrieving tags from datasets", "[dataset]")
       }
    }
 }
+
+SCENARIO("Storing attributes in a flat, arena-backed dataset", "[dataset]")
+{
+   GIVEN("A flat dataset with some attributes")
+   {
+      flat_dataset data;
+      data[{0x0028, 0x0010}] = make_elementfield<VR::US>(512);
+      data[{0x0010, 0x0010}] = make_elementfield<VR::PN>("test^est");
+      data[{0x0018, 0x1098}] = make_elementfield<VR::FD>(33.33);
+
+      THEN("the attributes are sorted by tag")
+      {
+         REQUIRE(data.size() == 3);
+         REQUIRE(std::distance(data.begin(), data.find({0x0010, 0x0010})) == 0);
+         REQUIRE(std::distance(data.begin(), data.find({0x0028, 0x0010})) == 2);
+         REQUIRE(*data.begin()->second.value_rep == VR::PN);
+      }
+      THEN("the values can be retrieved")
+      {
+         std::string name;
+         get_value_field<VR::PN>(data[{0x0010, 0x0010}], name);
+         REQUIRE(name == "test^est");
+
+         unsigned short rows;
+         get_value_field<VR::US>(data.at({0x0028, 0x0010}), rows);
+         REQUIRE(rows == 512);
+
+         REQUIRE(contains_tag(data, tag_type {0x0018, 0x1098}));
+         REQUIRE_THROWS(data.at({0x7fe0, 0x0010}));
+      }
+
+      WHEN("an attribute is replaced by a value of the same size")
+      {
+         auto arena_size = data.arena_size();
+         data[{0x0010, 0x0010}] = make_elementfield<VR::PN>("tset^tse");
+
+         THEN("the payload is overwritten in place")
+         {
+            std::string name;
+            get_value_field<VR::PN>(data[{0x0010, 0x0010}], name);
+            REQUIRE(name == "tset^tse");
+            REQUIRE(data.size() == 3);
+            REQUIRE(data.arena_size() == arena_size);
+         }
+      }
+      AND_WHEN("an attribute is erased")
+      {
+         REQUIRE(data.erase({0x0018, 0x1098}) == 1);
+
+         THEN("it is no longer found")
+         {
+            REQUIRE(data.size() == 2);
+            REQUIRE(data.count({0x0018, 0x1098}) == 0);
+         }
+      }
+   }
+
+   GIVEN("A map-based dataset with a sequence")
+   {
+      iod item, set;
+      item[{0xfffe, 0xe000}] = make_elementfield<VR::NI>();
+      item[{0x0010, 0x0010}] = make_elementfield<VR::PN>("q^test");
+      item[{0xfffe, 0xe00d}] = make_elementfield<VR::NI>();
+      set[{0x0008, 0x0018}] = make_elementfield<VR::UI>("1.2.3");
+      set[{0x0040, 0x0275}] = make_elementfield<VR::SQ>(0, {item});
+      set[{0x7fe0, 0x0010}] = make_elementfield<VR::OB>({0x01, 0x02, 0x03, 0x04});
+
+      WHEN("it is converted to a flat dataset and back")
+      {
+         flat_dataset flat {set};
+         auto converted = flat.to_dataset();
+
+         THEN("the traversal yields the same attributes")
+         {
+            std::vector<tag_type> expected, actual;
+            traverse(set, [&expected](tag_type tag, const elementfield&) { expected.push_back(tag); });
+            traverse(converted, [&actual](tag_type tag, const elementfield&) { actual.push_back(tag); });
+            REQUIRE(expected == actual);
+
+            std::vector<unsigned char> pixels;
+            get_value_field<VR::OB>(converted[{0x7fe0, 0x0010}], pixels);
+            std::vector<unsigned char> expected_pixels {0x01, 0x02, 0x03, 0x04};
+            REQUIRE(pixels == expected_pixels);
+            REQUIRE(flat.payload(flat.find({0x7fe0, 0x0010})).size() == 4);
+         }
+      }
+   }
+}
@@ -0,0 +1,329 @@
+#include "catch.hpp"
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <mutex>
+#include <stdexcept>
+
+#include <boost/filesystem.hpp>
+
+#include "libdicompp/dicomdata.hpp"
+
+using namespace dicom::data::attribute;
+using namespace dicom::data::dataset;
+using namespace dicom::filesystem;
+
+SCENARIO("Reading DICOM files through a memory mapping", "[dicomfile]")
+{
+   auto& dictionaries = dicom::data::dictionary::get_default_dictionaries();
+
+   GIVEN("A DICOM file written to disk")
+   {
+      const std::string path = "dicomfile_mapped_test.dcm";
+      std::vector<unsigned char> pixels(1024);
+      for (std::size_t i=0; i<pixels.size(); ++i) {
+         pixels[i] = static_cast<unsigned char>(i);
+      }
+
+      iod written;
+      written[{0x0008, 0x0016}] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.7");
+      written[{0x0010, 0x0010}] = make_elementfield<VR::PN>("test^est");
+      written[{0x7fe0, 0x0010}] = make_elementfield<VR::OB>(pixels);
+      {
+         dicomfile file {written, dictionaries};
+         std::ofstream os {path, std::ios::binary};
+         file.write_dataset(os);
+      }
+
+      WHEN("The file is opened mapped")
+      {
+         iod read;
+         dicomfile file {read, dictionaries};
+         file.open_mapped(path);
+         std::remove(path.c_str());
+
+         THEN("The pixel data is not copied until it is accessed")
+         {
+            auto lazy = dynamic_cast<lazy_element_field*>(read[{0x7fe0, 0x0010}].value_field.get());
+            REQUIRE(lazy != nullptr);
+            REQUIRE(!lazy->is_decoded());
+         }
+         AND_THEN("The values are read correctly")
+         {
+            std::string name;
+            get_value_field<VR::PN>(read[{0x0010, 0x0010}], name);
+            REQUIRE(name == "test^est");
+
+            std::vector<unsigned char> value;
+            get_value_field<VR::OB>(read[{0x7fe0, 0x0010}], value);
+            REQUIRE(value == pixels);
+         }
+         AND_THEN("The encoded dataset can be taken from the mapping")
+         {
+            auto encoded = file.encoded();
+            little_endian_explicit proc {dictionaries};
+            REQUIRE(encoded.transfer_syntax == "1.2.840.10008.1.2.1");
+            REQUIRE(std::vector<unsigned char>(encoded.data.begin(), encoded.data.end())
+                    == proc.serialize(written));
+         }
+      }
+      AND_WHEN("Only the metadata is read")
+      {
+         iod read;
+         dicomfile file {read, dictionaries};
+         parse_filter filter;
+         filter.stop_after = tag_type {0x0020, 0xffff};
+         file.set_parse_filter(filter);
+         file.open_mapped(path);
+         std::remove(path.c_str());
+
+         THEN("The pixel data is not contained")
+         {
+            REQUIRE(read.size() == 2);
+            REQUIRE(!contains_tag(read, {0x7fe0, 0x0010}));
+         }
+      }
+      AND_WHEN("The file is truncated within the pixel data")
+      {
+         boost::filesystem::resize_file(path, boost::filesystem::file_size(path) - 512);
+         iod read;
+         dicomfile file {read, dictionaries};
+
+         THEN("Opening it throws instead of reading beyond the mapping")
+         {
+            REQUIRE_THROWS_AS(file.open_mapped(path), std::runtime_error&);
+         }
+         std::remove(path.c_str());
+      }
+   }
+
+   GIVEN("A file which is not a DICOM file")
+   {
+      const std::string path = "dicomfile_invalid_test.dcm";
+      {
+         std::ofstream os {path, std::ios::binary};
+         os << std::string(200, 'x');
+      }
+
+      WHEN("The file is opened mapped")
+      {
+         iod read;
+         dicomfile file {read, dictionaries};
+
+         THEN("An exception is thrown")
+         {
+            REQUIRE_THROWS(file.encoded());
+            REQUIRE_THROWS(file.open_mapped(path));
+            REQUIRE_THROWS(file.open_mapped("does_not_exist.dcm"));
+         }
+         std::remove(path.c_str());
+      }
+   }
+}
+
+SCENARIO("Reading a batch of DICOM files in parallel", "[dicomfile]")
+{
+   auto& dictionaries = dicom::data::dictionary::get_default_dictionaries();
+
+   GIVEN("Several DICOM files with different transfer syntaxes")
+   {
+      const std::vector<std::string> syntaxes {
+         "1.2.840.10008.1.2", "1.2.840.10008.1.2.1", "1.2.840.10008.1.2.2"
+      };
+      // even length, so the values are not padded
+      auto name_of = [](std::size_t i) {
+         return std::string {i < 10 ? "patient^0" : "patient^"} + std::to_string(i);
+      };
+      std::vector<std::string> paths;
+      for (std::size_t i=0; i<12; ++i) {
+         paths.push_back("dicomfile_batch_test" + std::to_string(i) + ".dcm");
+         iod written;
+         written[{0x0008, 0x0016}] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.7");
+         written[{0x0010, 0x0010}] = make_elementfield<VR::PN>(name_of(i));
+         written[{0x0028, 0x0010}] = make_elementfield<VR::US>(static_cast<unsigned short>(i));
+         written[{0x7fe0, 0x0010}] = make_elementfield<VR::OB>(std::vector<unsigned char>(256*(i+1), 0x7f));
+         dicomfile file {written, dictionaries};
+         file.set_transfer_syntax(syntaxes[i % syntaxes.size()]);
+         std::ofstream os {paths.back(), std::ios::binary};
+         file.write_dataset(os);
+      }
+      paths.push_back("does_not_exist.dcm");
+
+      WHEN("The files are read with a budget smaller than a single file")
+      {
+         batch_options options;
+         options.threads = 4;
+         options.memory_budget = 64;
+         batch_reader reader {dictionaries, options};
+         auto results = reader.read(paths);
+
+         THEN("Each result holds the dataset of its file")
+         {
+            REQUIRE(results.size() == paths.size());
+            for (std::size_t i=0; i+1<results.size(); ++i) {
+               REQUIRE(results[i].index == i);
+               REQUIRE(results[i].path == paths[i]);
+               REQUIRE(!results[i].error);
+
+               std::string name;
+               get_value_field<VR::PN>(results[i].dataset[{0x0010, 0x0010}], name);
+               REQUIRE(name == name_of(i));
+               unsigned short rows;
+               get_value_field<VR::US>(results[i].dataset[{0x0028, 0x0010}], rows);
+               REQUIRE(rows == i);
+            }
+         }
+         AND_THEN("The missing file is reported as an error")
+         {
+            REQUIRE(results.back().error);
+            REQUIRE(results.back().dataset.empty());
+         }
+      }
+      AND_WHEN("The metadata is streamed to a handler")
+      {
+         batch_options options;
+         options.threads = 3;
+         options.lazy = true;
+         options.filter.stop_after = tag_type {0x0028, 0xffff};
+         batch_reader reader {dictionaries, options};
+
+         std::mutex lock;
+         std::vector<std::size_t> handled;
+         std::size_t errors = 0;
+         reader.read(paths, [&](batch_result& result) {
+            std::lock_guard<std::mutex> guard {lock};
+            handled.push_back(result.index);
+            if (result.error) {
+               ++errors;
+            } else if (contains_tag(result.dataset, {0x7fe0, 0x0010})) {
+               ++errors;
+            }
+         });
+
+         THEN("Every file is handled once without the pixel data")
+         {
+            std::sort(handled.begin(), handled.end());
+            REQUIRE(handled.size() == paths.size());
+            for (std::size_t i=0; i<handled.size(); ++i) {
+               REQUIRE(handled[i] == i);
+            }
+            REQUIRE(errors == 1);
+         }
+      }
+
+      for (std::size_t i=0; i+1<paths.size(); ++i) {
+         std::remove(paths[i].c_str());
+      }
+   }
+}
+
+SCENARIO("Spooling a received data set to a DICOM file", "[dicomfile]")
+{
+   auto& dictionaries = dicom::data::dictionary::get_default_dictionaries();
+
+   GIVEN("A serialized data set with a nested attribute")
+   {
+      const std::string path = "spool_file_test.dcm";
+      iod item, set;
+      item[{0xfffe, 0xe000}] = make_elementfield<VR::NI>();
+      item[{0x0010, 0x0020}] = make_elementfield<VR::LO>("nested");
+      item[{0xfffe, 0xe00d}] = make_elementfield<VR::NI>();
+      set[{0x0008, 0x0016}] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.7");
+      set[{0x0008, 0x0018}] = make_elementfield<VR::UI>("1.2.3.4");
+      set[{0x0008, 0x1115}] = make_elementfield<VR::SQ>(0, {item});
+      set[{0x0010, 0x0020}] = make_elementfield<VR::LO>("patient1");
+      set[{0x7fe0, 0x0010}] = make_elementfield<VR::OB>(std::vector<unsigned char>(10000, 0x42));
+      little_endian_explicit proc {dictionaries};
+      auto serialized = proc.serialize(set);
+
+      WHEN("It is written to a spool file in small fragments")
+      {
+         spool_file spool {path, dictionaries, "1.2.840.10008.5.1.4.1.1.7", "1.2.3.4",
+                           "1.2.840.10008.1.2.1", {{0x0008, 0x0018}, {0x0010, 0x0020}}};
+         for (std::size_t pos=0; pos<serialized.size(); pos+=7) {
+            spool.write(byte_view {serialized.data()+pos, std::min<std::size_t>(7, serialized.size()-pos)});
+         }
+         spool.finish();
+
+         THEN("The top-level header attributes are decoded")
+         {
+            auto& header = spool.header();
+            REQUIRE(header.size() == 2);
+            std::string instance, patient;
+            get_value_field<VR::UI>(header.at({0x0008, 0x0018}), instance);
+            get_value_field<VR::LO>(header.at({0x0010, 0x0020}), patient);
+            REQUIRE(instance.substr(0, 7) == "1.2.3.4");
+            REQUIRE(patient == "patient1");
+            REQUIRE(spool.dataset_size() == serialized.size());
+         }
+         AND_THEN("The file contains the data set with a file meta header")
+         {
+            std::ifstream is {path, std::ios::binary};
+            std::vector<unsigned char> bytes {std::istreambuf_iterator<char> {is},
+                                              std::istreambuf_iterator<char> {}};
+            auto layout = locate_part10(bytes, path);
+            auto metaheader = proc.deserialize(byte_view {bytes}.subview(layout.metaheader_offset,
+                                                                         layout.metaheader_size));
+            std::string transfer_syntax;
+            get_value_field<VR::UI>(metaheader[{0x0002, 0x0010}], transfer_syntax);
+            REQUIRE(transfer_syntax.substr(0, 19) == "1.2.840.10008.1.2.1");
+            REQUIRE(bytes.size() - layout.dataset_offset == serialized.size());
+
+            iod read;
+            dicomfile file {read, dictionaries};
+            file.open_mapped(path);
+            std::remove(path.c_str());
+
+            std::vector<unsigned char> pixels;
+            get_value_field<VR::OB>(read[{0x7fe0, 0x0010}], pixels);
+            REQUIRE(pixels == std::vector<unsigned char>(10000, 0x42));
+         }
+      }
+      AND_WHEN("The spool file is discarded before it is finished")
+      {
+         {
+            spool_file spool {path, dictionaries, "1.2.840.10008.5.1.4.1.1.7", "1.2.3.4",
+                              "1.2.840.10008.1.2.1"};
+            spool.write(byte_view {serialized.data(), 100});
+         }
+
+         THEN("No file is left behind")
+         {
+            std::ifstream final_file {path};
+            REQUIRE(!final_file);
+            for (boost::filesystem::directory_iterator it {"."}, end; it != end; ++it) {
+               REQUIRE(it->path().filename().string().find(path) != 0);
+            }
+         }
+      }
+      AND_WHEN("The same instance is spooled twice at the same time")
+      {
+         spool_file first {path, dictionaries, "1.2.840.10008.5.1.4.1.1.7", "1.2.3.4",
+                           "1.2.840.10008.1.2.1"};
+         spool_file second {path, dictionaries, "1.2.840.10008.5.1.4.1.1.7", "1.2.3.4",
+                            "1.2.840.10008.1.2.1"};
+         for (std::size_t pos=0; pos<serialized.size(); pos+=1000) {
+            byte_view fragment {serialized.data()+pos, std::min<std::size_t>(1000, serialized.size()-pos)};
+            first.write(fragment);
+            second.write(fragment);
+         }
+         first.finish();
+         second.finish();
+
+         THEN("The finished file contains the data set once")
+         {
+            iod read;
+            dicomfile file {read, dictionaries};
+            file.open_mapped(path);
+            std::remove(path.c_str());
+
+            std::vector<unsigned char> pixels;
+            get_value_field<VR::OB>(read[{0x7fe0, 0x0010}], pixels);
+            REQUIRE(pixels == std::vector<unsigned char>(10000, 0x42));
+         }
+      }
+   }
+}
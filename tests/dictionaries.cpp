@@ -1,5 +1,7 @@
 #include "catch.hpp"
 
+#include <cstdio>
+#include <fstream>
 #include <string>
 
 #include <boost/optional.hpp>
@@ -76,6 +78,100 @@ SCENARIO("Retrieval of dictionary information", "[dataset]")
    }
 }
 
+SCENARIO("Retrieval of dictionary information from the compiled-in table", "[dataset]")
+{
+   GIVEN("A static data dictionary")
+   {
+      dictionary_static dict;
+
+      WHEN("A lookup is performed for an existing element")
+      {
+         auto entry = dict.lookup({0x0010, 0x0010});
+
+         THEN("The returned entry contains the expected data")
+         {
+            REQUIRE(entry.is_initialized());
+            REQUIRE(valid_entry(*entry));
+            REQUIRE(entry->keyword == "PatientName");
+            REQUIRE(entry->vr[0] == dicom::data::attribute::VR::PN);
+         }
+      }
+
+      AND_WHEN("A lookup is performed for an element of a repeating group")
+      {
+         auto entry = dict.lookup({0x6002, 0x3000});
+
+         THEN("The masked entry is returned")
+         {
+            REQUIRE(entry.is_initialized());
+            REQUIRE(entry->keyword == "OverlayData");
+         }
+      }
+
+      AND_WHEN("A lookup is performed for a non-existing element")
+      {
+         auto entry = dict.lookup({0x0031, 0x0005});
+
+         THEN("The result entry contains no value")
+         {
+            REQUIRE(!entry.is_initialized());
+            REQUIRE(!dict.lookup_vr({0x0031, 0x0005}).is_initialized());
+         }
+      }
+
+      AND_WHEN("The table is compared to the dynamic dictionary")
+      {
+         dictionary_dyn dyn {"datadictionary.csv", dictionary_dyn::MODE::GREEDY};
+
+         THEN("The table is sorted and each entry matches the dynamic lookup")
+         {
+            for (std::size_t i=0; i<datadictionary_table_size; ++i) {
+               const auto& e = datadictionary_table[i];
+               if (i > 0) {
+                  const auto& prev = datadictionary_table[i-1];
+                  REQUIRE((prev.gid < e.gid || (prev.gid == e.gid && prev.eid < e.eid)));
+               }
+               // item tags have no VR representation in the dynamic dictionary
+               if (e.vr[0] == dicom::data::attribute::VR::NN) {
+                  continue;
+               }
+               auto dyn_entry = dyn.lookup({e.gid, e.eid});
+               REQUIRE(dyn_entry.is_initialized());
+               REQUIRE(dyn_entry->keyword == e.keyword);
+               REQUIRE(dyn_entry->vr[0] == e.vr[0]);
+            }
+         }
+      }
+   }
+}
+
+SCENARIO("Retrieving entries of a locally extended data dictionary")
+{
+   GIVEN("A data dictionary file with a site-specific entry")
+   {
+      {
+         std::ofstream site {"site_datadictionary.csv"};
+         site << "(0x0031,0x0010); LO; Site Tag; SiteTag; 1; \n";
+      }
+      dictionaries dicts {"commanddictionary.csv", "site_datadictionary.csv"};
+
+      WHEN("The site-specific tag is looked up")
+      {
+         THEN("The entry of the file is returned")
+         {
+            REQUIRE(dicts.lookup({0x0031, 0x0010}).keyword == "SiteTag");
+            REQUIRE(dicts.lookup_vr({0x0031, 0x0010}) == dicom::data::attribute::VR::LO);
+         }
+         AND_THEN("The static lookup only consults the compiled-in table")
+         {
+            REQUIRE(dicts.lookup_static_vr({0x0031, 0x0010}) == dicom::data::attribute::VR::UN);
+            REQUIRE(dicts.lookup_static_vr({0x0010, 0x0010}) == dicom::data::attribute::VR::PN);
+         }
+      }
+   }
+   std::remove("site_datadictionary.csv");
+}
+
 SCENARIO("Retrieving dictionary entries for combined dictionaries")
 {
    GIVEN("A dictionary aggregate")
@@ -92,6 +188,16 @@ SCENARIO("Retrieving dictionary entries for combined dictionaries")
          }
       }
 
+      AND_WHEN("The VR of an entry is looked up")
+      {
+         THEN("The VR of the command or data dictionary entry is returned")
+         {
+            REQUIRE(dicts.lookup_vr({0x0000, 0x0100}) == dicom::data::attribute::VR::US);
+            REQUIRE(dicts.lookup_vr({0x0010, 0x0010}) == dicom::data::attribute::VR::PN);
+            REQUIRE(dicts.lookup_vr({0x0031, 0x0005}) == dicom::data::attribute::VR::UN);
+         }
+      }
+
       AND_WHEN("A lookup is performed for an entry which is in neither dictionary")
       {
          auto entry = dicts.lookup({0x0031, 0x0005});
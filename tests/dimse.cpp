@@ -3,15 +3,26 @@
 #include <string>
 
 #include <fstream>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
+#include <atomic>
+#include <algorithm>
+#include <stdexcept>
+#include <vector>
 
-#include "libdicompp/network.hpp"
+#include "libdicompp/all.hpp"
 
 #include "stubs/upperlayer_communication_stub.hpp"
+#include "stubs/upperlayer_client_acceptor_stub.hpp"
 
 using namespace dicom::network;
 using namespace dicom::network::dimse;
 using namespace dicom::data;
 using namespace dicom::data::dataset;
+using namespace dicom::data::attribute;
 
 SCENARIO("Association negotiation on the dimse protocol machine as SCP", "[network][dimse]")
 {
@@ -227,6 +238,816 @@ SCENARIO("Data transmission on an established association", "[network][dimse]")
    }
 }
 
+SCENARIO("Processing received messages on a worker pool", "[network][dimse]")
+{
+   upperlayer_communication_stub ul_stub;
+   dicom::data::dictionary::dictionaries dict;
+
+   // functions posted to the connection are run on the test thread, which
+   // plays the role of the connection's thread
+   std::mutex posted_lock;
+   std::condition_variable posted_cv;
+   std::deque<std::function<void()>> posted;
+   ul_stub.set_handler_on_post([&](std::function<void()> f) {
+      std::lock_guard<std::mutex> lock {posted_lock};
+      posted.push_back(f);
+      posted_cv.notify_all();
+   });
+
+   std::vector<TYPE> written;
+   ul_stub.set_handler_on_queue_for_write([&](std::unique_ptr<property> p) {
+      written.push_back(p->type());
+   });
+
+   std::vector<unsigned char> cecho_bin;
+   std::fstream cecho_file {"cechorq.bin", std::ios::in | std::ios::binary};
+   std::copy(std::istreambuf_iterator<char>{cecho_file},
+             std::istreambuf_iterator<char>{},
+             std::back_inserter(cecho_bin));
+
+   GIVEN("An established association offloading to a pool of two threads")
+   {
+      const auto connection_thread = std::this_thread::get_id();
+      std::atomic<int> running {0};
+      std::atomic<int> max_running {0};
+      std::atomic<int> calls {0};
+      std::atomic<bool> on_connection_thread {false};
+
+      dimse::SOP_class echo {
+         "1.2.840.10008.1.1",
+         { { dataset::DIMSE_SERVICE_GROUP::C_ECHO_RQ,
+                     [&](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod>) {
+                  int now = ++running;
+                  max_running = std::max(max_running.load(), now);
+                  if (std::this_thread::get_id() == connection_thread) {
+                     on_connection_thread = true;
+                  }
+                  std::this_thread::sleep_for(std::chrono::milliseconds(5));
+                  ++calls;
+                  --running;
+                  pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_ECHO_RSP, command, boost::none, 0x0000});
+               }}}
+      };
+      association_definition::presentation_context pc {echo, {"1.2.840.10008.1.2"}, association_definition::DIMSE_MSG_TYPE::RESPONSE};
+      association_definition assoc {"CALLING", "CALLED", {pc}};
+
+      auto pool = std::make_shared<dicom::util::worker_pool>(2, 4);
+      dimse_pm dpm(ul_stub, assoc,  dict);
+      dpm.offload_to(pool, 2);
+
+      auto a = new a_associate_rq();
+      a->application_context = "1.2.840.10008.3.1.1.1";
+      a->pres_contexts.emplace_back();
+      a->pres_contexts[0].abstract_syntax = "1.2.840.10008.1.1";
+      a->pres_contexts[0].id = 1;
+      a->pres_contexts[0].transfer_syntaxes.push_back("1.2.840.10008.1.2");
+      a->max_message_length = 16384;
+      ul_stub.invoke_received_message(TYPE::A_ASSOCIATE_RQ, std::unique_ptr<property>(a));
+      written.clear();
+
+      WHEN("Several messages and a release request are received")
+      {
+         for (int i=0; i<3; ++i) {
+            p_data_tf* p_data = new p_data_tf;
+            p_data->command_set = cecho_bin;
+            p_data->pres_context_id = 1;
+            ul_stub.invoke_received_message(TYPE::P_DATA_TF, std::unique_ptr<property>(p_data));
+         }
+         bool paused = ul_stub.is_reading_paused();
+         ul_stub.invoke_received_message(TYPE::A_RELEASE_RQ, std::unique_ptr<property>(new a_release_rq));
+
+         auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(10);
+         while (written.size() < 4 && std::chrono::steady_clock::now() < deadline) {
+            std::function<void()> f;
+            {
+               std::unique_lock<std::mutex> lock {posted_lock};
+               posted_cv.wait_for(lock, std::chrono::milliseconds(100), [&]() { return !posted.empty(); });
+               if (posted.empty()) {
+                  continue;
+               }
+               f = posted.front();
+               posted.pop_front();
+            }
+            f();
+         }
+
+         THEN("The handlers run one after another on the workers")
+         {
+            REQUIRE(calls == 3);
+            REQUIRE(max_running == 1);
+            REQUIRE(!on_connection_thread);
+         }
+         AND_THEN("Reading is paused while messages are pending")
+         {
+            REQUIRE(paused);
+            REQUIRE(!ul_stub.is_reading_paused());
+         }
+         AND_THEN("The release is answered after the responses")
+         {
+            std::vector<TYPE> expected {TYPE::P_DATA_TF, TYPE::P_DATA_TF, TYPE::P_DATA_TF, TYPE::A_RELEASE_RP};
+            REQUIRE(written == expected);
+         }
+      }
+   }
+}
+
+namespace
+{
+
+struct recording_stream: dataset_stream
+{
+      std::vector<unsigned char> data;
+      std::size_t fragments = 0;
+      bool finished = false;
+
+      void write(const unsigned char* fragment, std::size_t len) override
+      {
+         data.insert(data.end(), fragment, fragment+len);
+         ++fragments;
+      }
+
+      void finish() override
+      {
+         finished = true;
+      }
+};
+
+}
+
+SCENARIO("Reporting the exceptions of worker pool tasks", "[network][dimse]")
+{
+   GIVEN("A worker pool")
+   {
+      std::mutex lock;
+      std::condition_variable reported;
+      std::vector<std::string> errors;
+      std::atomic<int> completed {0};
+
+      {
+         dicom::util::worker_pool pool {2, 4};
+
+         WHEN("Tasks with and without an error handler throw")
+         {
+            pool.submit([]() { throw std::runtime_error {"first"}; },
+                        [&](std::exception_ptr exception) {
+               try {
+                  std::rethrow_exception(exception);
+               } catch (std::exception& err) {
+                  std::lock_guard<std::mutex> guard {lock};
+                  errors.push_back(err.what());
+               }
+               reported.notify_all();
+            });
+            pool.submit([]() { throw std::runtime_error {"logged"}; });
+            pool.submit([&completed]() { ++completed; });
+
+            THEN("The handler receives the exception and the pool keeps working")
+            {
+               std::unique_lock<std::mutex> guard {lock};
+               REQUIRE(reported.wait_for(guard, std::chrono::seconds {5},
+                                         [&errors]() { return !errors.empty(); }));
+               REQUIRE(errors == std::vector<std::string> {"first"});
+            }
+         }
+      }
+      REQUIRE(completed.load() == 1);
+   }
+}
+
+SCENARIO("Streaming the data set of received messages", "[network][dimse]")
+{
+   upperlayer_communication_stub ul_stub;
+   dicom::data::dictionary::dictionaries dict;
+   ul_stub.set_handler_on_queue_for_write([](std::unique_ptr<property>) {});
+
+   std::vector<unsigned char> cecho_bin;
+   std::fstream cecho_file {"cechorq.bin", std::ios::in | std::ios::binary};
+   std::copy(std::istreambuf_iterator<char>{cecho_file},
+             std::istreambuf_iterator<char>{},
+             std::back_inserter(cecho_bin));
+
+   GIVEN("An established association with a stream selector")
+   {
+      bool data_passed = true;
+      std::shared_ptr<dataset_stream> handled_stream;
+      dimse::SOP_class echo {
+         "1.2.840.10008.1.1",
+         { { dataset::DIMSE_SERVICE_GROUP::C_ECHO_RQ,
+                     [&](dimse::dimse_pm* pm, dataset::commandset_data, std::unique_ptr<dataset::iod> data) {
+                  data_passed = data != nullptr;
+                  handled_stream = pm->get_current_stream();
+               }}}
+      };
+      association_definition::presentation_context pc {echo, {"1.2.840.10008.1.2"}, association_definition::DIMSE_MSG_TYPE::RESPONSE};
+      association_definition assoc {"CALLING", "CALLED", {pc}};
+
+      dimse_pm dpm(ul_stub, assoc,  dict);
+      auto stream = std::make_shared<recording_stream>();
+      std::string selected_syntax;
+      dpm.stream_datasets([&](dimse_pm*, const dataset::commandset_data&, const std::string& transfer_syntax) {
+         selected_syntax = transfer_syntax;
+         return stream;
+      });
+
+      auto a = new a_associate_rq();
+      a->application_context = "1.2.840.10008.3.1.1.1";
+      a->pres_contexts.emplace_back();
+      a->pres_contexts[0].abstract_syntax = "1.2.840.10008.1.1";
+      a->pres_contexts[0].id = 1;
+      a->pres_contexts[0].transfer_syntaxes.push_back("1.2.840.10008.1.2");
+      ul_stub.invoke_received_message(TYPE::A_ASSOCIATE_RQ, std::unique_ptr<property>(a));
+
+      WHEN("A message with a data set is received in fragments")
+      {
+         std::unique_ptr<p_data_tf> p_data {new p_data_tf};
+         p_data->command_set = cecho_bin;
+         p_data->pres_context_id = 1;
+         p_data->data_set = std::vector<unsigned char>(1000, 0x17);
+         ul_stub.invoke_received_stream(std::move(p_data), 300);
+
+         THEN("The stream receives the data set instead of the handler")
+         {
+            REQUIRE(stream->fragments == 4);
+            REQUIRE(stream->data == std::vector<unsigned char>(1000, 0x17));
+            REQUIRE(stream->finished);
+            REQUIRE(selected_syntax.substr(0, 17) == "1.2.840.10008.1.2");
+            REQUIRE(!data_passed);
+            REQUIRE(handled_stream == stream);
+            REQUIRE(dpm.get_current_stream() == nullptr);
+         }
+      }
+   }
+}
+
+SCENARIO("Sending an encoded data set", "[network][dimse]")
+{
+   upperlayer_communication_stub ul_stub;
+   dicom::data::dictionary::dictionaries dict;
+
+   std::vector<std::unique_ptr<property>> written;
+   ul_stub.set_handler_on_queue_for_write([&](std::unique_ptr<property> p) {
+      written.push_back(std::move(p));
+   });
+
+   std::vector<unsigned char> cecho_bin;
+   std::fstream cecho_file {"cechorq.bin", std::ios::in | std::ios::binary};
+   std::copy(std::istreambuf_iterator<char>{cecho_file},
+             std::istreambuf_iterator<char>{},
+             std::back_inserter(cecho_bin));
+
+   iod set;
+   set[{0x0008, 0x0018}] = make_elementfield<VR::UI>("1.2.3.4");
+   set[{0x0010, 0x0010}] = make_elementfield<VR::PN>("test^name");
+   little_endian_implicit implicit {dict};
+   little_endian_explicit explicit_proc {dict};
+
+   GIVEN("An established association with the implicit little endian transfer syntax")
+   {
+      encoded_dataset to_send;
+      dimse::SOP_class echo {
+         "1.2.840.10008.1.1",
+         { { dataset::DIMSE_SERVICE_GROUP::C_ECHO_RQ,
+                     [&](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod>) {
+                  pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_ECHO_RSP, command, to_send});
+               }}}
+      };
+      association_definition::presentation_context pc {echo, {"1.2.840.10008.1.2"}, association_definition::DIMSE_MSG_TYPE::RESPONSE};
+      association_definition assoc {"CALLING", "CALLED", {pc}};
+
+      dimse_pm dpm(ul_stub, assoc,  dict);
+
+      auto a = new a_associate_rq();
+      a->application_context = "1.2.840.10008.3.1.1.1";
+      a->pres_contexts.emplace_back();
+      a->pres_contexts[0].abstract_syntax = "1.2.840.10008.1.1";
+      a->pres_contexts[0].id = 1;
+      a->pres_contexts[0].transfer_syntaxes.push_back("1.2.840.10008.1.2");
+      a->max_message_length = 16384;
+      ul_stub.invoke_received_message(TYPE::A_ASSOCIATE_RQ, std::unique_ptr<property>(a));
+      written.clear();
+
+      auto receive_echo = [&]() {
+         p_data_tf* p_data = new p_data_tf;
+         p_data->command_set = cecho_bin;
+         p_data->pres_context_id = 1;
+         ul_stub.invoke_received_message(TYPE::P_DATA_TF, std::unique_ptr<property>(p_data));
+         REQUIRE(written.size() == 1);
+         auto sent = dynamic_cast<p_data_tf*>(written[0].get());
+         REQUIRE(sent != nullptr);
+         return sent;
+      };
+
+      WHEN("The data set is encoded in the negotiated transfer syntax")
+      {
+         auto encoded = std::make_shared<std::vector<unsigned char>>(implicit.serialize(set));
+         to_send = encoded_dataset {byte_view {*encoded}, encoded, "1.2.840.10008.1.2"};
+         auto sent = receive_echo();
+
+         THEN("The encoded bytes are sent without being copied")
+         {
+            pdu_buffers buffers;
+            sent->make_pdu_buffers(buffers);
+            REQUIRE(sent->data_set.empty());
+            REQUIRE(buffers.sequence.size() == 4);
+            REQUIRE(boost::asio::buffer_cast<const unsigned char*>(buffers.sequence[3])
+                    == encoded->data());
+         }
+      }
+      AND_WHEN("The data set is encoded in another transfer syntax")
+      {
+         auto encoded = std::make_shared<std::vector<unsigned char>>(explicit_proc.serialize(set));
+         to_send = encoded_dataset {byte_view {*encoded}, encoded, "1.2.840.10008.1.2.1"};
+         auto sent = receive_echo();
+
+         THEN("It is transcoded to the negotiated transfer syntax")
+         {
+            REQUIRE(sent->data_set == implicit.serialize(set));
+         }
+      }
+      AND_WHEN("The data set is encapsulated in another transfer syntax")
+      {
+         auto encoded = std::make_shared<std::vector<unsigned char>>(explicit_proc.serialize(set));
+         to_send = encoded_dataset {byte_view {*encoded}, encoded, "1.2.840.10008.1.2.4.50"};
+
+         THEN("It is not sent under the negotiated transfer syntax")
+         {
+            p_data_tf* p_data = new p_data_tf;
+            p_data->command_set = cecho_bin;
+            p_data->pres_context_id = 1;
+            REQUIRE_THROWS_AS(ul_stub.invoke_received_message(TYPE::P_DATA_TF, std::unique_ptr<property>(p_data)),
+                              std::runtime_error&);
+            REQUIRE(written.empty());
+         }
+      }
+   }
+}
+
+SCENARIO("Pipelining requests within an asynchronous operations window", "[network][dimse]")
+{
+   upperlayer_communication_stub ul_stub;
+   dicom::data::dictionary::dictionaries dict;
+
+   std::vector<std::unique_ptr<property>> written;
+   ul_stub.set_handler_on_queue_for_write([&](std::unique_ptr<property> p) {
+      written.push_back(std::move(p));
+   });
+
+   GIVEN("A protocol machine accepting associations with any window")
+   {
+      dimse::SOP_class echo {"1.2.840.10008.1.1",
+                             { { dataset::DIMSE_SERVICE_GROUP::C_ECHO_RQ,
+                     [](dimse::dimse_pm*, dataset::commandset_data, std::unique_ptr<dataset::iod>) {
+               }}}
+                            };
+      association_definition::presentation_context pc {echo, {"1.2.840.10008.1.2"}, association_definition::DIMSE_MSG_TYPE::RESPONSE};
+      association_definition assoc {"CALLING", "CALLED", {pc}};
+      assoc.set_async_ops_window(0, 1);
+      dimse_pm dpm(ul_stub, assoc,  dict);
+
+      auto a = new a_associate_rq();
+      a->application_context = "1.2.840.10008.3.1.1.1";
+      a->pres_contexts.emplace_back();
+      a->pres_contexts[0].abstract_syntax = "1.2.840.10008.1.1";
+      a->pres_contexts[0].id = 1;
+      a->pres_contexts[0].transfer_syntaxes.push_back("1.2.840.10008.1.2");
+
+      WHEN("A window is proposed")
+      {
+         a->max_ops_invoked = 8;
+         a->max_ops_performed = 4;
+         ul_stub.invoke_received_message(TYPE::A_ASSOCIATE_RQ, std::unique_ptr<property>(a));
+
+         THEN("The invoked operations are accepted and the performed ones limited")
+         {
+            auto ac = dynamic_cast<a_associate_ac*>(written.at(0).get());
+            REQUIRE(ac != nullptr);
+            REQUIRE(ac->max_ops_invoked == 8);
+            REQUIRE(ac->max_ops_performed == 1);
+         }
+      }
+      AND_WHEN("No window is proposed")
+      {
+         ul_stub.invoke_received_message(TYPE::A_ASSOCIATE_RQ, std::unique_ptr<property>(a));
+
+         THEN("The operations remain synchronous")
+         {
+            auto ac = dynamic_cast<a_associate_ac*>(written.at(0).get());
+            REQUIRE(ac != nullptr);
+            REQUIRE(ac->max_ops_invoked == 1);
+            REQUIRE(ac->max_ops_performed == 1);
+            REQUIRE(dpm.max_outstanding_requests() == 1);
+         }
+      }
+   }
+
+   GIVEN("A requestor proposing a window of four operations")
+   {
+      std::vector<unsigned short> responded;
+      std::vector<unsigned short> sent_ids;
+      dimse::SOP_class echo {"1.2.840.10008.1.1",
+                             { { dataset::DIMSE_SERVICE_GROUP::C_ECHO_RQ,
+                     [&](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod>) {
+                  while (pm->outstanding_requests() < pm->max_outstanding_requests()) {
+                     sent_ids.push_back(pm->send_request(
+                        {dataset::DIMSE_SERVICE_GROUP::C_ECHO_RQ, command},
+                        [&](dimse::dimse_pm*, dataset::commandset_data response, std::unique_ptr<dataset::iod>) {
+                           unsigned short id;
+                           get_value_field<VR::US>(response.at({0x0000, 0x0120}), id);
+                           responded.push_back(id);
+                        }));
+                  }
+               }}}
+                            };
+      association_definition::presentation_context pc {echo, {"1.2.840.10008.1.2"}, association_definition::DIMSE_MSG_TYPE::INITIATOR};
+      association_definition assoc {"CALLING", "CALLED", {pc}};
+      assoc.set_async_ops_window(4);
+      dimse_pm dpm(ul_stub, assoc,  dict);
+
+      auto rq = assoc.get_initial_request();
+      ul_stub.invoke_sent_message(TYPE::A_ASSOCIATE_RQ, &rq);
+
+      auto ac = new a_associate_ac();
+      ac->application_context = "1.2.840.10008.3.1.1.1";
+      ac->pres_contexts.push_back({1, a_associate_ac::presentation_context::RESULT::ACCEPTANCE, "1.2.840.10008.1.2"});
+      ac->max_message_length = 16384;
+      ac->max_ops_invoked = 2;
+
+      WHEN("The acceptor limits the window to two operations")
+      {
+         ul_stub.invoke_received_message(TYPE::A_ASSOCIATE_AC, std::unique_ptr<property>(ac));
+
+         THEN("Two requests are sent without waiting for a response")
+         {
+            REQUIRE(dpm.max_outstanding_requests() == 2);
+            REQUIRE(sent_ids.size() == 2);
+            REQUIRE(written.size() == 2);
+            REQUIRE(dpm.outstanding_requests() == 2);
+         }
+         AND_WHEN("The responses arrive in reverse order")
+         {
+            auto respond = [&](unsigned short id) {
+               iod command;
+               command[{0x0000, 0x0002}] = make_elementfield<VR::UI>("1.2.840.10008.1.1");
+               command[{0x0000, 0x0100}] = make_elementfield<VR::US>(0x8030);
+               command[{0x0000, 0x0120}] = make_elementfield<VR::US>(id);
+               command[{0x0000, 0x0800}] = make_elementfield<VR::US>(0x0101);
+               command[{0x0000, 0x0900}] = make_elementfield<VR::US>(0x0000);
+               p_data_tf* p_data = new p_data_tf;
+               p_data->command_set = commandset_processor {dict}.serialize(command);
+               p_data->pres_context_id = 1;
+               ul_stub.invoke_received_message(TYPE::P_DATA_TF, std::unique_ptr<property>(p_data));
+            };
+            respond(sent_ids[1]);
+            respond(sent_ids[0]);
+
+            THEN("Each response is correlated with its request")
+            {
+               std::vector<unsigned short> expected {sent_ids[1], sent_ids[0]};
+               REQUIRE(responded == expected);
+               REQUIRE(dpm.outstanding_requests() == 0);
+            }
+         }
+      }
+   }
+}
+
+SCENARIO("Reusing associations from a pool", "[network][dimse]")
+{
+   dicom::data::dictionary::dictionaries dict {"commanddictionary.csv", "datadictionary.csv"};
+
+   // each acceptor connects on run() and reads the a-associate-ac of the peer
+   std::vector<upperlayer_client_acceptor_stub*> acceptors;
+   std::size_t stopped = 0;
+   auto factory = [&](const connection&) {
+      auto acceptor = new upperlayer_client_acceptor_stub;
+      acceptor->set_run_handler([acceptor]() {
+         acceptor->push_connection([](infrastructure_read_connection_stub* conn) {
+            conn->set_next_segment("a_associate_ac.bin");
+         });
+      });
+      acceptor->set_stop_handler([&stopped]() { ++stopped; });
+      acceptors.push_back(acceptor);
+      return std::unique_ptr<Iinfrastructure_client_acceptor> {acceptor};
+   };
+
+   // the operations are completed as soon as they are started
+   std::size_t started = 0;
+   pooled_association* current = nullptr;
+   std::vector<SOP_class> sop_classes
+   {
+      {"1.2.840.10008.1.1", {{DIMSE_SERVICE_GROUP::C_ECHO_RQ,
+         [&](dimse_pm*, commandset_data, std::unique_ptr<iod>) { ++started; current->park(); }}}}
+   };
+   association_definition assoc {"CALLING", "CALLED",
+      make_presentation_contexts(sop_classes, {"1.2.840.10008.1.2.1"},
+                                 association_definition::DIMSE_MSG_TYPE::INITIATOR)};
+   auto request = assoc.get_initial_request();
+   connection endpoint {"CALLING", "CALLED", "localhost", 11112};
+
+   GIVEN("An association pool")
+   {
+      association_pool pool {dict, std::chrono::seconds {30}, factory};
+
+      WHEN("An association is acquired, used and put back")
+      {
+         auto association = pool.acquire(endpoint, request, assoc);
+         current = association.get();
+         association->run();
+         pool.put_back(std::move(association));
+
+         THEN("The association is negotiated and kept open in the pool")
+         {
+            REQUIRE(acceptors.size() == 1);
+            REQUIRE(started == 1);
+            REQUIRE(stopped == 1);
+            REQUIRE(pool.idle_associations() == 1);
+         }
+         AND_WHEN("An association with the same key is acquired")
+         {
+            auto reused = pool.acquire(endpoint, request, assoc);
+            current = reused.get();
+            reused->run();
+
+            THEN("The open association is used without connecting again")
+            {
+               REQUIRE(acceptors.size() == 1);
+               REQUIRE(started == 2);
+               REQUIRE(stopped == 2);
+               REQUIRE(pool.idle_associations() == 0);
+            }
+         }
+         AND_WHEN("An association to another host is acquired")
+         {
+            connection other {"CALLING", "CALLED", "otherhost", 11112};
+            auto association = pool.acquire(other, request, assoc);
+
+            THEN("A new association is created")
+            {
+               REQUIRE(acceptors.size() == 2);
+               REQUIRE(pool.idle_associations() == 1);
+            }
+         }
+         AND_WHEN("An association with another asynchronous operations window is acquired")
+         {
+            auto pipelined = request;
+            pipelined.max_ops_invoked = 8;
+            auto association = pool.acquire(endpoint, pipelined, assoc);
+
+            THEN("The open association negotiated for another window is not used")
+            {
+               REQUIRE(acceptors.size() == 2);
+               REQUIRE(pool.idle_associations() == 1);
+               REQUIRE_FALSE((association->key() == association_key {endpoint, request}));
+            }
+         }
+      }
+   }
+
+   GIVEN("An association pool whose associations expire immediately")
+   {
+      association_pool pool {dict, std::chrono::seconds {0}, factory};
+
+      WHEN("An association is put back and acquired again")
+      {
+         auto association = pool.acquire(endpoint, request, assoc);
+         current = association.get();
+         association->run();
+         pool.put_back(std::move(association));
+
+         auto next = pool.acquire(endpoint, request, assoc);
+
+         THEN("The idle association was released and a new one is created")
+         {
+            REQUIRE(acceptors.size() == 2);
+            REQUIRE(pool.idle_associations() == 0);
+         }
+      }
+   }
+   GIVEN("An association pool with a short idle timeout")
+   {
+      association_pool pool {dict, std::chrono::milliseconds {50}, factory};
+
+      WHEN("An association is put back and the pool is not used again")
+      {
+         auto association = pool.acquire(endpoint, request, assoc);
+         current = association.get();
+         association->run();
+         pool.put_back(std::move(association));
+
+         auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds {5};
+         while (pool.idle_associations() > 0 && std::chrono::steady_clock::now() < deadline) {
+            std::this_thread::sleep_for(std::chrono::milliseconds {10});
+         }
+
+         THEN("The idle association is released after the timeout")
+         {
+            REQUIRE(pool.idle_associations() == 0);
+            REQUIRE(acceptors.size() == 1);
+         }
+      }
+   }
+}
+
+SCENARIO("Sending a batch of instances over parallel associations", "[network][dimse]")
+{
+   using namespace dicom::serviceclass;
+   dicom::data::dictionary::dictionaries dict {"commanddictionary.csv", "datadictionary.csv"};
+
+   std::vector<std::string> paths;
+   for (int i=0; i<2; ++i) {
+      iod set;
+      set[SOPClassUID] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.1");
+      set[SOPInstanceUID] = make_elementfield<VR::UI>("1.2.3." + std::to_string(i));
+      set[PatientName] = make_elementfield<VR::PN>("patient1");
+      paths.push_back("fanout" + std::to_string(i) + ".dcm");
+      dicom::filesystem::dicomfile file {set, dict};
+      std::ofstream os {paths.back(), std::ios::binary};
+      file.write_dataset(os);
+   }
+
+   // each association reads the a-associate-ac and the C-STORE responses
+   // of the next segment. The message ids of the requests start at 2.
+   std::vector<std::vector<unsigned short>> segment_statuses;
+   std::size_t associations_created = 0;
+   auto factory = [&](const connection&) {
+      std::string segment {"fanout_segment" + std::to_string(associations_created) + ".bin"};
+      {
+         std::ifstream ac {"a_associate_ac.bin", std::ios::binary};
+         std::ofstream os {segment, std::ios::binary};
+         os << ac.rdbuf();
+         unsigned short id = 2;
+         for (auto status : segment_statuses.at(associations_created)) {
+            iod command;
+            command[{0x0000, 0x0002}] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.1");
+            command[{0x0000, 0x0100}] = make_elementfield<VR::US>(0x8001);
+            command[{0x0000, 0x0120}] = make_elementfield<VR::US>(id++);
+            command[{0x0000, 0x0800}] = make_elementfield<VR::US>(0x0101);
+            command[{0x0000, 0x0900}] = make_elementfield<VR::US>(status);
+            p_data_tf response;
+            response.msg_length = 16384;
+            response.pres_context_id = 1;
+            response.command_set = commandset_processor {dict}.serialize(command);
+            auto pdu = response.make_pdu();
+            os.write(reinterpret_cast<const char*>(pdu.data()), pdu.size());
+         }
+      }
+      ++associations_created;
+
+      auto acceptor = new upperlayer_client_acceptor_stub;
+      acceptor->set_run_handler([acceptor, segment]() {
+         acceptor->push_connection([segment](infrastructure_read_connection_stub* conn) {
+            conn->set_next_segment(segment);
+         });
+      });
+      return std::unique_ptr<Iinfrastructure_client_acceptor> {acceptor};
+   };
+
+   fanout_options options;
+   options.associations = 1;
+   options.max_attempts = 2;
+   // idle associations expire, so each run takes the next segment
+   options.pool = std::make_shared<association_pool>(dict, std::chrono::seconds {0}, factory);
+   storage_fanout fanout {{"CALLING", "CALLED", "localhost", 11112}, dict, options};
+
+   GIVEN("A destination which fails the second instance once")
+   {
+      segment_statuses = {{0x0000, 0xa700}, {0x0000}};
+
+      WHEN("The instances are sent")
+      {
+         auto results = fanout.send(paths);
+
+         THEN("The failed instance is retried by another association")
+         {
+            REQUIRE(associations_created == 2);
+            REQUIRE(results[0].status == 0x0000);
+            REQUIRE(results[0].attempts == 1);
+            REQUIRE(results[1].path == paths[1]);
+            REQUIRE(results[1].status == 0x0000);
+            REQUIRE(results[1].attempts == 2);
+            REQUIRE_FALSE(results[1].error);
+         }
+      }
+   }
+   GIVEN("A destination which fails the second instance on each attempt")
+   {
+      segment_statuses = {{0x0000, 0xa700}, {0xa700}};
+
+      WHEN("The instances are sent")
+      {
+         auto results = fanout.send(paths);
+
+         THEN("The failure is reported after the maximum number of attempts")
+         {
+            REQUIRE(results[0].status == 0x0000);
+            REQUIRE(results[1].status == 0xa700);
+            REQUIRE(results[1].attempts == 2);
+         }
+      }
+   }
+   GIVEN("The same file listed twice, whose second entry fails once")
+   {
+      segment_statuses = {{0x0000, 0xa700}, {0x0000}};
+      paths[1] = paths[0];
+
+      WHEN("The instances are sent")
+      {
+         auto results = fanout.send(paths);
+
+         THEN("Each entry is reported with its own attempts")
+         {
+            REQUIRE(results[0].index == 0);
+            REQUIRE(results[0].attempts == 1);
+            REQUIRE(results[1].index == 1);
+            REQUIRE(results[1].status == 0x0000);
+            REQUIRE(results[1].attempts == 2);
+         }
+      }
+   }
+   GIVEN("An instance which cannot be read")
+   {
+      segment_statuses = {{0x0000}};
+      paths[1] = "fanout_missing.dcm";
+
+      WHEN("The instances are sent")
+      {
+         auto results = fanout.send(paths);
+
+         THEN("The error is reported without retrying the instance")
+         {
+            REQUIRE(associations_created == 1);
+            REQUIRE(results[0].status == 0x0000);
+            REQUIRE(results[1].error);
+            REQUIRE(results[1].attempts == 1);
+         }
+      }
+   }
+
+   GIVEN("An instance of a SOP class which was not negotiated")
+   {
+      segment_statuses = {{0x0000}};
+      iod set;
+      set[SOPClassUID] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.2");
+      set[SOPInstanceUID] = make_elementfield<VR::UI>("1.2.3.2");
+      paths[1] = "fanout_ct.dcm";
+      dicom::filesystem::dicomfile file {set, dict};
+      std::ofstream os {paths[1], std::ios::binary};
+      file.write_dataset(os);
+      os.close();
+
+      WHEN("The instances are sent")
+      {
+         auto results = fanout.send(paths);
+
+         THEN("The instance is reported as failed without sending it")
+         {
+            REQUIRE(associations_created == 1);
+            REQUIRE(results[0].status == 0x0000);
+            REQUIRE(results[1].error);
+            REQUIRE(results[1].attempts == 1);
+         }
+      }
+   }
+
+   GIVEN("A fan-out proposing only another SOP class than that of the instances")
+   {
+      segment_statuses = {{}};
+      options.sop_classes = {"1.2.840.10008.5.1.4.1.1.2"};
+      storage_fanout restricted {{"CALLING", "CALLED", "localhost", 11112}, dict, options};
+
+      WHEN("The instances are sent")
+      {
+         auto results = restricted.send(paths);
+
+         THEN("The instances are reported as failed without sending them")
+         {
+            REQUIRE(associations_created == 1);
+            REQUIRE(results[0].error);
+            REQUIRE(results[1].error);
+            REQUIRE(results[1].attempts == 1);
+         }
+      }
+   }
+
+   GIVEN("A transfer limiter with a maximum data rate")
+   {
+      transfer_limiter limiter {1, 10000};
+
+      WHEN("Two data sets are transferred")
+      {
+         auto start = std::chrono::steady_clock::now();
+         limiter.transfer(1000);
+         limiter.transfer(1000);
+         auto elapsed = std::chrono::steady_clock::now() - start;
+
+         THEN("The second one waits for the first one at the maximum rate")
+         {
+            REQUIRE(elapsed >= std::chrono::milliseconds {90});
+         }
+      }
+   }
+}
+
 SCENARIO("Association release on the dimse protocol machine", "[network][dimse]")
 {
 
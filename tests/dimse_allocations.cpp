@@ -0,0 +1,127 @@
+#include "catch.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <new>
+#include <vector>
+
+#include "libdicompp/all.hpp"
+
+#include "stubs/upperlayer_communication_stub.hpp"
+
+// The global allocation functions are replaced to count the copies of a
+// value field. This file is linked into its own test executable, so the
+// replacement does not affect the other tests.
+
+using namespace dicom::network;
+using namespace dicom::network::dimse;
+using namespace dicom::data;
+using namespace dicom::data::dataset;
+using namespace dicom::data::attribute;
+
+namespace
+{
+
+// allocations of exactly watched_size bytes are counted, which are the
+// copies of a binary value field of that length
+std::atomic<std::size_t> watched_size {0};
+std::atomic<std::size_t> watched_allocations {0};
+
+}
+
+void* operator new(std::size_t size)
+{
+   if (size != 0 && size == watched_size.load(std::memory_order_relaxed)) {
+      ++watched_allocations;
+   }
+   if (void* p = std::malloc(size == 0 ? 1 : size)) {
+      return p;
+   }
+   throw std::bad_alloc {};
+}
+
+void operator delete(void* p) noexcept
+{
+   std::free(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept
+{
+   std::free(p);
+}
+
+SCENARIO("Passing a received image to the application", "[network][dimse]")
+{
+   upperlayer_communication_stub ul_stub;
+   dicom::data::dictionary::dictionaries dict;
+
+   std::vector<std::unique_ptr<property>> written;
+   ul_stub.set_handler_on_queue_for_write([&](std::unique_ptr<property> p) {
+      written.push_back(std::move(p));
+   });
+
+   const std::size_t pixel_data_size = 1024*1024 + 2;
+   little_endian_explicit explicit_proc {dict};
+
+   GIVEN("An established association with a storage SCP keeping and returning the images")
+   {
+      std::vector<iod> kept;
+      dimse::SOP_class storage {
+         "1.2.840.10008.5.1.4.1.1.2",
+         { { dataset::DIMSE_SERVICE_GROUP::C_STORE_RQ,
+                     [&](dimse::dimse_pm* pm, dataset::commandset_data command, std::unique_ptr<dataset::iod> data) {
+                  kept.push_back(*data);
+                  pm->send_response({dataset::DIMSE_SERVICE_GROUP::C_STORE_RSP, std::move(command), kept.back()});
+               }}}
+      };
+      association_definition::presentation_context pc {storage, {"1.2.840.10008.1.2.1"}, association_definition::DIMSE_MSG_TYPE::RESPONSE};
+      association_definition assoc {"CALLING", "CALLED", {pc}};
+      dimse_pm dpm(ul_stub, assoc,  dict);
+
+      auto a = new a_associate_rq();
+      a->application_context = "1.2.840.10008.3.1.1.1";
+      a->pres_contexts.emplace_back();
+      a->pres_contexts[0].abstract_syntax = "1.2.840.10008.5.1.4.1.1.2";
+      a->pres_contexts[0].id = 1;
+      a->pres_contexts[0].transfer_syntaxes.push_back("1.2.840.10008.1.2.1");
+      a->max_message_length = 16384;
+      ul_stub.invoke_received_message(TYPE::A_ASSOCIATE_RQ, std::unique_ptr<property>(a));
+      written.clear();
+
+      iod command;
+      command[{0x0000, 0x0002}] = make_elementfield<VR::UI>("1.2.840.10008.5.1.4.1.1.2");
+      command[{0x0000, 0x0100}] = make_elementfield<VR::US>(0x0001);
+      command[{0x0000, 0x0110}] = make_elementfield<VR::US>(1);
+      command[{0x0000, 0x0700}] = make_elementfield<VR::US>(0x0000);
+      command[{0x0000, 0x0800}] = make_elementfield<VR::US>(0x0000);
+      command[{0x0000, 0x1000}] = make_elementfield<VR::UI>("1.2.3.4");
+
+      iod image;
+      image[{0x0008, 0x0018}] = make_elementfield<VR::UI>("1.2.3.4");
+      image[{0x7fe0, 0x0010}] = make_elementfield<VR::OB>(std::vector<unsigned char>(pixel_data_size, 0x2a));
+
+      p_data_tf* p_data = new p_data_tf;
+      p_data->command_set = commandset_processor {dict}.serialize(command);
+      p_data->data_set = explicit_proc.serialize(image);
+      p_data->pres_context_id = 1;
+
+      WHEN("An image is received")
+      {
+         watched_allocations = 0;
+         watched_size = pixel_data_size;
+         ul_stub.invoke_received_message(TYPE::P_DATA_TF, std::unique_ptr<property>(p_data));
+         watched_size = 0;
+
+         THEN("Its pixel data is copied once from the received message")
+         {
+            REQUIRE(watched_allocations == 1);
+            REQUIRE(kept.size() == 1);
+            REQUIRE(written.size() == 1);
+            auto sent = dynamic_cast<p_data_tf*>(written[0].get());
+            REQUIRE(sent != nullptr);
+            REQUIRE(sent->data_set == explicit_proc.serialize(image));
+         }
+      }
+   }
+}
@@ -0,0 +1,168 @@
+#include "catch.hpp"
+
+#include <string>
+#include <sstream>
+#include <vector>
+
+#include "libdicompp/dicomdata.hpp"
+
+using namespace dicom::data::attribute;
+using namespace dicom::data;
+using namespace dicom::data::dataset;
+
+
+/**
+ * @brief recording_handler returns a handler which records all parse events as
+ *        strings in the given vector. Value chunks are appended to the last
+ *        recorded element.
+ */
+static stream_handler recording_handler(std::vector<std::string>& events)
+{
+   stream_handler handler;
+   handler.element = [&events](tag_type tag, VR, std::size_t len) {
+      std::stringstream ss;
+      ss << "element " << tag << " " << len << " ";
+      events.push_back(ss.str());
+   };
+   handler.value = [&events](tag_type, byte_view chunk, std::size_t) {
+      events.back().append(chunk.begin(), chunk.end());
+   };
+   handler.sequence_begin = [&events](tag_type tag, std::size_t) {
+      std::stringstream ss;
+      ss << "sequence " << tag;
+      events.push_back(ss.str());
+   };
+   handler.sequence_end = [&events](tag_type) { events.push_back("sequence end"); };
+   handler.item_begin = [&events](std::size_t) { events.push_back("item "); };
+   handler.item_end = [&events]() { events.push_back("item end"); };
+   return handler;
+}
+
+SCENARIO("Streaming parsing of serialized datasets", "[dataset][stream_parser]")
+{
+   auto& dictionaries = dicom::data::dictionary::get_default_dictionaries();
+
+   GIVEN("A serialized little endian explicit sequence with two items of defined length")
+   {
+      little_endian_explicit lee_tp {dictionaries};
+      std::vector<unsigned char> data
+      {
+          0x40,0x00,0x75,0x02,'S','Q',0x00, 0x00,0x2c,0x00,0x00,0x00,0xfe,0xff,0x00,0xe0,0x0e,0x00,0x00,0x00
+         ,0x10,0x00,0x10,0x00,'P','N',0x06,0x00,0x71,0x5e,0x74,0x65,0x73,0x74,0xfe,0xff
+         ,0x00,0xe0,0x0e,0x00,0x00,0x00,0x10,0x00,0x10,0x00,'P','N',0x06,0x00,0x72,0x5e
+         ,0x74,0x65,0x73,0x74
+      };
+
+      std::vector<std::string> events;
+      stream_parser parser {lee_tp, recording_handler(events)};
+
+      WHEN("The data is fed at once")
+      {
+         parser.feed(data);
+         parser.finish();
+
+         THEN("The structure is reported in order")
+         {
+            std::vector<std::string> expected {
+               "sequence (0040,0275)", "item ", "element (0010,0010) 6 q^test", "item end",
+               "item ", "element (0010,0010) 6 r^test", "item end", "sequence end"};
+            REQUIRE(events == expected);
+            REQUIRE(parser.position() == data.size());
+         }
+      }
+      AND_WHEN("The data is fed byte by byte")
+      {
+         std::vector<std::string> expected;
+         stream_parser reference {lee_tp, recording_handler(expected)};
+         reference.feed(data);
+
+         for (std::size_t i=0; i<data.size(); ++i) {
+            parser.feed(byte_view {data}.subview(i, 1));
+         }
+
+         THEN("The same events are reported")
+         {
+            REQUIRE(events == expected);
+            REQUIRE_NOTHROW(parser.finish());
+         }
+      }
+      AND_WHEN("The data is truncated")
+      {
+         parser.feed(byte_view {data}.subview(0, data.size()-3));
+
+         THEN("Finishing the parse fails")
+         {
+            REQUIRE_THROWS(parser.finish());
+         }
+      }
+   }
+
+   GIVEN("A serialized little endian implicit sequence of undefined length")
+   {
+      little_endian_implicit lei_tp {dictionaries};
+      std::vector<unsigned char> data
+      {
+         /*(0040,0275)*/ 0x40, 0x00, 0x75, 0x02, 0xff, 0xff, 0xff, 0xff,
+         /*Item*/ 0xfe, 0xff, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff,
+         /*(0010,0010)*/ 0x10, 0x00, 0x10, 0x00, 0x04, 0x00, 0x00, 0x00, 't', 'e', 's', 't',
+         /*ItemDelimitationItem*/ 0xfe, 0xff, 0x0d, 0xe0, 0x00, 0x00, 0x00, 0x00,
+         /*SequenceDelimitationItem*/ 0xfe, 0xff, 0xdd, 0xe0, 0x00, 0x00, 0x00, 0x00,
+         /*(0028,0010)*/ 0x28, 0x00, 0x10, 0x00, 0x02, 0x00, 0x00, 0x00, 'a', 'b'
+      };
+
+      WHEN("The data is fed in chunks of three bytes")
+      {
+         std::vector<std::string> events;
+         stream_parser parser {lei_tp, recording_handler(events)};
+         for (std::size_t i=0; i<data.size(); i+=3) {
+            parser.feed(byte_view {data}.subview(i, std::min<std::size_t>(3, data.size()-i)));
+         }
+
+         THEN("The delimitation items close the item and sequence")
+         {
+            std::vector<std::string> expected {
+               "sequence (0040,0275)", "item ", "element (0010,0010) 4 test", "item end",
+               "sequence end", "element (0028,0010) 2 ab"};
+            REQUIRE(events == expected);
+            REQUIRE_NOTHROW(parser.finish());
+         }
+      }
+   }
+
+   GIVEN("Serialized encapsulated pixel data")
+   {
+      little_endian_explicit lee_tp {dictionaries};
+      std::vector<unsigned char> data
+      {
+         /*(7fe0,0010)*/ 0xe0, 0x7f, 0x10, 0x00, 'O', 'B', 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+         /*offset table*/ 0xfe, 0xff, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00,
+         /*fragment*/ 0xfe, 0xff, 0x00, 0xe0, 0x06, 0x00, 0x00, 0x00, 'p', 'i', 'x', 'e', 'l', 's',
+         /*SequenceDelimitationItem*/ 0xfe, 0xff, 0xdd, 0xe0, 0x00, 0x00, 0x00, 0x00
+      };
+
+      WHEN("The data is fed in small chunks with a value buffer smaller than the fragment")
+      {
+         std::vector<std::size_t> chunk_sizes;
+         std::string fragment;
+         stream_handler handler;
+         handler.value = [&](tag_type tag, byte_view chunk, std::size_t offset) {
+            REQUIRE(tag == Item);
+            REQUIRE(offset == fragment.size());
+            fragment.append(chunk.begin(), chunk.end());
+            chunk_sizes.push_back(chunk.size());
+         };
+
+         stream_parser parser {lee_tp, handler, 2};
+         for (std::size_t i=0; i<data.size(); i+=4) {
+            parser.feed(byte_view {data}.subview(i, std::min<std::size_t>(4, data.size()-i)));
+         }
+
+         THEN("The fragments are delivered in chunks as they arrive")
+         {
+            REQUIRE(fragment == "pixels");
+            REQUIRE(chunk_sizes.size() > 2);
+            REQUIRE_NOTHROW(parser.finish());
+         }
+      }
+   }
+}
@@ -107,8 +107,37 @@ class infrastructure_read_connection_stub : public Iinfrastructure_upperlayer_co
          set_error_on_next(boost::system::errc::success);
       }
 
+      /**
+       * The write handler is invoked for each PDU contained in the sequence,
+       * as if the PDUs were written separately.
+       */
+      void write_data(std::vector<boost::asio::const_buffer> buffers,
+                      std::function<void (const boost::system::error_code&, std::size_t)> on_complete) override
+      {
+         std::vector<unsigned char> data(boost::asio::buffer_size(buffers));
+         boost::asio::buffer_copy(boost::asio::buffer(data), buffers);
+         if (write_handler) {
+            for (std::size_t pos = 0; pos+6 <= data.size(); ) {
+               std::size_t len = (std::size_t {data[pos+2]} << 24) | (std::size_t {data[pos+3]} << 16)
+                     | (std::size_t {data[pos+4]} << 8) | std::size_t {data[pos+5]};
+               write_handler(len+6);
+               pos += len+6;
+            }
+         }
+         if (error_after_bytecount == 0) {
+            on_complete(ec, data.size());
+         } else {
+            if (data.size() <= error_after_bytecount) {
+               on_complete(success_ec, data.size());
+            } else {
+               on_complete(ec, error_after_bytecount);
+            }
+         }
+         set_error_on_next(boost::system::errc::success);
+      }
+
       void read_data(std::shared_ptr<std::vector<unsigned char>> buffer,
-                     std::size_t len, std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override
+                     std::size_t len,std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override
       {
          std::istreambuf_iterator<char> instream {*in};
          std::copy_n(instream, len, std::begin(*buffer));
@@ -126,6 +155,28 @@ class infrastructure_read_connection_stub : public Iinfrastructure_upperlayer_co
          set_error_on_next(boost::system::errc::success);
       }
 
+      void read_data(void* data_offset, std::size_t len,
+                     std::function<void(const boost::system::error_code&, std::size_t)> on_complete) override
+      {
+         if (in->peek() == std::char_traits<char>::eof() && !ec) {
+            // end of the segment, the read stays pending like on an idle
+            // connection
+            return;
+         }
+         in->read(static_cast<char*>(data_offset), len);
+
+         if (error_after_bytecount == 0) {
+            on_complete(ec, len);
+         } else {
+            if (len <= error_after_bytecount) {
+               on_complete(success_ec, len);
+            } else {
+               on_complete(ec, error_after_bytecount);
+            }
+         }
+         set_error_on_next(boost::system::errc::success);
+      }
+
       void read_data(std::shared_ptr<std::vector<unsigned char>> buffer,
                      std::function<void (const boost::system::error_code&, std::size_t)> on_complete) override
       {
@@ -152,6 +203,11 @@ class infrastructure_read_connection_stub : public Iinfrastructure_upperlayer_co
          return std::unique_ptr<Iinfrastructure_timeout_connection> {new infrastrustructure_timer_stub{}};
       }
 
+      void post(std::function<void()> f) override
+      {
+         f();
+      }
+
       bool is_stopped() const override
       {
          return false;
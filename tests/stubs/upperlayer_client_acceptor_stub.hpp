@@ -26,6 +26,8 @@ class upperlayer_client_acceptor_stub : public Iinfrastructure_client_acceptor
 
       std::function<void()> on_run;
       std::function<void()> on_accept_new;
+      std::function<void()> on_stop;
+      std::function<void()> on_resume;
 
       // Iinfrastructure_server_acceptor interface
    public:
@@ -54,6 +56,24 @@ class upperlayer_client_acceptor_stub : public Iinfrastructure_client_acceptor
          }
       }
 
+      void stop() override
+      {
+         if (on_stop) {
+            on_stop();
+         }
+      }
+
+      void resume() override
+      {
+         if (on_resume) {
+            on_resume();
+         }
+      }
+
+      void poll() override
+      {
+      }
+
       /**
        * @brief set_run_handler sets the callback to be invoked when run()
        *        is called
@@ -75,6 +95,26 @@ class upperlayer_client_acceptor_stub : public Iinfrastructure_client_acceptor
       }
 
 
+      /**
+       * @brief set_stop_handler sets the callback to be invoked when stop()
+       *        is called
+       * @param stop_handler handler to be called
+       */
+      void set_stop_handler(decltype(on_stop) stop_handler)
+      {
+         on_stop = stop_handler;
+      }
+
+      /**
+       * @brief set_resume_handler sets the callback to be invoked when
+       *        resume() is called
+       * @param resume_handler handler to be called
+       */
+      void set_resume_handler(decltype(on_resume) resume_handler)
+      {
+         on_resume = resume_handler;
+      }
+
       template <typename Fn>
       void push_connection(Fn&& on_connect)
       {
@@ -5,6 +5,7 @@
 #include <exception>
 #include <functional>
 #include <memory>
+#include <algorithm>
 
 #include "../../source/network/upperlayer/upperlayer.hpp"
 
@@ -22,6 +23,11 @@ class upperlayer_communication_stub : public Iupperlayer_comm_ops
       std::map<TYPE, std::function<void (Iupperlayer_comm_ops*, std::unique_ptr<property>)>> upperlayer_msg_handlers;
       std::map<TYPE, std::function<void (Iupperlayer_comm_ops*, property*)> > upperlayer_conf_handlers;
 
+      std::function<data_stream(const p_data_tf&)> data_stream_selector;
+
+      std::function<void(std::function<void()>)> post_handler;
+      bool reading_paused = false;
+
 
    public:
       // Iupperlayer_comm_ops_interface
@@ -40,7 +46,46 @@ class upperlayer_communication_stub : public Iupperlayer_comm_ops
          upperlayer_conf_handlers[t] = f;
       }
 
+      void inject_data_stream(std::function<data_stream(const p_data_tf&)> f) override
+      {
+         data_stream_selector = f;
+      }
+
+      void post(std::function<void()> f) override
+      {
+         if (post_handler) {
+            post_handler(f);
+         } else {
+            f();
+         }
+      }
+
+      void pause_reading() override
+      {
+         reading_paused = true;
+      }
+
+      void resume_reading() override
+      {
+         reading_paused = false;
+      }
+
       // Functions for testing
+      /**
+       * @brief set_handler_on_post can be used to defer functions posted to
+       *        the connection, eg. to run them on the test thread.
+       * @param f callback receiving the posted function
+       */
+      void set_handler_on_post(std::function<void(std::function<void()>)> f)
+      {
+         post_handler = f;
+      }
+
+      bool is_reading_paused() const
+      {
+         return reading_paused;
+      }
+
       /**
        * @brief set_handler_on_queue_for_write can be used to set a callback
        *        when the dimse_pm wants to send a response property / PDU. The
@@ -63,6 +108,27 @@ class upperlayer_communication_stub : public Iupperlayer_comm_ops
          upperlayer_msg_handlers[t](this, std::move(prop));
       }
 
+      /**
+       * @brief invoke_received_stream simulates an incoming message whose data
+       *        set is passed to the injected data stream, if any, in fragments
+       *        of the given size before the message is handed to the handler.
+       * @param prop message with command and data set
+       * @param fragment_size size of the data set fragments
+       */
+      void invoke_received_stream(std::unique_ptr<p_data_tf> prop, std::size_t fragment_size)
+      {
+         auto stream = data_stream_selector ? data_stream_selector(*prop) : nullptr;
+         if (stream) {
+            const auto& data = prop->data_set;
+            for (std::size_t pos = 0; pos < data.size(); pos += fragment_size) {
+               auto len = std::min(fragment_size, data.size()-pos);
+               stream(data.data()+pos, len, pos+len == data.size());
+            }
+            prop->data_set.clear();
+         }
+         upperlayer_msg_handlers[TYPE::P_DATA_TF](this, std::move(prop));
+      }
+
       /**
        * @brief invoke_sent_message simulates an successful sent PDU
        *        notification from the upperlayer
@@ -7,6 +7,7 @@
 #include "../source/data/attribute/attribute.hpp"
 #include "../source/data/attribute/vmtype.hpp"
 #include "../source/data/attribute/attribute_field_coder.hpp"
+#include "../source/data/attribute/byte_order.hpp"
 
 using namespace dicom::data;
 using namespace dicom::data::attribute;
@@ -437,7 +438,7 @@ SCENARIO("Deserialization of an individual attribute", "[attributes][transfer_pr
             get_value_field<VR::IS>(value, int_values);
             REQUIRE(*int_values.begin() == "91");
             REQUIRE(*(int_values.begin()+1) == "87");
-            REQUIRE(int_values.back() == "1 ");
+            REQUIRE(int_values.back() == "1");
          }
       }
       WHEN("The value is deserialized in big-endian")
@@ -449,7 +450,86 @@ SCENARIO("Deserialization of an individual attribute", "[attributes][transfer_pr
             get_value_field<VR::IS>(value, int_values);
             REQUIRE(*int_values.begin() == "91");
             REQUIRE(*(int_values.begin()+1) == "87");
-            REQUIRE(int_values.back() == "1 ");
+            REQUIRE(int_values.back() == "1");
+         }
+      }
+   }
+
+   GIVEN("A serialized dicom value field of VR LO with padded values")
+   {
+      std::string padded {" ab \\cd\\ \\ef  "};
+      std::vector<unsigned char> value_bytes {padded.begin(), padded.end()};
+
+      WHEN("The value is deserialized")
+      {
+         auto value = decode_value_field(value_bytes, ENDIANNESS::LITTLE, value_bytes.size(), VR::LO, "*", 0);
+         THEN("Leading and trailing spaces are removed from each value")
+         {
+            vmtype<std::string> values;
+            get_value_field<VR::LO>(value, values);
+            std::vector<std::string> expected {"ab", "cd", "", "ef"};
+            std::vector<std::string> decoded;
+            for (auto it = values.cbegin(); it != values.cend(); ++it) {
+               decoded.push_back(*it);
+            }
+            REQUIRE(decoded == expected);
+         }
+      }
+   }
+
+   GIVEN("A serialized dicom value field of VR UI padded with a null byte")
+   {
+      std::string padded {"1.2.3"};
+      std::vector<unsigned char> value_bytes {padded.begin(), padded.end()};
+      value_bytes.push_back('\0');
+
+      WHEN("The value is deserialized")
+      {
+         auto value = decode_value_field(value_bytes, ENDIANNESS::LITTLE, value_bytes.size(), VR::UI, "1", 0);
+         THEN("The padding is removed")
+         {
+            std::string uid;
+            get_value_field<VR::UI>(value, uid);
+            REQUIRE(uid == "1.2.3");
+         }
+      }
+   }
+
+   GIVEN("A serialized dicom value field of VR LT containing a backslash")
+   {
+      std::string text {"  C:\\dir text "};
+      std::vector<unsigned char> value_bytes {text.begin(), text.end()};
+
+      WHEN("The value is deserialized")
+      {
+         auto value = decode_value_field(value_bytes, ENDIANNESS::LITTLE, value_bytes.size(), VR::LT, "1", 0);
+         THEN("It is not split and only trailing spaces are removed")
+         {
+            std::string text_value;
+            get_value_field<VR::LT>(value, text_value);
+            REQUIRE(text_value == "  C:\\dir text");
+         }
+      }
+   }
+
+   GIVEN("Serialized odd-length values of VR CS, LO and UI with their padding")
+   {
+      std::vector<unsigned char> cs_bytes {'A', 'X', 'I', 'A', 'L', ' '};
+      std::vector<unsigned char> lo_bytes {'a', 'b', '\\', 'c', 'd', ' '};
+      std::vector<unsigned char> ui_bytes {'1', '.', '2', '.', '3', '\0'};
+
+      WHEN("The values are deserialized and serialized again")
+      {
+         auto cs = decode_value_field(cs_bytes, ENDIANNESS::LITTLE, cs_bytes.size(), VR::CS, "*", 0);
+         auto lo = decode_value_field(lo_bytes, ENDIANNESS::LITTLE, lo_bytes.size(), VR::LO, "*", 0);
+         auto ui = decode_value_field(ui_bytes, ENDIANNESS::LITTLE, ui_bytes.size(), VR::UI, "1", 0);
+         THEN("CS and LO are padded with a space and UI with a null byte")
+         {
+            REQUIRE(encode_value_field(cs, ENDIANNESS::LITTLE, VR::CS) == cs_bytes);
+            REQUIRE(encode_value_field(lo, ENDIANNESS::LITTLE, VR::LO) == lo_bytes);
+            REQUIRE(encode_value_field(ui, ENDIANNESS::LITTLE, VR::UI) == ui_bytes);
+            REQUIRE(encoded_value_size(cs, VR::CS) == cs_bytes.size());
+            REQUIRE(encoded_value_size(ui, VR::UI) == ui_bytes.size());
          }
       }
    }
@@ -636,3 +716,89 @@ SCENARIO("Deserialization of an individual attribute", "[attributes][transfer_pr
 }
 
 
+
+SCENARIO("Byte order conversion of value arrays", "[attributes][transfer_processor]")
+{
+   GIVEN("Byte arrays longer than one vector register")
+   {
+      std::vector<unsigned char> bytes(8*37);
+      for (std::size_t i=0; i<bytes.size(); ++i) {
+         bytes[i] = static_cast<unsigned char>(i);
+      }
+
+      WHEN("The values are swapped with a width of 2, 4 and 8 bytes")
+      {
+         THEN("The byte order of every value is reversed, including the remainder")
+         {
+            for (std::size_t width : {2, 4, 8}) {
+               std::vector<unsigned char> swapped(bytes.size());
+               swap_bytes(bytes.data(), swapped.data(), bytes.size() / width, width);
+               for (std::size_t i=0; i<bytes.size(); ++i) {
+                  REQUIRE(swapped[i] == bytes[i - i%width + width-1 - i%width]);
+               }
+            }
+         }
+      }
+      AND_WHEN("The values are swapped in place")
+      {
+         std::vector<unsigned char> swapped {bytes};
+         swap_bytes(swapped.data(), swapped.data(), swapped.size() / 4, 4);
+         swap_bytes(swapped.data(), swapped.data(), swapped.size() / 4, 4);
+
+         THEN("Swapping twice restores the values")
+         {
+            REQUIRE(swapped == bytes);
+         }
+      }
+   }
+
+   GIVEN("A large dicom value field of VR OW")
+   {
+      std::vector<unsigned short> words(1001);
+      for (std::size_t i=0; i<words.size(); ++i) {
+         words[i] = static_cast<unsigned short>(i * 0x0101 + 1);
+      }
+      auto value = make_elementfield<VR::OW>(words.size()*2, words);
+
+      WHEN("The value is serialized and deserialized in big-endian")
+      {
+         auto value_data = encode_value_field(value, ENDIANNESS::BIG, VR::OW);
+         auto decoded = decode_value_field(value_data, ENDIANNESS::BIG, value_data.size(), VR::OW, "1", 0);
+
+         THEN("The words are stored most significant byte first")
+         {
+            REQUIRE(value_data.size() == words.size()*2);
+            REQUIRE(value_data[2*1000] == (words[1000] >> 8));
+            REQUIRE(value_data[2*1000+1] == (words[1000] & 0xff));
+         }
+         AND_THEN("The original value is restored")
+         {
+            std::vector<unsigned short> ow;
+            get_value_field<VR::OW>(decoded, ow);
+            REQUIRE(ow == words);
+         }
+      }
+   }
+
+   GIVEN("A multi-valued dicom value field of VR SL")
+   {
+      vmtype<long> values {{-2, 70000}, {"*"}};
+      auto value = make_elementfield<VR::SL>(values);
+
+      WHEN("The value is serialized and deserialized in big-endian")
+      {
+         auto value_data = encode_value_field(value, ENDIANNESS::BIG, VR::SL);
+         auto decoded = decode_value_field(value_data, ENDIANNESS::BIG, value_data.size(), VR::SL, "*", 0);
+
+         THEN("Each value is encoded in four bytes and restored with its sign")
+         {
+            std::vector<unsigned char> expected {0xff, 0xff, 0xff, 0xfe, 0x00, 0x01, 0x11, 0x70};
+            REQUIRE(value_data == expected);
+            vmtype<long> sl;
+            get_value_field<VR::SL>(decoded, sl);
+            REQUIRE(*sl.begin() == -2);
+            REQUIRE(*(sl.begin()+1) == 70000);
+         }
+      }
+   }
+}
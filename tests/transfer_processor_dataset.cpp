@@ -2,6 +2,7 @@
 
 #include <string>
 #include <exception>
+#include <stdexcept>
 #include <vector>
 
 #include "libdicompp/dicomdata.hpp"
@@ -175,6 +176,52 @@ SCENARIO("Serialization of a dataset with little-endian explicit transfer syntax
          }
       }
    }
+
+   GIVEN("A dataset with a sequence of undefined length and a large value")
+   {
+      iod dataset, item, seqdel;
+      item[{0xfffe, 0xe000}] = make_elementfield<VR::NI>(0xffffffff, VR::NI);
+      item[{0x0010, 0x0010}] = make_elementfield<VR::PN>("q^test");
+      item[{0xfffe, 0xe00d}] = make_elementfield<VR::NI>();
+      seqdel[{0xfffe, 0xe0dd}] = make_elementfield<VR::NI>();
+      dataset[{0x0008, 0x0060}] = make_elementfield<VR::CS>("MR");
+      dataset[{0x0040, 0x0275}] = make_elementfield<VR::SQ>(0xffffffff, {item, seqdel});
+      dataset[{0x7fe0, 0x0010}] = make_elementfield<VR::OW>(4096, std::vector<unsigned short>(2048, 0x1234));
+
+      auto expected = lee_tp.serialize(dataset);
+
+      THEN("The size of the serialized data is known in advance")
+      {
+         REQUIRE(lee_tp.serialized_size(dataset) == expected.size());
+         REQUIRE(expected.size() == 8+2 + 12+8+8+6+8+8 + 12+4096);
+      }
+      WHEN("The dataset is serialized into an existing buffer")
+      {
+         std::vector<unsigned char> buffer {0x01, 0x02};
+         lee_tp.serialize(dataset, buffer);
+
+         THEN("The serialized data is appended")
+         {
+            REQUIRE(buffer.size() == expected.size() + 2);
+            REQUIRE(std::equal(expected.begin(), expected.end(), buffer.begin()+2));
+         }
+      }
+      WHEN("The dataset is serialized into a sink")
+      {
+         std::vector<std::size_t> chunks;
+         std::vector<unsigned char> data;
+         lee_tp.serialize(dataset, [&](byte_view chunk) {
+            chunks.push_back(chunk.size());
+            data.insert(data.end(), chunk.begin(), chunk.end());
+         }, 32);
+
+         THEN("The chunks add up to the serialized data")
+         {
+            REQUIRE(chunks.size() > 1);
+            REQUIRE(data == expected);
+         }
+      }
+   }
 }
 
 SCENARIO("Serialization of a dataset with big-endian explicit transfer syntax", "[dataset][transfer_processor]")
@@ -303,6 +350,21 @@ SCENARIO("Deserialization of a dataset with little-endian implicit transfer synt
             REQUIRE(expected == "test");
          }
       }
+      AND_WHEN("The dataset is deserialized in place from a view into a larger buffer")
+      {
+         std::vector<unsigned char> buffer {0xde, 0xad};
+         buffer.insert(buffer.end(), data.begin(), data.end());
+         buffer.push_back(0xff);
+
+         auto set = lei_tp.deserialize(byte_view {buffer}.subview(2, data.size()));
+         THEN("Only the viewed range is parsed")
+         {
+            REQUIRE(set.size() == 1);
+            std::string expected;
+            get_value_field<VR::PN>(set[{0x0010, 0x0010}], expected);
+            REQUIRE(expected == "test");
+         }
+      }
    }
 
    GIVEN("A serialized sequence with two items")
@@ -426,6 +488,129 @@ SCENARIO("Deserialization of a dataset with little-endian explicit transfer synt
          }
       }
    }
+
+   GIVEN("A serialized dataset with undefined length sequences and pixel data")
+   {
+      std::vector<unsigned char> data
+      {
+         /*(0010,0010)*/ 0x10, 0x00, 0x10, 0x00, 'P', 'N', 0x04, 0x00, 't', 'e', 's', 't',
+         /*(0040,0275)*/ 0x40, 0x00, 0x75, 0x02, 'S', 'Q', 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+         /*Item*/ 0xfe, 0xff, 0x00, 0xe0, 0xff, 0xff, 0xff, 0xff,
+         /*(0010,0010)*/ 0x10, 0x00, 0x10, 0x00, 'P', 'N', 0x02, 0x00, 'q', 'q',
+         /*ItemDelimitationItem*/ 0xfe, 0xff, 0x0d, 0xe0, 0x00, 0x00, 0x00, 0x00,
+         /*SequenceDelimitationItem*/ 0xfe, 0xff, 0xdd, 0xe0, 0x00, 0x00, 0x00, 0x00,
+         /*(0040,0280)*/ 0x40, 0x00, 0x80, 0x02, 'S', 'T', 0x02, 0x00, 'a', 'b',
+         /*(7fe0,0010)*/ 0xe0, 0x7f, 0x10, 0x00, 'O', 'B', 0x00, 0x00, 0xff, 0xff, 0xff, 0xff,
+         /*Item*/ 0xfe, 0xff, 0x00, 0xe0, 0x00, 0x00, 0x00, 0x00,
+         /*Item*/ 0xfe, 0xff, 0x00, 0xe0, 0x04, 0x00, 0x00, 0x00, 0x01, 0x02, 0x03, 0x04,
+         /*SequenceDelimitationItem*/ 0xfe, 0xff, 0xdd, 0xe0, 0x00, 0x00, 0x00, 0x00
+      };
+
+      WHEN("The dataset is deserialized up to a tag")
+      {
+         parse_filter filter;
+         filter.stop_after = tag_type {0x0040, 0x0275};
+         auto set = lee_tp.deserialize(byte_view {data}, filter);
+
+         THEN("Only the attributes up to the tag are contained")
+         {
+            REQUIRE(set.size() == 2);
+            std::vector<dataset_type> items;
+            get_value_field<VR::SQ>(set[{0x0040, 0x0275}], items);
+            REQUIRE(contains_tag(items.front(), {0x0010, 0x0010}));
+         }
+      }
+      AND_WHEN("The dataset is deserialized with a tag filter")
+      {
+         parse_filter filter;
+         filter.tags = {{0x0010, 0x0010}, {0x0040, 0x0280}};
+         auto set = lee_tp.deserialize(byte_view {data}, filter);
+
+         THEN("The sequence and the pixel data are skipped")
+         {
+            REQUIRE(set.size() == 2);
+            std::string value;
+            get_value_field<VR::ST>(set[{0x0040, 0x0280}], value);
+            REQUIRE(value == "ab");
+         }
+      }
+   }
+
+   GIVEN("A serialized dataset which is deserialized lazily")
+   {
+      auto data = std::make_shared<std::vector<unsigned char>>(std::vector<unsigned char>
+      {/*tag*/ 0x28, 0x00, 0x10, 0x00, /*vr*/ 'S', 'S', /*length*/ 0x02, 0x00,
+       /*data*/ 0xfe, 0xff,
+       /*tag*/ 0xe0, 0x7f, 0x10, 0x00, /*vr*/'O', 'B', /*padding*/ 0x00, 0x00,
+       /*length*/ 0x04, 0x00, 0x00, 0x00, /*data*/ 0xc4, 0x0e, 0x71, 0x33});
+
+      auto set = lee_tp.deserialize_lazy(data);
+      auto lazy_field = [&set](tag_type tag) {
+         return dynamic_cast<lazy_element_field*>(set[tag].value_field.get());
+      };
+
+      THEN("The values are not decoded")
+      {
+         REQUIRE(set.size() == 2);
+         REQUIRE(lazy_field({0x0028, 0x0010}) != nullptr);
+         REQUIRE(!lazy_field({0x0028, 0x0010})->is_decoded());
+         REQUIRE(!lazy_field({0x7fe0, 0x0010})->is_decoded());
+      }
+      WHEN("A value is accessed")
+      {
+         short value;
+         get_value_field<VR::SS>(set[{0x0028, 0x0010}], value);
+
+         THEN("Only this value is decoded")
+         {
+            REQUIRE(value == -2);
+            REQUIRE(lazy_field({0x0028, 0x0010})->is_decoded());
+            REQUIRE(!lazy_field({0x7fe0, 0x0010})->is_decoded());
+         }
+         AND_THEN("The set is serialized to the original data")
+         {
+            REQUIRE(lee_tp.serialize(set) == *data);
+         }
+      }
+      AND_WHEN("A value is modified and the set is serialized")
+      {
+         set[{0x0028, 0x0010}] = make_elementfield<VR::SS>(3);
+         auto serialized = lee_tp.serialize(set);
+
+         THEN("The modified value is encoded")
+         {
+            REQUIRE(serialized.size() == data->size());
+            REQUIRE(serialized[8] == 0x03);
+            REQUIRE(serialized[9] == 0x00);
+            REQUIRE(std::equal(serialized.begin()+10, serialized.end(), data->begin()+10));
+         }
+      }
+   }
+   GIVEN("Serialized datasets whose lengths exceed the data")
+   {
+      std::vector<unsigned char> value =
+      {/*tag*/ 0x10, 0x00, 0x10, 0x00,
+       /*vr*/ 'P', 'N',
+       /*length*/ 0x10, 0x00,
+       /*data*/ 't', 'e', 's', 't'};
+      std::vector<unsigned char> item =
+      {/*tag*/ 0x40, 0x00, 0x75, 0x02,
+       /*vr*/ 'S', 'Q', 0x00, 0x00,
+       /*length*/ 0x10, 0x00, 0x00, 0x00,
+       /*tag*/ 0xfe, 0xff, 0x00, 0xe0,
+       /*length*/ 0x40, 0x00, 0x00, 0x00,
+       /*tag*/ 0x10, 0x00, 0x10, 0x00,
+       /*vr*/ 'P', 'N',
+       /*length*/ 0x00, 0x00};
+      std::vector<unsigned char> header {0x10, 0x00, 0x10, 0x00, 'P', 'N', 0x00};
+
+      THEN("The deserialization throws")
+      {
+         REQUIRE_THROWS_AS(lee_tp.deserialize(value), std::runtime_error&);
+         REQUIRE_THROWS_AS(lee_tp.deserialize(item), std::runtime_error&);
+         REQUIRE_THROWS_AS(lee_tp.deserialize(header), std::runtime_error&);
+      }
+   }
 }
 
 SCENARIO("Deserialization of a dataset with big-endian explicit transfer syntax", "[dataset][transfer_processor]")
@@ -556,3 +741,105 @@ SCENARIO("Creation of transfer processors")
    }
 }
 
+
+SCENARIO("Deserialization of datasets with an intern pool", "[dataset][transfer_processor]")
+{
+   auto& dictionaries = dicom::data::dictionary::get_default_dictionaries();
+   little_endian_explicit lee_tp {dictionaries};
+   auto pool = std::make_shared<intern_pool>();
+   lee_tp.set_intern_pool(pool);
+
+   GIVEN("Two serialized datasets with the same study instance uid")
+   {
+      std::vector<unsigned char> data =
+      {/*tag*/ 0x20, 0x00, 0x0d, 0x00,
+       /*vr*/ 'U', 'I',
+       /*length*/ 0x06, 0x00,
+       /*data*/ '1', '.', '2', '.', '3', 0x00,
+       /*tag*/ 0x28, 0x00, 0x10, 0x00,
+       /*vr*/ 'U', 'S',
+       /*length*/ 0x02, 0x00,
+       /*data*/ 0x00, 0x02};
+
+      WHEN("Both datasets are deserialized")
+      {
+         auto first = lee_tp.deserialize(data);
+         auto second = lee_tp.deserialize(data);
+
+         THEN("The value is stored once in the pool")
+         {
+            auto& first_uid = get_value_field_ref<VR::UI>(first[{0x0020, 0x000d}]);
+            auto& second_uid = get_value_field_ref<VR::UI>(second[{0x0020, 0x000d}]);
+            REQUIRE(&first_uid == &second_uid);
+            REQUIRE(*first_uid.cbegin() == "1.2.3");
+            REQUIRE(pool->size() == 1);
+         }
+         AND_THEN("Values of other VRs are not pooled")
+         {
+            unsigned short rows;
+            get_value_field<VR::US>(second[{0x0028, 0x0010}], rows);
+            REQUIRE(rows == 512);
+         }
+         AND_WHEN("One dataset is modified")
+         {
+            auto uid = get_value_field_pointer<VR::UI>(first[{0x0020, 0x000d}]);
+            *uid = attribute::vmtype<std::string> {"1.2.4"};
+
+            THEN("The other dataset and the pool are unchanged")
+            {
+               REQUIRE(*get_value_field_ref<VR::UI>(first[{0x0020, 0x000d}]).cbegin() == "1.2.4");
+               REQUIRE(*get_value_field_ref<VR::UI>(second[{0x0020, 0x000d}]).cbegin() == "1.2.3");
+               auto third = lee_tp.deserialize(data);
+               REQUIRE(*get_value_field_ref<VR::UI>(third[{0x0020, 0x000d}]).cbegin() == "1.2.3");
+            }
+         }
+         AND_WHEN("The datasets are destroyed")
+         {
+            first.clear();
+            second.clear();
+
+            THEN("The pool releases the value")
+            {
+               REQUIRE(pool->size() == 0);
+            }
+         }
+      }
+   }
+   GIVEN("Two serialized datasets with values differing in their padding")
+   {
+      std::vector<unsigned char> padded =
+      {/*tag*/ 0x08, 0x00, 0x60, 0x00,
+       /*vr*/ 'C', 'S',
+       /*length*/ 0x06, 0x00,
+       /*data*/ ' ', 'C', 'T', '\\', 'M', 'R'};
+      std::vector<unsigned char> unpadded =
+      {/*tag*/ 0x08, 0x00, 0x60, 0x00,
+       /*vr*/ 'C', 'S',
+       /*length*/ 0x06, 0x00,
+       /*data*/ 'C', 'T', '\\', 'M', 'R', ' '};
+      std::vector<unsigned char> joined =
+      {/*tag*/ 0x08, 0x00, 0x60, 0x00,
+       /*vr*/ 'C', 'S',
+       /*length*/ 0x04, 0x00,
+       /*data*/ 'C', 'T', 'M', 'R'};
+
+      WHEN("The datasets are deserialized")
+      {
+         auto first = lee_tp.deserialize(padded);
+         auto second = lee_tp.deserialize(unpadded);
+         auto third = lee_tp.deserialize(joined);
+
+         THEN("Equal values share the pooled value, different ones do not")
+         {
+            auto& first_modality = get_value_field_ref<VR::CS>(first[{0x0008, 0x0060}]);
+            auto& second_modality = get_value_field_ref<VR::CS>(second[{0x0008, 0x0060}]);
+            auto& third_modality = get_value_field_ref<VR::CS>(third[{0x0008, 0x0060}]);
+            REQUIRE(&first_modality == &second_modality);
+            REQUIRE(&first_modality != &third_modality);
+            REQUIRE(first_modality.size() == 2);
+            REQUIRE(*third_modality.cbegin() == "CTMR");
+            REQUIRE(pool->size() == 2);
+         }
+      }
+   }
+}
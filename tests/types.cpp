@@ -400,3 +400,122 @@ SCENARIO("Usage of vmtype<T> iterators", "[types]")
 
 
 
+
+SCENARIO("Parsing of the value multiplicity", "[types]")
+{
+   GIVEN("The notations of the data dictionary")
+   {
+      THEN("They are parsed into the range and step of the value count")
+      {
+         multiplicity_data one {"1"};
+         REQUIRE((one.min == 1 && one.max == 1 && one.step == 1));
+         multiplicity_data range {" 1 - 3 "};
+         REQUIRE((range.min == 1 && range.max == 3 && range.step == 1));
+         multiplicity_data open {"1-n"};
+         REQUIRE((open.min == 1 && open.max == multiplicity_data::unbounded && open.step == 1));
+         multiplicity_data multiple {"2-2n"};
+         REQUIRE((multiple.min == 2 && multiple.max == multiplicity_data::unbounded && multiple.step == 2));
+         multiplicity_data factor {"3n"};
+         REQUIRE((factor.min == 1 && factor.step == 3));
+         multiplicity_data any {"*"};
+         REQUIRE((any.min == 0 && any.max == multiplicity_data::unbounded && any.step == 1));
+      }
+      AND_THEN("The allowed value counts follow the notation")
+      {
+         REQUIRE(multiplicity_data {"2-2n"}.allows(4));
+         REQUIRE(!multiplicity_data {"2-2n"}.allows(3));
+         REQUIRE(!multiplicity_data {"2-2n"}.allows(0));
+         REQUIRE(multiplicity_data {"0-1"}.allows(0));
+         REQUIRE(!multiplicity_data {"0-1"}.allows(2));
+         REQUIRE(multiplicity_data {"*"}.allows(0));
+      }
+      AND_THEN("They are printed in the dictionary notation")
+      {
+         REQUIRE(multiplicity_data {"3"}.to_string() == "3");
+         REQUIRE(multiplicity_data {"1-3"}.to_string() == "1-3");
+         REQUIRE(multiplicity_data {"2-2n"}.to_string() == "2-2n");
+         REQUIRE(multiplicity_data {"*"}.to_string() == "*");
+      }
+   }
+}
+
+SCENARIO("Storage of the values of a vmtype", "[types]")
+{
+   GIVEN("A vmtype with few values")
+   {
+      vmtype<std::string> type {{"a long value which is allocated", "b"}, {"*"}};
+
+      WHEN("Values are added beyond the inline storage")
+      {
+         type.insert({"c", "d", "e", "f"});
+
+         THEN("All values are kept in order")
+         {
+            REQUIRE(type.size() == 6);
+            REQUIRE(type.data()[0] == "a long value which is allocated");
+            REQUIRE(type.data()[5] == "f");
+         }
+      }
+      AND_WHEN("It is copied and moved")
+      {
+         auto copy = type;
+         auto moved = std::move(type);
+
+         THEN("The values are preserved")
+         {
+            REQUIRE(copy == moved);
+            REQUIRE(moved.size() == 2);
+            REQUIRE(moved.back() == "b");
+         }
+      }
+   }
+
+   GIVEN("A small_vector grown onto the heap")
+   {
+      dicom::util::small_vector<unsigned short, 4> values;
+      for (unsigned short i=0; i<10; ++i) {
+         values.push_back(i);
+      }
+
+      WHEN("It is moved")
+      {
+         const unsigned short* heap = values.data();
+         auto moved = std::move(values);
+
+         THEN("The heap storage changes owner")
+         {
+            REQUIRE(!moved.is_inline());
+            REQUIRE(moved.data() == heap);
+            REQUIRE(moved.size() == 10);
+            REQUIRE(values.empty());
+            REQUIRE(values.is_inline());
+         }
+      }
+      AND_WHEN("One of its values is appended at full capacity")
+      {
+         dicom::util::small_vector<std::string, 2> strings;
+         strings.push_back("a value too long for the small string buffer");
+         strings.push_back("b");
+         strings.push_back(strings[0]);
+         strings.emplace_back(strings[1]);
+
+         THEN("The appended values are copies of the old ones")
+         {
+            REQUIRE(strings.size() == 4);
+            REQUIRE(strings[2] == "a value too long for the small string buffer");
+            REQUIRE(strings[3] == "b");
+            REQUIRE(strings[0] == strings[2]);
+         }
+      }
+      AND_WHEN("It is resized to fewer values")
+      {
+         values.resize(2);
+
+         THEN("The remaining values are kept")
+         {
+            REQUIRE(values.size() == 2);
+            REQUIRE(values.back() == 1);
+         }
+      }
+   }
+}
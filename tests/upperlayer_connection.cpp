@@ -4,6 +4,8 @@
 #include <exception>
 #include <memory>
 #include <deque>
+#include <vector>
+#include <algorithm>
 
 #include "libdicompp/network.hpp"
 
@@ -519,3 +521,309 @@ SCENARIO("Usage of the upperlayer as a service class user", "[network][upperlaye
    }
 
 }
+
+
+SCENARIO("Serialization of a p_data_tf into a buffer sequence", "[network][upperlayer]")
+{
+   GIVEN("A p_data_tf with a data set spanning exactly two fragments")
+   {
+      p_data_tf pdata;
+      pdata.msg_length = 112;
+      pdata.pres_context_id = 3;
+      pdata.command_set = std::vector<unsigned char>(20, 0xaa);
+      pdata.data_set = std::vector<unsigned char>(200, 0xbb);
+
+      WHEN("The buffer sequence is created")
+      {
+         pdu_buffers buffers;
+         pdata.make_pdu_buffers(buffers);
+
+         THEN("The data set is referenced, not copied")
+         {
+            REQUIRE(buffers.headers.size() == 3*12);
+            REQUIRE(buffers.sequence.size() == 6);
+            REQUIRE(boost::asio::buffer_cast<const unsigned char*>(buffers.sequence[3])
+                    == pdata.data_set.data());
+            REQUIRE(boost::asio::buffer_cast<const unsigned char*>(buffers.sequence[5])
+                    == pdata.data_set.data()+100);
+         }
+         AND_THEN("The concatenated buffers equal the serialized pdu")
+         {
+            std::vector<unsigned char> gathered(buffers.size());
+            boost::asio::buffer_copy(boost::asio::buffer(gathered), buffers.sequence);
+            REQUIRE(gathered == pdata.make_pdu());
+         }
+         AND_THEN("Only the last fragment is marked as such")
+         {
+            REQUIRE(buffers.headers[11] == 0x03);
+            REQUIRE(buffers.headers[12+11] == 0x00);
+            REQUIRE(buffers.headers[24+11] == 0x02);
+         }
+      }
+
+      WHEN("The serialized pdus are parsed")
+      {
+         auto pdu = pdata.make_pdu();
+         p_data_tf parsed;
+         parsed.from_pdu(pdu);
+
+         THEN("The command and data set are reassembled")
+         {
+            REQUIRE(parsed.pres_context_id == 3);
+            REQUIRE(parsed.command_set == pdata.command_set);
+            REQUIRE(parsed.data_set == pdata.data_set);
+         }
+         AND_THEN("A pdu with an invalid pdv length is rejected")
+         {
+            pdu[9] = 0xff;
+            p_data_tf invalid;
+            REQUIRE_THROWS(invalid.from_pdu(pdu));
+         }
+      }
+
+      WHEN("The buffer sequence is created without the data set")
+      {
+         pdu_buffers buffers;
+         pdata.make_pdu_buffers(buffers, false);
+
+         THEN("Only the command pdu is contained")
+         {
+            REQUIRE(buffers.sequence.size() == 2);
+            REQUIRE(buffers.size() == 12+20);
+         }
+      }
+
+      WHEN("The data set is replaced by a view on memory owned elsewhere")
+      {
+         auto owner = std::make_shared<std::vector<unsigned char>>(150, 0xcc);
+         pdata.set_data_set_view(owner->data(), owner->size(), owner);
+         std::weak_ptr<std::vector<unsigned char>> alive {owner};
+         owner.reset();
+
+         pdu_buffers buffers;
+         pdata.make_pdu_buffers(buffers);
+
+         THEN("The viewed memory is referenced and kept alive")
+         {
+            REQUIRE(!alive.expired());
+            REQUIRE(pdata.data_set.empty());
+            REQUIRE(buffers.sequence.size() == 6);
+            REQUIRE(boost::asio::buffer_cast<const unsigned char*>(buffers.sequence[3])
+                    == alive.lock()->data());
+            REQUIRE(buffers.size() == 3*12 + 20 + 150);
+         }
+         AND_THEN("It is parsed like an owned data set")
+         {
+            p_data_tf parsed;
+            parsed.from_pdu(pdata.make_pdu());
+            REQUIRE(parsed.data_set == std::vector<unsigned char>(150, 0xcc));
+         }
+      }
+   }
+}
+
+SCENARIO("Encoding of the asynchronous operations window", "[network][upperlayer]")
+{
+   GIVEN("An a_associate_rq")
+   {
+      a_associate_rq rq;
+      rq.called_ae = rq.calling_ae = "TEST            ";
+      rq.application_context = "1.2.840.10008.3.1.1.1";
+      rq.pres_contexts.push_back({1, "1.2.840.10008.1.1", {"1.2.840.10008.1.2"}});
+      rq.max_message_length = 16384;
+
+      WHEN("No window is set")
+      {
+         auto pdu = rq.make_pdu();
+         a_associate_rq parsed;
+         parsed.from_pdu(pdu);
+
+         THEN("The sub-item is omitted and synchronous operation assumed")
+         {
+            REQUIRE(std::find(pdu.end()-12, pdu.end(), 0x53) == pdu.end());
+            REQUIRE(parsed.max_message_length == 16384);
+            REQUIRE(parsed.max_ops_invoked == 1);
+            REQUIRE(parsed.max_ops_performed == 1);
+         }
+      }
+      AND_WHEN("A window is set")
+      {
+         rq.max_ops_invoked = 16;
+         rq.max_ops_performed = 0;
+         auto pdu = rq.make_pdu();
+         a_associate_rq parsed;
+         parsed.from_pdu(pdu);
+
+         THEN("It is encoded after the maximum length")
+         {
+            REQUIRE(parsed.max_message_length == 16384);
+            REQUIRE(parsed.max_ops_invoked == 16);
+            REQUIRE(parsed.max_ops_performed == 0);
+         }
+      }
+      AND_WHEN("The user information contains unsupported sub-items")
+      {
+         rq.max_ops_invoked = 3;
+         auto pdu = rq.make_pdu();
+         // append an implementation version name sub-item to the user
+         // information item, which is the last item of the pdu
+         const std::vector<unsigned char> version {0x55, 0x00, 0x00, 0x04, 'T', 'E', 'S', 'T'};
+         pdu.insert(pdu.end(), version.begin(), version.end());
+         pdu[pdu.size()-8-16-1] += 8;
+         pdu[5] += 8;
+         a_associate_rq parsed;
+         parsed.from_pdu(pdu);
+
+         THEN("They are skipped")
+         {
+            REQUIRE(parsed.max_message_length == 16384);
+            REQUIRE(parsed.max_ops_invoked == 3);
+         }
+      }
+   }
+
+   GIVEN("An a_associate_ac with a window")
+   {
+      a_associate_ac ac;
+      ac.called_ae = ac.calling_ae = "TEST            ";
+      ac.application_context = "1.2.840.10008.3.1.1.1";
+      ac.pres_contexts.push_back({1, a_associate_ac::presentation_context::RESULT::ACCEPTANCE, "1.2.840.10008.1.2"});
+      ac.max_message_length = 4096;
+      ac.max_ops_invoked = 5;
+      ac.max_ops_performed = 2;
+
+      WHEN("It is serialized and parsed")
+      {
+         a_associate_ac parsed;
+         parsed.from_pdu(ac.make_pdu());
+
+         THEN("The window is preserved")
+         {
+            REQUIRE(parsed.max_message_length == 4096);
+            REQUIRE(parsed.max_ops_invoked == 5);
+            REQUIRE(parsed.max_ops_performed == 2);
+         }
+      }
+   }
+}
+
+/**
+ * @brief The state_ops_recorder struct records the operations the
+ *        statemachine performs on the connection
+ */
+struct state_ops_recorder: Istate_trans_ops
+{
+      std::vector<std::string> ops;
+
+      void reset_artim() override { ops.push_back("reset_artim"); }
+      void stop_artim() override { ops.push_back("stop_artim"); }
+      void start_artim() override { ops.push_back("start_artim"); }
+      void ignore_next() override { ops.push_back("ignore_next"); }
+      void queue_for_write_w_prio(std::unique_ptr<property> p) override
+      {
+         ops.push_back(p->type() == TYPE::A_ABORT ? "write_a_abort" : "write");
+      }
+      void close_connection() override { ops.push_back("close_connection"); }
+};
+
+SCENARIO("Transitions of the upperlayer statemachine", "[network][upperlayer]")
+{
+   using EVENT = statemachine::EVENT;
+   using CONN_STATE = statemachine::CONN_STATE;
+
+   GIVEN("The next states of table 9-10 of the standard")
+   {
+      // rows are the events, columns the states Inv, Sta1 to Sta13; 0 marks
+      // an invalid event
+      const int next_state[statemachine::num_events][statemachine::num_states] {
+         { 0,  4,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+         { 0,  0,  0,  0,  5,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+         { 0,  0, 13, 13,  0,  6, 13, 13, 13, 13, 13, 13, 13, 13},
+         { 0,  0, 13, 13,  0,  1, 13, 13, 13, 13, 13, 13, 13, 13},
+         { 0,  2,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+         { 0,  0,  3, 13,  0, 13, 13, 13, 13, 13, 13, 13, 13, 13},
+         { 0,  0,  0,  6,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+         { 0,  0,  0, 13,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0},
+         { 0,  0,  0,  0,  0,  0,  6,  0,  8,  0,  0,  0,  0,  0},
+         { 0,  0, 13, 13,  0, 13,  6,  7, 13, 13, 13, 13, 13, 13},
+         { 0,  0,  0,  0,  0,  0,  7,  0,  0,  0,  0,  0,  0,  0},
+         { 0,  0, 13, 13,  0, 13,  8, 10, 13, 13, 13, 13, 13, 13},
+         { 0,  0, 13, 13,  0, 13, 13,  1, 13, 13, 12,  1, 13, 13},
+         { 0,  0,  0,  0,  0,  0,  0,  0, 13, 11,  0,  0, 13,  0},
+         { 0,  0,  0, 13,  1, 13, 13, 13, 13, 13, 13, 13, 13,  0},
+         { 0,  0,  1,  1,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1},
+         { 0,  0,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1,  1},
+         { 0,  0,  1,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  1},
+         { 0,  0, 13, 13,  0, 13, 13, 13, 13, 13, 13, 13, 13, 13}
+      };
+
+      WHEN("Each event occurs in each state")
+      {
+         THEN("The statemachine moves to the next state of the table")
+         {
+            for (std::size_t e = 0; e < statemachine::num_events; ++e) {
+               for (std::size_t s = 0; s < statemachine::num_states; ++s) {
+                  state_ops_recorder ops;
+                  statemachine sm {&ops, static_cast<CONN_STATE>(s)};
+                  auto expected = static_cast<CONN_STATE>(next_state[e][s]);
+
+                  INFO("event " << e << ", state " << s);
+                  REQUIRE(sm.transition(static_cast<EVENT>(e)) == expected);
+                  if (expected == CONN_STATE::INV) {
+                     REQUIRE(sm.get_state() == static_cast<CONN_STATE>(s));
+                     REQUIRE(ops.ops.empty());
+                  } else {
+                     REQUIRE(sm.get_state() == expected);
+                  }
+               }
+            }
+         }
+      }
+   }
+
+   GIVEN("A statemachine")
+   {
+      state_ops_recorder ops;
+
+      WHEN("An unrecognized pdu is received on an established association")
+      {
+         statemachine sm {&ops, CONN_STATE::STA6};
+         sm.transition(EVENT::UNRECOG_PDU);
+
+         THEN("An a_abort is sent and the ARTIM timer started (AA-8)")
+         {
+            REQUIRE(ops.ops == (std::vector<std::string> {"write_a_abort", "start_artim"}));
+         }
+      }
+      AND_WHEN("The ARTIM timer expires while awaiting the close")
+      {
+         statemachine sm {&ops, CONN_STATE::STA13};
+         sm.transition(EVENT::ARTIM_EXPIRED);
+
+         THEN("The connection is closed (AA-2)")
+         {
+            REQUIRE(ops.ops == (std::vector<std::string> {"stop_artim", "close_connection"}));
+         }
+      }
+      AND_WHEN("A pdu is received while awaiting the close")
+      {
+         statemachine sm {&ops, CONN_STATE::STA13};
+         sm.transition(EVENT::RECV_P_DATA_TF_PDU);
+
+         THEN("It is ignored (AA-6)")
+         {
+            REQUIRE(ops.ops == std::vector<std::string> {"ignore_next"});
+         }
+      }
+      AND_WHEN("Release requests collide")
+      {
+         statemachine sm {&ops, CONN_STATE::STA7};
+         sm.transition(EVENT::RECV_A_RELEASE_RQ_PDU);
+
+         THEN("The acceptor side waits for the local release response (AR-8)")
+         {
+            REQUIRE(sm.get_state() == CONN_STATE::STA10);
+         }
+      }
+   }
+}
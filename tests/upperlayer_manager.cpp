@@ -4,6 +4,11 @@
 #include <exception>
 #include <memory>
 #include <deque>
+#include <set>
+#include <mutex>
+#include <thread>
+#include <chrono>
+#include <condition_variable>
 
 #include "libdicompp/network.hpp"
 
@@ -298,3 +303,51 @@ SCENARIO("Managing of multiple upperlayer connections as a client", "[network][u
 
    }
 }
+
+SCENARIO("Accepting TCP connections on a pool of threads", "[network][upperlayer]")
+{
+   GIVEN("A server acceptor running three threads")
+   {
+      const std::size_t num_threads = 3;
+      const std::size_t num_connections = 6;
+
+      std::mutex lock;
+      std::condition_variable accepted;
+      std::set<std::thread::id> handler_threads;
+      std::size_t handled = 0;
+
+      asio_tcp_server_acceptor acceptor {11130, [&](Iinfrastructure_upperlayer_connection*) {
+            std::lock_guard<std::mutex> guard {lock};
+            handler_threads.insert(std::this_thread::get_id());
+            ++handled;
+            accepted.notify_all();
+         }, nullptr, num_threads};
+      std::thread server {[&acceptor]() { acceptor.run(); }};
+
+      WHEN("Several peers connect")
+      {
+         boost::asio::io_service client_io;
+         std::vector<std::unique_ptr<boost::asio::ip::tcp::socket>> clients;
+         for (std::size_t i=0; i<num_connections; ++i) {
+            clients.emplace_back(new boost::asio::ip::tcp::socket {client_io});
+            clients.back()->connect({boost::asio::ip::address_v4::loopback(), 11130});
+         }
+
+         std::unique_lock<std::mutex> guard {lock};
+         bool all_handled = accepted.wait_for(guard, std::chrono::seconds(10), [&]() {
+            return handled == num_connections;
+         });
+         auto threads_used = handler_threads.size();
+         guard.unlock();
+
+         acceptor.stop();
+         server.join();
+
+         THEN("The connections are distributed over all threads")
+         {
+            REQUIRE(all_handled);
+            REQUIRE(threads_used == num_threads);
+         }
+      }
+   }
+}
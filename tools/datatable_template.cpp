@@ -0,0 +1,15 @@
+#include "datadictionary_table.hpp"
+
+namespace dicom
+{
+
+namespace data
+{
+
+namespace dictionary
+{
+
+// This file is generated by tools/gendatatic.sh -t from the data dictionary.
+
+const datadictionary_table_entry datadictionary_table[] =
+{
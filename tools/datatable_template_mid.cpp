@@ -0,0 +1,7 @@
+};
+
+const std::size_t datadictionary_table_size
+   = sizeof(datadictionary_table) / sizeof(datadictionary_table[0]);
+
+const datadictionary_table_entry datadictionary_masked_table[] =
+{
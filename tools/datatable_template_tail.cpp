@@ -0,0 +1,10 @@
+};
+
+const std::size_t datadictionary_masked_table_size
+   = sizeof(datadictionary_masked_table) / sizeof(datadictionary_masked_table[0]);
+
+}
+
+}
+
+}
@@ -44,8 +44,73 @@ struct datadictionary<gid, eid, bool_t<(gid & $3) == $1>, bool_t<(eid & $4) == $
 }
 
 
+function write_table_entry {
+   echo -ne "   {$1, $2, $3, $4, "
+   write_vr_set "$5" "${10}"
+   echo -ne ", \"$6\", \"$7\", \"$8\", $9},\n"
+}
+
+
+# With -t, a flat lookup table sorted by tag is generated instead of the
+# template specializations. Entries with repeating group / element masks are
+# written into a separate table, which is searched linearly.
+TABLE=0
+if [[ $1 == "-t" ]]; then
+   TABLE=1
+   shift
+fi
+
 if [ $# -lt 1 ]; then
-   echo "Usage: gendatadic.sh datadic.txt"
+   echo "Usage: gendatadic.sh [-t] datadic.txt"
+fi
+
+
+if [[ $TABLE -eq 1 ]]; then
+   EXACT=$(mktemp)
+   MASKED=$(mktemp)
+
+   while read line; do
+      ISRET="false";
+
+      TAG=$(echo $line | cut -d ';' -f1 | tr -d ' ' | tr 'A-FX' 'a-fx')
+      RET=$(echo $line | cut -d ';' -f6 | tr -d ' ')
+      if [[ $RET == "RET" ]]; then
+         ISRET="true";
+      fi
+
+      VM=$(echo $line | cut -d ';' -f5 | tr -d ' ')
+      VR=$(echo $line | cut -d ';' -f2 | sed -e 's/^ *//' -e 's/ *$//')
+
+      # entries without a VR are not usable for the lookup
+      if [[ -z $VR ]]; then
+         continue
+      fi
+
+      NUMVROPT=$(echo $VR | tr -cd ' ' | wc -c)
+
+      KEYW=$(echo $line | cut -d ';' -f4 | tr -d ' ')
+      MESF=$(echo $line | cut -d ';' -f3 | sed -e 's/^ *//')
+      GID=$(echo $TAG | tr -d '(' | cut -d ',' -f1 | sed -e 's/0x//')
+      EID=$(echo $TAG | tr -d ')' | cut -d ',' -f2 | sed -e 's/0x//')
+      if [ $(echo $GID | tr -cd x | wc -c) -gt 0 ] || [  $(echo $EID | tr -cd x | wc -c) -gt 0 ]; then
+         MASKGID=$(echo "0x$(echo $GID | sed -e 's/[0-9a-f]/f/g' | sed -e 's/x/0/g')")
+         MASKEID=$(echo "0x$(echo $EID | sed -e 's/[0-9a-f]/f/g' | sed -e 's/x/0/g')")
+         GID=$(echo "0x$(echo $GID | sed -e 's/x/0/g')")
+         EID=$(echo "0x$(echo $EID | sed -e 's/x/0/g')")
+         write_table_entry "$GID" "$EID" "$MASKGID" "$MASKEID" "$VR" "$MESF" "$KEYW" "$VM" "$ISRET" "$NUMVROPT" >> $MASKED
+      else
+         write_table_entry "0x$GID" "0x$EID" "0xffff" "0xffff" "$VR" "$MESF" "$KEYW" "$VM" "$ISRET" "$NUMVROPT" >> $EXACT
+      fi
+   done < $1
+
+   cat datatable_template.cpp
+   LC_ALL=C sort -u -t ',' -k1,2 $EXACT
+   cat datatable_template_mid.cpp
+   cat $MASKED
+   cat datatable_template_tail.cpp
+
+   rm $EXACT $MASKED
+   exit 0
 fi
 
 